@@ -5,8 +5,13 @@
 #include "app.h"
 #include "app_funcs.h"
 #include "app_ios_and_regs.h"
+#include "pwm_hal.h"
 
 #include "pwm_gen_functions.h"
+#include "freq_meter_functions.h"
+#include "event_queue_functions.h"
+#include "profiling_functions.h"
+#include "preset_functions.h"
 
 
 /************************************************************************/
@@ -18,6 +23,8 @@ extern uint16_t app_regs_n_elements[];
 extern uint8_t *app_regs_pointer[];
 extern void (*app_func_rd_pointer[])(void);
 extern bool (*app_func_wr_pointer[])(void*);
+extern const app_reg_desc_t app_regs_desc[];
+extern const app_reg_range_t app_regs_ranges[];
 
 
 /************************************************************************/
@@ -102,6 +109,12 @@ void core_callback_initialize_hardware(void)
     /* Initialize IOs */
     /* Don't delete this function!!! */
     init_ios();    
+    
+    /* Start the profiling timer, if compiled in */
+    hwbp_app_prof_configure();
+    
+    /* Read the presets from the EEPROM */
+    hwbp_app_preset_init();
 }
 
 void core_callback_reset_registers(void)
@@ -160,6 +173,85 @@ void core_callback_reset_registers(void)
    
    app_regs.REG_EXEC_STATE = 0;
    app_regs.REG_EVNT_ENABLE = B_EVT0;
+
+   app_regs.REG_TRG_FMETER_EN = 0;
+   app_regs.REG_TRG_FMETER_WINDOW = 10;
+
+   app_regs.REG_CH_EXT_PERIOD[0] = 10;
+   app_regs.REG_CH_EXT_PERIOD[1] = 10;
+   app_regs.REG_CH_EXT_PERIOD[2] = 10;
+   app_regs.REG_CH_EXT_PERIOD[3] = 10;
+
+   app_regs.REG_CH_CHAIN[0] = 0;
+   app_regs.REG_CH_CHAIN[1] = 0;
+   app_regs.REG_CH_CHAIN[2] = 0;
+   app_regs.REG_CH_CHAIN[3] = 0;
+
+   app_regs.REG_VTRG_TABLE[0] = 0;
+   app_regs.REG_VTRG_TABLE[1] = 0;
+   app_regs.REG_VTRG_MASK[0] = 0;
+   app_regs.REG_VTRG_MASK[1] = 0;
+   app_regs.REG_VTRG_MODE[0] = GM_TRG_MODE_START;
+   app_regs.REG_VTRG_MODE[1] = GM_TRG_MODE_START;
+
+   app_regs.REG_EVNT_COALESCE = 0;
+   app_regs.REG_EXEC_BATCH[0] = 0;
+   app_regs.REG_EXEC_BATCH[1] = 0;
+   app_regs.REG_EXEC_BATCH[2] = 0;
+
+   for (uint8_t i = 0; i < 20; i++)
+      app_regs.REG_CH_STATS[i] = 0;
+   app_regs.REG_CH_STATS_CTRL = 0;
+
+   for (uint8_t i = 0; i < 4; i++)
+   {
+      app_regs.REG_CH_REMAINING[i] = 0;
+      app_regs.REG_CH_PROGRESS[i] = 0;
+   }
+
+   for (uint8_t i = 0; i < 9; i++)
+   {
+      app_regs.REG_PROF_ISR_COUNT[i] = 0;
+      app_regs.REG_PROF_ISR_MAX[i] = 0;
+      app_regs.REG_PROF_ISR_MEAN[i] = 0;
+   }
+   app_regs.REG_PROF_LATENCY_MAX = 0;
+   app_regs.REG_PROF_CPU_LOAD = 0;
+   app_regs.REG_PROF_LATENCY_MIN = 0;
+   for (uint8_t i = 0; i < 8; i++)
+      app_regs.REG_PROF_LATENCY_HIST[i] = 0;
+   app_regs.REG_PROF_SKEW_MAX = 0;
+   app_regs.REG_EVNT_DROPPED = 0;
+
+   for (uint8_t i = 0; i < 6; i++)
+   {
+      app_regs.REG_CH0_CONFIG[i] = 0;
+      app_regs.REG_CH1_CONFIG[i] = 0;
+      app_regs.REG_CH2_CONFIG[i] = 0;
+      app_regs.REG_CH3_CONFIG[i] = 0;
+   }
+
+   for (uint8_t i = 0; i < 12; i++)
+      app_regs.REG_STAGE_CONFIG[i] = 0;
+   app_regs.REG_STAGE_COMMIT = 0;
+   app_regs.REG_STAGE_TRIGGER = 0;
+
+   app_regs.REG_PRESET_SAVE = 0;
+   app_regs.REG_PRESET_LOAD = PRESET_NONE;
+   for (uint8_t i = 0; i < 32; i++)
+      app_regs.REG_PRESET_NAMES[i] = 0;
+   app_regs.REG_PRESET_TRIGGER = 0;
+
+   for (uint8_t i = 0; i < 3; i++)
+   {
+      app_regs.REG_CH0_TRAIN[i] = 0;
+      app_regs.REG_CH1_TRAIN[i] = 0;
+      app_regs.REG_CH2_TRAIN[i] = 0;
+      app_regs.REG_CH3_TRAIN[i] = 0;
+   }
+   for (uint8_t i = 0; i < 4; i++)
+      app_regs.REG_TRAIN_LEVEL[i] = 0;
+   app_regs.REG_TRAIN_LOW = 0;
 }
 
 void core_callback_registers_were_reinitialized(void)
@@ -167,15 +259,17 @@ void core_callback_registers_were_reinitialized(void)
     /* Check if the user indication is valid */
     update_enabled_pwmx();
 
+    /* Configure the TRIG inputs used as channel clocks and gates */
+    hwbp_app_pwm_gen_update_clock_inputs();
+    hwbp_app_pwm_gen_update_gates();
+
     /* Update registers that depend on others */
-    hwbp_app_pwm_gen_update_reals_ch0();
-    hwbp_app_pwm_gen_update_reals_ch1();
-    hwbp_app_pwm_gen_update_reals_ch2();
-    hwbp_app_pwm_gen_update_reals_ch3();
+    for (uint8_t j = 0; j < 4; j++)
+        hwbp_app_pwm_gen_update_reals(j);
 
     /* Update trigger state register */
-    app_regs.REG_TRIG_STATE = (read_TRIG_IN0) ? B_LTRG0 : 0;
-    app_regs.REG_TRIG_STATE |= (read_TRIG_IN1) ? B_LTRG1 : 0;
+    app_regs.REG_TRIG_STATE = read_TRIG_IN0_LEVEL;
+    app_regs.REG_TRIG_STATE |= read_TRIG_IN1_LEVEL;
     app_regs.REG_TRIG_STATE |= (read_TRIG_IN2) ? B_LTRG2 : 0;
     app_regs.REG_TRIG_STATE |= (read_TRIG_IN3) ? B_LTRG3 : 0;
     app_regs.REG_TRIG_STATE |= (read_TRIG_ALL) ? B_LTRGALL : 0;
@@ -186,16 +280,34 @@ void core_callback_registers_were_reinitialized(void)
     app_regs.REG_CH_STATE |= (read_PWM_OUT2) ? B_SCH2 : 0;
     app_regs.REG_CH_STATE |= (read_PWM_OUT3) ? B_SCH3 : 0;
 
+    /* Start the virtual triggers from the current TRIG inputs levels */
+    hwbp_app_pwm_gen_init_virtual_triggers();
+
     /* No PWM should be running */
     app_regs.REG_START_PWM = 0;
     app_regs.REG_STOP_PWM = 0;
-    app_regs.REG_EXEC_STATE = 0;
+    pwm_exec_state = 0;
 
     /* Stop PWMs */
-    timer_type0_stop(&TCC0);
-    timer_type0_stop(&TCD0);
-    timer_type0_stop(&TCE0);
-    timer_type0_stop(&TCF0);
+    hal_ch_timer_stop(HAL_CH0_TIMER);
+    hal_ch_timer_stop(HAL_CH1_TIMER);
+    hal_ch_timer_stop(HAL_CH2_TIMER);
+    hal_ch_timer_stop(HAL_CH3_TIMER);
+
+    /* Forget the events of the PWMs that were running */
+    hwbp_app_evt_queue_clear();
+
+    /* Forget the trains queued for them */
+    hwbp_app_pwm_gen_clear_trains(B_TRGCH0 | B_TRGCH1 | B_TRGCH2 | B_TRGCH3);
+
+    /* Start the frequency meter */
+    if (app_regs.REG_TRG_FMETER_WINDOW == 0)
+        app_regs.REG_TRG_FMETER_WINDOW = 10;
+
+    hwbp_app_freq_meter_configure();
+
+    /* The presets' names are kept with the presets */
+    hwbp_app_preset_read_names();
 }
 
 /************************************************************************/
@@ -222,16 +334,14 @@ void core_callback_visualen_to_off(void)
 void core_callback_device_to_standby(void)
 {
     /* Stop all PWMs when going to standby mode */
-    hwbp_app_pwm_gen_stop_ch0();
-    hwbp_app_pwm_gen_stop_ch1();
-    hwbp_app_pwm_gen_stop_ch2();
-    hwbp_app_pwm_gen_stop_ch3();
+    for (uint8_t j = 0; j < 4; j++)
+        hwbp_app_pwm_gen_stop(j);
     clr_SYNC_OUTALL;
     
     /* No PWM should be running */
     app_regs.REG_START_PWM = 0;
     app_regs.REG_STOP_PWM = 0;
-    app_regs.REG_EXEC_STATE = 0;
+    pwm_exec_state = 0;
 }
 void core_callback_device_to_active(void) {}
 void core_callback_device_to_enchanced_active(void) {}
@@ -242,9 +352,21 @@ void core_callback_device_to_speed(void) {}
 /************************************************************************/
 void core_callback_t_before_exec(void) {}
 void core_callback_t_after_exec(void) {}
-void core_callback_t_new_second(void) {}
-void core_callback_t_500us(void) {}
-void core_callback_t_1ms(void) {}
+void core_callback_t_new_second(void)
+{
+    hwbp_app_prof_new_second();
+}
+void core_callback_t_500us(void)
+{
+    hwbp_app_evt_queue_drain();
+}
+void core_callback_t_1ms(void)
+{
+    hwbp_app_evt_queue_drain();
+    hwbp_app_pwm_gen_update_dirty_reals();
+    hwbp_app_freq_meter_update();
+    hwbp_app_preset_update_eeprom();
+}
 
 /************************************************************************/
 /* Callbacks: clock control                                              */
@@ -278,7 +400,8 @@ bool core_read_app_register(uint8_t add, uint8_t type)
 		return false;
 	
 	/* Receive data */
-	(*app_func_rd_pointer[add-APP_REGS_ADD_MIN])();	
+	if (app_func_rd_pointer[add-APP_REGS_ADD_MIN])
+		(*app_func_rd_pointer[add-APP_REGS_ADD_MIN])();
 
 	/* Return success */
 	return true;
@@ -287,6 +410,59 @@ bool core_read_app_register(uint8_t add, uint8_t type)
 /************************************************************************/
 /* Callbacks: Write app register                                        */
 /************************************************************************/
+static bool in_range(uint8_t type, const app_reg_range_t *range, const void *element)
+{
+	switch (type)
+	{
+		case TYPE_U8:  return *((uint8_t*)element) >= range->min.u && *((uint8_t*)element) <= range->max.u;
+		case TYPE_I8:  return *((int8_t*)element) >= range->min.s && *((int8_t*)element) <= range->max.s;
+		case TYPE_U16: return *((uint16_t*)element) >= range->min.u && *((uint16_t*)element) <= range->max.u;
+		case TYPE_I16: return *((int16_t*)element) >= range->min.s && *((int16_t*)element) <= range->max.s;
+		case TYPE_U32: return *((uint32_t*)element) >= range->min.u && *((uint32_t*)element) <= range->max.u;
+		case TYPE_I32: return *((int32_t*)element) >= range->min.s && *((int32_t*)element) <= range->max.s;
+		
+		/* Also refuses NaN */
+		case TYPE_FLOAT: return *((float*)element) >= range->min.f && *((float*)element) <= range->max.f;
+	}
+	
+	return false;
+}
+
+bool app_reg_check_element(uint8_t add, const void *element)
+{
+	uint8_t index = add - APP_REGS_ADD_MIN;
+	const app_reg_desc_t *desc = &app_regs_desc[index];
+	
+	if ((desc->flags & REG_DESC_MASK) && (*((uint8_t*)element) & ~desc->mask))
+		return false;
+	
+	if ((desc->flags & REG_DESC_RANGE) && !in_range(app_regs_type[index], &app_regs_ranges[desc->range], element))
+		return false;
+	
+	return true;
+}
+
+static bool check_and_store_app_register(uint8_t index, uint8_t * content, uint16_t n_elements)
+{
+	uint8_t element_size = app_regs_type[index] & MSK_TYPE_LEN;
+	
+	if (app_regs_desc[index].flags & REG_DESC_READ_ONLY)
+		return false;
+	
+	for (uint16_t i = 0; i < n_elements; i++)
+		if (!app_reg_check_element(index + APP_REGS_ADD_MIN, content + i * element_size))
+			return false;
+	
+	/* Registers without a write function are only stored */
+	if (app_func_wr_pointer[index] == 0)
+	{
+		for (uint16_t i = 0; i < n_elements * element_size; i++)
+			app_regs_pointer[index][i] = content[i];
+	}
+	
+	return true;
+}
+
 bool core_write_app_register(uint8_t add, uint8_t type, uint8_t * content, uint16_t n_elements)
 {
 	/* Check if it will not access forbidden memory */
@@ -301,6 +477,13 @@ bool core_write_app_register(uint8_t add, uint8_t type, uint8_t * content, uint1
 	if (app_regs_n_elements[add-APP_REGS_ADD_MIN] != n_elements)
 		return false;
 
+	/* Apply the checks common to all registers */
+	if (!check_and_store_app_register(add-APP_REGS_ADD_MIN, content, n_elements))
+		return false;
+
 	/* Process data and return false if write is not allowed or contains errors */
-	return (*app_func_wr_pointer[add-APP_REGS_ADD_MIN])(content);
+	if (app_func_wr_pointer[add-APP_REGS_ADD_MIN])
+		return (*app_func_wr_pointer[add-APP_REGS_ADD_MIN])(content);
+
+	return true;
 }
\ No newline at end of file
@@ -2,736 +2,743 @@
 #include "app_ios_and_regs.h"
 #include "hwbp_core.h"
 #include "pwm_gen_functions.h"
+#include "freq_meter_functions.h"
+#include "event_queue_functions.h"
+#include "profiling_functions.h"
+#include "preset_functions.h"
 
 
 /************************************************************************/
-/* Create pointers to functions                                         */
+/* Registers' functions                                                 */
+/*                                                                      */
+/* The pointers to these functions are generated in app_regs_desc.c     */
+/* from the prototypes of app_funcs.h.                                  */
 /************************************************************************/
 extern AppRegs app_regs;
 
-void (*app_func_rd_pointer[])(void) = {
-	&app_read_REG_CH0_FREQ,
-	&app_read_REG_CH1_FREQ,
-	&app_read_REG_CH2_FREQ,
-	&app_read_REG_CH3_FREQ,
-	&app_read_REG_CH0_DUTYCYCLE,
-	&app_read_REG_CH1_DUTYCYCLE,
-	&app_read_REG_CH2_DUTYCYCLE,
-	&app_read_REG_CH3_DUTYCYCLE,
-	&app_read_REG_CH0_COUNTS,
-	&app_read_REG_CH1_COUNTS,
-	&app_read_REG_CH2_COUNTS,
-	&app_read_REG_CH3_COUNTS,
-	&app_read_REG_CH0_REAL_FREQ,
-	&app_read_REG_CH1_REAL_FREQ,
-	&app_read_REG_CH2_REAL_FREQ,
-	&app_read_REG_CH3_REAL_FREQ,
-	&app_read_REG_CH0_REAL_DUTYCYCLE,
-	&app_read_REG_CH1_REAL_DUTYCYCLE,
-	&app_read_REG_CH2_REAL_DUTYCYCLE,
-	&app_read_REG_CH3_REAL_DUTYCYCLE,
-	&app_read_REG_CH0_MODE,
-	&app_read_REG_CH1_MODE,
-	&app_read_REG_CH2_MODE,
-	&app_read_REG_CH3_MODE,
-	&app_read_REG_TRG0_MASK,
-	&app_read_REG_TRG1_MASK,
-	&app_read_REG_TRG2_MASK,
-	&app_read_REG_TRG3_MASK,
-	&app_read_REG_START_PWM,
-	&app_read_REG_STOP_PWM,
-	&app_read_REG_CH_ENABLE_SINGLE,
-	&app_read_REG_RESERVED1,
-	&app_read_REG_TRG0_MODE,
-	&app_read_REG_TRG1_MODE,
-	&app_read_REG_TRG2_MODE,
-	&app_read_REG_TRG3_MODE,
-	&app_read_REG_CH_CONFEN,
-	&app_read_REG_CH_ENABLE,
-	&app_read_REG_TRGALL_MODE,
-	&app_read_REG_TRIG_STATE,
-	&app_read_REG_CH_STATE,
-	&app_read_REG_EXEC_STATE,
-	&app_read_REG_EVNT_ENABLE
-};
-
-bool (*app_func_wr_pointer[])(void*) = {
-	&app_write_REG_CH0_FREQ,
-	&app_write_REG_CH1_FREQ,
-	&app_write_REG_CH2_FREQ,
-	&app_write_REG_CH3_FREQ,
-	&app_write_REG_CH0_DUTYCYCLE,
-	&app_write_REG_CH1_DUTYCYCLE,
-	&app_write_REG_CH2_DUTYCYCLE,
-	&app_write_REG_CH3_DUTYCYCLE,
-	&app_write_REG_CH0_COUNTS,
-	&app_write_REG_CH1_COUNTS,
-	&app_write_REG_CH2_COUNTS,
-	&app_write_REG_CH3_COUNTS,
-	&app_write_REG_CH0_REAL_FREQ,
-	&app_write_REG_CH1_REAL_FREQ,
-	&app_write_REG_CH2_REAL_FREQ,
-	&app_write_REG_CH3_REAL_FREQ,
-	&app_write_REG_CH0_REAL_DUTYCYCLE,
-	&app_write_REG_CH1_REAL_DUTYCYCLE,
-	&app_write_REG_CH2_REAL_DUTYCYCLE,
-	&app_write_REG_CH3_REAL_DUTYCYCLE,
-	&app_write_REG_CH0_MODE,
-	&app_write_REG_CH1_MODE,
-	&app_write_REG_CH2_MODE,
-	&app_write_REG_CH3_MODE,
-	&app_write_REG_TRG0_MASK,
-	&app_write_REG_TRG1_MASK,
-	&app_write_REG_TRG2_MASK,
-	&app_write_REG_TRG3_MASK,
-	&app_write_REG_START_PWM,
-	&app_write_REG_STOP_PWM,
-	&app_write_REG_CH_ENABLE_SINGLE,
-	&app_write_REG_RESERVED1,
-	&app_write_REG_TRG0_MODE,
-	&app_write_REG_TRG1_MODE,
-	&app_write_REG_TRG2_MODE,
-	&app_write_REG_TRG3_MODE,
-	&app_write_REG_CH_CONFEN,
-	&app_write_REG_CH_ENABLE,
-	&app_write_REG_TRGALL_MODE,
-	&app_write_REG_TRIG_STATE,
-	&app_write_REG_CH_STATE,
-	&app_write_REG_EXEC_STATE,
-	&app_write_REG_EVNT_ENABLE
-};
-
-void stop_and_update_ch0_temps(void)
+void stop_and_update_ch_temps(uint8_t ch)
 {       
-    if (hwbp_app_pwm_gen_stop_ch0())
+    if (hwbp_app_pwm_gen_stop(ch))
     {
-        app_regs.REG_EXEC_STATE &= ~(B_PWM0STATE);
+        pwm_exec_state &= ~(B_PWM0STATE << ch);
         
         if (app_regs.REG_EVNT_ENABLE & B_EVT0)
         {
-            core_func_send_event(ADD_REG_EXEC_STATE, true);
+            hwbp_app_evt_queue_push_exec_state();
         }
     }
     
-    hwbp_app_pwm_gen_update_reals_ch0();
+    hwbp_app_pwm_gen_mark_reals_dirty(ch);
 }
 
-void stop_and_update_ch1_temps(void)
-{       
-    if (hwbp_app_pwm_gen_stop_ch1())
-    {
-        app_regs.REG_EXEC_STATE &= ~(B_PWM1STATE);
-        
-        if (app_regs.REG_EVNT_ENABLE & B_EVT0)
-        {
-            core_func_send_event(ADD_REG_EXEC_STATE, true);
-        }
-    }
-    
-    hwbp_app_pwm_gen_update_reals_ch1();
+/************************************************************************/
+/* REG_CH0_FREQ to REG_CH3_FREQ                                         */
+/************************************************************************/
+static bool write_ch_freq(uint8_t ch, void *a)
+{
+    *((&app_regs.REG_CH0_FREQ) + ch) = *((float*)a);
+    stop_and_update_ch_temps(ch);
+    return true;
 }
 
-void stop_and_update_ch2_temps(void)
-{       
-    if (hwbp_app_pwm_gen_stop_ch2())
-    {
-        app_regs.REG_EXEC_STATE &= ~(B_PWM2STATE);
-        
-        if (app_regs.REG_EVNT_ENABLE & B_EVT0)
-        {
-            core_func_send_event(ADD_REG_EXEC_STATE, true);
-        }
-    }
-    
-    hwbp_app_pwm_gen_update_reals_ch2();
-}
+bool app_write_REG_CH0_FREQ(void *a) {return write_ch_freq(0, a);}
+bool app_write_REG_CH1_FREQ(void *a) {return write_ch_freq(1, a);}
+bool app_write_REG_CH2_FREQ(void *a) {return write_ch_freq(2, a);}
+bool app_write_REG_CH3_FREQ(void *a) {return write_ch_freq(3, a);}
 
-void stop_and_update_ch3_temps(void)
-{       
-    if (hwbp_app_pwm_gen_stop_ch3())
-    {
-        app_regs.REG_EXEC_STATE &= ~(B_PWM3STATE);
-        
-        if (app_regs.REG_EVNT_ENABLE & B_EVT0)
-        {
-            core_func_send_event(ADD_REG_EXEC_STATE, true);
-        }
-    }
-    
-    hwbp_app_pwm_gen_update_reals_ch3();
-}
 
 /************************************************************************/
-/* REG_CH0_FREQ                                                         */
+/* REG_CH0_DUTYCYCLE to REG_CH3_DUTYCYCLE                               */
 /************************************************************************/
-void app_read_REG_CH0_FREQ(void) {}
-bool app_write_REG_CH0_FREQ(void *a)
-{	
-    float reg = *((float*)a);
-    
-    if (reg < 0.5 || reg > 32768.0)
-        return false;
-
-	app_regs.REG_CH0_FREQ = reg;
-    stop_and_update_ch0_temps();
-	return true;
+static bool write_ch_dutycycle(uint8_t ch, void *a)
+{
+    *((&app_regs.REG_CH0_DUTYCYCLE) + ch) = *((float*)a);
+    stop_and_update_ch_temps(ch);
+    return true;
 }
 
+bool app_write_REG_CH0_DUTYCYCLE(void *a) {return write_ch_dutycycle(0, a);}
+bool app_write_REG_CH1_DUTYCYCLE(void *a) {return write_ch_dutycycle(1, a);}
+bool app_write_REG_CH2_DUTYCYCLE(void *a) {return write_ch_dutycycle(2, a);}
+bool app_write_REG_CH3_DUTYCYCLE(void *a) {return write_ch_dutycycle(3, a);}
+
 
 /************************************************************************/
-/* REG_CH1_FREQ                                                         */
+/* REG_CH0_COUNTS to REG_CH3_COUNTS                                     */
 /************************************************************************/
-void app_read_REG_CH1_FREQ(void) {}
-bool app_write_REG_CH1_FREQ(void *a)
+static bool write_ch_counts(uint8_t ch, void *a)
 {
-    float reg = *((float*)a);
-    
-    if (reg < 0.5 || reg > 32768.0)
-        return false;
-
-    app_regs.REG_CH1_FREQ = reg;
-    stop_and_update_ch1_temps();
+    *((&app_regs.REG_CH0_COUNTS) + ch) = *((uint32_t*)a);
+    stop_and_update_ch_temps(ch);
     return true;
 }
 
+bool app_write_REG_CH0_COUNTS(void *a) {return write_ch_counts(0, a);}
+bool app_write_REG_CH1_COUNTS(void *a) {return write_ch_counts(1, a);}
+bool app_write_REG_CH2_COUNTS(void *a) {return write_ch_counts(2, a);}
+bool app_write_REG_CH3_COUNTS(void *a) {return write_ch_counts(3, a);}
+
 
 /************************************************************************/
-/* REG_CH2_FREQ                                                         */
+/* REG_CH0_REAL_FREQ to REG_CH3_REAL_DUTYCYCLE                          */
 /************************************************************************/
-void app_read_REG_CH2_FREQ(void) {}
-bool app_write_REG_CH2_FREQ(void *a)
-{
-    float reg = *((float*)a);
-    
-    if (reg < 0.5 || reg > 32768.0)
-        return false;
-
-    app_regs.REG_CH2_FREQ = reg;
-    stop_and_update_ch2_temps();
-    return true;
-}
+void app_read_REG_CH0_REAL_FREQ(void) {hwbp_app_pwm_gen_update_dirty_reals();}
+void app_read_REG_CH1_REAL_FREQ(void) {hwbp_app_pwm_gen_update_dirty_reals();}
+void app_read_REG_CH2_REAL_FREQ(void) {hwbp_app_pwm_gen_update_dirty_reals();}
+void app_read_REG_CH3_REAL_FREQ(void) {hwbp_app_pwm_gen_update_dirty_reals();}
+void app_read_REG_CH0_REAL_DUTYCYCLE(void) {hwbp_app_pwm_gen_update_dirty_reals();}
+void app_read_REG_CH1_REAL_DUTYCYCLE(void) {hwbp_app_pwm_gen_update_dirty_reals();}
+void app_read_REG_CH2_REAL_DUTYCYCLE(void) {hwbp_app_pwm_gen_update_dirty_reals();}
+void app_read_REG_CH3_REAL_DUTYCYCLE(void) {hwbp_app_pwm_gen_update_dirty_reals();}
 
 
 /************************************************************************/
-/* REG_CH3_FREQ                                                         */
+/* REG_CH0_MODE to REG_CH3_MODE                                         */
 /************************************************************************/
-void app_read_REG_CH3_FREQ(void) {}
-bool app_write_REG_CH3_FREQ(void *a)
+/* The register's mask also allows both TRIG inputs as the clock source */
+static bool check_ch_mode(uint8_t mode)
 {
-    float reg = *((float*)a);
+    return app_reg_check_element(ADD_REG_CH0_MODE, &mode) && (mode & MSK_CH_CLK) != MSK_CH_CLK;
+}
+
+static bool write_ch_mode(uint8_t ch, void *a)
+{
+    uint8_t reg = *((uint8_t*)a);
     
-    if (reg < 0.5 || reg > 32768.0)
+    if (!check_ch_mode(reg))
         return false;
+
+    bool clock_changed = (reg ^ *((&app_regs.REG_CH0_MODE) + ch)) & MSK_CH_CLK;
+    *((&app_regs.REG_CH0_MODE) + ch) = reg;
+    
+    if (clock_changed)
+    {
+        stop_and_update_ch_temps(ch);
+        hwbp_app_pwm_gen_update_clock_inputs();
+        hwbp_app_pwm_gen_update_gates();
+    }
     
-    app_regs.REG_CH3_FREQ = reg;
-    stop_and_update_ch3_temps();
     return true;
 }
 
+bool app_write_REG_CH0_MODE(void *a) {return write_ch_mode(0, a);}
+bool app_write_REG_CH1_MODE(void *a) {return write_ch_mode(1, a);}
+bool app_write_REG_CH2_MODE(void *a) {return write_ch_mode(2, a);}
+bool app_write_REG_CH3_MODE(void *a) {return write_ch_mode(3, a);}
+
 
 /************************************************************************/
-/* REG_CH0_DUTYCYCLE                                                    */
+/* REG_TRG0_MASK to REG_TRG3_MASK                                       */
 /************************************************************************/
-void app_read_REG_CH0_DUTYCYCLE(void) {}
-bool app_write_REG_CH0_DUTYCYCLE(void *a)
+static bool write_trg_mask(uint8_t trg, void *a)
 {
-	float reg = *((float*)a);
-    
-    if (reg <= 0.1 || reg >= 99.9)
-	    return false;
-
-	app_regs.REG_CH0_DUTYCYCLE = reg;
-    stop_and_update_ch0_temps();
-	return true;
+    *((&app_regs.REG_TRG0_MASK) + trg) = *((uint8_t*)a);
+    hwbp_app_pwm_gen_update_gates();
+    return true;
 }
 
+bool app_write_REG_TRG0_MASK(void *a) {return write_trg_mask(0, a);}
+bool app_write_REG_TRG1_MASK(void *a) {return write_trg_mask(1, a);}
+bool app_write_REG_TRG2_MASK(void *a) {return write_trg_mask(2, a);}
+bool app_write_REG_TRG3_MASK(void *a) {return write_trg_mask(3, a);}
+
 
 /************************************************************************/
-/* REG_CH1_DUTYCYCLE                                                    */
+/* REG_START_PWM                                                        */
 /************************************************************************/
-void app_read_REG_CH1_DUTYCYCLE(void) {}
-bool app_write_REG_CH1_DUTYCYCLE(void *a)
+void app_read_REG_START_PWM(void)
 {
-    float reg = *((float*)a);
-    
-    if (reg <= 0.1 || reg >= 99.9)
-        return false;
+    app_regs.REG_START_PWM = 0;
+}
 
-    app_regs.REG_CH1_DUTYCYCLE = reg;
-    stop_and_update_ch1_temps();
+bool app_write_REG_START_PWM(void *a)
+{
+    app_regs.REG_START_PWM = *((uint8_t*)a);
+    check_and_start_pwms(app_regs.REG_START_PWM);
     return true;
 }
 
 
 /************************************************************************/
-/* REG_CH2_DUTYCYCLE                                                    */
+/* REG_STOP_PWM                                                         */
 /************************************************************************/
-void app_read_REG_CH2_DUTYCYCLE(void) {}
-bool app_write_REG_CH2_DUTYCYCLE(void *a)
+void app_read_REG_STOP_PWM(void)
 {
-    float reg = *((float*)a);
-    
-    if (reg <= 0.1 || reg >= 99.9)
-        return false;
+    app_regs.REG_STOP_PWM = 0;
+}
 
-    app_regs.REG_CH2_DUTYCYCLE = reg;
-    stop_and_update_ch2_temps();
+bool app_write_REG_STOP_PWM(void *a)
+{
+    app_regs.REG_STOP_PWM = *((uint8_t*)a);
+    check_and_stop_pwms(app_regs.REG_STOP_PWM);
     return true;
 }
 
 
 /************************************************************************/
-/* REG_CH3_DUTYCYCLE                                                    */
+/* REG_CH_ENABLE_SINGLE                                                 */
 /************************************************************************/
-void app_read_REG_CH3_DUTYCYCLE(void) {}
-bool app_write_REG_CH3_DUTYCYCLE(void *a)
-{
-    float reg = *((float*)a);
-    
-    if (reg <= 0.1 || reg >= 99.9)
-        return false;
+void app_read_REG_CH_ENABLE_SINGLE(void) {};
+        
 
-    app_regs.REG_CH3_DUTYCYCLE = reg;
-    stop_and_update_ch3_temps();
-    return true;
-}
 
+/************************************************************************/
+/* REG_RESERVED1                                                        */
+/************************************************************************/
+void app_read_REG_RESERVED1(void) {};
+    
 
 /************************************************************************/
-/* REG_CH0_COUNTS                                                       */
+/* REG_TRG0_MODE to REG_TRG3_MODE                                       */
 /************************************************************************/
-void app_read_REG_CH0_COUNTS(void) {}
-bool app_write_REG_CH0_COUNTS(void *a)
+static bool write_trg_mode(uint8_t trg, void *a)
 {
-	if (*((uint32_t*)a) == 0)
+    /* The mask allows the TRGALL modes, which are only valid on REG_TRGALL_MODE */
+    if ((*((uint8_t*)a) & MSK_TRG_MODE) == MSK_TRG_MODE)
         return false;
 
-	app_regs.REG_CH0_COUNTS = *((uint32_t*)a);
-    stop_and_update_ch0_temps();
-	return true;
+    *((&app_regs.REG_TRG0_MODE) + trg) = *((uint8_t*)a);
+    hwbp_app_pwm_gen_update_gates();
+    return true;
 }
 
+bool app_write_REG_TRG0_MODE(void *a) {return write_trg_mode(0, a);}
+bool app_write_REG_TRG1_MODE(void *a) {return write_trg_mode(1, a);}
+bool app_write_REG_TRG2_MODE(void *a) {return write_trg_mode(2, a);}
+bool app_write_REG_TRG3_MODE(void *a) {return write_trg_mode(3, a);}
+
 
 /************************************************************************/
-/* REG_CH1_COUNTS                                                       */
+/* REG_CH_CONFEN                                                        */
 /************************************************************************/
-void app_read_REG_CH1_COUNTS(void) {}
-bool app_write_REG_CH1_COUNTS(void *a)
-{
-    if (*((uint32_t*)a) == 0)
-        return false;
+extern void update_enabled_pwmx(void);
 
-    app_regs.REG_CH1_COUNTS = *((uint32_t*)a);
-    stop_and_update_ch1_temps();
+bool app_write_REG_CH_CONFEN(void *a)
+{
+    app_regs.REG_CH_CONFEN = *((uint8_t*)a);
+    update_enabled_pwmx();
     return true;
 }
 
 
 /************************************************************************/
-/* REG_CH2_COUNTS                                                       */
+/* REG_CH_ENABLE                                                        */
 /************************************************************************/
-void app_read_REG_CH2_COUNTS(void) {}
-bool app_write_REG_CH2_COUNTS(void *a)
+bool app_write_REG_CH_ENABLE(void *a)
 {
-    if (*((uint32_t*)a) == 0)
-        return false;
-
-    app_regs.REG_CH2_COUNTS = *((uint32_t*)a);
-    stop_and_update_ch2_temps();
+    app_regs.REG_CH_ENABLE = *((uint8_t*)a);
+    update_enabled_pwmx();
     return true;
 }
 
 
 /************************************************************************/
-/* REG_CH3_COUNTS                                                       */
+/* REG_TRIG_STATE                                                       */
 /************************************************************************/
-void app_read_REG_CH3_COUNTS(void) {}
-bool app_write_REG_CH3_COUNTS(void *a)
+void app_read_REG_TRIG_STATE(void)
 {
-    if (*((uint32_t*)a) == 0)
-        return false;
-
-    app_regs.REG_CH3_COUNTS = *((uint32_t*)a);
-    stop_and_update_ch3_temps();
-    return true;
+    app_regs.REG_TRIG_STATE  = read_TRIG_IN0_LEVEL;
+    app_regs.REG_TRIG_STATE |= read_TRIG_IN1_LEVEL;
+    app_regs.REG_TRIG_STATE |= (read_TRIG_IN2) ? B_LTRG2 : 0;
+    app_regs.REG_TRIG_STATE |= (read_TRIG_IN3) ? B_LTRG3 : 0;
+    app_regs.REG_TRIG_STATE |= (read_TRIG_ALL) ? B_LTRGALL : 0;
 }
 
 
 /************************************************************************/
-/* REG_CH0_REAL_FREQ                                                    */
+/* REG_CH_STATE                                                         */
 /************************************************************************/
-void app_read_REG_CH0_REAL_FREQ(void) {}
-bool app_write_REG_CH0_REAL_FREQ(void *a) {return false;}
+void app_read_REG_CH_STATE(void)
+{
+    app_regs.REG_CH_STATE  = (read_PWM_OUT0) ? B_SCH0 : 0;
+    app_regs.REG_CH_STATE |= (read_PWM_OUT1) ? B_SCH1 : 0;
+    app_regs.REG_CH_STATE |= (read_PWM_OUT2) ? B_SCH2 : 0;
+    app_regs.REG_CH_STATE |= (read_PWM_OUT3) ? B_SCH3 : 0;
+}
 
 
 /************************************************************************/
-/* REG_CH1_REAL_FREQ                                                    */
+/* REG_EXEC_STATE                                                       */
 /************************************************************************/
-void app_read_REG_CH1_REAL_FREQ(void) {}
-bool app_write_REG_CH1_REAL_FREQ(void *a) {return false;}
+void app_read_REG_EXEC_STATE(void)
+{
+    hwbp_app_evt_queue_read_exec_state();
+}
 
 
 /************************************************************************/
-/* REG_CH2_REAL_FREQ                                                    */
+/* REG_TRG_FMETER_EN                                                    */
 /************************************************************************/
-void app_read_REG_CH2_REAL_FREQ(void) {}
-bool app_write_REG_CH2_REAL_FREQ(void *a) {return false;}
+bool app_write_REG_TRG_FMETER_EN(void *a)
+{
+    app_regs.REG_TRG_FMETER_EN = *((uint8_t*)a);
+    hwbp_app_freq_meter_configure();
+    return true;
+}
 
 
 /************************************************************************/
-/* REG_CH3_REAL_FREQ                                                    */
+/* REG_TRG_FMETER_WINDOW                                                */
 /************************************************************************/
-void app_read_REG_CH3_REAL_FREQ(void) {}
-bool app_write_REG_CH3_REAL_FREQ(void *a) {return false;}
+bool app_write_REG_TRG_FMETER_WINDOW(void *a)
+{
+    app_regs.REG_TRG_FMETER_WINDOW = *((uint8_t*)a);
+    hwbp_app_freq_meter_configure();
+    return true;
+}
 
 
 /************************************************************************/
-/* REG_CH0_REAL_DUTYCYCLE                                               */
+/* REG_CH_EXT_PERIOD                                                    */
 /************************************************************************/
-void app_read_REG_CH0_REAL_DUTYCYCLE(void) {}
-bool app_write_REG_CH0_REAL_DUTYCYCLE(void *a) {return false;}
+bool app_write_REG_CH_EXT_PERIOD(void *a)
+{
+    uint16_t *reg = ((uint16_t*)a);
+    
+    for (uint8_t i = 0; i < 4; i++)
+        app_regs.REG_CH_EXT_PERIOD[i] = reg[i];
+    
+    /* Only the channels clocked by a TRIG input are affected */
+    for (uint8_t j = 0; j < 4; j++)
+        if (*((&app_regs.REG_CH0_MODE) + j) & MSK_CH_CLK)
+            stop_and_update_ch_temps(j);
+    
+    return true;
+}
 
 
 /************************************************************************/
-/* REG_CH1_REAL_DUTYCYCLE                                               */
+/* REG_VTRG_TABLE                                                       */
 /************************************************************************/
-void app_read_REG_CH1_REAL_DUTYCYCLE(void) {}
-bool app_write_REG_CH1_REAL_DUTYCYCLE(void *a) {return false;}
+bool app_write_REG_VTRG_TABLE(void *a)
+{
+    app_regs.REG_VTRG_TABLE[0] = ((uint32_t*)a)[0];
+    app_regs.REG_VTRG_TABLE[1] = ((uint32_t*)a)[1];
+    hwbp_app_pwm_gen_init_virtual_triggers();
+    return true;
+}
 
 
 /************************************************************************/
-/* REG_CH2_REAL_DUTYCYCLE                                               */
+/* REG_CH_STATS                                                         */
 /************************************************************************/
-void app_read_REG_CH2_REAL_DUTYCYCLE(void) {}
-bool app_write_REG_CH2_REAL_DUTYCYCLE(void *a) {return false;}
+void app_read_REG_CH_STATS(void)
+{
+    hwbp_app_pwm_gen_read_stats(app_regs.REG_CH_STATS, app_regs.REG_CH_STATS_CTRL & B_STATS_CLR_ON_READ);
+}
+
+bool app_write_REG_CH_STATS(void *a)
+{
+    /* Any write clears the statistics */
+    hwbp_app_pwm_gen_read_stats(app_regs.REG_CH_STATS, true);
+    return true;
+}
 
 
 /************************************************************************/
-/* REG_CH3_REAL_DUTYCYCLE                                               */
+/* REG_CH_REMAINING                                                     */
 /************************************************************************/
-void app_read_REG_CH3_REAL_DUTYCYCLE(void) {}
-bool app_write_REG_CH3_REAL_DUTYCYCLE(void *a) {return false;}
+void app_read_REG_CH_REMAINING(void)
+{
+    hwbp_app_pwm_gen_read_remaining(app_regs.REG_CH_REMAINING);
+}
 
 
 /************************************************************************/
-/* REG_CH0_MODE                                                         */
+/* REG_CH_PROGRESS                                                      */
 /************************************************************************/
-void app_read_REG_CH0_MODE(void) {}
-bool app_write_REG_CH0_MODE(void *a)
+bool app_write_REG_CH_PROGRESS(void *a)
 {
-    if (*((uint8_t*)a) & ~MSK_CH_MODE)
-        return false;
-
-	app_regs.REG_CH0_MODE = *((uint8_t*)a);
-	return true;
+    for (uint8_t i = 0; i < 4; i++)
+        app_regs.REG_CH_PROGRESS[i] = ((uint16_t*)a)[i];
+    
+    hwbp_app_pwm_gen_restart_progress();
+    return true;
 }
 
 
 /************************************************************************/
-/* REG_CH1_MODE                                                         */
+/* REG_PROF_ISR_COUNT                                                   */
 /************************************************************************/
-void app_read_REG_CH1_MODE(void) {}
-bool app_write_REG_CH1_MODE(void *a)
+void app_read_REG_PROF_ISR_COUNT(void)
 {
-    if (*((uint8_t*)a) & ~MSK_CH_MODE)
-        return false;
+    hwbp_app_prof_update_regs();
+}
 
-    app_regs.REG_CH1_MODE = *((uint8_t*)a);
+bool app_write_REG_PROF_ISR_COUNT(void *a)
+{
+    /* Any write restarts the profiling */
+    hwbp_app_prof_clear();
     return true;
 }
 
 
 /************************************************************************/
-/* REG_CH2_MODE                                                         */
+/* REG_PROF_ISR_MAX                                                     */
 /************************************************************************/
-void app_read_REG_CH2_MODE(void) {}
-bool app_write_REG_CH2_MODE(void *a)
+void app_read_REG_PROF_ISR_MAX(void)
 {
-    if (*((uint8_t*)a) & ~MSK_CH_MODE)
-        return false;
-
-    app_regs.REG_CH2_MODE = *((uint8_t*)a);
-    return true;
+    hwbp_app_prof_update_regs();
 }
 
 
 /************************************************************************/
-/* REG_CH3_MODE                                                         */
+/* REG_PROF_ISR_MEAN                                                    */
 /************************************************************************/
-void app_read_REG_CH3_MODE(void) {}
-bool app_write_REG_CH3_MODE(void *a)
+void app_read_REG_PROF_ISR_MEAN(void)
 {
-    if (*((uint8_t*)a) & ~MSK_CH_MODE)
-        return false;
-
-    app_regs.REG_CH3_MODE = *((uint8_t*)a);
-    return true;
+    hwbp_app_prof_update_regs();
 }
 
 
 /************************************************************************/
-/* REG_TRG0_MASK                                                        */
+/* REG_PROF_LATENCY_MAX                                                 */
 /************************************************************************/
-void app_read_REG_TRG0_MASK(void) {}
-bool app_write_REG_TRG0_MASK(void *a)
+void app_read_REG_PROF_LATENCY_MAX(void)
 {
-	if (*((uint8_t*)a) & ~(B_TRGCH0 | B_TRGCH1 | B_TRGCH2 | B_TRGCH3))
-        return false;
-
-	app_regs.REG_TRG0_MASK = *((uint8_t*)a);
-	return true;
+    hwbp_app_prof_update_regs();
 }
 
 
 /************************************************************************/
-/* REG_TRG1_MASK                                                        */
+/* REG_PROF_CPU_LOAD                                                    */
 /************************************************************************/
-void app_read_REG_TRG1_MASK(void) {}
-bool app_write_REG_TRG1_MASK(void *a)
+void app_read_REG_PROF_CPU_LOAD(void)
 {
-    if (*((uint8_t*)a) & ~(B_TRGCH0 | B_TRGCH1 | B_TRGCH2 | B_TRGCH3))
-        return false;
-
-    app_regs.REG_TRG1_MASK = *((uint8_t*)a);
-    return true;
+    hwbp_app_prof_update_regs();
 }
 
 
 /************************************************************************/
-/* REG_TRG2_MASK                                                        */
+/* Channels' configuration in a single register                         */
+/*                                                                      */
+/* The elements are the frequency, duty cycle, counts and mode, which   */
+/* are validated and applied together, followed by the real frequency   */
+/* and duty cycle, which are ignored on writes and updated after them.  */
 /************************************************************************/
-void app_read_REG_TRG2_MASK(void) {}
-bool app_write_REG_TRG2_MASK(void *a)
+#define CONFIG_FREQ 0
+#define CONFIG_DUTYCYCLE 1
+#define CONFIG_COUNTS 2
+#define CONFIG_MODE 3
+#define CONFIG_REAL_FREQ 4
+#define CONFIG_REAL_DUTYCYCLE 5
+#define CONFIG_N 6
+
+/* Checks a frequency, duty cycle and counts against REG_CH0_FREQ, REG_CH0_DUTYCYCLE and REG_CH0_COUNTS */
+static bool check_pwm_floats(float *pwm)
 {
-    if (*((uint8_t*)a) & ~(B_TRGCH0 | B_TRGCH1 | B_TRGCH2 | B_TRGCH3))
+    if (!app_reg_check_element(ADD_REG_CH0_FREQ, &pwm[0]) || !app_reg_check_element(ADD_REG_CH0_DUTYCYCLE, &pwm[1]))
         return false;
+    
+    /* Counts above 2^24 can't be represented exactly */
+    if (!(pwm[2] >= 0 && pwm[2] <= 16777216.0) || pwm[2] != (uint32_t)pwm[2])
+        return false;
+    
+    uint32_t counts = pwm[2];
+    return app_reg_check_element(ADD_REG_CH0_COUNTS, &counts);
+}
 
-    app_regs.REG_TRG2_MASK = *((uint8_t*)a);
-    return true;
+static bool check_ch_config(float *config)
+{
+    if (!check_pwm_floats(config + CONFIG_FREQ))
+        return false;
+    
+    if (!(config[CONFIG_MODE] >= 0 && config[CONFIG_MODE] <= 255) || config[CONFIG_MODE] != (uint8_t)config[CONFIG_MODE])
+        return false;
+    
+    return check_ch_mode(config[CONFIG_MODE]);
 }
 
+static void read_ch_config(uint8_t ch, float *config)
+{
+    hwbp_app_pwm_gen_update_dirty_reals();
+    
+    config[CONFIG_FREQ] = *((&app_regs.REG_CH0_FREQ) + ch);
+    config[CONFIG_DUTYCYCLE] = *((&app_regs.REG_CH0_DUTYCYCLE) + ch);
+    config[CONFIG_COUNTS] = *((&app_regs.REG_CH0_COUNTS) + ch);
+    config[CONFIG_MODE] = *((&app_regs.REG_CH0_MODE) + ch);
+    config[CONFIG_REAL_FREQ] = *((&app_regs.REG_CH0_REAL_FREQ) + ch);
+    config[CONFIG_REAL_DUTYCYCLE] = *((&app_regs.REG_CH0_REAL_DUTYCYCLE) + ch);
+}
 
-/************************************************************************/
-/* REG_TRG3_MASK                                                        */
-/************************************************************************/
-void app_read_REG_TRG3_MASK(void) {}
-bool app_write_REG_TRG3_MASK(void *a)
+/* Returns true if the channel's clock source changed */
+static bool apply_ch_config(uint8_t ch, float *config)
 {
-    if (*((uint8_t*)a) & ~(B_TRGCH0 | B_TRGCH1 | B_TRGCH2 | B_TRGCH3))
-        return false;
+    uint8_t mode = config[CONFIG_MODE];
+    bool clock_changed = (mode ^ *((&app_regs.REG_CH0_MODE) + ch)) & MSK_CH_CLK;
+    
+    *((&app_regs.REG_CH0_FREQ) + ch) = config[CONFIG_FREQ];
+    *((&app_regs.REG_CH0_DUTYCYCLE) + ch) = config[CONFIG_DUTYCYCLE];
+    *((&app_regs.REG_CH0_COUNTS) + ch) = config[CONFIG_COUNTS];
+    *((&app_regs.REG_CH0_MODE) + ch) = mode;
+    
+    /* Stops the channel and computes the real values only once */
+    stop_and_update_ch_temps(ch);
+    
+    return clock_changed;
+}
 
-    app_regs.REG_TRG3_MASK = *((uint8_t*)a);
+static bool write_ch_configs(float *configs, uint8_t first_ch, uint8_t n_ch)
+{
+    for (uint8_t i = 0; i < n_ch; i++)
+        if (!check_ch_config(configs + i * CONFIG_N))
+            return false;
+    
+    bool clock_changed = false;
+    
+    for (uint8_t i = 0; i < n_ch; i++)
+        clock_changed |= apply_ch_config(first_ch + i, configs + i * CONFIG_N);
+    
+    if (clock_changed)
+    {
+        /* Reconfigure the TRIG inputs used as channel clocks and gates */
+        hwbp_app_pwm_gen_update_clock_inputs();
+        hwbp_app_pwm_gen_update_gates();
+    }
+    
+    /* The reply carries the real values */
+    for (uint8_t i = 0; i < n_ch; i++)
+        read_ch_config(first_ch + i, app_regs.REG_CH0_CONFIG + (first_ch + i) * CONFIG_N);
+    
     return true;
 }
 
 
 /************************************************************************/
-/* REG_START_PWM                                                        */
+/* REG_CH0_CONFIG                                                       */
 /************************************************************************/
-void app_read_REG_START_PWM(void)
+void app_read_REG_CH0_CONFIG(void)
 {
-    app_regs.REG_START_PWM = 0;
+    read_ch_config(0, app_regs.REG_CH0_CONFIG);
 }
 
-bool app_write_REG_START_PWM(void *a)
+bool app_write_REG_CH0_CONFIG(void *a)
 {
-    if (*((uint8_t*)a) & ~(B_START_TRG0 | B_START_TRG1 | B_START_TRG2 | B_START_TRG3))
-        return false;
-    
-    app_regs.REG_START_PWM = *((uint8_t*)a);
-    check_and_start_pwms(*((uint8_t*)a));
-	return true;
+    return write_ch_configs((float*)a, 0, 1);
 }
 
 
 /************************************************************************/
-/* REG_STOP_PWM                                                         */
+/* REG_CH1_CONFIG                                                       */
 /************************************************************************/
-void app_read_REG_STOP_PWM(void)
+void app_read_REG_CH1_CONFIG(void)
 {
-    app_regs.REG_STOP_PWM = 0;
+    read_ch_config(1, app_regs.REG_CH1_CONFIG);
 }
 
-bool app_write_REG_STOP_PWM(void *a)
+bool app_write_REG_CH1_CONFIG(void *a)
 {
-    if (*((uint8_t*)a) & ~(B_STOP_TRG0 | B_STOP_TRG1 | B_STOP_TRG2 | B_STOP_TRG3))
-        return false;
-    
-    app_regs.REG_STOP_PWM = *((uint8_t*)a);
-    check_and_stop_pwms(*((uint8_t*)a));
-    return true;
+    return write_ch_configs((float*)a, 1, 1);
 }
 
 
 /************************************************************************/
-/* REG_CH_ENABLE_SINGLE                                                 */
+/* REG_CH2_CONFIG                                                       */
 /************************************************************************/
-void app_read_REG_CH_ENABLE_SINGLE(void) {};
-bool app_write_REG_CH_ENABLE_SINGLE(void *a) 
+void app_read_REG_CH2_CONFIG(void)
 {
-    if (*((uint8_t*)a) & ~(B_SGLE0 | B_SGLE1 | B_SGLE2 | B_SGLE3))
-        return false;
-    
-    app_regs.REG_CH_ENABLE_SINGLE = *((uint8_t*)a);        
-    return true;
-}        
+    read_ch_config(2, app_regs.REG_CH2_CONFIG);
+}
+
+bool app_write_REG_CH2_CONFIG(void *a)
+{
+    return write_ch_configs((float*)a, 2, 1);
+}
 
 
 /************************************************************************/
-/* REG_RESERVED1                                                        */
+/* REG_CH3_CONFIG                                                       */
 /************************************************************************/
-void app_read_REG_RESERVED1(void) {};
-bool app_write_REG_RESERVED1(void *a) {return true;}
-    
+void app_read_REG_CH3_CONFIG(void)
+{
+    read_ch_config(3, app_regs.REG_CH3_CONFIG);
+}
+
+bool app_write_REG_CH3_CONFIG(void *a)
+{
+    return write_ch_configs((float*)a, 3, 1);
+}
+
 
 /************************************************************************/
-/* REG_TRG0_MODE                                                        */
+/* REG_CH_CONFIG_ALL                                                    */
 /************************************************************************/
-void app_read_REG_TRG0_MODE(void) {}
-bool app_write_REG_TRG0_MODE(void *a)
+void app_read_REG_CH_CONFIG_ALL(void)
 {
-	if (*((uint8_t*)a) & ~(MSK_TRG_MODE | B_NTRG))
-        return false;
+    for (uint8_t i = 0; i < 4; i++)
+        read_ch_config(i, app_regs.REG_CH0_CONFIG + i * CONFIG_N);
+}
 
-	app_regs.REG_TRG0_MODE = *((uint8_t*)a);
-	return true;
+bool app_write_REG_CH_CONFIG_ALL(void *a)
+{
+    return write_ch_configs((float*)a, 0, 4);
 }
 
 
 /************************************************************************/
-/* REG_TRG1_MODE                                                        */
+/* REG_STAGE_CONFIG                                                     */
 /************************************************************************/
-void app_read_REG_TRG1_MODE(void) {}
-bool app_write_REG_TRG1_MODE(void *a)
+bool app_write_REG_STAGE_CONFIG(void *a)
 {
-    if (*((uint8_t*)a) & ~(MSK_TRG_MODE | B_NTRG))
+    float *reg = ((float*)a);
+    uint8_t ch_mask = 0;
+    
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        float *config = reg + i * 3;
+        
+        /* A channel written with a zero frequency keeps its staged configuration */
+        if (config[0] == 0)
+            continue;
+        
+        if (!check_pwm_floats(config))
+            return false;
+        
+        ch_mask |= (B_TRGCH0 << i);
+    }
+    
+    /* The timer values are computed now so the commit is quick */
+    if (!hwbp_app_pwm_gen_stage(ch_mask, reg))
         return false;
-
-    app_regs.REG_TRG1_MODE = *((uint8_t*)a);
+    
+    for (uint8_t i = 0; i < 12; i++)
+        if (ch_mask & (B_TRGCH0 << (i / 3)))
+            app_regs.REG_STAGE_CONFIG[i] = reg[i];
+    
     return true;
 }
 
 
 /************************************************************************/
-/* REG_TRG2_MODE                                                        */
+/* REG_STAGE_COMMIT                                                     */
 /************************************************************************/
-void app_read_REG_TRG2_MODE(void) {}
-bool app_write_REG_TRG2_MODE(void *a)
+bool app_write_REG_STAGE_COMMIT(void *a)
 {
-    if (*((uint8_t*)a) & ~(MSK_TRG_MODE | B_NTRG))
+    uint8_t reg = *((uint8_t*)a);
+    
+    if (reg & ~(B_TRGCH0 | B_TRGCH1 | B_TRGCH2 | B_TRGCH3 | B_COMMIT_ON_TRIG))
         return false;
-
-    app_regs.REG_TRG2_MODE = *((uint8_t*)a);
+    
+    if (reg & B_COMMIT_ON_TRIG)
+    {
+        app_regs.REG_STAGE_COMMIT = reg;
+        hwbp_app_pwm_gen_arm_commit(reg & ~B_COMMIT_ON_TRIG);
+    }
+    else
+    {
+        hwbp_app_pwm_gen_commit(reg);
+    }
+    
     return true;
 }
 
 
 /************************************************************************/
-/* REG_TRG3_MODE                                                        */
+/* REG_PRESET_SAVE                                                      */
 /************************************************************************/
-void app_read_REG_TRG3_MODE(void) {}
-bool app_write_REG_TRG3_MODE(void *a)
+bool app_write_REG_PRESET_SAVE(void *a)
 {
-    if (*((uint8_t*)a) & ~(MSK_TRG_MODE | B_NTRG))
+    uint8_t reg = *((uint8_t*)a);
+    
+    if (!hwbp_app_preset_save(reg))
         return false;
-
-    app_regs.REG_TRG3_MODE = *((uint8_t*)a);
+    
+    app_regs.REG_PRESET_SAVE = reg;
     return true;
 }
 
 
 /************************************************************************/
-/* REG_CH_CONFEN                                                        */
+/* REG_PRESET_LOAD                                                      */
 /************************************************************************/
-extern void update_enabled_pwmx(void);
+bool app_write_REG_PRESET_LOAD(void *a)
+{
+    /* Also refuses presets that were never saved */
+    return hwbp_app_preset_load(*((uint8_t*)a));
+}
 
-void app_read_REG_CH_CONFEN(void) {}
-bool app_write_REG_CH_CONFEN(void *a)
+
+/************************************************************************/
+/* REG_PRESET_NAMES                                                     */
+/************************************************************************/
+bool app_write_REG_PRESET_NAMES(void *a)
 {
-    if (*((uint8_t*)a) & ~(B_USEEN0 | B_USEEN1 | B_USEEN2 | B_USEEN3))
-        return false;
+    for (uint8_t i = 0; i < PRESETS_N * PRESET_NAME_LENGTH; i++)
+        app_regs.REG_PRESET_NAMES[i] = ((uint8_t*)a)[i];
     
-	app_regs.REG_CH_CONFEN = *((uint8_t*)a);
-	update_enabled_pwmx();
-	return true;
+    hwbp_app_preset_save_names();
+    return true;
 }
 
 
 /************************************************************************/
-/* REG_CH_ENABLE                                                        */
+/* REG_CH0_TRAIN to REG_CH3_TRAIN                                       */
 /************************************************************************/
-void app_read_REG_CH_ENABLE(void) {}
-bool app_write_REG_CH_ENABLE(void *a)
+static bool write_ch_train(uint8_t ch, float *reg, void *a)
 {
-    if (*((uint8_t*)a) & ~(B_EN0 | B_EN1 | B_EN2 | B_EN3))
-	    return false;
+    float *train = ((float*)a);
+    
+    if (!check_pwm_floats(train))
+        return false;
     
-    app_regs.REG_CH_ENABLE = *((uint8_t*)a);    
-	update_enabled_pwmx();
-	return true;
+    /* Refused if the queue is full or the prescaler differs from the channel's */
+    if (!hwbp_app_pwm_gen_enqueue_train(ch, train[0], train[1], train[2]))
+        return false;
+    
+    for (uint8_t i = 0; i < 3; i++)
+        reg[i] = train[i];
+    
+    return true;
 }
 
+bool app_write_REG_CH0_TRAIN(void *a) {return write_ch_train(0, app_regs.REG_CH0_TRAIN, a);}
+bool app_write_REG_CH1_TRAIN(void *a) {return write_ch_train(1, app_regs.REG_CH1_TRAIN, a);}
+bool app_write_REG_CH2_TRAIN(void *a) {return write_ch_train(2, app_regs.REG_CH2_TRAIN, a);}
+bool app_write_REG_CH3_TRAIN(void *a) {return write_ch_train(3, app_regs.REG_CH3_TRAIN, a);}
+
 
 /************************************************************************/
-/* REG_TRGALL_MODE                                                      */
+/* REG_TRAIN_LEVEL                                                      */
 /************************************************************************/
-void app_read_REG_TRGALL_MODE(void) {}
-bool app_write_REG_TRGALL_MODE(void *a)
+bool app_write_REG_TRAIN_LEVEL(void *a)
 {
-    if (*((uint8_t*)a) & ~(MSK_ALL_MODE | B_NEG))
-	    return false;
-
-	app_regs.REG_TRGALL_MODE = *((uint8_t*)a);
-	return true;
+    /* The range only accepts zeros, which empty all the queues */
+    hwbp_app_pwm_gen_clear_trains(B_TRGCH0 | B_TRGCH1 | B_TRGCH2 | B_TRGCH3);
+    return true;
 }
 
 
 /************************************************************************/
-/* REG_TRIG_STATE                                                       */
+/* REG_PROF_LATENCY_MIN                                                 */
 /************************************************************************/
-void app_read_REG_TRIG_STATE(void)
+void app_read_REG_PROF_LATENCY_MIN(void)
 {
-    app_regs.REG_TRIG_STATE  = (read_TRIG_IN0) ? B_LTRG0 : 0;
-    app_regs.REG_TRIG_STATE |= (read_TRIG_IN1) ? B_LTRG1 : 0;
-    app_regs.REG_TRIG_STATE |= (read_TRIG_IN2) ? B_LTRG2 : 0;
-    app_regs.REG_TRIG_STATE |= (read_TRIG_IN3) ? B_LTRG3 : 0;
-    app_regs.REG_TRIG_STATE |= (read_TRIG_ALL) ? B_LTRGALL : 0;
+    hwbp_app_prof_update_regs();
 }
 
-bool app_write_REG_TRIG_STATE(void *a) {return false;}
-
 
 /************************************************************************/
-/* REG_CH_STATE                                                         */
+/* REG_PROF_LATENCY_HIST                                                */
 /************************************************************************/
-void app_read_REG_CH_STATE(void)
+void app_read_REG_PROF_LATENCY_HIST(void)
 {
-    app_regs.REG_CH_STATE  = (read_PWM_OUT0) ? B_SCH0 : 0;
-    app_regs.REG_CH_STATE |= (read_PWM_OUT1) ? B_SCH1 : 0;
-    app_regs.REG_CH_STATE |= (read_PWM_OUT2) ? B_SCH2 : 0;
-    app_regs.REG_CH_STATE |= (read_PWM_OUT3) ? B_SCH3 : 0;
+    hwbp_app_prof_update_regs();
 }
 
-bool app_write_REG_CH_STATE(void *a) {return false;}
-
 
 /************************************************************************/
-/* REG_EXEC_STATE                                                       */
+/* REG_PROF_SKEW_MAX                                                    */
 /************************************************************************/
-void app_read_REG_EXEC_STATE(void) {}
-bool app_write_REG_EXEC_STATE(void *a) {return false;}
+void app_read_REG_PROF_SKEW_MAX(void)
+{
+    hwbp_app_prof_update_regs();
+}
 
 
 /************************************************************************/
-/* REG_EVNT_ENABLE                                                      */
+/* REG_EVNT_DROPPED                                                     */
 /************************************************************************/
-void app_read_REG_EVNT_ENABLE(void) {}
-
-bool app_write_REG_EVNT_ENABLE(void *a)
+void app_read_REG_EVNT_DROPPED(void)
 {
-	if (*((uint8_t*)a) & ~(B_EVT0))
-        return false;
-
-	app_regs.REG_EVNT_ENABLE = *((uint8_t*)a);
-	return true;
-}
\ No newline at end of file
+    hwbp_app_evt_queue_read_dropped();
+}
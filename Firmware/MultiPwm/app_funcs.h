@@ -20,18 +20,6 @@
 /************************************************************************/
 /* Prototypes                                                           */
 /************************************************************************/
-void app_read_REG_CH0_FREQ(void);
-void app_read_REG_CH1_FREQ(void);
-void app_read_REG_CH2_FREQ(void);
-void app_read_REG_CH3_FREQ(void);
-void app_read_REG_CH0_DUTYCYCLE(void);
-void app_read_REG_CH1_DUTYCYCLE(void);
-void app_read_REG_CH2_DUTYCYCLE(void);
-void app_read_REG_CH3_DUTYCYCLE(void);
-void app_read_REG_CH0_COUNTS(void);
-void app_read_REG_CH1_COUNTS(void);
-void app_read_REG_CH2_COUNTS(void);
-void app_read_REG_CH3_COUNTS(void);
 void app_read_REG_CH0_REAL_FREQ(void);
 void app_read_REG_CH1_REAL_FREQ(void);
 void app_read_REG_CH2_REAL_FREQ(void);
@@ -40,29 +28,27 @@ void app_read_REG_CH0_REAL_DUTYCYCLE(void);
 void app_read_REG_CH1_REAL_DUTYCYCLE(void);
 void app_read_REG_CH2_REAL_DUTYCYCLE(void);
 void app_read_REG_CH3_REAL_DUTYCYCLE(void);
-void app_read_REG_CH0_MODE(void);
-void app_read_REG_CH1_MODE(void);
-void app_read_REG_CH2_MODE(void);
-void app_read_REG_CH3_MODE(void);
-void app_read_REG_TRG0_MASK(void);
-void app_read_REG_TRG1_MASK(void);
-void app_read_REG_TRG2_MASK(void);
-void app_read_REG_TRG3_MASK(void);
 void app_read_REG_START_PWM(void);
 void app_read_REG_STOP_PWM(void);
-void app_read_REG_CH_ENABLE_SINGLE(void);
-void app_read_REG_RESERVED1(void);
-void app_read_REG_TRG0_MODE(void);
-void app_read_REG_TRG1_MODE(void);
-void app_read_REG_TRG2_MODE(void);
-void app_read_REG_TRG3_MODE(void);
-void app_read_REG_CH_CONFEN(void);
-void app_read_REG_CH_ENABLE(void);
-void app_read_REG_TRGALL_MODE(void);
 void app_read_REG_TRIG_STATE(void);
 void app_read_REG_CH_STATE(void);
 void app_read_REG_EXEC_STATE(void);
-void app_read_REG_EVNT_ENABLE(void);
+void app_read_REG_CH_STATS(void);
+void app_read_REG_CH_REMAINING(void);
+void app_read_REG_PROF_ISR_COUNT(void);
+void app_read_REG_PROF_ISR_MAX(void);
+void app_read_REG_PROF_ISR_MEAN(void);
+void app_read_REG_PROF_LATENCY_MAX(void);
+void app_read_REG_PROF_CPU_LOAD(void);
+void app_read_REG_CH0_CONFIG(void);
+void app_read_REG_CH1_CONFIG(void);
+void app_read_REG_CH2_CONFIG(void);
+void app_read_REG_CH3_CONFIG(void);
+void app_read_REG_CH_CONFIG_ALL(void);
+void app_read_REG_PROF_LATENCY_MIN(void);
+void app_read_REG_PROF_LATENCY_HIST(void);
+void app_read_REG_PROF_SKEW_MAX(void);
+void app_read_REG_EVNT_DROPPED(void);
 
 bool app_write_REG_CH0_FREQ(void *a);
 bool app_write_REG_CH1_FREQ(void *a);
@@ -76,14 +62,6 @@ bool app_write_REG_CH0_COUNTS(void *a);
 bool app_write_REG_CH1_COUNTS(void *a);
 bool app_write_REG_CH2_COUNTS(void *a);
 bool app_write_REG_CH3_COUNTS(void *a);
-bool app_write_REG_CH0_REAL_FREQ(void *a);
-bool app_write_REG_CH1_REAL_FREQ(void *a);
-bool app_write_REG_CH2_REAL_FREQ(void *a);
-bool app_write_REG_CH3_REAL_FREQ(void *a);
-bool app_write_REG_CH0_REAL_DUTYCYCLE(void *a);
-bool app_write_REG_CH1_REAL_DUTYCYCLE(void *a);
-bool app_write_REG_CH2_REAL_DUTYCYCLE(void *a);
-bool app_write_REG_CH3_REAL_DUTYCYCLE(void *a);
 bool app_write_REG_CH0_MODE(void *a);
 bool app_write_REG_CH1_MODE(void *a);
 bool app_write_REG_CH2_MODE(void *a);
@@ -94,19 +72,41 @@ bool app_write_REG_TRG2_MASK(void *a);
 bool app_write_REG_TRG3_MASK(void *a);
 bool app_write_REG_START_PWM(void *a);
 bool app_write_REG_STOP_PWM(void *a);
-bool app_write_REG_CH_ENABLE_SINGLE(void *a);
-bool app_write_REG_RESERVED1(void *a);
 bool app_write_REG_TRG0_MODE(void *a);
 bool app_write_REG_TRG1_MODE(void *a);
 bool app_write_REG_TRG2_MODE(void *a);
 bool app_write_REG_TRG3_MODE(void *a);
 bool app_write_REG_CH_CONFEN(void *a);
 bool app_write_REG_CH_ENABLE(void *a);
-bool app_write_REG_TRGALL_MODE(void *a);
-bool app_write_REG_TRIG_STATE(void *a);
-bool app_write_REG_CH_STATE(void *a);
-bool app_write_REG_EXEC_STATE(void *a);
-bool app_write_REG_EVNT_ENABLE(void *a);
+bool app_write_REG_TRG_FMETER_EN(void *a);
+bool app_write_REG_TRG_FMETER_WINDOW(void *a);
+bool app_write_REG_CH_EXT_PERIOD(void *a);
+bool app_write_REG_VTRG_TABLE(void *a);
+bool app_write_REG_CH_STATS(void *a);
+bool app_write_REG_CH_PROGRESS(void *a);
+bool app_write_REG_PROF_ISR_COUNT(void *a);
+bool app_write_REG_CH0_CONFIG(void *a);
+bool app_write_REG_CH1_CONFIG(void *a);
+bool app_write_REG_CH2_CONFIG(void *a);
+bool app_write_REG_CH3_CONFIG(void *a);
+bool app_write_REG_CH_CONFIG_ALL(void *a);
+bool app_write_REG_STAGE_CONFIG(void *a);
+bool app_write_REG_STAGE_COMMIT(void *a);
+bool app_write_REG_PRESET_SAVE(void *a);
+bool app_write_REG_PRESET_LOAD(void *a);
+bool app_write_REG_PRESET_NAMES(void *a);
+bool app_write_REG_CH0_TRAIN(void *a);
+bool app_write_REG_CH1_TRAIN(void *a);
+bool app_write_REG_CH2_TRAIN(void *a);
+bool app_write_REG_CH3_TRAIN(void *a);
+bool app_write_REG_TRAIN_LEVEL(void *a);
+
+
+/************************************************************************/
+/* Registers' descriptors                                               */
+/************************************************************************/
+/* Checks one element of a register against its mask and range, as done on writes */
+bool app_reg_check_element(uint8_t add, const void *element);
 
 
 #endif /* _APP_FUNCTIONS_H_ */
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include <avr/io.h>
 #include "hwbp_core_types.h"
 #include "app_ios_and_regs.h"
+#include "pwm_gen_functions.h"
 
 /************************************************************************/
 /* Configure and initialize IOs                                         */
@@ -20,6 +21,11 @@ void init_ios(void)
 	io_set_int(&PORTK, INT_LEVEL_LOW, 0, (1<<1), false);                 // TRIG_IN3
 	io_set_int(&PORTQ, INT_LEVEL_LOW, 0, (1<<2), false);                 // TRIG_ALL
 
+	/* Route the trigger inputs to the event system */
+	/* Only PORTA to PORTF pins can generate events, so TRIG_IN2, TRIG_IN3 and TRIG_ALL are left out */
+	EVSYS.CH0MUX = EVSYS_CHMUX_PORTF_PIN5_gc;                            // TRIG_IN0
+	EVSYS.CH1MUX = EVSYS_CHMUX_PORTF_PIN6_gc;                            // TRIG_IN1
+
 	/* Configure output pins */
 	io_pin2out(&PORTC, 1, OUT_IO_DIGITAL, IN_EN_IO_DIS);                 // SYNC_OUT0
 	io_pin2out(&PORTD, 1, OUT_IO_DIGITAL, IN_EN_IO_DIS);                 // SYNC_OUT1
@@ -56,140 +62,3 @@ void init_ios(void)
 /************************************************************************/
 AppRegs app_regs;
 
-uint8_t app_regs_type[] = {
-	TYPE_FLOAT,
-	TYPE_FLOAT,
-	TYPE_FLOAT,
-	TYPE_FLOAT,
-	TYPE_FLOAT,
-	TYPE_FLOAT,
-	TYPE_FLOAT,
-	TYPE_FLOAT,
-	TYPE_U32,
-	TYPE_U32,
-	TYPE_U32,
-	TYPE_U32,
-	TYPE_FLOAT,
-	TYPE_FLOAT,
-	TYPE_FLOAT,
-	TYPE_FLOAT,
-	TYPE_FLOAT,
-	TYPE_FLOAT,
-	TYPE_FLOAT,
-	TYPE_FLOAT,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8
-};
-
-uint16_t app_regs_n_elements[] = {
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1
-};
-
-uint8_t *app_regs_pointer[] = {
-	(uint8_t*)(&app_regs.REG_CH0_FREQ),
-	(uint8_t*)(&app_regs.REG_CH1_FREQ),
-	(uint8_t*)(&app_regs.REG_CH2_FREQ),
-	(uint8_t*)(&app_regs.REG_CH3_FREQ),
-	(uint8_t*)(&app_regs.REG_CH0_DUTYCYCLE),
-	(uint8_t*)(&app_regs.REG_CH1_DUTYCYCLE),
-	(uint8_t*)(&app_regs.REG_CH2_DUTYCYCLE),
-	(uint8_t*)(&app_regs.REG_CH3_DUTYCYCLE),
-	(uint8_t*)(&app_regs.REG_CH0_COUNTS),
-	(uint8_t*)(&app_regs.REG_CH1_COUNTS),
-	(uint8_t*)(&app_regs.REG_CH2_COUNTS),
-	(uint8_t*)(&app_regs.REG_CH3_COUNTS),
-	(uint8_t*)(&app_regs.REG_CH0_REAL_FREQ),
-	(uint8_t*)(&app_regs.REG_CH1_REAL_FREQ),
-	(uint8_t*)(&app_regs.REG_CH2_REAL_FREQ),
-	(uint8_t*)(&app_regs.REG_CH3_REAL_FREQ),
-	(uint8_t*)(&app_regs.REG_CH0_REAL_DUTYCYCLE),
-	(uint8_t*)(&app_regs.REG_CH1_REAL_DUTYCYCLE),
-	(uint8_t*)(&app_regs.REG_CH2_REAL_DUTYCYCLE),
-	(uint8_t*)(&app_regs.REG_CH3_REAL_DUTYCYCLE),
-	(uint8_t*)(&app_regs.REG_CH0_MODE),
-	(uint8_t*)(&app_regs.REG_CH1_MODE),
-	(uint8_t*)(&app_regs.REG_CH2_MODE),
-	(uint8_t*)(&app_regs.REG_CH3_MODE),
-	(uint8_t*)(&app_regs.REG_TRG0_MASK),
-	(uint8_t*)(&app_regs.REG_TRG1_MASK),
-	(uint8_t*)(&app_regs.REG_TRG2_MASK),
-	(uint8_t*)(&app_regs.REG_TRG3_MASK),
-	(uint8_t*)(&app_regs.REG_START_PWM),
-	(uint8_t*)(&app_regs.REG_STOP_PWM),
-	(uint8_t*)(&app_regs.REG_CH_ENABLE_SINGLE),
-	(uint8_t*)(&app_regs.REG_RESERVED1),
-	(uint8_t*)(&app_regs.REG_TRG0_MODE),
-	(uint8_t*)(&app_regs.REG_TRG1_MODE),
-	(uint8_t*)(&app_regs.REG_TRG2_MODE),
-	(uint8_t*)(&app_regs.REG_TRG3_MODE),
-	(uint8_t*)(&app_regs.REG_CH_CONFEN),
-	(uint8_t*)(&app_regs.REG_CH_ENABLE),
-	(uint8_t*)(&app_regs.REG_TRGALL_MODE),
-	(uint8_t*)(&app_regs.REG_TRIG_STATE),
-	(uint8_t*)(&app_regs.REG_CH_STATE),
-	(uint8_t*)(&app_regs.REG_EXEC_STATE),
-	(uint8_t*)(&app_regs.REG_EVNT_ENABLE)
-};
\ No newline at end of file
@@ -162,8 +162,85 @@ typedef struct
 	uint8_t REG_CH_STATE;
 	uint8_t REG_EXEC_STATE;
 	uint8_t REG_EVNT_ENABLE;
+	uint8_t REG_TRG_FMETER_EN;
+	uint8_t REG_TRG_FMETER_WINDOW;
+	uint32_t REG_TRG_PERIOD[2];
+	float REG_TRG_FREQ[2];
+	float REG_TRG_DUTYCYCLE[2];
+	uint16_t REG_CH_EXT_PERIOD[4];
+	uint8_t REG_CH_CHAIN[4];
+	uint32_t REG_VTRG_TABLE[2];
+	uint8_t REG_VTRG_MASK[2];
+	uint8_t REG_VTRG_MODE[2];
+	uint16_t REG_EVNT_COALESCE;
+	uint8_t REG_EXEC_BATCH[3];
+	uint32_t REG_CH_STATS[20];
+	uint8_t REG_CH_STATS_CTRL;
+	uint32_t REG_CH_REMAINING[4];
+	uint16_t REG_CH_PROGRESS[4];
+	uint32_t REG_PROF_ISR_COUNT[9];
+	uint16_t REG_PROF_ISR_MAX[9];
+	uint16_t REG_PROF_ISR_MEAN[9];
+	uint16_t REG_PROF_LATENCY_MAX;
+	float REG_PROF_CPU_LOAD;
+	union
+	{
+		struct
+		{
+			float REG_CH0_CONFIG[6];
+			float REG_CH1_CONFIG[6];
+			float REG_CH2_CONFIG[6];
+			float REG_CH3_CONFIG[6];
+		};
+		float REG_CH_CONFIG_ALL[24];              // Shares the memory of REG_CH0_CONFIG to REG_CH3_CONFIG
+	};
+	float REG_STAGE_CONFIG[12];
+	uint8_t REG_STAGE_COMMIT;
+	uint8_t REG_STAGE_TRIGGER;
+	uint8_t REG_PRESET_SAVE;
+	uint8_t REG_PRESET_LOAD;
+	uint8_t REG_PRESET_NAMES[32];
+	uint8_t REG_PRESET_TRIGGER;
+	float REG_CH0_TRAIN[3];
+	float REG_CH1_TRAIN[3];
+	float REG_CH2_TRAIN[3];
+	float REG_CH3_TRAIN[3];
+	uint8_t REG_TRAIN_LEVEL[4];
+	uint8_t REG_TRAIN_LOW;
+	uint16_t REG_PROF_LATENCY_MIN;
+	uint16_t REG_PROF_LATENCY_HIST[8];
+	uint16_t REG_PROF_SKEW_MAX;
+	uint16_t REG_EVNT_DROPPED;
 } AppRegs;
 
+/************************************************************************/
+/* Registers' descriptors                                               */
+/************************************************************************/
+/* Generated from device.yml in app_regs_desc.c and checked by core_write_app_register() */
+#define REG_DESC_READ_ONLY                 (1<<0)       // Writes are refused
+#define REG_DESC_MASK                      (1<<1)       // Each U8 element only has the bits of mask
+#define REG_DESC_RANGE                     (1<<2)       // Each element is inside app_regs_ranges[range]
+
+typedef union
+{
+	uint32_t u;
+	int32_t s;
+	float f;
+} app_reg_limit_t;
+
+typedef struct
+{
+	app_reg_limit_t min;
+	app_reg_limit_t max;
+} app_reg_range_t;
+
+typedef struct
+{
+	uint8_t flags;
+	uint8_t mask;
+	uint8_t range;
+} app_reg_desc_t;
+
 /************************************************************************/
 /* Registers' address                                                   */
 /************************************************************************/
@@ -211,6 +288,49 @@ typedef struct
 #define ADD_REG_CH_STATE                    72 // U8     Read only. Current digital state of the PWM OUT outputs.
 #define ADD_REG_EXEC_STATE                  73 // U8     State of each PWM execution.
 #define ADD_REG_EVNT_ENABLE                 74 // U8     Enable the Events
+#define ADD_REG_TRG_FMETER_EN               75 // U8     Enable the frequency meter on TRIG_IN0 and TRIG_IN1
+#define ADD_REG_TRG_FMETER_WINDOW           76 // U8     Number of measured periods averaged by the frequency meter
+#define ADD_REG_TRG_PERIOD                  77 // U32    Read only. Measured period (ns) of TRIG_IN0 and TRIG_IN1 [2]
+#define ADD_REG_TRG_FREQ                    78 // FLOAT  Read only. Measured frequency (Hz) of TRIG_IN0 and TRIG_IN1 [2]
+#define ADD_REG_TRG_DUTYCYCLE               79 // FLOAT  Read only. Measured duty cycle (%) of TRIG_IN0 and TRIG_IN1 [2]
+#define ADD_REG_CH_EXT_PERIOD               80 // U16    Period, in external clock cycles, of the channels clocked by a TRIG input [4]
+#define ADD_REG_CH_CHAIN                    81 // U8     Channels started when the channel completes its Count mode train [4]
+#define ADD_REG_VTRG_TABLE                  82 // U32    Truth table of the virtual triggers over the TRIG inputs levels [2]
+#define ADD_REG_VTRG_MASK                   83 // U8     Channels affected by the virtual triggers [2]
+#define ADD_REG_VTRG_MODE                   84 // U8     Mode of the virtual triggers [2]
+#define ADD_REG_EVNT_COALESCE               85 // U16    Window, in microseconds, used to merge the EXEC_STATE changes into one event (0 disables)
+#define ADD_REG_EXEC_BATCH                  86 // U8     Merged EXEC_STATE changes: state, started channels and stopped channels [3]
+#define ADD_REG_CH_STATS                    87 // U32    Pulses, trains, accepted starts, starts ignored when busy and when disabled for each channel [20]
+#define ADD_REG_CH_STATS_CTRL               88 // U8     Configures the channels' statistics
+#define ADD_REG_CH_REMAINING                89 // U32    Pulses left on Count mode or pulses emitted on Infinite mode [4]
+#define ADD_REG_CH_PROGRESS                 90 // U16    Pulses between CH_REMAINING events (0 disables) [4]
+#define ADD_REG_PROF_ISR_COUNT              91 // U32    Calls of the CCA0-3, TRIG_IN0-3 and TRIG_ALL interrupts [9]
+#define ADD_REG_PROF_ISR_MAX                92 // U16    Maximum cycles spent on each interrupt [9]
+#define ADD_REG_PROF_ISR_MEAN               93 // U16    Mean cycles spent on each interrupt [9]
+#define ADD_REG_PROF_LATENCY_MAX            94 // U16    Maximum cycles from a trigger interrupt to the start of a channel
+#define ADD_REG_PROF_CPU_LOAD               95 // FLOAT  CPU load on the last second, in percentage
+#define ADD_REG_CH0_CONFIG                  96 // FLOAT  Frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 0 [6]
+#define ADD_REG_CH1_CONFIG                  97 // FLOAT  Frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 1 [6]
+#define ADD_REG_CH2_CONFIG                  98 // FLOAT  Frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 2 [6]
+#define ADD_REG_CH3_CONFIG                  99 // FLOAT  Frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 3 [6]
+#define ADD_REG_CH_CONFIG_ALL              100 // FLOAT  Configuration of the four channels, shares the memory of CHx_CONFIG [24]
+#define ADD_REG_STAGE_CONFIG               101 // FLOAT  Staged frequency, duty cycle and counts of each channel [12]
+#define ADD_REG_STAGE_COMMIT               102 // U8     Applies the staged configuration of the channels, now or on the next trigger
+#define ADD_REG_STAGE_TRIGGER              103 // U8     TRIG inputs that apply a pending staged configuration
+#define ADD_REG_PRESET_SAVE                104 // U8     Saves the current configuration on the preset [0:3]
+#define ADD_REG_PRESET_LOAD                105 // U8     Loads a preset [0:3]. Reads the last loaded preset
+#define ADD_REG_PRESET_NAMES               106 // U8     Name of each preset, 8 characters each [32]
+#define ADD_REG_PRESET_TRIGGER             107 // U8     TRIG inputs that load the next valid preset
+#define ADD_REG_CH0_TRAIN                  108 // FLOAT  Queues a train on channel 0 (frequency, duty cycle and counts) [3]
+#define ADD_REG_CH1_TRAIN                  109 // FLOAT  Queues a train on channel 1 (frequency, duty cycle and counts) [3]
+#define ADD_REG_CH2_TRAIN                  110 // FLOAT  Queues a train on channel 2 (frequency, duty cycle and counts) [3]
+#define ADD_REG_CH3_TRAIN                  111 // FLOAT  Queues a train on channel 3 (frequency, duty cycle and counts) [3]
+#define ADD_REG_TRAIN_LEVEL                112 // U8     Trains waiting on each channel's queue. Writing 0 empties the queue [4]
+#define ADD_REG_TRAIN_LOW                  113 // U8     Sends a TRAIN_LEVEL event when a channel's queue drops to this level
+#define ADD_REG_PROF_LATENCY_MIN           114 // U16    Minimum cycles from a trigger interrupt to the start of a channel
+#define ADD_REG_PROF_LATENCY_HIST          115 // U16    Channel starts by latency, in buckets of 64 cycles [8]
+#define ADD_REG_PROF_SKEW_MAX              116 // U16    Maximum cycles between the first and last channel started by a trigger
+#define ADD_REG_EVNT_DROPPED               117 // U16    Events dropped because their queue was full
 
 /************************************************************************/
 /* PWM Generator registers' memory limits                               */
@@ -220,8 +340,8 @@ typedef struct
 /************************************************************************/
 /* Memory limits */
 #define APP_REGS_ADD_MIN                    0x20
-#define APP_REGS_ADD_MAX                    0x4A
-#define APP_NBYTES_OF_REG_BANK              103
+#define APP_REGS_ADD_MAX                    0x75
+#define APP_NBYTES_OF_REG_BANK              597
 
 /************************************************************************/
 /* Registers' bits                                                      */
@@ -229,6 +349,10 @@ typedef struct
 #define MSK_CH_MODE                        (1<<0)       // 
 #define GM_CH_MODE_COUNT                   (0<<0)       // 
 #define GM_CH_MODE_INFINITE                (1<<0)       // 
+#define MSK_CH_CLK                         (3<<4)       // Clock source of the channel's timer
+#define GM_CH_CLK_INTERNAL                 (0<<4)       // 32 MHz peripheral clock
+#define GM_CH_CLK_TRIG0                    (1<<4)       // Rising edges of TRIG_IN0
+#define GM_CH_CLK_TRIG1                    (2<<4)       // Rising edges of TRIG_IN1
 #define B_TRGCH0                           (1<<0)       // Trigger PWM on channel 0
 #define B_TRGCH1                           (1<<1)       // Trigger PWM on channel 1
 #define B_TRGCH2                           (1<<2)       // Trigger PWM on channel 2
@@ -245,9 +369,10 @@ typedef struct
 #define B_SGLE1                            (1<<1)       // Disable channel 1 after running the PWM
 #define B_SGLE2                            (1<<2)       // Disable channel 2 after running the PWM
 #define B_SGLE3                            (1<<3)       // Disable channel 3 after running the PWM
-#define MSK_TRG_MODE                       (1<<0)       // 
+#define MSK_TRG_MODE                       (3<<0)       // 
 #define GM_TRG_MODE_START                  (0<<0)       // 
 #define GM_TRG_MODE_START_AND_STOP         (1<<0)       // 
+#define GM_TRG_MODE_GATE                   (2<<0)       // Channels only run while the trigger is active
 #define B_NTRG                             (1<<3)       // 
 #define B_USEEN0                           (1<<0)       // 
 #define B_USEEN1                           (1<<1)       // 
@@ -277,5 +402,12 @@ typedef struct
 #define B_PWM2STATE                        (1<<2)       // 
 #define B_PWM3STATE                        (1<<3)       // 
 #define B_EVT0                             (1<<0)       // Events of register EXEC_STATE
+#define B_EVT1                             (1<<1)       // Events of register TRG_FREQ
+#define B_EVT2                             (1<<2)       // Events of register CH_REMAINING
+#define B_EVT3                             (1<<3)       // Events of register TRAIN_LEVEL
+#define B_FMTRG0                           (1<<0)       // Measure TRIG_IN0
+#define B_FMTRG1                           (1<<1)       // Measure TRIG_IN1
+#define B_STATS_CLR_ON_READ                (1<<0)       // Clear the statistics each time REG_CH_STATS is read
+#define B_COMMIT_ON_TRIG                   (1<<7)       // Wait for one of the REG_STAGE_TRIGGER inputs to commit
 
 #endif /* _APP_REGS_H_ */
\ No newline at end of file
@@ -0,0 +1,563 @@
+/************************************************************************/
+/* Registers' tables                                                    */
+/*                                                                      */
+/* Generated from device.yml by Generators/RegisterDescriptors.tt. Do   */
+/* not edit, change the type, length, minValue, maxValue, maskType or   */
+/* access of the register in device.yml instead. The names come from    */
+/* the ADD_ defines of app_ios_and_regs.h and the read and write        */
+/* functions from the prototypes of app_funcs.h.                        */
+/************************************************************************/
+#include <float.h>
+#include <stdint.h>
+#include "hwbp_core_types.h"
+#include "app_ios_and_regs.h"
+#include "app_funcs.h"
+
+extern AppRegs app_regs;
+
+uint8_t app_regs_type[] = {
+	TYPE_FLOAT,                                     // REG_CH0_FREQ
+	TYPE_FLOAT,                                     // REG_CH1_FREQ
+	TYPE_FLOAT,                                     // REG_CH2_FREQ
+	TYPE_FLOAT,                                     // REG_CH3_FREQ
+	TYPE_FLOAT,                                     // REG_CH0_DUTYCYCLE
+	TYPE_FLOAT,                                     // REG_CH1_DUTYCYCLE
+	TYPE_FLOAT,                                     // REG_CH2_DUTYCYCLE
+	TYPE_FLOAT,                                     // REG_CH3_DUTYCYCLE
+	TYPE_U32,                                       // REG_CH0_COUNTS
+	TYPE_U32,                                       // REG_CH1_COUNTS
+	TYPE_U32,                                       // REG_CH2_COUNTS
+	TYPE_U32,                                       // REG_CH3_COUNTS
+	TYPE_FLOAT,                                     // REG_CH0_REAL_FREQ
+	TYPE_FLOAT,                                     // REG_CH1_REAL_FREQ
+	TYPE_FLOAT,                                     // REG_CH2_REAL_FREQ
+	TYPE_FLOAT,                                     // REG_CH3_REAL_FREQ
+	TYPE_FLOAT,                                     // REG_CH0_REAL_DUTYCYCLE
+	TYPE_FLOAT,                                     // REG_CH1_REAL_DUTYCYCLE
+	TYPE_FLOAT,                                     // REG_CH2_REAL_DUTYCYCLE
+	TYPE_FLOAT,                                     // REG_CH3_REAL_DUTYCYCLE
+	TYPE_U8,                                        // REG_CH0_MODE
+	TYPE_U8,                                        // REG_CH1_MODE
+	TYPE_U8,                                        // REG_CH2_MODE
+	TYPE_U8,                                        // REG_CH3_MODE
+	TYPE_U8,                                        // REG_TRG0_MASK
+	TYPE_U8,                                        // REG_TRG1_MASK
+	TYPE_U8,                                        // REG_TRG2_MASK
+	TYPE_U8,                                        // REG_TRG3_MASK
+	TYPE_U8,                                        // REG_START_PWM
+	TYPE_U8,                                        // REG_STOP_PWM
+	TYPE_U8,                                        // REG_CH_ENABLE_SINGLE
+	TYPE_U8,                                        // REG_RESERVED1
+	TYPE_U8,                                        // REG_TRG0_MODE
+	TYPE_U8,                                        // REG_TRG1_MODE
+	TYPE_U8,                                        // REG_TRG2_MODE
+	TYPE_U8,                                        // REG_TRG3_MODE
+	TYPE_U8,                                        // REG_CH_CONFEN
+	TYPE_U8,                                        // REG_CH_ENABLE
+	TYPE_U8,                                        // REG_TRGALL_MODE
+	TYPE_U8,                                        // REG_TRIG_STATE
+	TYPE_U8,                                        // REG_CH_STATE
+	TYPE_U8,                                        // REG_EXEC_STATE
+	TYPE_U8,                                        // REG_EVNT_ENABLE
+	TYPE_U8,                                        // REG_TRG_FMETER_EN
+	TYPE_U8,                                        // REG_TRG_FMETER_WINDOW
+	TYPE_U32,                                       // REG_TRG_PERIOD
+	TYPE_FLOAT,                                     // REG_TRG_FREQ
+	TYPE_FLOAT,                                     // REG_TRG_DUTYCYCLE
+	TYPE_U16,                                       // REG_CH_EXT_PERIOD
+	TYPE_U8,                                        // REG_CH_CHAIN
+	TYPE_U32,                                       // REG_VTRG_TABLE
+	TYPE_U8,                                        // REG_VTRG_MASK
+	TYPE_U8,                                        // REG_VTRG_MODE
+	TYPE_U16,                                       // REG_EVNT_COALESCE
+	TYPE_U8,                                        // REG_EXEC_BATCH
+	TYPE_U32,                                       // REG_CH_STATS
+	TYPE_U8,                                        // REG_CH_STATS_CTRL
+	TYPE_U32,                                       // REG_CH_REMAINING
+	TYPE_U16,                                       // REG_CH_PROGRESS
+	TYPE_U32,                                       // REG_PROF_ISR_COUNT
+	TYPE_U16,                                       // REG_PROF_ISR_MAX
+	TYPE_U16,                                       // REG_PROF_ISR_MEAN
+	TYPE_U16,                                       // REG_PROF_LATENCY_MAX
+	TYPE_FLOAT,                                     // REG_PROF_CPU_LOAD
+	TYPE_FLOAT,                                     // REG_CH0_CONFIG
+	TYPE_FLOAT,                                     // REG_CH1_CONFIG
+	TYPE_FLOAT,                                     // REG_CH2_CONFIG
+	TYPE_FLOAT,                                     // REG_CH3_CONFIG
+	TYPE_FLOAT,                                     // REG_CH_CONFIG_ALL
+	TYPE_FLOAT,                                     // REG_STAGE_CONFIG
+	TYPE_U8,                                        // REG_STAGE_COMMIT
+	TYPE_U8,                                        // REG_STAGE_TRIGGER
+	TYPE_U8,                                        // REG_PRESET_SAVE
+	TYPE_U8,                                        // REG_PRESET_LOAD
+	TYPE_U8,                                        // REG_PRESET_NAMES
+	TYPE_U8,                                        // REG_PRESET_TRIGGER
+	TYPE_FLOAT,                                     // REG_CH0_TRAIN
+	TYPE_FLOAT,                                     // REG_CH1_TRAIN
+	TYPE_FLOAT,                                     // REG_CH2_TRAIN
+	TYPE_FLOAT,                                     // REG_CH3_TRAIN
+	TYPE_U8,                                        // REG_TRAIN_LEVEL
+	TYPE_U8,                                        // REG_TRAIN_LOW
+	TYPE_U16,                                       // REG_PROF_LATENCY_MIN
+	TYPE_U16,                                       // REG_PROF_LATENCY_HIST
+	TYPE_U16,                                       // REG_PROF_SKEW_MAX
+	TYPE_U16                                        // REG_EVNT_DROPPED
+};
+
+uint16_t app_regs_n_elements[] = {
+	1,                                              // REG_CH0_FREQ
+	1,                                              // REG_CH1_FREQ
+	1,                                              // REG_CH2_FREQ
+	1,                                              // REG_CH3_FREQ
+	1,                                              // REG_CH0_DUTYCYCLE
+	1,                                              // REG_CH1_DUTYCYCLE
+	1,                                              // REG_CH2_DUTYCYCLE
+	1,                                              // REG_CH3_DUTYCYCLE
+	1,                                              // REG_CH0_COUNTS
+	1,                                              // REG_CH1_COUNTS
+	1,                                              // REG_CH2_COUNTS
+	1,                                              // REG_CH3_COUNTS
+	1,                                              // REG_CH0_REAL_FREQ
+	1,                                              // REG_CH1_REAL_FREQ
+	1,                                              // REG_CH2_REAL_FREQ
+	1,                                              // REG_CH3_REAL_FREQ
+	1,                                              // REG_CH0_REAL_DUTYCYCLE
+	1,                                              // REG_CH1_REAL_DUTYCYCLE
+	1,                                              // REG_CH2_REAL_DUTYCYCLE
+	1,                                              // REG_CH3_REAL_DUTYCYCLE
+	1,                                              // REG_CH0_MODE
+	1,                                              // REG_CH1_MODE
+	1,                                              // REG_CH2_MODE
+	1,                                              // REG_CH3_MODE
+	1,                                              // REG_TRG0_MASK
+	1,                                              // REG_TRG1_MASK
+	1,                                              // REG_TRG2_MASK
+	1,                                              // REG_TRG3_MASK
+	1,                                              // REG_START_PWM
+	1,                                              // REG_STOP_PWM
+	1,                                              // REG_CH_ENABLE_SINGLE
+	1,                                              // REG_RESERVED1
+	1,                                              // REG_TRG0_MODE
+	1,                                              // REG_TRG1_MODE
+	1,                                              // REG_TRG2_MODE
+	1,                                              // REG_TRG3_MODE
+	1,                                              // REG_CH_CONFEN
+	1,                                              // REG_CH_ENABLE
+	1,                                              // REG_TRGALL_MODE
+	1,                                              // REG_TRIG_STATE
+	1,                                              // REG_CH_STATE
+	1,                                              // REG_EXEC_STATE
+	1,                                              // REG_EVNT_ENABLE
+	1,                                              // REG_TRG_FMETER_EN
+	1,                                              // REG_TRG_FMETER_WINDOW
+	2,                                              // REG_TRG_PERIOD
+	2,                                              // REG_TRG_FREQ
+	2,                                              // REG_TRG_DUTYCYCLE
+	4,                                              // REG_CH_EXT_PERIOD
+	4,                                              // REG_CH_CHAIN
+	2,                                              // REG_VTRG_TABLE
+	2,                                              // REG_VTRG_MASK
+	2,                                              // REG_VTRG_MODE
+	1,                                              // REG_EVNT_COALESCE
+	3,                                              // REG_EXEC_BATCH
+	20,                                             // REG_CH_STATS
+	1,                                              // REG_CH_STATS_CTRL
+	4,                                              // REG_CH_REMAINING
+	4,                                              // REG_CH_PROGRESS
+	9,                                              // REG_PROF_ISR_COUNT
+	9,                                              // REG_PROF_ISR_MAX
+	9,                                              // REG_PROF_ISR_MEAN
+	1,                                              // REG_PROF_LATENCY_MAX
+	1,                                              // REG_PROF_CPU_LOAD
+	6,                                              // REG_CH0_CONFIG
+	6,                                              // REG_CH1_CONFIG
+	6,                                              // REG_CH2_CONFIG
+	6,                                              // REG_CH3_CONFIG
+	24,                                             // REG_CH_CONFIG_ALL
+	12,                                             // REG_STAGE_CONFIG
+	1,                                              // REG_STAGE_COMMIT
+	1,                                              // REG_STAGE_TRIGGER
+	1,                                              // REG_PRESET_SAVE
+	1,                                              // REG_PRESET_LOAD
+	32,                                             // REG_PRESET_NAMES
+	1,                                              // REG_PRESET_TRIGGER
+	3,                                              // REG_CH0_TRAIN
+	3,                                              // REG_CH1_TRAIN
+	3,                                              // REG_CH2_TRAIN
+	3,                                              // REG_CH3_TRAIN
+	4,                                              // REG_TRAIN_LEVEL
+	1,                                              // REG_TRAIN_LOW
+	1,                                              // REG_PROF_LATENCY_MIN
+	8,                                              // REG_PROF_LATENCY_HIST
+	1,                                              // REG_PROF_SKEW_MAX
+	1                                               // REG_EVNT_DROPPED
+};
+
+uint8_t *app_regs_pointer[] = {
+	(uint8_t*)(&app_regs.REG_CH0_FREQ),             // REG_CH0_FREQ
+	(uint8_t*)(&app_regs.REG_CH1_FREQ),             // REG_CH1_FREQ
+	(uint8_t*)(&app_regs.REG_CH2_FREQ),             // REG_CH2_FREQ
+	(uint8_t*)(&app_regs.REG_CH3_FREQ),             // REG_CH3_FREQ
+	(uint8_t*)(&app_regs.REG_CH0_DUTYCYCLE),        // REG_CH0_DUTYCYCLE
+	(uint8_t*)(&app_regs.REG_CH1_DUTYCYCLE),        // REG_CH1_DUTYCYCLE
+	(uint8_t*)(&app_regs.REG_CH2_DUTYCYCLE),        // REG_CH2_DUTYCYCLE
+	(uint8_t*)(&app_regs.REG_CH3_DUTYCYCLE),        // REG_CH3_DUTYCYCLE
+	(uint8_t*)(&app_regs.REG_CH0_COUNTS),           // REG_CH0_COUNTS
+	(uint8_t*)(&app_regs.REG_CH1_COUNTS),           // REG_CH1_COUNTS
+	(uint8_t*)(&app_regs.REG_CH2_COUNTS),           // REG_CH2_COUNTS
+	(uint8_t*)(&app_regs.REG_CH3_COUNTS),           // REG_CH3_COUNTS
+	(uint8_t*)(&app_regs.REG_CH0_REAL_FREQ),        // REG_CH0_REAL_FREQ
+	(uint8_t*)(&app_regs.REG_CH1_REAL_FREQ),        // REG_CH1_REAL_FREQ
+	(uint8_t*)(&app_regs.REG_CH2_REAL_FREQ),        // REG_CH2_REAL_FREQ
+	(uint8_t*)(&app_regs.REG_CH3_REAL_FREQ),        // REG_CH3_REAL_FREQ
+	(uint8_t*)(&app_regs.REG_CH0_REAL_DUTYCYCLE),   // REG_CH0_REAL_DUTYCYCLE
+	(uint8_t*)(&app_regs.REG_CH1_REAL_DUTYCYCLE),   // REG_CH1_REAL_DUTYCYCLE
+	(uint8_t*)(&app_regs.REG_CH2_REAL_DUTYCYCLE),   // REG_CH2_REAL_DUTYCYCLE
+	(uint8_t*)(&app_regs.REG_CH3_REAL_DUTYCYCLE),   // REG_CH3_REAL_DUTYCYCLE
+	(uint8_t*)(&app_regs.REG_CH0_MODE),             // REG_CH0_MODE
+	(uint8_t*)(&app_regs.REG_CH1_MODE),             // REG_CH1_MODE
+	(uint8_t*)(&app_regs.REG_CH2_MODE),             // REG_CH2_MODE
+	(uint8_t*)(&app_regs.REG_CH3_MODE),             // REG_CH3_MODE
+	(uint8_t*)(&app_regs.REG_TRG0_MASK),            // REG_TRG0_MASK
+	(uint8_t*)(&app_regs.REG_TRG1_MASK),            // REG_TRG1_MASK
+	(uint8_t*)(&app_regs.REG_TRG2_MASK),            // REG_TRG2_MASK
+	(uint8_t*)(&app_regs.REG_TRG3_MASK),            // REG_TRG3_MASK
+	(uint8_t*)(&app_regs.REG_START_PWM),            // REG_START_PWM
+	(uint8_t*)(&app_regs.REG_STOP_PWM),             // REG_STOP_PWM
+	(uint8_t*)(&app_regs.REG_CH_ENABLE_SINGLE),     // REG_CH_ENABLE_SINGLE
+	(uint8_t*)(&app_regs.REG_RESERVED1),            // REG_RESERVED1
+	(uint8_t*)(&app_regs.REG_TRG0_MODE),            // REG_TRG0_MODE
+	(uint8_t*)(&app_regs.REG_TRG1_MODE),            // REG_TRG1_MODE
+	(uint8_t*)(&app_regs.REG_TRG2_MODE),            // REG_TRG2_MODE
+	(uint8_t*)(&app_regs.REG_TRG3_MODE),            // REG_TRG3_MODE
+	(uint8_t*)(&app_regs.REG_CH_CONFEN),            // REG_CH_CONFEN
+	(uint8_t*)(&app_regs.REG_CH_ENABLE),            // REG_CH_ENABLE
+	(uint8_t*)(&app_regs.REG_TRGALL_MODE),          // REG_TRGALL_MODE
+	(uint8_t*)(&app_regs.REG_TRIG_STATE),           // REG_TRIG_STATE
+	(uint8_t*)(&app_regs.REG_CH_STATE),             // REG_CH_STATE
+	(uint8_t*)(&app_regs.REG_EXEC_STATE),           // REG_EXEC_STATE
+	(uint8_t*)(&app_regs.REG_EVNT_ENABLE),          // REG_EVNT_ENABLE
+	(uint8_t*)(&app_regs.REG_TRG_FMETER_EN),        // REG_TRG_FMETER_EN
+	(uint8_t*)(&app_regs.REG_TRG_FMETER_WINDOW),    // REG_TRG_FMETER_WINDOW
+	(uint8_t*)(app_regs.REG_TRG_PERIOD),            // REG_TRG_PERIOD
+	(uint8_t*)(app_regs.REG_TRG_FREQ),              // REG_TRG_FREQ
+	(uint8_t*)(app_regs.REG_TRG_DUTYCYCLE),         // REG_TRG_DUTYCYCLE
+	(uint8_t*)(app_regs.REG_CH_EXT_PERIOD),         // REG_CH_EXT_PERIOD
+	(uint8_t*)(app_regs.REG_CH_CHAIN),              // REG_CH_CHAIN
+	(uint8_t*)(app_regs.REG_VTRG_TABLE),            // REG_VTRG_TABLE
+	(uint8_t*)(app_regs.REG_VTRG_MASK),             // REG_VTRG_MASK
+	(uint8_t*)(app_regs.REG_VTRG_MODE),             // REG_VTRG_MODE
+	(uint8_t*)(&app_regs.REG_EVNT_COALESCE),        // REG_EVNT_COALESCE
+	(uint8_t*)(app_regs.REG_EXEC_BATCH),            // REG_EXEC_BATCH
+	(uint8_t*)(app_regs.REG_CH_STATS),              // REG_CH_STATS
+	(uint8_t*)(&app_regs.REG_CH_STATS_CTRL),        // REG_CH_STATS_CTRL
+	(uint8_t*)(app_regs.REG_CH_REMAINING),          // REG_CH_REMAINING
+	(uint8_t*)(app_regs.REG_CH_PROGRESS),           // REG_CH_PROGRESS
+	(uint8_t*)(app_regs.REG_PROF_ISR_COUNT),        // REG_PROF_ISR_COUNT
+	(uint8_t*)(app_regs.REG_PROF_ISR_MAX),          // REG_PROF_ISR_MAX
+	(uint8_t*)(app_regs.REG_PROF_ISR_MEAN),         // REG_PROF_ISR_MEAN
+	(uint8_t*)(&app_regs.REG_PROF_LATENCY_MAX),     // REG_PROF_LATENCY_MAX
+	(uint8_t*)(&app_regs.REG_PROF_CPU_LOAD),        // REG_PROF_CPU_LOAD
+	(uint8_t*)(app_regs.REG_CH0_CONFIG),            // REG_CH0_CONFIG
+	(uint8_t*)(app_regs.REG_CH1_CONFIG),            // REG_CH1_CONFIG
+	(uint8_t*)(app_regs.REG_CH2_CONFIG),            // REG_CH2_CONFIG
+	(uint8_t*)(app_regs.REG_CH3_CONFIG),            // REG_CH3_CONFIG
+	(uint8_t*)(app_regs.REG_CH_CONFIG_ALL),         // REG_CH_CONFIG_ALL
+	(uint8_t*)(app_regs.REG_STAGE_CONFIG),          // REG_STAGE_CONFIG
+	(uint8_t*)(&app_regs.REG_STAGE_COMMIT),         // REG_STAGE_COMMIT
+	(uint8_t*)(&app_regs.REG_STAGE_TRIGGER),        // REG_STAGE_TRIGGER
+	(uint8_t*)(&app_regs.REG_PRESET_SAVE),          // REG_PRESET_SAVE
+	(uint8_t*)(&app_regs.REG_PRESET_LOAD),          // REG_PRESET_LOAD
+	(uint8_t*)(app_regs.REG_PRESET_NAMES),          // REG_PRESET_NAMES
+	(uint8_t*)(&app_regs.REG_PRESET_TRIGGER),       // REG_PRESET_TRIGGER
+	(uint8_t*)(app_regs.REG_CH0_TRAIN),             // REG_CH0_TRAIN
+	(uint8_t*)(app_regs.REG_CH1_TRAIN),             // REG_CH1_TRAIN
+	(uint8_t*)(app_regs.REG_CH2_TRAIN),             // REG_CH2_TRAIN
+	(uint8_t*)(app_regs.REG_CH3_TRAIN),             // REG_CH3_TRAIN
+	(uint8_t*)(app_regs.REG_TRAIN_LEVEL),           // REG_TRAIN_LEVEL
+	(uint8_t*)(&app_regs.REG_TRAIN_LOW),            // REG_TRAIN_LOW
+	(uint8_t*)(&app_regs.REG_PROF_LATENCY_MIN),     // REG_PROF_LATENCY_MIN
+	(uint8_t*)(app_regs.REG_PROF_LATENCY_HIST),     // REG_PROF_LATENCY_HIST
+	(uint8_t*)(&app_regs.REG_PROF_SKEW_MAX),        // REG_PROF_SKEW_MAX
+	(uint8_t*)(&app_regs.REG_EVNT_DROPPED)          // REG_EVNT_DROPPED
+};
+
+void (*app_func_rd_pointer[])(void) = {
+	0,                                              // REG_CH0_FREQ
+	0,                                              // REG_CH1_FREQ
+	0,                                              // REG_CH2_FREQ
+	0,                                              // REG_CH3_FREQ
+	0,                                              // REG_CH0_DUTYCYCLE
+	0,                                              // REG_CH1_DUTYCYCLE
+	0,                                              // REG_CH2_DUTYCYCLE
+	0,                                              // REG_CH3_DUTYCYCLE
+	0,                                              // REG_CH0_COUNTS
+	0,                                              // REG_CH1_COUNTS
+	0,                                              // REG_CH2_COUNTS
+	0,                                              // REG_CH3_COUNTS
+	&app_read_REG_CH0_REAL_FREQ,                    // REG_CH0_REAL_FREQ
+	&app_read_REG_CH1_REAL_FREQ,                    // REG_CH1_REAL_FREQ
+	&app_read_REG_CH2_REAL_FREQ,                    // REG_CH2_REAL_FREQ
+	&app_read_REG_CH3_REAL_FREQ,                    // REG_CH3_REAL_FREQ
+	&app_read_REG_CH0_REAL_DUTYCYCLE,               // REG_CH0_REAL_DUTYCYCLE
+	&app_read_REG_CH1_REAL_DUTYCYCLE,               // REG_CH1_REAL_DUTYCYCLE
+	&app_read_REG_CH2_REAL_DUTYCYCLE,               // REG_CH2_REAL_DUTYCYCLE
+	&app_read_REG_CH3_REAL_DUTYCYCLE,               // REG_CH3_REAL_DUTYCYCLE
+	0,                                              // REG_CH0_MODE
+	0,                                              // REG_CH1_MODE
+	0,                                              // REG_CH2_MODE
+	0,                                              // REG_CH3_MODE
+	0,                                              // REG_TRG0_MASK
+	0,                                              // REG_TRG1_MASK
+	0,                                              // REG_TRG2_MASK
+	0,                                              // REG_TRG3_MASK
+	&app_read_REG_START_PWM,                        // REG_START_PWM
+	&app_read_REG_STOP_PWM,                         // REG_STOP_PWM
+	0,                                              // REG_CH_ENABLE_SINGLE
+	0,                                              // REG_RESERVED1
+	0,                                              // REG_TRG0_MODE
+	0,                                              // REG_TRG1_MODE
+	0,                                              // REG_TRG2_MODE
+	0,                                              // REG_TRG3_MODE
+	0,                                              // REG_CH_CONFEN
+	0,                                              // REG_CH_ENABLE
+	0,                                              // REG_TRGALL_MODE
+	&app_read_REG_TRIG_STATE,                       // REG_TRIG_STATE
+	&app_read_REG_CH_STATE,                         // REG_CH_STATE
+	&app_read_REG_EXEC_STATE,                       // REG_EXEC_STATE
+	0,                                              // REG_EVNT_ENABLE
+	0,                                              // REG_TRG_FMETER_EN
+	0,                                              // REG_TRG_FMETER_WINDOW
+	0,                                              // REG_TRG_PERIOD
+	0,                                              // REG_TRG_FREQ
+	0,                                              // REG_TRG_DUTYCYCLE
+	0,                                              // REG_CH_EXT_PERIOD
+	0,                                              // REG_CH_CHAIN
+	0,                                              // REG_VTRG_TABLE
+	0,                                              // REG_VTRG_MASK
+	0,                                              // REG_VTRG_MODE
+	0,                                              // REG_EVNT_COALESCE
+	0,                                              // REG_EXEC_BATCH
+	&app_read_REG_CH_STATS,                         // REG_CH_STATS
+	0,                                              // REG_CH_STATS_CTRL
+	&app_read_REG_CH_REMAINING,                     // REG_CH_REMAINING
+	0,                                              // REG_CH_PROGRESS
+	&app_read_REG_PROF_ISR_COUNT,                   // REG_PROF_ISR_COUNT
+	&app_read_REG_PROF_ISR_MAX,                     // REG_PROF_ISR_MAX
+	&app_read_REG_PROF_ISR_MEAN,                    // REG_PROF_ISR_MEAN
+	&app_read_REG_PROF_LATENCY_MAX,                 // REG_PROF_LATENCY_MAX
+	&app_read_REG_PROF_CPU_LOAD,                    // REG_PROF_CPU_LOAD
+	&app_read_REG_CH0_CONFIG,                       // REG_CH0_CONFIG
+	&app_read_REG_CH1_CONFIG,                       // REG_CH1_CONFIG
+	&app_read_REG_CH2_CONFIG,                       // REG_CH2_CONFIG
+	&app_read_REG_CH3_CONFIG,                       // REG_CH3_CONFIG
+	&app_read_REG_CH_CONFIG_ALL,                    // REG_CH_CONFIG_ALL
+	0,                                              // REG_STAGE_CONFIG
+	0,                                              // REG_STAGE_COMMIT
+	0,                                              // REG_STAGE_TRIGGER
+	0,                                              // REG_PRESET_SAVE
+	0,                                              // REG_PRESET_LOAD
+	0,                                              // REG_PRESET_NAMES
+	0,                                              // REG_PRESET_TRIGGER
+	0,                                              // REG_CH0_TRAIN
+	0,                                              // REG_CH1_TRAIN
+	0,                                              // REG_CH2_TRAIN
+	0,                                              // REG_CH3_TRAIN
+	0,                                              // REG_TRAIN_LEVEL
+	0,                                              // REG_TRAIN_LOW
+	&app_read_REG_PROF_LATENCY_MIN,                 // REG_PROF_LATENCY_MIN
+	&app_read_REG_PROF_LATENCY_HIST,                // REG_PROF_LATENCY_HIST
+	&app_read_REG_PROF_SKEW_MAX,                    // REG_PROF_SKEW_MAX
+	&app_read_REG_EVNT_DROPPED                      // REG_EVNT_DROPPED
+};
+
+bool (*app_func_wr_pointer[])(void*) = {
+	&app_write_REG_CH0_FREQ,                        // REG_CH0_FREQ
+	&app_write_REG_CH1_FREQ,                        // REG_CH1_FREQ
+	&app_write_REG_CH2_FREQ,                        // REG_CH2_FREQ
+	&app_write_REG_CH3_FREQ,                        // REG_CH3_FREQ
+	&app_write_REG_CH0_DUTYCYCLE,                   // REG_CH0_DUTYCYCLE
+	&app_write_REG_CH1_DUTYCYCLE,                   // REG_CH1_DUTYCYCLE
+	&app_write_REG_CH2_DUTYCYCLE,                   // REG_CH2_DUTYCYCLE
+	&app_write_REG_CH3_DUTYCYCLE,                   // REG_CH3_DUTYCYCLE
+	&app_write_REG_CH0_COUNTS,                      // REG_CH0_COUNTS
+	&app_write_REG_CH1_COUNTS,                      // REG_CH1_COUNTS
+	&app_write_REG_CH2_COUNTS,                      // REG_CH2_COUNTS
+	&app_write_REG_CH3_COUNTS,                      // REG_CH3_COUNTS
+	0,                                              // REG_CH0_REAL_FREQ
+	0,                                              // REG_CH1_REAL_FREQ
+	0,                                              // REG_CH2_REAL_FREQ
+	0,                                              // REG_CH3_REAL_FREQ
+	0,                                              // REG_CH0_REAL_DUTYCYCLE
+	0,                                              // REG_CH1_REAL_DUTYCYCLE
+	0,                                              // REG_CH2_REAL_DUTYCYCLE
+	0,                                              // REG_CH3_REAL_DUTYCYCLE
+	&app_write_REG_CH0_MODE,                        // REG_CH0_MODE
+	&app_write_REG_CH1_MODE,                        // REG_CH1_MODE
+	&app_write_REG_CH2_MODE,                        // REG_CH2_MODE
+	&app_write_REG_CH3_MODE,                        // REG_CH3_MODE
+	&app_write_REG_TRG0_MASK,                       // REG_TRG0_MASK
+	&app_write_REG_TRG1_MASK,                       // REG_TRG1_MASK
+	&app_write_REG_TRG2_MASK,                       // REG_TRG2_MASK
+	&app_write_REG_TRG3_MASK,                       // REG_TRG3_MASK
+	&app_write_REG_START_PWM,                       // REG_START_PWM
+	&app_write_REG_STOP_PWM,                        // REG_STOP_PWM
+	0,                                              // REG_CH_ENABLE_SINGLE
+	0,                                              // REG_RESERVED1
+	&app_write_REG_TRG0_MODE,                       // REG_TRG0_MODE
+	&app_write_REG_TRG1_MODE,                       // REG_TRG1_MODE
+	&app_write_REG_TRG2_MODE,                       // REG_TRG2_MODE
+	&app_write_REG_TRG3_MODE,                       // REG_TRG3_MODE
+	&app_write_REG_CH_CONFEN,                       // REG_CH_CONFEN
+	&app_write_REG_CH_ENABLE,                       // REG_CH_ENABLE
+	0,                                              // REG_TRGALL_MODE
+	0,                                              // REG_TRIG_STATE
+	0,                                              // REG_CH_STATE
+	0,                                              // REG_EXEC_STATE
+	0,                                              // REG_EVNT_ENABLE
+	&app_write_REG_TRG_FMETER_EN,                   // REG_TRG_FMETER_EN
+	&app_write_REG_TRG_FMETER_WINDOW,               // REG_TRG_FMETER_WINDOW
+	0,                                              // REG_TRG_PERIOD
+	0,                                              // REG_TRG_FREQ
+	0,                                              // REG_TRG_DUTYCYCLE
+	&app_write_REG_CH_EXT_PERIOD,                   // REG_CH_EXT_PERIOD
+	0,                                              // REG_CH_CHAIN
+	&app_write_REG_VTRG_TABLE,                      // REG_VTRG_TABLE
+	0,                                              // REG_VTRG_MASK
+	0,                                              // REG_VTRG_MODE
+	0,                                              // REG_EVNT_COALESCE
+	0,                                              // REG_EXEC_BATCH
+	&app_write_REG_CH_STATS,                        // REG_CH_STATS
+	0,                                              // REG_CH_STATS_CTRL
+	0,                                              // REG_CH_REMAINING
+	&app_write_REG_CH_PROGRESS,                     // REG_CH_PROGRESS
+	&app_write_REG_PROF_ISR_COUNT,                  // REG_PROF_ISR_COUNT
+	0,                                              // REG_PROF_ISR_MAX
+	0,                                              // REG_PROF_ISR_MEAN
+	0,                                              // REG_PROF_LATENCY_MAX
+	0,                                              // REG_PROF_CPU_LOAD
+	&app_write_REG_CH0_CONFIG,                      // REG_CH0_CONFIG
+	&app_write_REG_CH1_CONFIG,                      // REG_CH1_CONFIG
+	&app_write_REG_CH2_CONFIG,                      // REG_CH2_CONFIG
+	&app_write_REG_CH3_CONFIG,                      // REG_CH3_CONFIG
+	&app_write_REG_CH_CONFIG_ALL,                   // REG_CH_CONFIG_ALL
+	&app_write_REG_STAGE_CONFIG,                    // REG_STAGE_CONFIG
+	&app_write_REG_STAGE_COMMIT,                    // REG_STAGE_COMMIT
+	0,                                              // REG_STAGE_TRIGGER
+	&app_write_REG_PRESET_SAVE,                     // REG_PRESET_SAVE
+	&app_write_REG_PRESET_LOAD,                     // REG_PRESET_LOAD
+	&app_write_REG_PRESET_NAMES,                    // REG_PRESET_NAMES
+	0,                                              // REG_PRESET_TRIGGER
+	&app_write_REG_CH0_TRAIN,                       // REG_CH0_TRAIN
+	&app_write_REG_CH1_TRAIN,                       // REG_CH1_TRAIN
+	&app_write_REG_CH2_TRAIN,                       // REG_CH2_TRAIN
+	&app_write_REG_CH3_TRAIN,                       // REG_CH3_TRAIN
+	&app_write_REG_TRAIN_LEVEL,                     // REG_TRAIN_LEVEL
+	0,                                              // REG_TRAIN_LOW
+	0,                                              // REG_PROF_LATENCY_MIN
+	0,                                              // REG_PROF_LATENCY_HIST
+	0,                                              // REG_PROF_SKEW_MAX
+	0                                               // REG_EVNT_DROPPED
+};
+
+const app_reg_range_t app_regs_ranges[] = {
+	{{.f = 0.5}, {.f = 32768}},                                                     // 0
+	{{.f = 0.1}, {.f = 99.9}},                                                      // 1
+	{{.u = 1}, {.u = UINT32_MAX}},                                                  // 2
+	{{.u = 1}, {.u = UINT8_MAX}},                                                   // 3
+	{{.u = 2}, {.u = UINT16_MAX}},                                                  // 4
+	{{.u = 0}, {.u = 15}},                                                          // 5
+	{{.u = 0}, {.u = 2}},                                                           // 6
+	{{.u = 0}, {.u = 50000}},                                                       // 7
+	{{.u = 0}, {.u = 3}},                                                           // 8
+	{{.u = 0}, {.u = 0}}                                                            // 9
+};
+
+const app_reg_desc_t app_regs_desc[] = {
+	{REG_DESC_RANGE, 0x00, 0},                                                      // PwmChannel0Frequency
+	{REG_DESC_RANGE, 0x00, 0},                                                      // PwmChannel1Frequency
+	{REG_DESC_RANGE, 0x00, 0},                                                      // PwmChannel2Frequency
+	{REG_DESC_RANGE, 0x00, 0},                                                      // PwmChannel3Frequency
+	{REG_DESC_RANGE, 0x00, 1},                                                      // PwmChannel0DutyCycle
+	{REG_DESC_RANGE, 0x00, 1},                                                      // PwmChannel1DutyCycle
+	{REG_DESC_RANGE, 0x00, 1},                                                      // PwmChannel2DutyCycle
+	{REG_DESC_RANGE, 0x00, 1},                                                      // PwmChannel3DutyCycle
+	{REG_DESC_RANGE, 0x00, 2},                                                      // PwmChannel0PulseCount
+	{REG_DESC_RANGE, 0x00, 2},                                                      // PwmChannel1PulseCount
+	{REG_DESC_RANGE, 0x00, 2},                                                      // PwmChannel2PulseCount
+	{REG_DESC_RANGE, 0x00, 2},                                                      // PwmChannel3PulseCount
+	{REG_DESC_READ_ONLY, 0x00, 0},                                                  // PwmChannel0RealFrequency
+	{REG_DESC_READ_ONLY, 0x00, 0},                                                  // PwmChannel1RealFrequency
+	{REG_DESC_READ_ONLY, 0x00, 0},                                                  // PwmChannel2RealFrequency
+	{REG_DESC_READ_ONLY, 0x00, 0},                                                  // PwmChannel3RealFrequency
+	{REG_DESC_READ_ONLY, 0x00, 0},                                                  // PwmChannel0RealDutyCycle
+	{REG_DESC_READ_ONLY, 0x00, 0},                                                  // PwmChannel1RealDutyCycle
+	{REG_DESC_READ_ONLY, 0x00, 0},                                                  // PwmChannel2RealDutyCycle
+	{REG_DESC_READ_ONLY, 0x00, 0},                                                  // PwmChannel3RealDutyCycle
+	{REG_DESC_MASK, 0x31, 0},                                                       // PwmChannel0PlaybackMode
+	{REG_DESC_MASK, 0x31, 0},                                                       // PwmChannel1PlaybackMode
+	{REG_DESC_MASK, 0x31, 0},                                                       // PwmChannel2PlaybackMode
+	{REG_DESC_MASK, 0x31, 0},                                                       // PwmChannel3PlaybackMode
+	{REG_DESC_MASK, 0x0F, 0},                                                       // Trigger0Targets
+	{REG_DESC_MASK, 0x0F, 0},                                                       // Trigger1Targets
+	{REG_DESC_MASK, 0x0F, 0},                                                       // Trigger2Targets
+	{REG_DESC_MASK, 0x0F, 0},                                                       // Trigger3Targets
+	{REG_DESC_MASK, 0x0F, 0},                                                       // StartSoftwareTrigger
+	{REG_DESC_MASK, 0x0F, 0},                                                       // StopSoftwareTrigger
+	{REG_DESC_MASK, 0x0F, 0},                                                       // ArmPwmChannels
+	{REG_DESC_READ_ONLY, 0x00, 0},                                                  // Reserved0
+	{REG_DESC_MASK, 0x0B, 0},                                                       // Trigger0Mode
+	{REG_DESC_MASK, 0x0B, 0},                                                       // Trigger1Mode
+	{REG_DESC_MASK, 0x0B, 0},                                                       // Trigger2Mode
+	{REG_DESC_MASK, 0x0B, 0},                                                       // Trigger3Mode
+	{REG_DESC_MASK, 0x0F, 0},                                                       // RequestEnable
+	{REG_DESC_MASK, 0x0F, 0},                                                       // EnablePwmChannels
+	{REG_DESC_MASK, 0x0B, 0},                                                       // TriggerAllMode
+	{REG_DESC_READ_ONLY, 0x00, 0},                                                  // TriggerChannelState
+	{REG_DESC_READ_ONLY, 0x00, 0},                                                  // PwmChannelState
+	{REG_DESC_READ_ONLY, 0x00, 0},                                                  // PwmState
+	{REG_DESC_MASK, 0x0F, 0},                                                       // EnableEvents
+	{REG_DESC_MASK, 0x03, 0},                                                       // FrequencyMeterEnable
+	{REG_DESC_RANGE, 0x00, 3},                                                      // FrequencyMeterWindow
+	{REG_DESC_READ_ONLY, 0x00, 0},                                                  // TriggerPeriod
+	{REG_DESC_READ_ONLY, 0x00, 0},                                                  // TriggerFrequency
+	{REG_DESC_READ_ONLY, 0x00, 0},                                                  // TriggerDutyCycle
+	{REG_DESC_RANGE, 0x00, 4},                                                      // PwmExternalClockPeriod
+	{REG_DESC_RANGE, 0x00, 5},                                                      // PwmChainedChannels
+	{0, 0x00, 0},                                                                   // VirtualTriggerTable
+	{REG_DESC_RANGE, 0x00, 5},                                                      // VirtualTriggerMask
+	{REG_DESC_RANGE, 0x00, 6},                                                      // VirtualTriggerMode
+	{REG_DESC_RANGE, 0x00, 7},                                                      // EventCoalesceWindow
+	{REG_DESC_READ_ONLY, 0x00, 0},                                                  // PwmStateBatch
+	{0, 0x00, 0},                                                                   // PwmStatistics
+	{REG_DESC_MASK, 0x01, 0},                                                       // PwmStatisticsControl
+	{REG_DESC_READ_ONLY, 0x00, 0},                                                  // PwmRemainingCount
+	{0, 0x00, 0},                                                                   // PwmProgressInterval
+	{0, 0x00, 0},                                                                   // ProfilingInterruptCount
+	{REG_DESC_READ_ONLY, 0x00, 0},                                                  // ProfilingInterruptMaxCycles
+	{REG_DESC_READ_ONLY, 0x00, 0},                                                  // ProfilingInterruptMeanCycles
+	{REG_DESC_READ_ONLY, 0x00, 0},                                                  // ProfilingMaxLatency
+	{REG_DESC_READ_ONLY, 0x00, 0},                                                  // ProfilingCpuLoad
+	{0, 0x00, 0},                                                                   // Channel0Configuration
+	{0, 0x00, 0},                                                                   // Channel1Configuration
+	{0, 0x00, 0},                                                                   // Channel2Configuration
+	{0, 0x00, 0},                                                                   // Channel3Configuration
+	{0, 0x00, 0},                                                                   // ChannelsConfiguration
+	{0, 0x00, 0},                                                                   // StagedConfiguration
+	{REG_DESC_MASK, 0x8F, 0},                                                       // CommitStagedConfiguration
+	{REG_DESC_MASK, 0x1F, 0},                                                       // CommitTriggers
+	{REG_DESC_RANGE, 0x00, 8},                                                      // SavePreset
+	{REG_DESC_RANGE, 0x00, 8},                                                      // LoadPreset
+	{0, 0x00, 0},                                                                   // PresetNames
+	{REG_DESC_MASK, 0x1F, 0},                                                       // PresetTriggers
+	{0, 0x00, 0},                                                                   // Channel0Train
+	{0, 0x00, 0},                                                                   // Channel1Train
+	{0, 0x00, 0},                                                                   // Channel2Train
+	{0, 0x00, 0},                                                                   // Channel3Train
+	{REG_DESC_RANGE, 0x00, 9},                                                      // TrainQueueLevel
+	{REG_DESC_RANGE, 0x00, 8},                                                      // TrainQueueLow
+	{REG_DESC_READ_ONLY, 0x00, 0},                                                  // ProfilingMinLatency
+	{REG_DESC_READ_ONLY, 0x00, 0},                                                  // ProfilingLatencyHistogram
+	{REG_DESC_READ_ONLY, 0x00, 0},                                                  // ProfilingMaxSkew
+	{REG_DESC_READ_ONLY, 0x00, 0}                                                   // DroppedEvents
+};
@@ -0,0 +1,349 @@
+#include <util/atomic.h>
+
+#include "cpu.h"
+#include "hwbp_core.h"
+#include "app_ios_and_regs.h"
+#include "pwm_gen_functions.h"
+#include "event_queue_functions.h"
+
+extern AppRegs app_regs;
+extern void update_enabled_pwmx(void);
+
+/************************************************************************/
+/* Event queue                                                          */
+/*                                                                      */
+/* The interrupts only store the new register value and the time of     */
+/* the change, which takes a bounded handful of cycles. The Harp frame  */
+/* is built and sent later by the drain, using the stored time as the   */
+/* event's timestamp.                                                   */
+/*                                                                      */
+/* Each interrupt level pushes to a ring of its own, so every ring has  */
+/* a single producer and a single consumer, the drain. The producer     */
+/* only writes the head, after the entry is complete, and the drain     */
+/* only writes the tail, after copying the entry, so neither of them    */
+/* needs to block the interrupts. An interrupt of the same level never  */
+/* preempts the producer, and the main loop doesn't push. The drain     */
+/* merges the rings in timestamp order.                                 */
+/*                                                                      */
+/* A full ring drops the new entry and counts it on its level's         */
+/* counter, which only its producer writes. REG_EVNT_DROPPED reports    */
+/* the sum of the three counters.                                       */
+/************************************************************************/
+#define EVT_QUEUE_LEVELS 3
+
+typedef struct
+{
+	uint8_t add;
+	uint8_t value;
+	uint32_t seconds;
+	uint16_t useconds;
+} evt_entry_t;
+
+static volatile evt_entry_t evt_queue[EVT_QUEUE_LEVELS][EVT_QUEUE_SIZE];
+static volatile uint8_t evt_head[EVT_QUEUE_LEVELS];
+static volatile uint8_t evt_tail[EVT_QUEUE_LEVELS];
+static volatile uint16_t evt_dropped[EVT_QUEUE_LEVELS];
+static volatile bool leds_requested = false;
+
+/* A clear drops the entries pushed before it, the drain applies it */
+static volatile uint8_t clear_head[EVT_QUEUE_LEVELS];
+static volatile uint8_t clear_exec_state;
+static volatile bool clear_requested = false;
+
+/************************************************************************/
+/* REG_EXEC_STATE                                                       */
+/*                                                                      */
+/* The register is a shadow of pwm_exec_state that the core reads as    */
+/* any other register. A host read copies the current state into it.    */
+/* The drain writes the entry's value into it while the event is sent,  */
+/* since the state keeps changing in the meantime, and a read that      */
+/* preempts the drain then gets the value being sent instead of         */
+/* overwriting it.                                                      */
+/************************************************************************/
+static volatile bool exec_state_sending = false;
+
+/************************************************************************/
+/* Coalescing                                                           */
+/*                                                                      */
+/* When REG_EVNT_COALESCE is not zero, the changes of REG_EXEC_STATE    */
+/* are merged into REG_EXEC_BATCH until the window, counted from the    */
+/* first change, elapses. The event is sent with the timestamp of the   */
+/* first change. The queue is drained every 500 us, so this is also the */
+/* resolution of the window.                                            */
+/************************************************************************/
+static uint8_t last_exec_state = 0;
+static bool batch_pending = false;
+static uint32_t batch_seconds;
+static uint16_t batch_useconds;
+
+static void read_timestamp(uint32_t *seconds, uint16_t *useconds)
+{
+	*seconds = core_func_read_R_TIMESTAMP_SECOND();
+	*useconds = core_func_read_R_TIMESTAMP_MICRO();
+	
+	/* The microseconds may have wrapped between the two readings */
+	if (core_func_read_R_TIMESTAMP_SECOND() != *seconds)
+	{
+		*seconds = core_func_read_R_TIMESTAMP_SECOND();
+		*useconds = core_func_read_R_TIMESTAMP_MICRO();
+	}
+}
+
+/* Only the interrupts push, each on the ring of the level it runs at.  */
+/* The main loop runs with no level executing, so a push from it would  */
+/* take level 0 and break the single producer of the low level ring.    */
+static uint8_t producer_level(void)
+{
+	if (PMIC.STATUS & PMIC_HILVLEX_bm)
+		return 2;
+	
+	if (PMIC.STATUS & PMIC_MEDLVLEX_bm)
+		return 1;
+	
+	return 0;
+}
+
+static void push(uint8_t add, uint8_t value)
+{
+	uint32_t seconds;
+	uint16_t useconds;
+	
+	read_timestamp(&seconds, &useconds);
+	
+	uint8_t level = producer_level();
+	uint8_t head = evt_head[level];
+	uint8_t next = (head + 1) & (EVT_QUEUE_SIZE - 1);
+	
+	/* When full, the oldest entries are kept since they are the ones in flight */
+	if (next == evt_tail[level])
+	{
+		if (evt_dropped[level] != UINT16_MAX)
+			evt_dropped[level]++;
+		return;
+	}
+	
+	volatile evt_entry_t *entry = &evt_queue[level][head];
+	entry->add = add;
+	entry->value = value;
+	entry->seconds = seconds;
+	entry->useconds = useconds;
+	
+	evt_head[level] = next;
+}
+
+void hwbp_app_evt_queue_push_exec_state(void)
+{
+	push(ADD_REG_EXEC_STATE, pwm_exec_state);
+}
+
+void hwbp_app_evt_queue_push_progress(void)
+{
+	push(ADD_REG_CH_REMAINING, 0);
+}
+
+void hwbp_app_evt_queue_push_train_level(void)
+{
+	push(ADD_REG_TRAIN_LEVEL, 0);
+}
+
+void hwbp_app_evt_queue_clear(void)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		for (uint8_t level = 0; level < EVT_QUEUE_LEVELS; level++)
+			clear_head[level] = evt_head[level];
+		
+		clear_exec_state = pwm_exec_state;
+		clear_requested = true;
+	}
+}
+
+static void apply_clear(void)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		for (uint8_t level = 0; level < EVT_QUEUE_LEVELS; level++)
+			evt_tail[level] = clear_head[level];
+		
+		last_exec_state = clear_exec_state;
+		clear_requested = false;
+	}
+	
+	batch_pending = false;
+	
+	app_regs.REG_EXEC_BATCH[0] = last_exec_state;
+	app_regs.REG_EXEC_BATCH[1] = 0;
+	app_regs.REG_EXEC_BATCH[2] = 0;
+}
+
+void hwbp_app_evt_queue_read_exec_state(void)
+{
+	if (!exec_state_sending)
+		app_regs.REG_EXEC_STATE = pwm_exec_state;
+}
+
+void hwbp_app_evt_queue_read_dropped(void)
+{
+	uint16_t dropped = 0;
+	
+	for (uint8_t level = 0; level < EVT_QUEUE_LEVELS; level++)
+	{
+		uint16_t count;
+		
+		/* The higher levels can write their counters while they are read */
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			count = evt_dropped[level];
+		}
+		
+		dropped = (count > UINT16_MAX - dropped) ? UINT16_MAX : dropped + count;
+	}
+	
+	app_regs.REG_EVNT_DROPPED = dropped;
+}
+
+void hwbp_app_evt_queue_request_leds(void)
+{
+	leds_requested = true;
+}
+
+static void send_batch(void)
+{
+	core_func_update_user_timestamp(batch_seconds, batch_useconds);
+	core_func_send_event(ADD_REG_EXEC_BATCH, false);
+	
+	batch_pending = false;
+}
+
+static void add_to_batch(evt_entry_t *entry)
+{
+	if (!batch_pending)
+	{
+		batch_pending = true;
+		batch_seconds = entry->seconds;
+		batch_useconds = entry->useconds;
+		
+		app_regs.REG_EXEC_BATCH[1] = 0;
+		app_regs.REG_EXEC_BATCH[2] = 0;
+	}
+	
+	/* A channel that starts and stops inside the window shows up on both masks */
+	app_regs.REG_EXEC_BATCH[0] = entry->value;
+	app_regs.REG_EXEC_BATCH[1] |= entry->value & ~last_exec_state;
+	app_regs.REG_EXEC_BATCH[2] |= last_exec_state & ~entry->value;
+}
+
+static bool batch_window_elapsed(void)
+{
+	uint32_t seconds;
+	uint16_t useconds;
+	
+	read_timestamp(&seconds, &useconds);
+	
+	int32_t elapsed = (int32_t)(seconds - batch_seconds) * 1000000 + ((int32_t)useconds - batch_useconds);
+	
+	return elapsed >= app_regs.REG_EVNT_COALESCE;
+}
+
+static void send_exec_state(evt_entry_t *entry)
+{
+	exec_state_sending = true;
+	app_regs.REG_EXEC_STATE = entry->value;
+	
+	core_func_update_user_timestamp(entry->seconds, entry->useconds);
+	core_func_send_event(ADD_REG_EXEC_STATE, false);
+	
+	app_regs.REG_EXEC_STATE = pwm_exec_state;
+	exec_state_sending = false;
+}
+
+/* Returns EVT_QUEUE_LEVELS when all the rings are empty */
+static uint8_t oldest_level(void)
+{
+	uint8_t oldest = EVT_QUEUE_LEVELS;
+	
+	for (uint8_t level = 0; level < EVT_QUEUE_LEVELS; level++)
+	{
+		uint8_t tail = evt_tail[level];
+		
+		if (tail == evt_head[level])
+			continue;
+		
+		if (oldest != EVT_QUEUE_LEVELS)
+		{
+			volatile evt_entry_t *entry = &evt_queue[level][tail];
+			volatile evt_entry_t *first = &evt_queue[oldest][evt_tail[oldest]];
+			
+			if (entry->seconds > first->seconds)
+				continue;
+			
+			if (entry->seconds == first->seconds && entry->useconds >= first->useconds)
+				continue;
+		}
+		
+		oldest = level;
+	}
+	
+	return oldest;
+}
+
+void hwbp_app_evt_queue_drain(void)
+{
+	if (leds_requested)
+	{
+		leds_requested = false;
+		update_enabled_pwmx();
+	}
+	
+	while (true)
+	{
+		if (clear_requested)
+			apply_clear();
+		
+		uint8_t level = oldest_level();
+		
+		if (level == EVT_QUEUE_LEVELS)
+			break;
+		
+		/* Copy the entry and hand its slot back before sending it */
+		uint8_t tail = evt_tail[level];
+		evt_entry_t entry = evt_queue[level][tail];
+		evt_tail[level] = (tail + 1) & (EVT_QUEUE_SIZE - 1);
+		
+		if (entry.add == ADD_REG_CH_REMAINING)
+		{
+			/* The counters are sent with their current values */
+			hwbp_app_pwm_gen_read_remaining(app_regs.REG_CH_REMAINING);
+			core_func_update_user_timestamp(entry.seconds, entry.useconds);
+			core_func_send_event(ADD_REG_CH_REMAINING, false);
+			continue;
+		}
+		
+		if (entry.add == ADD_REG_TRAIN_LEVEL)
+		{
+			/* The levels are sent with their current values */
+			core_func_update_user_timestamp(entry.seconds, entry.useconds);
+			core_func_send_event(ADD_REG_TRAIN_LEVEL, false);
+			continue;
+		}
+		
+		if (app_regs.REG_EVNT_COALESCE)
+		{
+			add_to_batch(&entry);
+		}
+		else
+		{
+			/* Coalescing was just disabled, keep the events in order */
+			if (batch_pending)
+				send_batch();
+			
+			/* Send the register with the value it had when the change happened */
+			send_exec_state(&entry);
+		}
+		
+		last_exec_state = entry.value;
+	}
+	
+	if (batch_pending && (app_regs.REG_EVNT_COALESCE == 0 || batch_window_elapsed()))
+		send_batch();
+}
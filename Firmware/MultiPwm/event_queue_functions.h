@@ -0,0 +1,50 @@
+#ifndef _EVENT_QUEUE_FUNCTIONS_H_
+#define _EVENT_QUEUE_FUNCTIONS_H_
+
+/************************************************************************/
+/* Number of entries of each interrupt level's queue                    */
+/************************************************************************/
+/* Must be a power of 2 */
+#define EVT_QUEUE_SIZE 16
+
+/************************************************************************/
+/* Queue a REG_EXEC_STATE event with its current value and timestamp    */
+/************************************************************************/
+void hwbp_app_evt_queue_push_exec_state(void);
+
+/************************************************************************/
+/* Queue a REG_CH_REMAINING event with the current timestamp            */
+/************************************************************************/
+void hwbp_app_evt_queue_push_progress(void);
+
+/************************************************************************/
+/* Queue a REG_TRAIN_LEVEL event with the current timestamp             */
+/************************************************************************/
+void hwbp_app_evt_queue_push_train_level(void);
+
+/************************************************************************/
+/* Drop the queued events and restart the coalescing                    */
+/************************************************************************/
+void hwbp_app_evt_queue_clear(void);
+
+/************************************************************************/
+/* Update REG_EXEC_STATE and REG_EVNT_DROPPED before a host read        */
+/************************************************************************/
+void hwbp_app_evt_queue_read_exec_state(void);
+void hwbp_app_evt_queue_read_dropped(void);
+
+/************************************************************************/
+/* Request an update of the channels enable indicators                  */
+/************************************************************************/
+void hwbp_app_evt_queue_request_leds(void);
+
+/************************************************************************/
+/* Send the queued events                                               */
+/*                                                                      */
+/* Called from the core's 500 us and 1 ms callbacks, which run in its   */
+/* timer interrupt. Only the drain sends, and it doesn't block the      */
+/* other interrupts while doing it.                                     */
+/************************************************************************/
+void hwbp_app_evt_queue_drain(void);
+
+#endif /* _EVENT_QUEUE_FUNCTIONS_H_ */
@@ -0,0 +1,200 @@
+#include "cpu.h"
+#include "hwbp_core.h"
+#include "app_ios_and_regs.h"
+#include "pwm_gen_functions.h"
+#include "freq_meter_functions.h"
+
+extern AppRegs app_regs;
+
+/************************************************************************/
+/* Frequency meter                                                      */
+/*                                                                      */
+/* Each input is measured by a spare TC1 restarted by the input's event */
+/* channel on every rising edge. The capture alternates between         */
+/* frequency capture (period) and pulse width capture (high time).      */
+/* Since both restart the counter on the rising edge, switching between */
+/* them doesn't spoil the next capture. The hardware does all the work  */
+/* on the edges, the CPU only collects the last capture every 1 ms.     */
+/************************************************************************/
+static TC1_t * const fmeter_timer[FMETER_N_INPUTS] = {&TCD1, &TCE1};
+static const uint8_t fmeter_evsel[FMETER_N_INPUTS] = {TC_EVSEL_CH0_gc, TC_EVSEL_CH1_gc};
+
+static uint8_t fmeter_prescaler[FMETER_N_INPUTS];
+static bool fmeter_high_phase[FMETER_N_INPUTS];
+static bool fmeter_discard[FMETER_N_INPUTS];
+static uint8_t fmeter_n_period[FMETER_N_INPUTS];
+static uint8_t fmeter_n_high[FMETER_N_INPUTS];
+static uint32_t fmeter_sum_period[FMETER_N_INPUTS];
+static uint32_t fmeter_sum_high[FMETER_N_INPUTS];
+
+static void fmeter_clear_results(uint8_t i)
+{
+	app_regs.REG_TRG_PERIOD[i] = 0;
+	app_regs.REG_TRG_FREQ[i] = 0;
+	app_regs.REG_TRG_DUTYCYCLE[i] = 0;
+}
+
+static void fmeter_set_capture(uint8_t i)
+{
+	fmeter_timer[i]->CTRLD = (fmeter_high_phase[i] ? TC_EVACT_PW_gc : TC_EVACT_FRQ_gc) | fmeter_evsel[i];
+	fmeter_timer[i]->INTFLAGS = TC1_CCAIF_bm;
+}
+
+static void fmeter_restart(uint8_t i)
+{
+	fmeter_timer[i]->CTRLA = fmeter_prescaler[i];
+	fmeter_timer[i]->CTRLFSET = TC_CMD_RESTART_gc;
+	fmeter_timer[i]->INTFLAGS = TC1_OVFIF_bm;
+	fmeter_set_capture(i);
+
+	/* The first capture starts at a random point of the signal */
+	fmeter_discard[i] = true;
+
+	fmeter_n_period[i] = 0;
+	fmeter_n_high[i] = 0;
+	fmeter_sum_period[i] = 0;
+	fmeter_sum_high[i] = 0;
+}
+
+/************************************************************************/
+/* Configure the frequency meter according to REG_TRG_FMETER_EN         */
+/************************************************************************/
+void hwbp_app_freq_meter_configure(void)
+{
+	for (uint8_t i = 0; i < FMETER_N_INPUTS; i++)
+	{
+		TC1_t *timer = fmeter_timer[i];
+
+		timer_type1_stop(timer);
+		timer->CTRLD = 0;
+		timer->CTRLB = 0;
+
+		if (app_regs.REG_TRG_FMETER_EN & (B_FMTRG0 << i))
+		{
+			timer->CTRLB = TC1_CCAEN_bm | TC_WGMODE_NORMAL_gc;
+			timer->INTCTRLA = 0;
+			timer->INTCTRLB = 0;
+			timer->PER = 0xFFFF;
+
+			fmeter_prescaler[i] = TIMER_PRESCALER_DIV1;
+			fmeter_high_phase[i] = false;
+			fmeter_restart(i);
+		}
+
+		fmeter_clear_results(i);
+	}
+}
+
+/************************************************************************/
+/* Collect the captures. Should be called every millisecond.            */
+/************************************************************************/
+void hwbp_app_freq_meter_update(void)
+{
+	bool window_done = false;
+
+	for (uint8_t i = 0; i < FMETER_N_INPUTS; i++)
+	{
+		if (!(app_regs.REG_TRG_FMETER_EN & (B_FMTRG0 << i)))
+			continue;
+
+		TC1_t *timer = fmeter_timer[i];
+		uint8_t flags = timer->INTFLAGS;
+
+		/* An input used as a channel clock only generates events on rising edges */
+		bool measure_duty = !(hwbp_app_pwm_gen_clock_inputs() & (B_LTRG0 << i));
+
+		if (!measure_duty && fmeter_high_phase[i])
+		{
+			fmeter_high_phase[i] = false;
+			fmeter_set_capture(i);
+			continue;
+		}
+
+		/* The period doesn't fit on the counter, use a slower clock */
+		if (flags & TC1_OVFIF_bm)
+		{
+			if (fmeter_prescaler[i] < TIMER_PRESCALER_DIV1024)
+			{
+				fmeter_prescaler[i]++;
+			}
+			else if (app_regs.REG_TRG_PERIOD[i])
+			{
+				/* No signal or slower than ~0.5 Hz */
+				fmeter_clear_results(i);
+				window_done = true;
+			}
+
+			fmeter_restart(i);
+			continue;
+		}
+
+		if (!(flags & TC1_CCAIF_bm))
+			continue;
+
+		uint16_t capture = timer->CCA;
+		timer->INTFLAGS = TC1_CCAIF_bm;
+
+		if (fmeter_discard[i])
+		{
+			fmeter_discard[i] = false;
+			continue;
+		}
+
+		if (fmeter_high_phase[i])
+		{
+			fmeter_sum_high[i] += capture;
+			fmeter_n_high[i]++;
+		}
+		else
+		{
+			/* Use a faster clock if the period still fits on the counter */
+			if (fmeter_prescaler[i] > TIMER_PRESCALER_DIV1)
+			{
+				uint8_t ratio = get_divider(fmeter_prescaler[i]) / get_divider(fmeter_prescaler[i] - 1);
+
+				if ((uint32_t)capture * ratio < 0xC000)
+				{
+					fmeter_prescaler[i]--;
+					fmeter_restart(i);
+					continue;
+				}
+			}
+
+			fmeter_sum_period[i] += capture;
+			fmeter_n_period[i]++;
+		}
+
+		/* Alternate between period and high time captures */
+		if (measure_duty)
+		{
+			fmeter_high_phase[i] = !fmeter_high_phase[i];
+			fmeter_set_capture(i);
+		}
+
+		if (fmeter_n_period[i] >= app_regs.REG_TRG_FMETER_WINDOW && (fmeter_n_high[i] >= app_regs.REG_TRG_FMETER_WINDOW || !measure_duty))
+		{
+			uint16_t divider = get_divider(fmeter_prescaler[i]);
+			float period_ticks = (float)fmeter_sum_period[i] / fmeter_n_period[i];
+
+			app_regs.REG_TRG_PERIOD[i] = period_ticks * divider * 31.25 + 0.5;
+			app_regs.REG_TRG_FREQ[i] = 32000000.0 / (divider * period_ticks);
+			app_regs.REG_TRG_DUTYCYCLE[i] = measure_duty ? 100.0 * ((float)fmeter_sum_high[i] / fmeter_n_high[i]) / period_ticks : 0;
+
+			/* A pin inverted for the gate's fault input captures the low time */
+			if (measure_duty && (trig_in_inverted & (B_LTRG0 << i)))
+				app_regs.REG_TRG_DUTYCYCLE[i] = 100.0 - app_regs.REG_TRG_DUTYCYCLE[i];
+
+			fmeter_n_period[i] = 0;
+			fmeter_n_high[i] = 0;
+			fmeter_sum_period[i] = 0;
+			fmeter_sum_high[i] = 0;
+
+			window_done = true;
+		}
+	}
+
+	if (window_done && (app_regs.REG_EVNT_ENABLE & B_EVT1))
+	{
+		core_func_send_event(ADD_REG_TRG_FREQ, true);
+	}
+}
@@ -0,0 +1,20 @@
+#ifndef _FREQ_METER_FUNCTIONS_H_
+#define _FREQ_METER_FUNCTIONS_H_
+
+/************************************************************************/
+/* Number of trigger inputs that can be measured                        */
+/************************************************************************/
+/* Only TRIG_IN0 and TRIG_IN1 (PORTF) are able to generate events */
+#define FMETER_N_INPUTS 2
+
+/************************************************************************/
+/* Configure the frequency meter according to REG_TRG_FMETER_EN         */
+/************************************************************************/
+void hwbp_app_freq_meter_configure(void);
+
+/************************************************************************/
+/* Collect the captures. Should be called every millisecond.            */
+/************************************************************************/
+void hwbp_app_freq_meter_update(void);
+
+#endif /* _FREQ_METER_FUNCTIONS_H_ */
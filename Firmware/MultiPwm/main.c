@@ -1,7 +1,9 @@
 #include <avr/io.h>
+#include <util/atomic.h>
 
 #include "app.h"
 #include "app_ios_and_regs.h"
+#include "profiling_functions.h"
 
 int main(void)
 {
@@ -12,6 +14,10 @@ int main(void)
 	hwbp_app_enable_interrupts;
 	
 	/* Infinite loop */
-	while(1);
+	while(1)
+	{
+		/* Counts the turns of the loop when profiling */
+		PROF_IDLE();
 		//__asm volatile("sleep");
+	}
 }
\ No newline at end of file
@@ -0,0 +1,245 @@
+#include <stddef.h>
+#include <util/atomic.h>
+
+#include "cpu.h"
+#include "hwbp_core.h"
+#include "app_ios_and_regs.h"
+#include "pwm_gen_functions.h"
+#include "preset_functions.h"
+
+extern AppRegs app_regs;
+
+extern void stop_and_update_ch_temps(uint8_t ch);
+
+/************************************************************************/
+/* Presets                                                              */
+/*                                                                      */
+/* A preset holds the channels' and triggers' configuration together    */
+/* with the timer values computed when it was saved, so loading it is   */
+/* only a copy from the SRAM cache. The cache is written to the EEPROM  */
+/* in the background, one byte per millisecond, to keep the command     */
+/* path short. Each preset and the names are written on their own, so   */
+/* saving two presets only writes those two.                            */
+/*                                                                      */
+/* The header's version changes with the layout of preset_t, so the     */
+/* presets saved by another firmware are seen as empty. The validity of */
+/* each preset is checked when the cache is read and set on a save, so  */
+/* the trigger interrupts don't go through the checksum.                */
+/************************************************************************/
+#define PRESET_MAGIC 0xA5
+#define PRESET_VERSION 1
+
+typedef struct
+{
+	uint8_t magic;
+	uint8_t version;
+	pwm_config_t ch[4];
+	uint8_t ch_mode[4];
+	uint8_t trg_mask[4];
+	uint8_t trg_mode[4];
+	uint8_t trgall_mode;
+	uint8_t checksum;
+} preset_t;
+
+typedef struct
+{
+	preset_t presets[PRESETS_N];
+	uint8_t names[PRESETS_N * PRESET_NAME_LENGTH];
+} presets_cache_t;
+
+static presets_cache_t cache;
+static uint8_t presets_valid = 0;
+
+/* Range of each block of the cache still to be written to the EEPROM */
+/* A block is a preset or the names */
+#define PRESET_BLOCKS (PRESETS_N + 1)
+#define PRESET_BLOCK_NAMES PRESETS_N
+
+static uint16_t eeprom_start[PRESET_BLOCKS];
+static uint16_t eeprom_end[PRESET_BLOCKS];
+
+static uint8_t checksum(preset_t *preset)
+{
+	uint8_t sum = 0;
+
+	for (uint16_t i = 0; i < offsetof(preset_t, checksum); i++)
+		sum += ((uint8_t*)preset)[i];
+
+	return sum;
+}
+
+static bool is_valid(uint8_t preset)
+{
+	preset_t *p = &cache.presets[preset];
+
+	return p->magic == PRESET_MAGIC && p->version == PRESET_VERSION && p->checksum == checksum(p);
+}
+
+static void write_to_eeprom(uint8_t block, void *from, uint16_t length)
+{
+	uint16_t start = (uint8_t*)from - (uint8_t*)&cache;
+
+	/* A block saved again while it's written starts over */
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		eeprom_start[block] = start;
+		eeprom_end[block] = start + length;
+	}
+}
+
+void hwbp_app_preset_init(void)
+{
+	for (uint16_t i = 0; i < sizeof(presets_cache_t); i++)
+		((uint8_t*)&cache)[i] = eeprom_rd_byte(PRESETS_EEPROM_ADD + i);
+
+	presets_valid = 0;
+
+	for (uint8_t i = 0; i < PRESETS_N; i++)
+		if (is_valid(i))
+			presets_valid |= (1 << i);
+
+	for (uint8_t block = 0; block < PRESET_BLOCKS; block++)
+		eeprom_start[block] = eeprom_end[block] = 0;
+}
+
+void hwbp_app_preset_read_names(void)
+{
+	/* An erased EEPROM reads 0xFF */
+	for (uint8_t i = 0; i < PRESETS_N * PRESET_NAME_LENGTH; i++)
+		app_regs.REG_PRESET_NAMES[i] = (cache.names[i] == 0xFF) ? 0 : cache.names[i];
+}
+
+bool hwbp_app_preset_save(uint8_t preset)
+{
+	preset_t new_preset;
+
+	if (preset >= PRESETS_N)
+		return false;
+
+	new_preset.magic = PRESET_MAGIC;
+	new_preset.version = PRESET_VERSION;
+
+	for (uint8_t j = 0; j < 4; j++)
+	{
+		hwbp_app_pwm_gen_read_config(j, &new_preset.ch[j]);
+		new_preset.ch_mode[j] = *((&app_regs.REG_CH0_MODE) + j);
+		new_preset.trg_mask[j] = *((&app_regs.REG_TRG0_MASK) + j);
+		new_preset.trg_mode[j] = *((&app_regs.REG_TRG0_MODE) + j);
+	}
+
+	new_preset.trgall_mode = app_regs.REG_TRGALL_MODE;
+	new_preset.checksum = checksum(&new_preset);
+
+	/* A trigger may be loading a preset */
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		cache.presets[preset] = new_preset;
+		presets_valid |= (1 << preset);
+	}
+
+	write_to_eeprom(preset, &cache.presets[preset], sizeof(preset_t));
+
+	return true;
+}
+
+bool hwbp_app_preset_load(uint8_t preset)
+{
+	if (preset >= PRESETS_N || !(presets_valid & (1 << preset)))
+		return false;
+
+	preset_t *p = &cache.presets[preset];
+	bool clock_changed = false;
+	bool triggers_changed = false;
+
+	/* Changing the clock source stops the channel */
+	for (uint8_t j = 0; j < 4; j++)
+	{
+		uint8_t *ch_mode = (&app_regs.REG_CH0_MODE) + j;
+
+		if ((*ch_mode ^ p->ch_mode[j]) & MSK_CH_CLK)
+		{
+			*ch_mode = p->ch_mode[j];
+			clock_changed = true;
+
+			stop_and_update_ch_temps(j);
+		}
+
+		*ch_mode = p->ch_mode[j];
+	}
+
+	hwbp_app_pwm_gen_apply_configs(B_TRGCH0 | B_TRGCH1 | B_TRGCH2 | B_TRGCH3, p->ch);
+
+	for (uint8_t j = 0; j < 4; j++)
+	{
+		uint8_t *trg_mask = (&app_regs.REG_TRG0_MASK) + j;
+		uint8_t *trg_mode = (&app_regs.REG_TRG0_MODE) + j;
+
+		if (*trg_mask != p->trg_mask[j] || *trg_mode != p->trg_mode[j])
+			triggers_changed = true;
+
+		*trg_mask = p->trg_mask[j];
+		*trg_mode = p->trg_mode[j];
+	}
+
+	app_regs.REG_TRGALL_MODE = p->trgall_mode;
+
+	if (clock_changed)
+		hwbp_app_pwm_gen_update_clock_inputs();
+
+	if (clock_changed || triggers_changed)
+		hwbp_app_pwm_gen_update_gates();
+
+	app_regs.REG_PRESET_LOAD = preset;
+	return true;
+}
+
+void hwbp_app_preset_save_names(void)
+{
+	for (uint8_t i = 0; i < PRESETS_N * PRESET_NAME_LENGTH; i++)
+		cache.names[i] = app_regs.REG_PRESET_NAMES[i];
+
+	write_to_eeprom(PRESET_BLOCK_NAMES, cache.names, sizeof(cache.names));
+}
+
+void hwbp_app_preset_on_trigger(uint8_t trigger)
+{
+	if (!(app_regs.REG_PRESET_TRIGGER & trigger))
+		return;
+
+	uint8_t preset = app_regs.REG_PRESET_LOAD;
+
+	for (uint8_t i = 0; i < PRESETS_N; i++)
+	{
+		preset = (preset >= PRESETS_N - 1) ? 0 : preset + 1;
+
+		if (hwbp_app_preset_load(preset))
+			return;
+	}
+}
+
+void hwbp_app_preset_update_eeprom(void)
+{
+	if (eeprom_is_busy())
+		return;
+
+	for (uint8_t block = 0; block < PRESET_BLOCKS; block++)
+	{
+		uint16_t i;
+		bool pending;
+
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			i = eeprom_start[block];
+			pending = i != eeprom_end[block];
+
+			if (pending)
+				eeprom_start[block]++;
+		}
+
+		if (pending)
+		{
+			eeprom_wr_byte(PRESETS_EEPROM_ADD + i, ((uint8_t*)&cache)[i]);
+			return;
+		}
+	}
+}
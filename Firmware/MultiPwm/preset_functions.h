@@ -0,0 +1,49 @@
+#ifndef _PRESET_FUNCTIONS_H_
+#define _PRESET_FUNCTIONS_H_
+
+/************************************************************************/
+/* Presets                                                              */
+/************************************************************************/
+#define PRESETS_N 4
+#define PRESET_NAME_LENGTH 8
+#define PRESET_NONE 0xFF
+
+/* Above the area used by the core to save the registers */
+#define PRESETS_EEPROM_ADD 0x400
+
+/************************************************************************/
+/* Read the presets from the EEPROM into the SRAM cache                 */
+/************************************************************************/
+void hwbp_app_preset_init(void);
+
+/************************************************************************/
+/* Copy the presets' names from the SRAM cache to REG_PRESET_NAMES      */
+/************************************************************************/
+void hwbp_app_preset_read_names(void);
+
+/************************************************************************/
+/* Save the current configuration on a preset                           */
+/************************************************************************/
+bool hwbp_app_preset_save(uint8_t preset);
+
+/************************************************************************/
+/* Apply a preset from the SRAM cache                                   */
+/************************************************************************/
+bool hwbp_app_preset_load(uint8_t preset);
+
+/************************************************************************/
+/* Save the presets' names                                              */
+/************************************************************************/
+void hwbp_app_preset_save_names(void);
+
+/************************************************************************/
+/* Move to the next valid preset if the trigger is in REG_PRESET_TRIGGER */
+/************************************************************************/
+void hwbp_app_preset_on_trigger(uint8_t trigger);
+
+/************************************************************************/
+/* Write the pending bytes to the EEPROM. Should be called every ms.    */
+/************************************************************************/
+void hwbp_app_preset_update_eeprom(void);
+
+#endif /* _PRESET_FUNCTIONS_H_ */
@@ -0,0 +1,185 @@
+#include <util/atomic.h>
+
+#include "cpu.h"
+#include "hwbp_core.h"
+#include "app_ios_and_regs.h"
+#include "profiling_functions.h"
+
+#ifdef PWM_PROFILING
+
+extern AppRegs app_regs;
+
+/************************************************************************/
+/* Profiling                                                            */
+/*                                                                      */
+/* The cycles spent on each interrupt are read from a free running      */
+/* timer. The mean is kept as a sum and a count which are halved when   */
+/* the sum gets close to overflow.                                      */
+/*                                                                      */
+/* The CPU load comes from the number of turns of the main loop on each */
+/* second. The highest number observed is taken as the idle CPU. The    */
+/* loop's counter is never reset, each second takes the difference      */
+/* from the previous one's reading. The counter is the main loop's      */
+/* only, the new second's interrupt just flags it and the loop takes    */
+/* the reading on its next turn, so counting never disables interrupts. */
+/*                                                                      */
+/* The latency of every channel started by a trigger goes to a          */
+/* histogram, so the jitter shows up as its spread. The skew is the     */
+/* difference between the first and the last channel started by the     */
+/* same trigger.                                                        */
+/************************************************************************/
+uint32_t prof_idle_count = 0;
+volatile bool prof_idle_second = false;
+uint16_t prof_trigger_t0;
+bool prof_in_trigger = false;
+bool prof_trigger_started = false;
+
+static uint32_t prof_isr_count[PROF_N_ISRS];
+static uint32_t prof_isr_sum[PROF_N_ISRS];
+static uint32_t prof_isr_n[PROF_N_ISRS];
+static uint16_t prof_isr_max[PROF_N_ISRS];
+static uint16_t prof_latency_max;
+static uint16_t prof_latency_min;
+static uint16_t prof_latency_hist[PROF_LATENCY_BUCKETS];
+static uint16_t prof_first_start;
+static uint16_t prof_skew_max;
+static uint32_t prof_idle_max;
+static uint32_t prof_idle_last = 0;
+static volatile bool prof_idle_clear = false;
+static float prof_cpu_load;
+
+void hwbp_app_prof_configure(void)
+{
+	PROF_TIMER.CTRLA = 0;
+	PROF_TIMER.CTRLB = TC_WGMODE_NORMAL_gc;
+	PROF_TIMER.INTCTRLA = 0;
+	PROF_TIMER.INTCTRLB = 0;
+	PROF_TIMER.PER = 0xFFFF;
+	PROF_TIMER.CNT = 0;
+	PROF_TIMER.CTRLA = TC_CLKSEL_DIV1_gc;
+	
+	hwbp_app_prof_clear();
+}
+
+void hwbp_app_prof_clear(void)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		for (uint8_t i = 0; i < PROF_N_ISRS; i++)
+		{
+			prof_isr_count[i] = 0;
+			prof_isr_sum[i] = 0;
+			prof_isr_n[i] = 0;
+			prof_isr_max[i] = 0;
+		}
+		
+		for (uint8_t i = 0; i < PROF_LATENCY_BUCKETS; i++)
+			prof_latency_hist[i] = 0;
+		
+		prof_latency_max = 0;
+		prof_latency_min = 0xFFFF;
+		prof_skew_max = 0;
+		prof_idle_clear = true;
+		prof_cpu_load = 0;
+	}
+}
+
+void hwbp_app_prof_isr_done(uint8_t isr, uint16_t cycles)
+{
+	prof_isr_count[isr]++;
+	
+	if (cycles > prof_isr_max[isr])
+		prof_isr_max[isr] = cycles;
+	
+	if (prof_isr_sum[isr] > 0xFFFF0000)
+	{
+		prof_isr_sum[isr] >>= 1;
+		prof_isr_n[isr] >>= 1;
+	}
+	
+	prof_isr_sum[isr] += cycles;
+	prof_isr_n[isr]++;
+}
+
+void hwbp_app_prof_started(uint16_t cycles)
+{
+	if (cycles > prof_latency_max)
+		prof_latency_max = cycles;
+	
+	if (cycles < prof_latency_min)
+		prof_latency_min = cycles;
+	
+	uint16_t bucket = cycles >> PROF_LATENCY_BUCKET_SHIFT;
+	
+	if (bucket >= PROF_LATENCY_BUCKETS)
+		bucket = PROF_LATENCY_BUCKETS - 1;
+	
+	/* Saturates instead of wrapping */
+	if (prof_latency_hist[bucket] != 0xFFFF)
+		prof_latency_hist[bucket]++;
+	
+	if (!prof_trigger_started)
+	{
+		prof_trigger_started = true;
+		prof_first_start = cycles;
+	}
+	else if (cycles - prof_first_start > prof_skew_max)
+	{
+		prof_skew_max = cycles - prof_first_start;
+	}
+}
+
+void hwbp_app_prof_new_second(void)
+{
+	prof_idle_second = true;
+}
+
+void hwbp_app_prof_idle_second(void)
+{
+	uint32_t idle = prof_idle_count - prof_idle_last;
+	
+	prof_idle_second = false;
+	prof_idle_last = prof_idle_count;
+	
+	/* The second after a clear starts the highest number over */
+	if (prof_idle_clear)
+	{
+		prof_idle_clear = false;
+		prof_idle_max = 0;
+	}
+	
+	if (idle > prof_idle_max)
+		prof_idle_max = idle;
+	
+	float load = (prof_idle_max) ? 100.0 * (1.0 - (float)idle / prof_idle_max) : 0;
+	
+	/* Read by the registers' update, which may interrupt the loop */
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		prof_cpu_load = load;
+	}
+}
+
+void hwbp_app_prof_update_regs(void)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		for (uint8_t i = 0; i < PROF_N_ISRS; i++)
+		{
+			app_regs.REG_PROF_ISR_COUNT[i] = prof_isr_count[i];
+			app_regs.REG_PROF_ISR_MAX[i] = prof_isr_max[i];
+			app_regs.REG_PROF_ISR_MEAN[i] = (prof_isr_n[i]) ? prof_isr_sum[i] / prof_isr_n[i] : 0;
+		}
+		
+		app_regs.REG_PROF_LATENCY_MAX = prof_latency_max;
+		app_regs.REG_PROF_LATENCY_MIN = (prof_latency_min == 0xFFFF) ? 0 : prof_latency_min;
+		app_regs.REG_PROF_SKEW_MAX = prof_skew_max;
+		
+		for (uint8_t i = 0; i < PROF_LATENCY_BUCKETS; i++)
+			app_regs.REG_PROF_LATENCY_HIST[i] = prof_latency_hist[i];
+	}
+	
+	app_regs.REG_PROF_CPU_LOAD = prof_cpu_load;
+}
+
+#endif /* PWM_PROFILING */
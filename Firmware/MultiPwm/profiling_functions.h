@@ -0,0 +1,68 @@
+#ifndef _PROFILING_FUNCTIONS_H_
+#define _PROFILING_FUNCTIONS_H_
+
+/************************************************************************/
+/* Profiling                                                            */
+/*                                                                      */
+/* Only compiled when PWM_PROFILING is defined on the project symbols.  */
+/* Otherwise the macros are empty and the registers read as zero.       */
+/************************************************************************/
+#define PROF_ISR_CCA0 0
+#define PROF_ISR_CCA1 1
+#define PROF_ISR_CCA2 2
+#define PROF_ISR_CCA3 3
+#define PROF_ISR_TRG0 4
+#define PROF_ISR_TRG1 5
+#define PROF_ISR_TRG2 6
+#define PROF_ISR_TRG3 7
+#define PROF_ISR_TRGALL 8
+#define PROF_N_ISRS 9
+
+/* Buckets of 64 cycles (2 us), the last one takes the longer latencies */
+#define PROF_LATENCY_BUCKETS 8
+#define PROF_LATENCY_BUCKET_SHIFT 6
+
+#ifdef PWM_PROFILING
+
+/* Free running at 32 MHz, so the counts are CPU cycles */
+#define PROF_TIMER TCF1
+
+extern uint32_t prof_idle_count;
+extern volatile bool prof_idle_second;
+extern uint16_t prof_trigger_t0;
+extern bool prof_in_trigger;
+extern bool prof_trigger_started;
+
+void hwbp_app_prof_configure(void);
+void hwbp_app_prof_clear(void);
+void hwbp_app_prof_isr_done(uint8_t isr, uint16_t cycles);
+void hwbp_app_prof_started(uint16_t cycles);
+void hwbp_app_prof_new_second(void);
+void hwbp_app_prof_idle_second(void);
+void hwbp_app_prof_update_regs(void);
+
+/* Only the main loop reads and writes the counter, so it takes no lock */
+#define PROF_IDLE() do { prof_idle_count++; if (prof_idle_second) hwbp_app_prof_idle_second(); } while (0)
+#define PROF_ISR_ENTER() uint16_t prof_t0 = PROF_TIMER.CNT
+#define PROF_ISR_EXIT(isr) hwbp_app_prof_isr_done(isr, PROF_TIMER.CNT - prof_t0)
+#define PROF_TRIGGER_ENTER() PROF_ISR_ENTER(); prof_trigger_t0 = prof_t0; prof_in_trigger = true; prof_trigger_started = false
+#define PROF_TRIGGER_EXIT(isr) prof_in_trigger = false; PROF_ISR_EXIT(isr)
+#define PROF_STARTED() if (prof_in_trigger) hwbp_app_prof_started(PROF_TIMER.CNT - prof_trigger_t0)
+
+#else
+
+#define hwbp_app_prof_configure()
+#define hwbp_app_prof_clear()
+#define hwbp_app_prof_new_second()
+#define hwbp_app_prof_update_regs()
+
+#define PROF_IDLE()
+#define PROF_ISR_ENTER()
+#define PROF_ISR_EXIT(isr)
+#define PROF_TRIGGER_ENTER()
+#define PROF_TRIGGER_EXIT(isr)
+#define PROF_STARTED()
+
+#endif /* PWM_PROFILING */
+
+#endif /* _PROFILING_FUNCTIONS_H_ */
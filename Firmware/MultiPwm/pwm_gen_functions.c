@@ -1,7 +1,14 @@
+#include <util/atomic.h>
+
 #include "app_ios_and_regs.h"
+#include "pwm_hal.h"
 #include "hwbp_core.h"
 #include "app_funcs.h"
 #include "pwm_gen_functions.h"
+#include "event_queue_functions.h"
+#include "profiling_functions.h"
+#include "preset_functions.h"
+#include "timer_solver_functions.h"
 
 extern AppRegs app_regs;
 
@@ -10,115 +17,686 @@ extern AppRegs app_regs;
 /************************************************************************/
 uint16_t get_divider(uint8_t prescaler)
 {
-	switch(prescaler)
+	return (prescaler < TIMER_SOLVER_N_PRESCALERS) ? timer_solver_dividers[prescaler] : 0;
+}
+
+/************************************************************************/
+/* Running channels                                                     */
+/************************************************************************/
+uint8_t pwm_exec_state = 0;
+
+/************************************************************************/
+/* Channels                                                             */
+/*                                                                      */
+/* Everything kept about a channel is on its descriptor, so the same    */
+/* code serves the four channels, indexed by the channel number.        */
+/************************************************************************/
+typedef struct
+{
+	TC0_t * const timer;
+	PORT_t * const sync_port;
+	AWEX_t * const awex;                      // NULL on the channels without one
+	uint8_t prescaler;                        // CTRLA while running on the internal clock
+	uint16_t target_count;                    // PER + 1
+	uint16_t duty_cycle;                      // CCA
+	uint32_t tcount;                          // Pulses left on Count mode, decremented on every pulse
+	uint32_t tcount_start;                    // tcount at the start of the train or at the last statistics clear
+	uint16_t progress_count;                  // Pulses left until the next REG_CH_REMAINING event
+	uint8_t gate_clksel;                      // CTRLA to restore when the gate opens
+	uint32_t stats[CH_STATS_N];
+	uint8_t train_tail;
+	pwm_config_t train_queue[TRAIN_QUEUE_SIZE];
+} pwm_channel_t;
+
+static pwm_channel_t channels[4] = {
+	{.timer = HAL_CH0_TIMER, .sync_port = HAL_CH0_SYNC_PORT, .awex = HAL_CH0_AWEX},
+	{.timer = HAL_CH1_TIMER, .sync_port = HAL_CH1_SYNC_PORT},
+	{.timer = HAL_CH2_TIMER, .sync_port = HAL_CH2_SYNC_PORT, .awex = HAL_CH2_AWEX},
+	{.timer = HAL_CH3_TIMER, .sync_port = HAL_CH3_SYNC_PORT}
+};
+
+#define ch_mode(ch) (*((&app_regs.REG_CH0_MODE) + (ch)))
+
+/************************************************************************/
+/* External clock                                                       */
+/*                                                                      */
+/* A channel clocked by a TRIG input counts the input's rising edges    */
+/* through the event system, so the period is REG_CH_EXT_PERIOD cycles  */
+/* of the external clock. The real frequency can't be known and is      */
+/* reported as the negative of the period in external clock cycles.     */
+/************************************************************************/
+static uint8_t clock_inputs = 0;
+
+/* Takes the duty cycle from config and the period from config->target_count */
+static void compute_reals_ext_clock(pwm_config_t *config)
+{
+	uint16_t period = config->target_count;
+	
+	config->duty_cycle = config->dutycycle / 100.0 * period + 0.5;
+	
+	if (config->duty_cycle == 0 || config->duty_cycle >= period)
+	{
+		config->real_freq = 0;
+		config->real_dutycycle = 0;
+	}
+	else
+	{
+		config->real_freq = -(float)period;
+		config->real_dutycycle = 100.0 * ((float)config->duty_cycle / period);
+	}
+}
+
+static uint8_t ext_clksel(uint8_t ch)
+{
+	return ((ch_mode(ch) & MSK_CH_CLK) == GM_CH_CLK_TRIG0) ? HAL_CLKSEL_TRIG0 : HAL_CLKSEL_TRIG1;
+}
+
+void hwbp_app_pwm_gen_update_clock_inputs(void)
+{
+	clock_inputs = 0;
+	
+	for (uint8_t j = 0; j < 4; j++)
 	{
-		case TIMER_PRESCALER_DIV1: return 1;
-		case TIMER_PRESCALER_DIV2: return 2;
-		case TIMER_PRESCALER_DIV4: return 4;
-		case TIMER_PRESCALER_DIV8: return 8;
-		case TIMER_PRESCALER_DIV64: return 64;
-		case TIMER_PRESCALER_DIV256: return 256;
-		case TIMER_PRESCALER_DIV1024: return 1024;
-		default: return 0;
+		switch (*((&app_regs.REG_CH0_MODE) + j) & MSK_CH_CLK)
+		{
+			case GM_CH_CLK_TRIG0: clock_inputs |= B_LTRG0; break;
+			case GM_CH_CLK_TRIG1: clock_inputs |= B_LTRG1; break;
+		}
+	}
+	
+	/* A clock input generates events on rising edges only and stops being a trigger */
+	for (uint8_t i = 0; i < 2; i++)
+	{
+		if (clock_inputs & (B_LTRG0 << i))
+			hal_trig_to_clock(i);
+		else
+			hal_trig_to_trigger(i);
 	}
 }
 
-uint8_t prescaler0, prescaler1, prescaler2, prescaler3;
-uint16_t target_count0, target_count1, target_count2, target_count3;
-uint16_t duty_cycle0, duty_cycle1, duty_cycle2, duty_cycle3;
+uint8_t hwbp_app_pwm_gen_clock_inputs(void)
+{
+	return clock_inputs;
+}
 
 /************************************************************************/
-/* Calculate real values (frequency and duty cycle)                     */
+/* Gated mode                                                           */
+/*                                                                      */
+/* While the gate is inactive, the channel's waveform override is       */
+/* removed, so the pin falls back to its (cleared) PORT value, and the  */
+/* timer is frozen by clocking it from event channel 7, which has no    */
+/* source. CTRLA stays non-zero, so the channel is still seen as        */
+/* running and resumes from where it stopped when the gate opens.       */
+/*                                                                      */
+/* Channels 0 and 2 have an AWeX. When gated by TRIG_IN0 or TRIG_IN1,   */
+/* the gate's event channel is also used as the AWeX fault input, which */
+/* cuts the output in hardware without waiting for the interrupt. The   */
+/* other channels, and these two gated by TRIG_IN2, TRIG_IN3 or a       */
+/* virtual trigger, are only cut by the interrupt. The fault is on the  */
+/* cycle-by-cycle mode, which would only bring the output back on the   */
+/* timer's next UPDATE and lose the rest of the frozen period, so the   */
+/* interrupt that opens the gate sets the override back itself.         */
 /************************************************************************/
-void hwbp_app_pwm_gen_update_reals_ch0(void)
+static uint8_t gate_paused = 0;
+
+uint8_t trig_in_inverted = 0;
+
+static void update_awex_gate(AWEX_t *awex, uint8_t ch)
+{
+	for (uint8_t i = 0; i < 2; i++)
+	{
+		uint8_t trg_mode = *((&app_regs.REG_TRG0_MODE) + i);
+		
+		if ((trg_mode & MSK_TRG_MODE) != GM_TRG_MODE_GATE)
+			continue;
+		
+		if (!(*((&app_regs.REG_TRG0_MASK) + i) & (B_TRGCH0 << ch)))
+			continue;
+		
+		if (clock_inputs & (B_LTRG0 << i))
+			continue;
+		
+		/* The fault is the event level, so it must be high while the gate is inactive */
+		if (!(trg_mode & B_NTRG))
+			trig_in_inverted |= (B_LTRG0 << i);
+		
+		hal_awex_gate_on(awex, i);
+		return;
+	}
+	
+	hal_awex_gate_off(awex);
+}
+
+void hwbp_app_pwm_gen_update_gates(void)
 {
-	if (calculate_timer_16bits(32000000, app_regs.REG_CH0_FREQ, &prescaler0, &target_count0))
+	trig_in_inverted = 0;
+	
+	update_awex_gate(HAL_CH0_AWEX, 0);
+	update_awex_gate(HAL_CH2_AWEX, 2);
+	
+	/* Inverting a pin looks like an edge, so drop the interrupts it may have raised */
+	for (uint8_t i = 0; i < 2; i++)
+		hal_trig_invert(i, trig_in_inverted & (B_LTRG0 << i));
+	
+	hal_trig_clear_flags();
+}
+
+void hwbp_app_pwm_gen_gate(uint8_t ch_mask, bool active)
+{
+	uint8_t exec_state = 0;
+	
+	for (uint8_t j = 0; j < 4; j++)
 	{
-		app_regs.REG_CH0_REAL_FREQ = 32000000.0 / ((uint32_t)(get_divider(prescaler0)) * (uint32_t)target_count0);
-		app_regs.REG_CH0_REAL_DUTYCYCLE = 100.0 * ((float)((uint16_t)(app_regs.REG_CH0_DUTYCYCLE/100.0 * target_count0 + 0.5)) / target_count0);
-		duty_cycle0 = app_regs.REG_CH0_DUTYCYCLE/100.0 * target_count0 + 0.5;
+		if (!(ch_mask & (B_TRGCH0 << j)))
+			continue;
 		
-		if (app_regs.REG_CH0_REAL_DUTYCYCLE <= 0 || app_regs.REG_CH0_REAL_DUTYCYCLE >= 100)
+		TC0_t *timer = channels[j].timer;
+		
+		if (active)
+		{
+			/* The fault cleared the override, whether the channel was paused or stopped since */
+			if (channels[j].awex)
+				hal_awex_gate_open(channels[j].awex);
+			
+			if (gate_paused & (1 << j))
+			{
+				hal_ch_timer_set_clksel(timer, channels[j].gate_clksel);
+				hal_ch_timer_output_on(timer);
+				gate_paused &= ~(1 << j);
+			}
+			else if (!(pwm_exec_state & (B_PWM0STATE << j)))
+			{
+				exec_state |= hwbp_app_pwm_gen_start(j);
+			}
+		}
+		else if (hal_ch_timer_running(timer) && !(gate_paused & (1 << j)))
 		{
-			app_regs.REG_CH0_REAL_FREQ = 0;
-			app_regs.REG_CH0_REAL_DUTYCYCLE = 0;
+			hal_ch_timer_output_off(timer);
+			channels[j].gate_clksel = hal_ch_timer_clksel(timer);
+			hal_ch_timer_set_clksel(timer, HAL_CLKSEL_FROZEN);
+			gate_paused |= (1 << j);
 		}
 	}
-	else
+	
+	if (exec_state)
+	{
+		set_SYNC_OUTALL;
+		pwm_exec_state |= exec_state;
+		
+		if (app_regs.REG_EVNT_ENABLE & B_EVT0)
+		{
+			hwbp_app_evt_queue_push_exec_state();
+		}
+	}
+}
+
+/************************************************************************/
+/* Calculate real values (frequency and duty cycle)                     */
+/************************************************************************/
+/* Copies the inputs of the channel's real values, with the current timer values kept if the solver fails */
+static void read_reals_inputs(uint8_t ch, pwm_config_t *config)
+{
+	config->freq = *((&app_regs.REG_CH0_FREQ) + ch);
+	config->dutycycle = *((&app_regs.REG_CH0_DUTYCYCLE) + ch);
+	config->counts = *((&app_regs.REG_CH0_COUNTS) + ch);
+	config->prescaler = channels[ch].prescaler;
+	config->target_count = (ch_mode(ch) & MSK_CH_CLK) ? app_regs.REG_CH_EXT_PERIOD[ch] : channels[ch].target_count;
+	config->duty_cycle = channels[ch].duty_cycle;
+}
+
+static void compute_reals(uint8_t ch, pwm_config_t *config)
+{
+	if (ch_mode(ch) & MSK_CH_CLK)
 	{
-		app_regs.REG_CH0_REAL_FREQ = 0;
-		app_regs.REG_CH0_REAL_DUTYCYCLE = 0;
+		compute_reals_ext_clock(config);
+		return;
+	}
+	
+	if (!hwbp_app_pwm_gen_compute_config(config, config->freq, config->dutycycle, config->counts))
+	{
+		config->real_freq = 0;
+		config->real_dutycycle = 0;
+	}
+}
+
+static void write_reals(uint8_t ch, const pwm_config_t *config)
+{
+	pwm_channel_t *c = &channels[ch];
+	
+	c->prescaler = config->prescaler;
+	c->target_count = config->target_count;
+	c->duty_cycle = config->duty_cycle;
+	*((&app_regs.REG_CH0_REAL_FREQ) + ch) = config->real_freq;
+	*((&app_regs.REG_CH0_REAL_DUTYCYCLE) + ch) = config->real_dutycycle;
+}
+
+void hwbp_app_pwm_gen_update_reals(uint8_t ch)
+{
+	pwm_config_t config;
+	
+	read_reals_inputs(ch, &config);
+	compute_reals(ch, &config);
+	write_reals(ch, &config);
+}
+
+/************************************************************************/
+/* Lazy update of the real values                                       */
+/*                                                                      */
+/* The register writes only mark the channel. The timer values and the  */
+/* real registers are computed once, on the next start, on a read of a  */
+/* real register or on the next millisecond, whichever comes first.     */
+/*                                                                      */
+/* Any context can preempt an update: a register write, a start or a    */
+/* train. So the inputs are copied and the results written with the     */
+/* interrupts off, and each mark or train bumps the channel's           */
+/* generation. An update only writes its results, and clears the flag,  */
+/* if the generation is the one it copied the inputs from; otherwise    */
+/* the inputs changed while it was computing and it starts again. A     */
+/* start that preempts an update still sees the flag set and computes   */
+/* the values itself.                                                   */
+/************************************************************************/
+static volatile uint8_t reals_dirty = 0;
+static volatile uint8_t reals_generation[4] = {0, 0, 0, 0};
+
+void hwbp_app_pwm_gen_mark_reals_dirty(uint8_t ch)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		reals_dirty |= (1 << ch);
+		reals_generation[ch]++;
 	}
 }
 
-void hwbp_app_pwm_gen_update_reals_ch1(void)
+/* Called with the interrupts off when the real values are written from a precomputed configuration */
+static void reals_written(uint8_t ch)
 {
-	if (calculate_timer_16bits(32000000, app_regs.REG_CH1_FREQ, &prescaler1, &target_count1))
+	reals_dirty &= ~(1 << ch);
+	reals_generation[ch]++;
+}
+
+static void update_reals_if_dirty(uint8_t ch)
+{
+	while (reals_dirty & (1 << ch))
 	{
-		app_regs.REG_CH1_REAL_FREQ = 32000000 / ((uint32_t)(get_divider(prescaler1)) * (uint32_t)target_count1);
-		app_regs.REG_CH1_REAL_DUTYCYCLE = 100.0 * ((float)((uint16_t)(app_regs.REG_CH1_DUTYCYCLE/100.0 * target_count1 + 0.5)) / target_count1);
-		duty_cycle1 = app_regs.REG_CH1_DUTYCYCLE/100.0 * target_count1 + 0.5;
+		pwm_config_t config;
+		uint8_t generation;
+		
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			generation = reals_generation[ch];
+			read_reals_inputs(ch, &config);
+		}
+		
+		compute_reals(ch, &config);
 		
-		if (app_regs.REG_CH1_REAL_DUTYCYCLE <= 0 || app_regs.REG_CH1_REAL_DUTYCYCLE >= 100)
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
 		{
-			app_regs.REG_CH1_REAL_FREQ = 0;
-			app_regs.REG_CH1_REAL_DUTYCYCLE = 0;
+			if (generation == reals_generation[ch])
+			{
+				write_reals(ch, &config);
+				reals_dirty &= ~(1 << ch);
+			}
 		}
 	}
-	else
+}
+
+void hwbp_app_pwm_gen_update_dirty_reals(void)
+{
+	for (uint8_t j = 0; j < 4; j++)
+		update_reals_if_dirty(j);
+}
+
+/************************************************************************/
+/* Staged configuration                                                 */
+/*                                                                      */
+/* The timer values of a configuration are computed beforehand, so      */
+/* applying it only copies them. Running channels that keep their       */
+/* prescaler get the new period and duty cycle through the PERBUF and   */
+/* CCABUF registers, which the timer loads at the end of the current    */
+/* period. The others are restarted together. The running channels      */
+/* count the new number of pulses from the commit.                      */
+/*                                                                      */
+/* The configurations are staged from the serial interrupt, which can   */
+/* preempt a commit done by a trigger. So they are double buffered: a   */
+/* stage fills the buffer the commits don't read and then flips them.   */
+/************************************************************************/
+static pwm_config_t staged[2][4];
+static uint8_t stage_valid[2] = {0, 0};
+static volatile uint8_t stage_front = 0;
+static uint8_t stage_armed = 0;
+
+bool hwbp_app_pwm_gen_compute_config(pwm_config_t *config, float freq, float dutycycle, uint32_t counts)
+{
+	if (!timer_solver_solve(32000000, freq, dutycycle, &config->prescaler, &config->target_count, &config->duty_cycle))
+		return false;
+	
+	config->freq = freq;
+	config->dutycycle = dutycycle;
+	config->counts = counts;
+	config->real_freq = 32000000.0 / ((uint32_t)(get_divider(config->prescaler)) * (uint32_t)config->target_count);
+	config->real_dutycycle = 100.0 * ((float)config->duty_cycle / config->target_count);
+	
+	return true;
+}
+
+void hwbp_app_pwm_gen_read_config(uint8_t ch, pwm_config_t *config)
+{
+	update_reals_if_dirty(ch);
+	
+	config->freq = *((&app_regs.REG_CH0_FREQ) + ch);
+	config->dutycycle = *((&app_regs.REG_CH0_DUTYCYCLE) + ch);
+	config->counts = *((&app_regs.REG_CH0_COUNTS) + ch);
+	config->prescaler = channels[ch].prescaler;
+	config->target_count = channels[ch].target_count;
+	config->duty_cycle = channels[ch].duty_cycle;
+	config->real_freq = *((&app_regs.REG_CH0_REAL_FREQ) + ch);
+	config->real_dutycycle = *((&app_regs.REG_CH0_REAL_DUTYCYCLE) + ch);
+}
+
+bool hwbp_app_pwm_gen_stage(uint8_t ch_mask, const float *configs)
+{
+	uint8_t back = stage_front ^ 1;
+	
+	/* The channels left out keep their staged configuration */
+	for (uint8_t j = 0; j < 4; j++)
+		staged[back][j] = staged[stage_front][j];
+	
+	stage_valid[back] = stage_valid[stage_front];
+	
+	for (uint8_t j = 0; j < 4; j++)
 	{
-		app_regs.REG_CH1_REAL_FREQ = 0;
-		app_regs.REG_CH1_REAL_DUTYCYCLE = 0;
+		if (!(ch_mask & (B_TRGCH0 << j)))
+			continue;
+		
+		if (!hwbp_app_pwm_gen_compute_config(&staged[back][j], configs[j * 3], configs[j * 3 + 1], configs[j * 3 + 2]))
+			return false;
+		
+		stage_valid[back] |= (1 << j);
 	}
+	
+	stage_front = back;
+	return true;
+}
+
+void hwbp_app_pwm_gen_commit(uint8_t ch_mask)
+{
+	uint8_t front = stage_front;
+	
+	/* Channels never staged keep their configuration */
+	hwbp_app_pwm_gen_apply_configs(ch_mask & stage_valid[front], staged[front]);
+	
+	stage_armed = 0;
+	app_regs.REG_STAGE_COMMIT = 0;
 }
 
-void hwbp_app_pwm_gen_update_reals_ch2(void)
+void hwbp_app_pwm_gen_apply_configs(uint8_t ch_mask, const pwm_config_t *configs)
 {
-	if (calculate_timer_16bits(32000000, app_regs.REG_CH2_FREQ, &prescaler2, &target_count2))
+	uint8_t restart = 0;
+	
+	/* Copy the values to the registers */
+	for (uint8_t j = 0; j < 4; j++)
 	{
-		app_regs.REG_CH2_REAL_FREQ = 32000000 / ((uint32_t)(get_divider(prescaler2)) * (uint32_t)target_count2);
-		app_regs.REG_CH2_REAL_DUTYCYCLE = 100.0 * ((float)((uint16_t)(app_regs.REG_CH2_DUTYCYCLE/100.0 * target_count2 + 0.5)) / target_count2);
-		duty_cycle2 = app_regs.REG_CH2_DUTYCYCLE/100.0 * target_count2 + 0.5;
+		pwm_channel_t *c = &channels[j];
+		
+		if (!(ch_mask & (B_TRGCH0 << j)))
+			continue;
 		
-		if (app_regs.REG_CH2_REAL_DUTYCYCLE <= 0 || app_regs.REG_CH2_REAL_DUTYCYCLE >= 100)
+		*((&app_regs.REG_CH0_FREQ) + j) = configs[j].freq;
+		*((&app_regs.REG_CH0_DUTYCYCLE) + j) = configs[j].dutycycle;
+		*((&app_regs.REG_CH0_COUNTS) + j) = configs[j].counts;
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
 		{
-			app_regs.REG_CH2_REAL_FREQ = 0;
-			app_regs.REG_CH2_REAL_DUTYCYCLE = 0;
+			reals_written(j);
 		}
+		
+		/* The channels clocked by a TRIG input only take the duty cycle */
+		if (ch_mode(j) & MSK_CH_CLK)
+		{
+			hwbp_app_pwm_gen_update_reals(j);
+			continue;
+		}
+		
+		*((&app_regs.REG_CH0_REAL_FREQ) + j) = configs[j].real_freq;
+		*((&app_regs.REG_CH0_REAL_DUTYCYCLE) + j) = configs[j].real_dutycycle;
+		c->prescaler = configs[j].prescaler;
+		c->target_count = configs[j].target_count;
+		c->duty_cycle = configs[j].duty_cycle;
 	}
-	else
+	
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
 	{
-		app_regs.REG_CH2_REAL_FREQ = 0;
-		app_regs.REG_CH2_REAL_DUTYCYCLE = 0;
+		for (uint8_t j = 0; j < 4; j++)
+		{
+			pwm_channel_t *c = &channels[j];
+			TC0_t *timer = c->timer;
+			
+			if (!(ch_mask & (B_TRGCH0 << j)) || !hal_ch_timer_running(timer))
+				continue;
+			
+			bool ext_clock = ch_mode(j) & MSK_CH_CLK;
+			
+			c->stats[CH_STATS_PULSES] += c->tcount_start - c->tcount;
+			c->tcount = configs[j].counts;
+			c->tcount_start = c->tcount;
+			
+			if (gate_paused & (1 << j))
+			{
+				/* The timer is frozen by the gate, so it can take the values right away */
+				hal_ch_timer_load_now(timer, c->target_count, c->duty_cycle);
+				if (!ext_clock)
+					c->gate_clksel = c->prescaler;
+			}
+			else if (ext_clock || hal_ch_timer_clksel(timer) == c->prescaler)
+			{
+				hal_ch_timer_load_next(timer, c->target_count, c->duty_cycle);
+			}
+			else
+			{
+				hal_ch_timer_halt(timer);
+				hal_ch_timer_load_now(timer, c->target_count, c->duty_cycle);
+				restart |= (1 << j);
+			}
+		}
+		
+		for (uint8_t j = 0; j < 4; j++)
+			if (restart & (1 << j))
+				hal_ch_timer_set_clksel(channels[j].timer, channels[j].prescaler);
 	}
 }
 
-void hwbp_app_pwm_gen_update_reals_ch3(void)
-{	
-	if (calculate_timer_16bits(32000000, app_regs.REG_CH3_FREQ, &prescaler3, &target_count3))
+void hwbp_app_pwm_gen_arm_commit(uint8_t ch_mask)
+{
+	stage_armed = ch_mask;
+}
+
+void hwbp_app_pwm_gen_commit_on_trigger(uint8_t trigger)
+{
+	if (stage_armed && (app_regs.REG_STAGE_TRIGGER & trigger))
+		hwbp_app_pwm_gen_commit(stage_armed);
+}
+
+/************************************************************************/
+/* Pulses left on Count mode or emitted on Infinite mode                */
+/*                                                                      */
+/* Each 32 bits counter is copied with the interrupts blocked for a few */
+/* cycles, so it is never read while the CCA interrupt changes it.      */
+/************************************************************************/
+void hwbp_app_pwm_gen_restart_progress(void)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
 	{
-		app_regs.REG_CH3_REAL_FREQ = 32000000 / ((uint32_t)(get_divider(prescaler3)) * (uint32_t)target_count3);
-		app_regs.REG_CH3_REAL_DUTYCYCLE = 100.0 * ((float)((uint16_t)(app_regs.REG_CH3_DUTYCYCLE/100.0 * target_count3 + 0.5)) / target_count3);
-		duty_cycle3 = app_regs.REG_CH3_DUTYCYCLE/100.0 * target_count3 + 0.5;
+		for (uint8_t j = 0; j < 4; j++)
+			channels[j].progress_count = app_regs.REG_CH_PROGRESS[j];
+	}
+}
+
+void hwbp_app_pwm_gen_read_remaining(uint32_t *remaining)
+{
+	for (uint8_t j = 0; j < 4; j++)
+	{
+		uint32_t count, start;
+		bool running;
 		
-		if (app_regs.REG_CH3_REAL_DUTYCYCLE <= 0 || app_regs.REG_CH3_REAL_DUTYCYCLE >= 100)
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
 		{
-			app_regs.REG_CH3_REAL_FREQ = 0;
-			app_regs.REG_CH3_REAL_DUTYCYCLE = 0;
+			count = channels[j].tcount;
+			start = channels[j].tcount_start;
+			running = hal_ch_timer_running(channels[j].timer);
 		}
+		
+		if (!running)
+			remaining[j] = 0;
+		else if ((ch_mode(j) & MSK_CH_MODE) == GM_CH_MODE_COUNT)
+			remaining[j] = count;
+		else
+			remaining[j] = start - count;
 	}
-	else
+}
+
+/************************************************************************/
+/* Channels' statistics                                                 */
+/*                                                                      */
+/* The interrupts only touch the counters when a train starts or ends.  */
+/* The pulses are counted from tcount, the difference between its value */
+/* at the start and its current value, when the train ends or when the  */
+/* statistics are read.                                                 */
+/************************************************************************/
+void hwbp_app_pwm_gen_read_stats(uint32_t *stats, bool clear)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
 	{
-		app_regs.REG_CH3_REAL_FREQ = 0;
-		app_regs.REG_CH3_REAL_DUTYCYCLE = 0;
+		for (uint8_t j = 0; j < 4; j++)
+		{
+			pwm_channel_t *c = &channels[j];
+			
+			for (uint8_t k = 0; k < CH_STATS_N; k++)
+				stats[j * CH_STATS_N + k] = c->stats[k];
+			
+			/* Pulses of the train still running */
+			if (hal_ch_timer_running(c->timer))
+				stats[j * CH_STATS_N + CH_STATS_PULSES] += c->tcount_start - c->tcount;
+			
+			if (clear)
+			{
+				for (uint8_t k = 0; k < CH_STATS_N; k++)
+					c->stats[k] = 0;
+				
+				c->tcount_start = c->tcount;
+			}
+		}
 	}
 }
 
 /************************************************************************/
-/* Start PWMs                                                           */
+/* Train queue                                                          */
+/*                                                                      */
+/* When a train on Count mode emits its last pulse, the CCA interrupt   */
+/* loads the next queued train into PERBUF and CCABUF. The timer takes  */
+/* them at the end of the current period, so the next train follows     */
+/* without a gap. The prescaler can't be changed this way, so a train   */
+/* must use the prescaler of the channel. When the channel's prescaler  */
+/* changes, the queue is dropped and a REG_TRAIN_LEVEL event is sent.   */
 /************************************************************************/
-uint32_t tcount0, tcount1, tcount2, tcount3;
+bool hwbp_app_pwm_gen_enqueue_train(uint8_t ch, float freq, float dutycycle, uint32_t counts)
+{
+	pwm_config_t config;
+	
+	/* The channels clocked by a TRIG input have a fixed period */
+	if (ch_mode(ch) & MSK_CH_CLK)
+		return false;
+	
+	if (!hwbp_app_pwm_gen_compute_config(&config, freq, dutycycle, counts))
+		return false;
+	
+	/* The channel's prescaler isn't computed yet after a write of its frequency */
+	update_reals_if_dirty(ch);
+	
+	if (config.prescaler != channels[ch].prescaler)
+		return false;
+	
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		uint8_t level = app_regs.REG_TRAIN_LEVEL[ch];
+		
+		if (level == TRAIN_QUEUE_SIZE)
+			return false;
+		
+		channels[ch].train_queue[(channels[ch].train_tail + level) & (TRAIN_QUEUE_SIZE - 1)] = config;
+		app_regs.REG_TRAIN_LEVEL[ch] = level + 1;
+	}
+	
+	return true;
+}
+
+void hwbp_app_pwm_gen_clear_trains(uint8_t ch_mask)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		for (uint8_t j = 0; j < 4; j++)
+			if (ch_mask & (B_TRGCH0 << j))
+				app_regs.REG_TRAIN_LEVEL[j] = 0;
+	}
+}
+
+/* Called from the CCA interrupt when the last pulse of the train was emitted */
+static inline bool load_next_train(uint8_t ch)
+{
+	pwm_channel_t *c = &channels[ch];
+	
+	if (app_regs.REG_TRAIN_LEVEL[ch] == 0)
+		return false;
+	
+	pwm_config_t *train = &c->train_queue[c->train_tail];
+	
+	/* A timer frozen by the gate keeps its prescaler aside */
+	uint8_t prescaler = (gate_paused & (1 << ch)) ? c->gate_clksel : hal_ch_timer_clksel(c->timer);
+	
+	/* The channel's frequency was changed after the train was queued */
+	if (train->prescaler != prescaler)
+	{
+		app_regs.REG_TRAIN_LEVEL[ch] = 0;
+		
+		/* Let the host know the queue was dropped */
+		if (app_regs.REG_EVNT_ENABLE & B_EVT3)
+			hwbp_app_evt_queue_push_train_level();
+		
+		return false;
+	}
+	
+	hal_ch_timer_load_next(c->timer, train->target_count, train->duty_cycle);
+	
+	c->stats[CH_STATS_TRAINS]++;
+	c->stats[CH_STATS_PULSES] += c->tcount_start;
+	c->tcount = train->counts;
+	c->tcount_start = train->counts;
+	
+	/* The channel keeps the configuration of the last train */
+	c->target_count = train->target_count;
+	c->duty_cycle = train->duty_cycle;
+	
+	/* The serial interrupt preempts this one, so a read can't see half of a value */
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		*((&app_regs.REG_CH0_FREQ) + ch) = train->freq;
+		*((&app_regs.REG_CH0_DUTYCYCLE) + ch) = train->dutycycle;
+		*((&app_regs.REG_CH0_COUNTS) + ch) = train->counts;
+		*((&app_regs.REG_CH0_REAL_FREQ) + ch) = train->real_freq;
+		*((&app_regs.REG_CH0_REAL_DUTYCYCLE) + ch) = train->real_dutycycle;
+		reals_written(ch);
+	}
+	
+	c->train_tail = (c->train_tail + 1) & (TRAIN_QUEUE_SIZE - 1);
+	app_regs.REG_TRAIN_LEVEL[ch]--;
+	
+	if (app_regs.REG_TRAIN_LEVEL[ch] <= app_regs.REG_TRAIN_LOW && (app_regs.REG_EVNT_ENABLE & B_EVT3))
+		hwbp_app_evt_queue_push_train_level();
+	
+	return true;
+}
 
+/************************************************************************/
+/* Start PWMs                                                           */
+/************************************************************************/
 void check_and_start_pwms(uint8_t start_pwm_reg)
 {
     uint8_t exec_state = 0;    
@@ -132,35 +710,25 @@ void check_and_start_pwms(uint8_t start_pwm_reg)
             /* Run trough each channel trigger */
             for (uint8_t j = 0; j < 4; j++)
             {
-                /* Check if the channel is not already running */
-                if (!(app_regs.REG_EXEC_STATE & (B_PWM0STATE << j)))
-                {
-                    /* Check if the channel should start */
-                    if (*((&app_regs.REG_TRG0_MASK) + i) & (B_TRGCH0 << j))
-                    {                    
-                        switch (j)
-                        {
-                            case 0: exec_state |= hwbp_app_pwm_gen_start_ch0(); break;
-                            case 1: exec_state |= hwbp_app_pwm_gen_start_ch1(); break;
-                            case 2: exec_state |= hwbp_app_pwm_gen_start_ch2(); break;
-                            case 3: exec_state |= hwbp_app_pwm_gen_start_ch3(); break;
-                        }
-                        
-                        if (TCC0_CTRLA != 0 || TCD0_CTRLA != 0 || TCE0_CTRLA != 0 || TCF0_CTRLA != 0)
-                        {
-                        	set_SYNC_OUTALL;
-                        }                            
-                    }
+                /* Check if the channel should start, the running ones are counted as busy */
+                if (*((&app_regs.REG_TRG0_MASK) + i) & (B_TRGCH0 << j))
+                {                    
+                    exec_state |= hwbp_app_pwm_gen_start(j);
+                    
+                    if (hal_any_ch_timer_running)
+                    {
+                    	set_SYNC_OUTALL;
+                    }                            
                 }
             }
             
             if (exec_state)
             {   
-                app_regs.REG_EXEC_STATE |= exec_state;
+                pwm_exec_state |= exec_state;
                 
                 if (app_regs.REG_EVNT_ENABLE & B_EVT0)
                 {
-                    core_func_send_event(ADD_REG_EXEC_STATE, true);
+                    hwbp_app_evt_queue_push_exec_state();
                 }
                 
                 exec_state = 0;
@@ -169,76 +737,59 @@ void check_and_start_pwms(uint8_t start_pwm_reg)
     }
 }
 
-uint8_t hwbp_app_pwm_gen_start_ch0(void)
+uint8_t hwbp_app_pwm_gen_start(uint8_t ch)
 {
-	if (!(app_regs.REG_CH_CONFEN & B_USEEN0) || ((app_regs.REG_CH_CONFEN & B_USEEN0) && (app_regs.REG_CH_ENABLE & B_EN0)))
-	{		
-		if (!(TCC0_CTRLA))
-        {
-            tcount0 = app_regs.REG_CH0_COUNTS;
-
-		    timer_type0_pwm(&TCC0, prescaler0, target_count0, duty_cycle0, INT_LEVEL_LOW, INT_LEVEL_LOW);
-		    set_SYNC_OUT0;
-        
-            return B_PWM0STATE;
-        }            
+	pwm_channel_t *c = &channels[ch];
+	
+	if (!(app_regs.REG_CH_CONFEN & (B_USEEN0 << ch)) || (app_regs.REG_CH_ENABLE & (B_EN0 << ch)))
+	{
+		if (!(pwm_exec_state & (B_PWM0STATE << ch)) && !hal_ch_timer_running(c->timer))
+		{
+			update_reals_if_dirty(ch);
+			c->tcount = *((&app_regs.REG_CH0_COUNTS) + ch);
+			c->tcount_start = c->tcount;
+			c->progress_count = app_regs.REG_CH_PROGRESS[ch];
+			
+			if (ch_mode(ch) & MSK_CH_CLK)
+				hal_ch_timer_start_clksel(c->timer, ext_clksel(ch), c->target_count, c->duty_cycle);
+			else
+				hal_ch_timer_start(c->timer, c->prescaler, c->target_count, c->duty_cycle);
+			hal_ch_sync_set(c->sync_port);
+			PROF_STARTED();
+			
+			c->stats[CH_STATS_ACCEPTED]++;
+			return B_PWM0STATE << ch;
+		}
+		
+		c->stats[CH_STATS_BUSY]++;
 	}
-    
-    return 0;    
-}
-
-uint8_t hwbp_app_pwm_gen_start_ch1(void)
-{
-	if (!(app_regs.REG_CH_CONFEN & B_USEEN1) || ((app_regs.REG_CH_CONFEN & B_USEEN1) && (app_regs.REG_CH_ENABLE & B_EN1)))
-	{		
-		if (!(TCD0_CTRLA))
-        {
-		    tcount1 = app_regs.REG_CH1_COUNTS;
-
-		    timer_type0_pwm(&TCD0, prescaler1, target_count1, duty_cycle1, INT_LEVEL_LOW, INT_LEVEL_LOW);
-		    set_SYNC_OUT1;
-        
-            return B_PWM1STATE;
-        }            
+	else
+	{
+		c->stats[CH_STATS_DISABLED]++;
 	}
-    
-    return 0;
+	
+	return 0;
 }
 
-uint8_t hwbp_app_pwm_gen_start_ch2(void)
+/************************************************************************/
+/* Start the channels on a mask and return the started ones             */
+/*                                                                      */
+/* Used to start the chained channels from the CCA interrupt right      */
+/* after the last pulse, so they start within the interrupt latency.    */
+/* The timers can't be started by an event, so this is done by the CPU. */
+/************************************************************************/
+static uint8_t start_masked_pwms(uint8_t ch_mask)
 {
-	if (!(app_regs.REG_CH_CONFEN & B_USEEN2) || ((app_regs.REG_CH_CONFEN & B_USEEN2) && (app_regs.REG_CH_ENABLE & B_EN2)))
-	{		
-		if (!(TCE0_CTRLA))
-        {
-		    tcount2 = app_regs.REG_CH2_COUNTS;
-
-		    timer_type0_pwm(&TCE0, prescaler2, target_count2, duty_cycle2, INT_LEVEL_LOW, INT_LEVEL_LOW);
-		    set_SYNC_OUT2;
-        
-            return B_PWM2STATE;
-        }            
-	}
+    uint8_t exec_state = 0;
     
-    return 0;
-}
-
-uint8_t hwbp_app_pwm_gen_start_ch3(void)
-{
-	if (!(app_regs.REG_CH_CONFEN & B_USEEN3) || ((app_regs.REG_CH_CONFEN & B_USEEN3) && (app_regs.REG_CH_ENABLE & B_EN3)))
-	{		
-		if (!(TCF0_CTRLA))
-        {
-		    tcount3 = app_regs.REG_CH3_COUNTS;
-
-		    timer_type0_pwm(&TCF0, prescaler3, target_count3, duty_cycle3, INT_LEVEL_LOW, INT_LEVEL_LOW);
-		    set_SYNC_OUT3;
-        
-            return B_PWM3STATE;
-        }            
-	}
+    for (uint8_t j = 0; j < 4; j++)
+        if (ch_mask & (B_TRGCH0 << j))
+            exec_state |= hwbp_app_pwm_gen_start(j);
     
-    return 0;
+    if (exec_state)
+        set_SYNC_OUTALL;
+    
+    return exec_state;
 }
 
 /************************************************************************/
@@ -260,20 +811,14 @@ void check_and_stop_pwms(uint8_t stop_pwm_reg)
             for (uint8_t j = 0; j < 4; j++)
             {
                 /* Check if the channel is running */
-                if (app_regs.REG_EXEC_STATE & (B_PWM0STATE << j))
+                if (pwm_exec_state & (B_PWM0STATE << j))
                 {
                     /* Check if the channel should stop */
                     if (*((&app_regs.REG_TRG0_MASK) + i) & (B_TRGCH0 << j))
                     {
-                        switch (j)
-                        {
-                            case 0: exec_state |= hwbp_app_pwm_gen_stop_ch0(); break;
-                            case 1: exec_state |= hwbp_app_pwm_gen_stop_ch1(); break;
-                            case 2: exec_state |= hwbp_app_pwm_gen_stop_ch2(); break;
-                            case 3: exec_state |= hwbp_app_pwm_gen_stop_ch3(); break;
-                        }
+                        exec_state |= hwbp_app_pwm_gen_stop(j);
                         
-                        if (TCC0_CTRLA == 0 && TCD0_CTRLA == 0 && TCE0_CTRLA == 0 && TCF0_CTRLA == 0)
+                        if (!hal_any_ch_timer_running)
                         {
                         	clr_SYNC_OUTALL;
                         }                            
@@ -283,11 +828,11 @@ void check_and_stop_pwms(uint8_t stop_pwm_reg)
             
             if (exec_state)
             {
-                app_regs.REG_EXEC_STATE &= ~(exec_state);
+                pwm_exec_state &= ~(exec_state);
                 
                 if (app_regs.REG_EVNT_ENABLE & B_EVT0)
                 {
-                    core_func_send_event(ADD_REG_EXEC_STATE, true);
+                    hwbp_app_evt_queue_push_exec_state();
                 }
                 
                 exec_state = 0;
@@ -295,102 +840,186 @@ void check_and_stop_pwms(uint8_t stop_pwm_reg)
         }
     }
     
-    update_enabled_pwmx();
+    hwbp_app_evt_queue_request_leds();
 }
 
-uint8_t hwbp_app_pwm_gen_stop_ch0(void)
+uint8_t hwbp_app_pwm_gen_stop(uint8_t ch)
 {
-	if (TCC0_CTRLA)
-    {
-        timer_type0_stop(&TCC0);
-	    clr_SYNC_OUT0;
-        
-        if (app_regs.REG_CH_ENABLE_SINGLE & B_SGLE0)
-    	    app_regs.REG_CH_ENABLE &= ~(B_EN0);
-    	    
-    	return B_PWM0STATE;
+	pwm_channel_t *c = &channels[ch];
+	
+	if (hal_ch_timer_running(c->timer))
+	{
+		hal_ch_timer_stop(c->timer);
+		c->stats[CH_STATS_PULSES] += c->tcount_start - c->tcount;
+		gate_paused &= ~(1 << ch);
+		hal_ch_sync_clr(c->sync_port);
+		
+		if (app_regs.REG_CH_ENABLE_SINGLE & (B_SGLE0 << ch))
+			app_regs.REG_CH_ENABLE &= ~(B_EN0 << ch);
+		
+		return B_PWM0STATE << ch;
 	}
 	
 	return 0;
 }
 
-uint8_t hwbp_app_pwm_gen_stop_ch1(void)
+/************************************************************************/
+/* Virtual triggers                                                     */
+/*                                                                      */
+/* Each virtual trigger is a 32 entries truth table indexed by the      */
+/* levels of TRIG_IN0 (bit 0) to TRIG_IN3 (bit 3) and TRIG_ALL (bit 4). */
+/* The table is evaluated on every edge of any of the TRIG inputs and   */
+/* acts on its channels when the result changes.                        */
+/************************************************************************/
+static uint8_t vtrg_state = 0;
+
+static uint8_t read_trig_levels(void)
 {
-	if (TCD0_CTRLA)
-	{
-    	timer_type0_stop(&TCD0);
-	    clr_SYNC_OUT1;
-	    
-	    if (app_regs.REG_CH_ENABLE_SINGLE & B_SGLE1)
-	        app_regs.REG_CH_ENABLE &= ~(B_EN1);
-	    
-	    return B_PWM1STATE;
-    }
-    
-    return 0;
+	uint8_t levels = read_TRIG_IN0_LEVEL | read_TRIG_IN1_LEVEL;
+	
+	levels |= (read_TRIG_IN2) ? B_LTRG2 : 0;
+	levels |= (read_TRIG_IN3) ? B_LTRG3 : 0;
+	levels |= (read_TRIG_ALL) ? B_LTRGALL : 0;
+	
+	return levels;
 }
 
-uint8_t hwbp_app_pwm_gen_stop_ch2(void)
+static uint8_t evaluate_virtual_triggers(uint8_t levels)
 {
-	if (TCE0_CTRLA)
-	{
-    	timer_type0_stop(&TCE0);
-	    clr_SYNC_OUT2;
-		
-        if (app_regs.REG_CH_ENABLE_SINGLE & B_SGLE2)
-		    app_regs.REG_CH_ENABLE &= ~(B_EN2);
-		    
-	    return B_PWM2STATE;
-    }
-    
-    return 0;
+	uint8_t state = 0;
+	
+	for (uint8_t i = 0; i < 2; i++)
+		if (((uint8_t*)(&app_regs.REG_VTRG_TABLE[i]))[levels >> 3] & (1 << (levels & 7)))
+			state |= (1 << i);
+	
+	return state;
+}
+
+void hwbp_app_pwm_gen_init_virtual_triggers(void)
+{
+	/* Only the changes that happen from now on will act on the channels */
+	vtrg_state = evaluate_virtual_triggers(read_trig_levels());
 }
 
-uint8_t hwbp_app_pwm_gen_stop_ch3(void)
+static void update_virtual_triggers(void)
 {
-	if (TCF0_CTRLA)
+	uint8_t state = evaluate_virtual_triggers(read_trig_levels());
+	uint8_t changed = state ^ vtrg_state;
+	
+	vtrg_state = state;
+	
+	for (uint8_t i = 0; i < 2; i++)
 	{
-    	timer_type0_stop(&TCF0);
-	    clr_SYNC_OUT3;	
+		if (!(changed & (1 << i)))
+			continue;
 		
-        if (app_regs.REG_CH_ENABLE_SINGLE & B_SGLE3)
-		    app_regs.REG_CH_ENABLE &= ~(B_EN3);
-		    
-	    return B_PWM3STATE;
-    }
-    
-    return 0;
+		bool active = state & (1 << i);
+		uint8_t ch_mask = app_regs.REG_VTRG_MASK[i];
+		uint8_t mode = app_regs.REG_VTRG_MODE[i] & MSK_TRG_MODE;
+		
+		if (mode == GM_TRG_MODE_GATE)
+		{
+			hwbp_app_pwm_gen_gate(ch_mask, active);
+		}
+		else if (active)
+		{
+			uint8_t exec_state = start_masked_pwms(ch_mask);
+			
+			if (exec_state)
+			{
+				pwm_exec_state |= exec_state;
+				
+				if (app_regs.REG_EVNT_ENABLE & B_EVT0)
+				{
+					hwbp_app_evt_queue_push_exec_state();
+				}
+			}
+		}
+		else if (mode == GM_TRG_MODE_START_AND_STOP)
+		{
+			uint8_t exec_state = 0;
+			
+			for (uint8_t j = 0; j < 4; j++)
+				if (ch_mask & (B_TRGCH0 << j))
+					exec_state |= hwbp_app_pwm_gen_stop(j);
+			
+			if (!hal_any_ch_timer_running)
+				clr_SYNC_OUTALL;
+			
+			if (exec_state)
+			{
+				pwm_exec_state &= ~(exec_state);
+				
+				if (app_regs.REG_EVNT_ENABLE & B_EVT0)
+				{
+					hwbp_app_evt_queue_push_exec_state();
+				}
+				
+				hwbp_app_evt_queue_request_leds();
+			}
+		}
+	}
 }
 
 /************************************************************************/
 /* PWM interrupts                                                       */
+/*                                                                      */
+/* The CCA interrupts are wrappers of the same handler, inlined with    */
+/* the channel as a constant, so the descriptor's fields are reached    */
+/* with fixed addresses.                                                */
 /************************************************************************/
+static inline void channel_cca(uint8_t ch) __attribute__((always_inline));
+static inline void channel_cca(uint8_t ch)
+{
+	pwm_channel_t *c = &channels[ch];
+	
+	if (app_regs.REG_CH_PROGRESS[ch] && --c->progress_count == 0)
+	{
+		c->progress_count = app_regs.REG_CH_PROGRESS[ch];
+		
+		if (app_regs.REG_EVNT_ENABLE & B_EVT2)
+			hwbp_app_evt_queue_push_progress();
+	}
+	
+	if (--c->tcount == 0)
+		if ((ch_mode(ch) & MSK_CH_MODE) == GM_CH_MODE_COUNT && !load_next_train(ch))
+		{
+			c->stats[CH_STATS_TRAINS]++;
+			hwbp_app_pwm_gen_stop(ch);
+			pwm_exec_state &= ~(B_PWM0STATE << ch);
+			
+			uint8_t chained = start_masked_pwms(app_regs.REG_CH_CHAIN[ch]);
+			
+			if (!hal_any_ch_timer_running)
+				clr_SYNC_OUTALL;
+			
+			/* A channel chained to itself restarts, so its stop gets an event of its own */
+			if ((chained & (B_PWM0STATE << ch)) && (app_regs.REG_EVNT_ENABLE & B_EVT0))
+			{
+				hwbp_app_evt_queue_push_exec_state();
+			}
+			
+			pwm_exec_state |= chained;
+			
+			if (app_regs.REG_EVNT_ENABLE & B_EVT0)
+			{
+				hwbp_app_evt_queue_push_exec_state();
+			}
+			
+			hwbp_app_evt_queue_request_leds();
+		}
+}
+
 ISR(TCC0_OVF_vect, ISR_NAKED)
 {
 	reti();
 }
 
-ISR(TCC0_CCA_vect, ISR_NAKED)
+ISR(TCC0_CCA_vect)
 {
-	if (--tcount0 == 0)
-		if ((app_regs.REG_CH0_MODE & MSK_CH_MODE) == GM_CH_MODE_COUNT)
-		{
-			hwbp_app_pwm_gen_stop_ch0();
-            
-            if (TCD0_CTRLA == 0 && TCE0_CTRLA == 0 && TCF0_CTRLA == 0)
-                clr_SYNC_OUTALL;
-            
-            app_regs.REG_EXEC_STATE &= ~(B_PWM0STATE);
-            
-            if (app_regs.REG_EVNT_ENABLE & B_EVT0)
-            {
-                core_func_send_event(ADD_REG_EXEC_STATE, true);
-            }
-            
-            update_enabled_pwmx();
-		}
-
-	reti();
+	PROF_ISR_ENTER();
+	channel_cca(0);
+	PROF_ISR_EXIT(PROF_ISR_CCA0);
 }
 
 ISR(TCD0_OVF_vect, ISR_NAKED)
@@ -398,27 +1027,11 @@ ISR(TCD0_OVF_vect, ISR_NAKED)
 	reti();
 }
 
-ISR(TCD0_CCA_vect, ISR_NAKED)
+ISR(TCD0_CCA_vect)
 {
-	if (--tcount1 == 0)
-		if ((app_regs.REG_CH1_MODE & MSK_CH_MODE) == GM_CH_MODE_COUNT)
-		{
-    		hwbp_app_pwm_gen_stop_ch1();            
-            
-            if (TCC0_CTRLA == 0 && TCE0_CTRLA == 0 && TCF0_CTRLA == 0)
-                clr_SYNC_OUTALL;
-            
-            app_regs.REG_EXEC_STATE &= ~(B_PWM1STATE);
-            
-            if (app_regs.REG_EVNT_ENABLE & B_EVT0)
-            {
-                core_func_send_event(ADD_REG_EXEC_STATE, true);
-            }
-            
-            update_enabled_pwmx();
-		}
-
-	reti();
+	PROF_ISR_ENTER();
+	channel_cca(1);
+	PROF_ISR_EXIT(PROF_ISR_CCA1);
 }
 
 ISR(TCE0_OVF_vect, ISR_NAKED)
@@ -426,173 +1039,154 @@ ISR(TCE0_OVF_vect, ISR_NAKED)
 	reti();
 }
 
-ISR(TCE0_CCA_vect, ISR_NAKED)
+ISR(TCE0_CCA_vect)
 {
-	if (--tcount2 == 0)
-		if ((app_regs.REG_CH2_MODE & MSK_CH_MODE) == GM_CH_MODE_COUNT)
-		{
-			hwbp_app_pwm_gen_stop_ch2();
-            
-            if (TCC0_CTRLA == 0 && TCD0_CTRLA == 0 && TCF0_CTRLA == 0)
-                clr_SYNC_OUTALL;
-            
-            app_regs.REG_EXEC_STATE &= ~(B_PWM2STATE);
-            
-            if (app_regs.REG_EVNT_ENABLE & B_EVT0)
-            {
-                core_func_send_event(ADD_REG_EXEC_STATE, true);
-            }
-            
-            update_enabled_pwmx();
-		}
-
-	reti();
+	PROF_ISR_ENTER();
+	channel_cca(2);
+	PROF_ISR_EXIT(PROF_ISR_CCA2);
 }
 
-
 ISR(TCF0_OVF_vect, ISR_NAKED)
 {
 	reti();
 }
 
-ISR(TCF0_CCA_vect, ISR_NAKED)
+ISR(TCF0_CCA_vect)
 {
-	if (--tcount3 == 0)
-		if ((app_regs.REG_CH3_MODE & MSK_CH_MODE) == GM_CH_MODE_COUNT)
-		{
-			hwbp_app_pwm_gen_stop_ch3();
-            
-            if (TCC0_CTRLA == 0 && TCD0_CTRLA == 0 && TCE0_CTRLA == 0)
-                clr_SYNC_OUTALL;
-            
-            app_regs.REG_EXEC_STATE &= ~(B_PWM3STATE);
-            
-            if (app_regs.REG_EVNT_ENABLE & B_EVT0)
-            {
-                core_func_send_event(ADD_REG_EXEC_STATE, true);
-            }
-            
-            update_enabled_pwmx();
-		}
-
-	reti();
+	PROF_ISR_ENTER();
+	channel_cca(3);
+	PROF_ISR_EXIT(PROF_ISR_CCA3);
 }
 
 /************************************************************************/
 /* External pin interrupts                                              */
+/*                                                                      */
+/* The TRIG_INx and TRIG_ALL interrupts are wrappers of the same        */
+/* handler, inlined with the input as a constant, like the CCA          */
+/* interrupts. TRIG_ALL is input 4 and acts on the four channels, as    */
+/* set by REG_TRGALL_MODE, whose B_NEG is the same bit as B_NTRG.       */
 /************************************************************************/
-/* TRIG_IN0 */
-ISR(PORTF_INT0_vect, ISR_NAKED)
-{	
-	if((read_TRIG_IN0 && !(app_regs.REG_TRG0_MODE & B_NTRG)) || (!read_TRIG_IN0 && (app_regs.REG_TRG0_MODE & B_NTRG)))
+#define TRG_ALL 4
+
+static void start_all_pwms(void)
+{
+	uint8_t exec_state = 0;
+	
+	for (uint8_t j = 0; j < 4; j++)
+		exec_state |= hwbp_app_pwm_gen_start(j);
+	
+	set_SYNC_OUTALL;
+	
+	if (exec_state)
 	{
-        check_and_start_pwms(B_START_TRG0);
+		pwm_exec_state |= exec_state;
+		
+		if (app_regs.REG_EVNT_ENABLE & B_EVT0)
+			hwbp_app_evt_queue_push_exec_state();
 	}
-	else if((app_regs.REG_TRG0_MODE & MSK_TRG_MODE) == GM_TRG_MODE_START_AND_STOP)
+}
+
+static void stop_all_pwms(void)
+{
+	uint8_t exec_state = 0;
+	
+	for (uint8_t j = 0; j < 4; j++)
+		exec_state |= hwbp_app_pwm_gen_stop(j);
+	
+	clr_SYNC_OUTALL;
+	
+	if (exec_state)
 	{
-        check_and_stop_pwms(B_STOP_TRG0);
+		pwm_exec_state &= ~(exec_state);
+		
+		if (app_regs.REG_EVNT_ENABLE & B_EVT0)
+			hwbp_app_evt_queue_push_exec_state();
 	}
-
-	reti();
 }
 
-/* TRIG_IN1 */
-ISR(PORTF_INT1_vect, ISR_NAKED)
+static inline void trigger_input(uint8_t trg, bool level) __attribute__((always_inline));
+static inline void trigger_input(uint8_t trg, bool level)
 {
-	if((read_TRIG_IN1 && !(app_regs.REG_TRG1_MODE & B_NTRG)) || (!read_TRIG_IN1 && (app_regs.REG_TRG1_MODE & B_NTRG)))
+	uint8_t mode = (trg == TRG_ALL) ? app_regs.REG_TRGALL_MODE : *((&app_regs.REG_TRG0_MODE) + trg);
+	bool active = (level && !(mode & B_NTRG)) || (!level && (mode & B_NTRG));
+	
+	/* A staged configuration or a preset is applied before the trigger acts on the channels */
+	if (active)
 	{
-    	check_and_start_pwms(B_START_TRG1);
+		hwbp_app_pwm_gen_commit_on_trigger(B_LTRG0 << trg);
+		hwbp_app_preset_on_trigger(B_LTRG0 << trg);
 	}
-	else if((app_regs.REG_TRG1_MODE & MSK_TRG_MODE) == GM_TRG_MODE_START_AND_STOP)
+	
+	if (trg == TRG_ALL)
 	{
-    	check_and_stop_pwms(B_STOP_TRG1);
+		uint8_t all_mode = mode & MSK_ALL_MODE;
+		
+		if (active && (all_mode == GM_ALL_MODE_TRIG_ALL || all_mode == GM_ALL_MODE_TRIG_ALL_AND_STOP))
+		{
+			start_all_pwms();
+		}
+		else if (active)
+		{
+			app_regs.REG_CH_ENABLE |= B_EN3 | B_EN2 | B_EN1 | B_EN0;
+			hwbp_app_evt_queue_request_leds();
+		}
+		else if (all_mode == GM_ALL_MODE_TRIG_ALL_AND_STOP || all_mode == GM_ALL_MODE_ENABLE_AND_STOP)
+		{
+			stop_all_pwms();
+		}
 	}
-
-	reti();
-}
-
-
-/* TRIG_IN2 */
-ISR(PORTH_INT0_vect, ISR_NAKED)
-{
-	if((read_TRIG_IN2 && !(app_regs.REG_TRG2_MODE & B_NTRG)) || (!read_TRIG_IN2 && (app_regs.REG_TRG2_MODE & B_NTRG)))
+	else if ((mode & MSK_TRG_MODE) == GM_TRG_MODE_GATE)
 	{
-    	check_and_start_pwms(B_START_TRG2);
+		hwbp_app_pwm_gen_gate(*((&app_regs.REG_TRG0_MASK) + trg), active);
 	}
-	else if((app_regs.REG_TRG2_MODE & MSK_TRG_MODE) == GM_TRG_MODE_START_AND_STOP)
+	else if (active)
 	{
-    	check_and_stop_pwms(B_STOP_TRG2);
+		check_and_start_pwms(B_START_TRG0 << trg);
 	}
-
-	reti();
+	else if ((mode & MSK_TRG_MODE) == GM_TRG_MODE_START_AND_STOP)
+	{
+		check_and_stop_pwms(B_STOP_TRG0 << trg);
+	}
+	
+	update_virtual_triggers();
 }
 
+/* TRIG_IN0 */
+ISR(PORTF_INT0_vect)
+{
+	PROF_TRIGGER_ENTER();
+	trigger_input(0, read_TRIG_IN0_LEVEL);
+	PROF_TRIGGER_EXIT(PROF_ISR_TRG0);
+}
 
-/* TRIG_IN3 */
-ISR(PORTK_INT0_vect, ISR_NAKED)
+/* TRIG_IN1 */
+ISR(PORTF_INT1_vect)
 {
-	if((read_TRIG_IN3 && !(app_regs.REG_TRG3_MODE & B_NTRG)) || (!read_TRIG_IN3 && (app_regs.REG_TRG3_MODE & B_NTRG)))
-	{
-    	check_and_start_pwms(B_START_TRG3);
-	}
-	else if((app_regs.REG_TRG3_MODE & MSK_TRG_MODE) == GM_TRG_MODE_START_AND_STOP)
-	{
-    	check_and_stop_pwms(B_STOP_TRG3);
-	}
+	PROF_TRIGGER_ENTER();
+	trigger_input(1, read_TRIG_IN1_LEVEL);
+	PROF_TRIGGER_EXIT(PROF_ISR_TRG1);
+}
 
-	reti();
+/* TRIG_IN2 */
+ISR(PORTH_INT0_vect)
+{
+	PROF_TRIGGER_ENTER();
+	trigger_input(2, read_TRIG_IN2);
+	PROF_TRIGGER_EXIT(PROF_ISR_TRG2);
 }
 
+/* TRIG_IN3 */
+ISR(PORTK_INT0_vect)
+{
+	PROF_TRIGGER_ENTER();
+	trigger_input(3, read_TRIG_IN3);
+	PROF_TRIGGER_EXIT(PROF_ISR_TRG3);
+}
 
 /* TRIG_ALL */
-ISR(PORTQ_INT0_vect, ISR_NAKED)
+ISR(PORTQ_INT0_vect)
 {
-	if((read_TRIG_ALL && !(app_regs.REG_TRGALL_MODE & B_NEG)) || (!read_TRIG_ALL && (app_regs.REG_TRGALL_MODE & B_NEG)))
-	{
-		if ((app_regs.REG_TRGALL_MODE & MSK_ALL_MODE) == GM_ALL_MODE_TRIG_ALL || (app_regs.REG_TRGALL_MODE & MSK_ALL_MODE) == GM_ALL_MODE_TRIG_ALL_AND_STOP)
-		{
-            uint8_t exec_state = 0;
-            exec_state |= hwbp_app_pwm_gen_start_ch0();
-            exec_state |= hwbp_app_pwm_gen_start_ch1();
-            exec_state |= hwbp_app_pwm_gen_start_ch2();
-            exec_state |= hwbp_app_pwm_gen_start_ch3();
-            set_SYNC_OUTALL;
-            
-            if (exec_state)
-            {   
-                app_regs.REG_EXEC_STATE |= exec_state;
-                
-                if (app_regs.REG_EVNT_ENABLE & B_EVT0)
-                {
-                    core_func_send_event(ADD_REG_EXEC_STATE, true);
-                }
-            }                
-		}
-		else
-		{
-			app_regs.REG_CH_ENABLE |= B_EN3 | B_EN2 | B_EN1 | B_EN0;
-			update_enabled_pwmx();
-		}
-	}
-	else if ((app_regs.REG_TRGALL_MODE & MSK_ALL_MODE) == GM_ALL_MODE_TRIG_ALL_AND_STOP || (app_regs.REG_TRGALL_MODE & MSK_ALL_MODE) == GM_ALL_MODE_ENABLE_AND_STOP )
-	{
-        uint8_t exec_state = 0;
-        exec_state |= hwbp_app_pwm_gen_stop_ch0();
-        exec_state |= hwbp_app_pwm_gen_stop_ch1();
-        exec_state |= hwbp_app_pwm_gen_stop_ch2();
-        exec_state |= hwbp_app_pwm_gen_stop_ch3();
-        clr_SYNC_OUTALL;
-            
-        if (exec_state)
-        {
-            app_regs.REG_EXEC_STATE &= ~(exec_state);
-                
-            if (app_regs.REG_EVNT_ENABLE & B_EVT0)
-            {
-                core_func_send_event(ADD_REG_EXEC_STATE, true);
-            }
-        }       
-	}
-	
-	reti();
+	PROF_TRIGGER_ENTER();
+	trigger_input(TRG_ALL, read_TRIG_ALL);
+	PROF_TRIGGER_EXIT(PROF_ISR_TRGALL);
 }
\ No newline at end of file
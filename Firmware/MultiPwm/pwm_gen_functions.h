@@ -6,30 +6,111 @@
 /************************************************************************/
 uint16_t get_divider(uint8_t prescaler);
 
+/************************************************************************/
+/* Running channels                                                     */
+/*                                                                      */
+/* B_PWMxSTATE bits of the channels that are running. REG_EXEC_STATE    */
+/* is the copy read by the host, see event_queue_functions.h.           */
+/************************************************************************/
+extern uint8_t pwm_exec_state;
+
 /************************************************************************/
 /* Calculate real values (frequency and duty cycle)                     */
 /************************************************************************/
-void hwbp_app_pwm_gen_update_reals_ch0(void);
-void hwbp_app_pwm_gen_update_reals_ch1(void);
-void hwbp_app_pwm_gen_update_reals_ch2(void);
-void hwbp_app_pwm_gen_update_reals_ch3(void);
+void hwbp_app_pwm_gen_update_reals(uint8_t ch);
+
+/************************************************************************/
+/* Lazy update of the real values                                       */
+/************************************************************************/
+void hwbp_app_pwm_gen_mark_reals_dirty(uint8_t ch);
+void hwbp_app_pwm_gen_update_dirty_reals(void);
+
+/************************************************************************/
+/* External clock                                                       */
+/************************************************************************/
+void hwbp_app_pwm_gen_update_clock_inputs(void);
+uint8_t hwbp_app_pwm_gen_clock_inputs(void);
+
+/************************************************************************/
+/* Gated mode                                                           */
+/************************************************************************/
+extern uint8_t trig_in_inverted;
+
+/* Level of TRIG_IN0 and TRIG_IN1 regardless of the pin inversion used by the AWeX gate */
+#define read_TRIG_IN0_LEVEL (((read_TRIG_IN0) ? B_LTRG0 : 0) ^ (trig_in_inverted & B_LTRG0))
+#define read_TRIG_IN1_LEVEL (((read_TRIG_IN1) ? B_LTRG1 : 0) ^ (trig_in_inverted & B_LTRG1))
+
+void hwbp_app_pwm_gen_update_gates(void);
+void hwbp_app_pwm_gen_gate(uint8_t ch_mask, bool active);
+
+/************************************************************************/
+/* Channel configuration with precomputed timer values                  */
+/************************************************************************/
+typedef struct
+{
+	float freq;
+	float dutycycle;
+	uint32_t counts;
+	uint8_t prescaler;
+	uint16_t target_count;
+	uint16_t duty_cycle;
+	float real_freq;
+	float real_dutycycle;
+} pwm_config_t;
+
+bool hwbp_app_pwm_gen_compute_config(pwm_config_t *config, float freq, float dutycycle, uint32_t counts);
+void hwbp_app_pwm_gen_read_config(uint8_t ch, pwm_config_t *config);
+void hwbp_app_pwm_gen_apply_configs(uint8_t ch_mask, const pwm_config_t *configs);
+
+/************************************************************************/
+/* Staged configuration                                                 */
+/************************************************************************/
+bool hwbp_app_pwm_gen_stage(uint8_t ch_mask, const float *configs);
+void hwbp_app_pwm_gen_commit(uint8_t ch_mask);
+void hwbp_app_pwm_gen_arm_commit(uint8_t ch_mask);
+void hwbp_app_pwm_gen_commit_on_trigger(uint8_t trigger);
+
+/************************************************************************/
+/* Virtual triggers                                                     */
+/************************************************************************/
+void hwbp_app_pwm_gen_init_virtual_triggers(void);
+
+/************************************************************************/
+/* Channels' statistics                                                 */
+/************************************************************************/
+#define CH_STATS_PULSES 0
+#define CH_STATS_TRAINS 1
+#define CH_STATS_ACCEPTED 2
+#define CH_STATS_BUSY 3
+#define CH_STATS_DISABLED 4
+#define CH_STATS_N 5
+
+void hwbp_app_pwm_gen_read_stats(uint32_t *stats, bool clear);
+
+/************************************************************************/
+/* Pulses left on Count mode or emitted on Infinite mode                */
+/************************************************************************/
+void hwbp_app_pwm_gen_read_remaining(uint32_t *remaining);
+void hwbp_app_pwm_gen_restart_progress(void);
+
+/************************************************************************/
+/* Train queue                                                          */
+/************************************************************************/
+#define TRAIN_QUEUE_SIZE 4
+
+bool hwbp_app_pwm_gen_enqueue_train(uint8_t ch, float freq, float dutycycle, uint32_t counts);
+void hwbp_app_pwm_gen_clear_trains(uint8_t ch_mask);
 
 /************************************************************************/
 /* Start PWMs                                                           */
 /************************************************************************/
 void check_and_start_pwms(uint8_t start_pwm_reg);
-uint8_t hwbp_app_pwm_gen_start_ch0(void);
-uint8_t hwbp_app_pwm_gen_start_ch1(void);
-uint8_t hwbp_app_pwm_gen_start_ch2(void);
-uint8_t hwbp_app_pwm_gen_start_ch3(void);
+uint8_t hwbp_app_pwm_gen_start(uint8_t ch);
 
 /************************************************************************/
 /* Stop PWMs                                                            */
 /************************************************************************/
 void check_and_stop_pwms(uint8_t stop_pwm_reg);
-uint8_t hwbp_app_pwm_gen_stop_ch0(void);
-uint8_t hwbp_app_pwm_gen_stop_ch1(void);
-uint8_t hwbp_app_pwm_gen_stop_ch2(void);
-uint8_t hwbp_app_pwm_gen_stop_ch3(void);
+uint8_t hwbp_app_pwm_gen_stop(uint8_t ch);
 
 #endif /* _PWM_GEN_FUNCTION_H_ */
\ No newline at end of file
@@ -0,0 +1,126 @@
+#ifndef _PWM_HAL_H_
+#define _PWM_HAL_H_
+#include "cpu.h"
+
+/************************************************************************/
+/* Timers of the channels                                               */
+/*                                                                      */
+/* The channels' logic reaches the timers, the TRIG_IN0 and TRIG_IN1    */
+/* pins and the AWeX only through these macros, so it can be built      */
+/* against another peripheral model by replacing this file.             */
+/************************************************************************/
+#define HAL_CH0_TIMER (&TCC0)
+#define HAL_CH1_TIMER (&TCD0)
+#define HAL_CH2_TIMER (&TCE0)
+#define HAL_CH3_TIMER (&TCF0)
+
+/* SYNC_OUTx is pin 1 of the port of the channel's timer */
+#define HAL_CH0_SYNC_PORT (&PORTC)
+#define HAL_CH1_SYNC_PORT (&PORTD)
+#define HAL_CH2_SYNC_PORT (&PORTE)
+#define HAL_CH3_SYNC_PORT (&PORTF)
+
+#define hal_ch_sync_set(port) ((port)->OUTSET = (1<<1))
+#define hal_ch_sync_clr(port) ((port)->OUTCLR = (1<<1))
+
+/* A stopped timer has no clock selected */
+#define hal_ch_timer_running(timer) ((timer)->CTRLA != 0)
+#define hal_any_ch_timer_running (hal_ch_timer_running(HAL_CH0_TIMER) || hal_ch_timer_running(HAL_CH1_TIMER) || hal_ch_timer_running(HAL_CH2_TIMER) || hal_ch_timer_running(HAL_CH3_TIMER))
+
+#define hal_ch_timer_start(timer, prescaler, target_count, duty_cycle) timer_type0_pwm(timer, prescaler, target_count, duty_cycle, INT_LEVEL_LOW, INT_LEVEL_LOW)
+#define hal_ch_timer_stop(timer) timer_type0_stop(timer)
+
+/* Loaded by the timer at the end of the current period */
+#define hal_ch_timer_load_next(timer, target_count, duty_cycle) do { (timer)->PERBUF = (target_count) - 1; (timer)->CCABUF = (duty_cycle); } while (0)
+
+/* Taken right away, only on a timer that doesn't count */
+#define hal_ch_timer_load_now(timer, target_count, duty_cycle) do { (timer)->PER = (target_count) - 1; (timer)->CCA = (duty_cycle); } while (0)
+
+/************************************************************************/
+/* Clock of the channels' timers                                        */
+/*                                                                      */
+/* The clock is the prescaler of the internal clock, one of the TRIG    */
+/* inputs through event channels 0 and 1, or event channel 7, which has */
+/* no source and so freezes the counter. A halted timer is rewound and  */
+/* keeps its waveform and interrupts until its clock is set again.      */
+/************************************************************************/
+#define HAL_CLKSEL_TRIG0 TC_CLKSEL_EVCH0_gc
+#define HAL_CLKSEL_TRIG1 TC_CLKSEL_EVCH1_gc
+#define HAL_CLKSEL_FROZEN TC_CLKSEL_EVCH7_gc
+
+#define hal_ch_timer_clksel(timer) ((timer)->CTRLA)
+#define hal_ch_timer_set_clksel(timer, clksel) ((timer)->CTRLA = (clksel))
+#define hal_ch_timer_halt(timer) do { (timer)->CTRLA = 0; (timer)->CNT = 0; } while (0)
+
+/* timer_type0_pwm() only takes the prescalers of the internal clock */
+#define hal_ch_timer_start_clksel(timer, clksel, target_count, duty_cycle) do { \
+	(timer)->CTRLA = 0; \
+	(timer)->CTRLB = TC0_CCAEN_bm | TC_WGMODE_SS_gc; \
+	(timer)->CNT = 0; \
+	(timer)->PER = (target_count) - 1; \
+	(timer)->CCA = (duty_cycle); \
+	(timer)->INTCTRLA = INT_LEVEL_LOW; \
+	(timer)->INTCTRLB = INT_LEVEL_LOW; \
+	(timer)->CTRLA = (clksel); } while (0)
+
+/* PWM_OUTx follows the compare match only while its output is enabled */
+#define hal_ch_timer_output_on(timer) ((timer)->CTRLB |= TC0_CCAEN_bm)
+#define hal_ch_timer_output_off(timer) ((timer)->CTRLB &= ~TC0_CCAEN_bm)
+
+/************************************************************************/
+/* TRIG_IN0 and TRIG_IN1                                                */
+/*                                                                      */
+/* Pins 5 and 6 of PORTF, on the port's interrupts 0 and 1. Indexed by  */
+/* the input, since their control, mask and flag registers follow each  */
+/* other.                                                               */
+/************************************************************************/
+#define HAL_TRIG_PORT (&PORTF)
+#define hal_trig_pin(i) (5 + (i))
+#define hal_trig_pinctrl(i) ((&HAL_TRIG_PORT->PIN0CTRL)[hal_trig_pin(i)])
+#define hal_trig_intmask(i) ((&HAL_TRIG_PORT->INT0MASK)[i])
+
+/* A clock input only makes events, on its rising edges */
+#define hal_trig_to_clock(i) do { \
+	hal_trig_intmask(i) &= ~(1 << hal_trig_pin(i)); \
+	hal_trig_pinctrl(i) = (hal_trig_pinctrl(i) & ~PORT_ISC_gm) | PORT_ISC_RISING_gc; } while (0)
+
+#define hal_trig_to_trigger(i) do { \
+	hal_trig_pinctrl(i) = (hal_trig_pinctrl(i) & ~PORT_ISC_gm) | PORT_ISC_BOTHEDGES_gc; \
+	HAL_TRIG_PORT->INTFLAGS = PORT_INT0IF_bm << (i); \
+	hal_trig_intmask(i) |= (1 << hal_trig_pin(i)); } while (0)
+
+#define hal_trig_invert(i, inverted) do { \
+	if (inverted) hal_trig_pinctrl(i) |= PORT_INVEN_bm; \
+	else hal_trig_pinctrl(i) &= ~PORT_INVEN_bm; } while (0)
+
+#define hal_trig_clear_flags() (HAL_TRIG_PORT->INTFLAGS = PORT_INT0IF_bm | PORT_INT1IF_bm)
+
+/************************************************************************/
+/* AWeX of channels 0 and 2                                             */
+/*                                                                      */
+/* Gating the output removes the waveform override of pin 0 when the    */
+/* level of event channel evch, the fault input, is high. Opening the   */
+/* gate sets it back right away, instead of on the next UPDATE.         */
+/************************************************************************/
+#define HAL_CH0_AWEX (&AWEXC)
+#define HAL_CH2_AWEX (&AWEXE)
+
+#define hal_awex_gate_on(awex, evch) do { \
+	(awex)->DTBOTH = 0; \
+	(awex)->OUTOVEN = (1<<0); \
+	(awex)->FDEMASK = (1 << (evch)); \
+	(awex)->FDCTRL = AWEX_FDMODE_bm | AWEX_FDACT_CLEAROE_gc; \
+	(awex)->CTRL = AWEX_DTICCAEN_bm; } while (0)
+
+#define hal_awex_gate_open(awex) do { \
+	if ((awex)->CTRL & AWEX_DTICCAEN_bm) { \
+		(awex)->STATUS = AWEX_FDF_bm; \
+		(awex)->OUTOVEN = (1<<0); } } while (0)
+
+#define hal_awex_gate_off(awex) do { \
+	(awex)->CTRL = 0; \
+	(awex)->FDEMASK = 0; \
+	(awex)->FDCTRL = 0; \
+	(awex)->OUTOVEN = 0; } while (0)
+
+#endif /* _PWM_HAL_H_ */
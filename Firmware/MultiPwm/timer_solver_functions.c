@@ -0,0 +1,66 @@
+#include "timer_solver_functions.h"
+
+/************************************************************************/
+/* Timer solver                                                         */
+/*                                                                      */
+/* Every prescaler is tried with the target count nearest to the ideal  */
+/* period. The frequency error relative to the period and the duty      */
+/* cycle error are both taken as fractions with 16 bits, so 1 % of      */
+/* frequency weights as much as 1 % of duty cycle, and the smallest sum */
+/* wins. On a tie the smaller prescaler is kept for its finer steps.    */
+/*                                                                      */
+/* Only the two conversions from the float registers use float math.    */
+/* This file doesn't depend on the AVR headers so the host tools can    */
+/* build it as well.                                                    */
+/************************************************************************/
+const uint16_t timer_solver_dividers[TIMER_SOLVER_N_PRESCALERS] = {0, 1, 2, 4, 8, 64, 256, 1024};
+
+/* Ideal period in 1/16 of CPU cycles */
+#define PERIOD_SHIFT 4
+
+uint8_t timer_solver_solve(uint32_t f_cpu, float freq, float dutycycle, uint8_t *prescaler, uint16_t *target_count, uint16_t *duty_cycle)
+{
+	/* Keeps the ideal period below 2^32 up to f_cpu = 128 MHz */
+	if (freq < 0.5f || dutycycle <= 0 || dutycycle >= 100)
+		return 0;
+
+	/* Float literals, so the host tools round as the AVR, where double is float */
+	uint32_t period = (float)f_cpu * (1 << PERIOD_SHIFT) / freq + 0.5f;
+	uint32_t dc = dutycycle * 655.36f + 0.5f;           // Fraction of the period with 16 bits
+	uint32_t best_score = 0xFFFFFFFF;
+
+	for (uint8_t p = 1; p < TIMER_SOLVER_N_PRESCALERS; p++)
+	{
+		uint32_t step = (uint32_t)timer_solver_dividers[p] << PERIOD_SHIFT;
+		uint32_t target = (period + step / 2) / step;
+
+		if (target < 2 || target > 65535)
+			continue;
+
+		uint32_t duty = (dc * target + 32768) >> 16;
+
+		if (duty == 0 || duty >= target)
+			continue;
+
+		uint32_t real_period = target * step;
+		uint32_t freq_error = (real_period > period) ? real_period - period : period - real_period;
+
+		/* Fits on 32 bits since the error is at most half of the step, 2^13 */
+		freq_error = (freq_error << 16) / period;
+
+		/* Fits on 32 bits since the duty is below 2^16 */
+		uint32_t duty_error = duty << 16;
+		duty_error = (duty_error > dc * target) ? duty_error - dc * target : dc * target - duty_error;
+		duty_error /= target;
+
+		if (freq_error + duty_error < best_score)
+		{
+			best_score = freq_error + duty_error;
+			*prescaler = p;
+			*target_count = target;
+			*duty_cycle = duty;
+		}
+	}
+
+	return best_score != 0xFFFFFFFF;
+}
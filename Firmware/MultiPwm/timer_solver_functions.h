@@ -0,0 +1,18 @@
+#ifndef _TIMER_SOLVER_FUNCTIONS_H_
+#define _TIMER_SOLVER_FUNCTIONS_H_
+#include <stdint.h>
+
+/************************************************************************/
+/* Decimal divider of each prescaler                                    */
+/************************************************************************/
+/* Indexed by TIMER_PRESCALER_DIVx, 0 is the timer off */
+#define TIMER_SOLVER_N_PRESCALERS 8
+extern const uint16_t timer_solver_dividers[TIMER_SOLVER_N_PRESCALERS];
+
+/************************************************************************/
+/* Find the prescaler, target count and duty cycle count that give the  */
+/* smallest frequency and duty cycle error. Returns 0 if none is valid. */
+/************************************************************************/
+uint8_t timer_solver_solve(uint32_t f_cpu, float freq, float dutycycle, uint8_t *prescaler, uint16_t *target_count, uint16_t *duty_cycle);
+
+#endif /* _TIMER_SOLVER_FUNCTIONS_H_ */
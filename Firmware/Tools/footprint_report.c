@@ -0,0 +1,426 @@
+/************************************************************************/
+/* Firmware footprint report                                            */
+/*                                                                      */
+/* Host tool that reads the linker map of the firmware and reports the  */
+/* flash, SRAM and EEPROM used by each module, the size of the AppRegs  */
+/* bank and the size of the hot path functions (the interrupt handlers  */
+/* and the ones given with -f). It compares the result with a stored    */
+/* baseline and fails when a total grew.                                */
+/*                                                                      */
+/* Build: gcc -O2 -std=gnu99 -o footprint_report footprint_report.c     */
+/*                                                                      */
+/* Usage: footprint_report [-b baseline.txt] [-w] [-t tolerance]        */
+/*            [-r app_ios_and_regs.h] [-f function] MultiPwm.map        */
+/*                                                                      */
+/* The map is made by the Atmel Studio build next to the ELF. A module  */
+/* is a source file of the firmware, the core library or the toolchain  */
+/* (C runtime, libc, libgcc and libm). The .data section counts on both */
+/* flash, where its initial values are, and SRAM. The stack isn't       */
+/* counted, see isr_analysis for the stack of the interrupts.           */
+/*                                                                      */
+/* The report has the same format of the baseline. Without a baseline   */
+/* file, the report is written as the baseline. With -w, the baseline   */
+/* is replaced by the report, to accept the new footprint. The totals   */
+/* and the AppRegs bank can't grow more than tolerance bytes (default   */
+/* 0), the modules are only reported.                                   */
+/************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#define MAX_ENTRIES 256
+#define MAX_FUNCTIONS 32
+
+typedef struct
+{
+	char region[8];             // flash, sram, eeprom, regs or hot
+	char name[64];
+	long size;
+} entry_t;
+
+static entry_t entries[MAX_ENTRIES];
+static int n_entries;
+
+static const char *functions[MAX_FUNCTIONS];
+static int n_functions;
+
+static entry_t *find_entry(entry_t *list, int n, const char *region, const char *name)
+{
+	for (int i = 0; i < n; i++)
+		if (!strcmp(list[i].region, region) && !strcmp(list[i].name, name))
+			return &list[i];
+
+	return NULL;
+}
+
+static void add_size(const char *region, const char *name, long size)
+{
+	entry_t *e = find_entry(entries, n_entries, region, name);
+
+	if (!e)
+	{
+		if (n_entries == MAX_ENTRIES)
+			return;
+
+		e = &entries[n_entries++];
+		snprintf(e->region, sizeof(e->region), "%s", region);
+		snprintf(e->name, sizeof(e->name), "%s", name);
+		e->size = 0;
+	}
+
+	e->size += size;
+}
+
+/************************************************************************/
+/* Modules                                                              */
+/************************************************************************/
+static void module_name(const char *file, char *module, size_t len)
+{
+	const char *base = strrchr(file, '/');
+	const char *member = strchr(file, '(');
+
+	if (strrchr(file, '\\') > base)
+		base = strrchr(file, '\\');
+	base = base ? base + 1 : file;
+
+	if (strstr(file, "libATxmega"))
+	{
+		snprintf(module, len, "core library");
+	}
+	else if (member || strstr(base, "crt") == base)
+	{
+		snprintf(module, len, "toolchain");
+	}
+	else
+	{
+		/* app_funcs.o is app_funcs.c */
+		snprintf(module, len, "%s", base);
+
+		char *ext = strrchr(module, '.');
+		if (ext && !strcmp(ext, ".o"))
+			strcpy(ext, ".c");
+	}
+}
+
+static int is_hot(const char *section)
+{
+	const char *fn = strncmp(section, ".text.", 6) ? NULL : section + 6;
+
+	if (!fn)
+		return 0;
+
+	if (!strncmp(fn, "__vector_", 9))
+		return 1;
+
+	for (int i = 0; i < n_functions; i++)
+		if (!strcmp(functions[i], fn))
+			return 1;
+
+	return 0;
+}
+
+/************************************************************************/
+/* Linker map parser                                                    */
+/*                                                                      */
+/* .text           0x00000000     0x5e2c                                */
+/*  .text.app_read_REG_CH0_REAL_FREQ                                    */
+/*                 0x0000044a        0x8 app_funcs.o                    */
+/*  COMMON         0x00802100      0x253 app_ios_and_regs.o             */
+/************************************************************************/
+static void add_input_section(const char *output, const char *section, long size, const char *file)
+{
+	char module[64];
+
+	module_name(file, module, sizeof(module));
+
+	if (!strcmp(output, ".text"))
+	{
+		add_size("flash", module, size);
+		if (is_hot(section))
+			add_size("hot", section + 6, size);
+	}
+	else if (!strcmp(output, ".data"))
+	{
+		add_size("flash", module, size);
+		add_size("sram", module, size);
+	}
+	else if (!strcmp(output, ".bss") || !strcmp(output, ".noinit"))
+	{
+		add_size("sram", module, size);
+	}
+	else if (!strcmp(output, ".eeprom"))
+	{
+		add_size("eeprom", module, size);
+	}
+	else
+	{
+		return;
+	}
+
+	if (!strcmp(section, ".bss.app_regs") || !strcmp(section, ".data.app_regs"))
+		add_size("regs", "AppRegs", size);
+}
+
+static int parse_map(FILE *f)
+{
+	char line[1024], output[64] = "", pending[256] = "";
+	int in_memory_map = 0, in_common = 0;
+
+	while (fgets(line, sizeof(line), f))
+	{
+		char name[256], file[512];
+		unsigned long addr, size;
+
+		line[strcspn(line, "\r\n")] = 0;
+
+		if (!strncmp(line, "Allocating common symbols", 25))
+		{
+			in_common = 1;
+			continue;
+		}
+
+		if (!strncmp(line, "Linker script and memory map", 28))
+		{
+			in_common = 0;
+			in_memory_map = 1;
+			continue;
+		}
+
+		/* app_regs            0x253             app_ios_and_regs.o */
+		if (in_common)
+		{
+			if (sscanf(line, "app_regs %lx", &size) == 1)
+				add_size("regs", "AppRegs", size);
+			continue;
+		}
+
+		if (!in_memory_map || !line[0])
+			continue;
+
+		if (line[0] == '.')
+		{
+			sscanf(line, "%63s", output);
+			pending[0] = 0;
+			continue;
+		}
+
+		if (line[0] != ' ')
+		{
+			output[0] = 0;
+			continue;
+		}
+
+		/* The address, size and file are on the next line when the section's name is long */
+		if (pending[0] && sscanf(line, " 0x%lx 0x%lx %511[^\n]", &addr, &size, file) == 3)
+		{
+			add_input_section(output, pending, size, file);
+			pending[0] = 0;
+			continue;
+		}
+
+		pending[0] = 0;
+
+		if (line[1] != '.' && strncmp(line + 1, "COMMON", 6))
+			continue;
+
+		int n = sscanf(line, " %255s 0x%lx 0x%lx %511[^\n]", name, &addr, &size, file);
+
+		if (n == 4)
+			add_input_section(output, name, size, file);
+		else if (n == 1)
+			snprintf(pending, sizeof(pending), "%s", name);
+	}
+
+	return in_memory_map;
+}
+
+static long read_reg_bank(const char *path)
+{
+	FILE *f = fopen(path, "r");
+	char line[256];
+	long n = -1;
+
+	if (!f)
+	{
+		perror(path);
+		return -1;
+	}
+
+	while (fgets(line, sizeof(line), f))
+		if (sscanf(line, "#define APP_NBYTES_OF_REG_BANK %ld", &n) == 1)
+			break;
+
+	fclose(f);
+	return n;
+}
+
+/************************************************************************/
+/* Report and baseline                                                  */
+/************************************************************************/
+static const char *regions[] = {"flash", "sram", "eeprom", "regs", "hot"};
+
+static int compare_entries(const void *a, const void *b)
+{
+	const entry_t *x = a, *y = b;
+	int rx = 0, ry = 0;
+
+	for (int i = 0; i < 5; i++)
+	{
+		if (!strcmp(x->region, regions[i])) rx = i;
+		if (!strcmp(y->region, regions[i])) ry = i;
+	}
+
+	if (rx != ry)
+		return rx - ry;
+
+	/* The totals first, then the biggest modules */
+	if (!strcmp(x->name, "total") != !strcmp(y->name, "total"))
+		return !strcmp(x->name, "total") ? -1 : 1;
+
+	return (y->size > x->size) - (y->size < x->size);
+}
+
+static int read_baseline(const char *path, entry_t *list)
+{
+	FILE *f = fopen(path, "r");
+	char line[256];
+	int n = 0;
+
+	if (!f)
+		return -1;
+
+	while (fgets(line, sizeof(line), f) && n < MAX_ENTRIES)
+	{
+		entry_t e;
+
+		if (line[0] == '#' || sscanf(line, "%7s %ld %63[^\n]", e.region, &e.size, e.name) != 3)
+			continue;
+
+		list[n++] = e;
+	}
+
+	fclose(f);
+	return n;
+}
+
+static void write_report(FILE *f)
+{
+	fprintf(f, "# region size module\n");
+
+	for (int i = 0; i < n_entries; i++)
+		fprintf(f, "%-7s %7ld %s\n", entries[i].region, entries[i].size, entries[i].name);
+}
+
+int main(int argc, char *argv[])
+{
+	const char *baseline_path = NULL;
+	const char *regs_path = NULL;
+	int write_baseline = 0;
+	long tolerance = 0;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "b:wt:r:f:h")) != -1)
+	{
+		switch (opt)
+		{
+			case 'b': baseline_path = optarg; break;
+			case 'w': write_baseline = 1; break;
+			case 't': tolerance = strtol(optarg, NULL, 0); break;
+			case 'r': regs_path = optarg; break;
+			case 'f':
+				if (n_functions < MAX_FUNCTIONS)
+					functions[n_functions++] = optarg;
+				break;
+			default:
+				fprintf(stderr, "usage: %s [-b baseline.txt] [-w] [-t tolerance] [-r app_ios_and_regs.h] [-f function] MultiPwm.map\n", argv[0]);
+				return opt == 'h' ? 0 : 1;
+		}
+	}
+
+	if (optind >= argc)
+		return 1;
+
+	FILE *f = fopen(argv[optind], "r");
+
+	if (!f)
+	{
+		perror(argv[optind]);
+		return 1;
+	}
+
+	int parsed = parse_map(f);
+	fclose(f);
+
+	if (!parsed)
+	{
+		fprintf(stderr, "%s is not a linker map\n", argv[optind]);
+		return 1;
+	}
+
+	/* Totals of each region */
+	long totals[3] = {0, 0, 0};
+
+	for (int i = 0; i < n_entries; i++)
+		for (int r = 0; r < 3; r++)
+			if (!strcmp(entries[i].region, regions[r]))
+				totals[r] += entries[i].size;
+
+	for (int r = 0; r < 3; r++)
+		add_size(regions[r], "total", totals[r]);
+
+	if (regs_path)
+	{
+		long n = read_reg_bank(regs_path);
+		entry_t *bank = find_entry(entries, n_entries, "regs", "AppRegs");
+
+		if (n >= 0)
+			add_size("regs", "APP_NBYTES_OF_REG_BANK", n);
+
+		if (n >= 0 && bank && bank->size != n)
+			fprintf(stderr, "warning: AppRegs has %ld bytes but APP_NBYTES_OF_REG_BANK is %ld\n", bank->size, n);
+	}
+
+	qsort(entries, n_entries, sizeof(entry_t), compare_entries);
+
+	/* Compare with the baseline */
+	static entry_t baseline[MAX_ENTRIES];
+	int n_baseline = baseline_path ? read_baseline(baseline_path, baseline) : -1;
+	int failed = 0;
+
+	printf("%-7s %-32s %8s %8s %8s\n", "region", "module", "size", "baseline", "delta");
+
+	for (int i = 0; i < n_entries; i++)
+	{
+		entry_t *e = &entries[i];
+		entry_t *b = (n_baseline > 0) ? find_entry(baseline, n_baseline, e->region, e->name) : NULL;
+		int checked = !strcmp(e->name, "total") || !strcmp(e->region, "regs");
+		int over = b && checked && e->size - b->size > tolerance;
+
+		printf("%-7s %-32s %8ld ", e->region, e->name, e->size);
+
+		if (b)
+			printf("%8ld %+8ld%s\n", b->size, e->size - b->size, over ? "  OVER BASELINE" : "");
+		else
+			printf("%8s %8s\n", "-", (n_baseline > 0) ? "new" : "-");
+
+		failed |= over;
+	}
+
+	if (baseline_path && (n_baseline < 0 || write_baseline))
+	{
+		if ((f = fopen(baseline_path, "w")) == NULL)
+		{
+			perror(baseline_path);
+			return 1;
+		}
+
+		write_report(f);
+		fclose(f);
+		fprintf(stderr, "baseline written to %s\n", baseline_path);
+		return 0;
+	}
+
+	return failed;
+}
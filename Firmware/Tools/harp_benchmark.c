@@ -0,0 +1,711 @@
+/************************************************************************/
+/* Harp command benchmark                                               */
+/*                                                                      */
+/* Host tool that measures, on a MultiPwm device or on the emulator,    */
+/* the round-trip time of reads and writes of each class of register,   */
+/* the throughput of pipelined commands and the delivery latency of the */
+/* EXEC_STATE events. The results can be written as JSON, to keep a     */
+/* history of them.                                                     */
+/*                                                                      */
+/* Build: gcc -O2 -std=gnu99 -o harp_benchmark harp_benchmark.c         */
+/*                                                                      */
+/* Usage: harp_benchmark [-n samples] [-w window] [-t timeout_ms]       */
+/*            [-o results.json] port                                    */
+/*                                                                      */
+/* Every write stores the register's current contents, so the writes    */
+/* go through the firmware's whole path, float math included, without   */
+/* changing the configuration. The event test uses channel 0 and its    */
+/* trigger 0 mask, and restores them at the end. A channel 0 running    */
+/* when the benchmark starts is stopped by the first write.             */
+/*                                                                      */
+/* The event latency is how much later than the write's reply an event  */
+/* arrives, less how much later than the reply it was timestamped. It   */
+/* is the time the event waits on the device's queue and on the link,   */
+/* measured without comparing the host's clock with the device's.       */
+/************************************************************************/
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <time.h>
+#include <termios.h>
+
+#define HARP_READ 1
+#define HARP_WRITE 2
+#define HARP_EVENT 3
+#define HARP_ERROR 0x08
+#define HARP_PORT_DEVICE 255
+
+#define TYPE_U8 0x01
+#define TYPE_U16 0x02
+#define TYPE_U32 0x04
+#define TYPE_FLOAT 0x44
+#define MSK_TYPE_LEN 0x0F
+#define MSK_TIMESTAMP_AT_PAYLOAD 0x10
+
+/* From hwbp_core_regs.h and app_ios_and_regs.h */
+#define ADD_R_WHO_AM_I 0x00
+#define ADD_R_FW_VERSION_H 0x06
+#define ADD_R_FW_VERSION_L 0x07
+#define ADD_R_TIMESTAMP_SECOND 0x08
+#define ADD_R_OPERATION_CTRL 0x0A
+#define ADD_REG_CH0_FREQ 32
+#define ADD_REG_CH0_DUTYCYCLE 36
+#define ADD_REG_CH0_COUNTS 40
+#define ADD_REG_CH0_MODE 52
+#define ADD_REG_TRG0_MASK 56
+#define ADD_REG_START_PWM 60
+#define ADD_REG_STOP_PWM 61
+#define ADD_REG_CH_ENABLE 69
+#define ADD_REG_EXEC_STATE 73
+#define ADD_REG_EVNT_ENABLE 74
+#define ADD_REG_CH_EXT_PERIOD 80
+#define ADD_REG_CH0_CONFIG 96
+#define ADD_REG_CH_CONFIG_ALL 100
+
+#define MSK_OP_MODE 0x03
+#define GM_OP_MODE_ACTIVE 0x01
+#define B_MUTE_RPL (1<<4)
+#define B_EVT0 (1<<0)
+
+#define MULTIPWM_WHO_AM_I 1040
+#define MAX_PAYLOAD 245
+
+typedef struct
+{
+	uint8_t type;
+	uint8_t add;
+	uint8_t payload_type;
+	uint8_t payload[MAX_PAYLOAD];
+	uint8_t length;
+	double device_us;                         // Timestamp of the device
+	double host_us;                           // Arrival on the host
+} harp_msg_t;
+
+static int fd = -1;
+static int timeout_ms = 200;
+
+static double host_us(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1e6 + t.tv_nsec / 1e3;
+}
+
+/************************************************************************/
+/* Harp frames                                                          */
+/************************************************************************/
+static int harp_send(uint8_t type, uint8_t add, uint8_t payload_type, const void *payload, uint8_t length)
+{
+	uint8_t frame[MAX_PAYLOAD + 6];
+	uint8_t sum = 0;
+
+	frame[0] = type;
+	frame[1] = length + 4;
+	frame[2] = add;
+	frame[3] = HARP_PORT_DEVICE;
+	frame[4] = payload_type;
+	if (length)
+		memcpy(frame + 5, payload, length);
+
+	for (int i = 0; i < length + 5; i++)
+		sum += frame[i];
+	frame[length + 5] = sum;
+
+	return write(fd, frame, length + 6) == length + 6 ? 0 : -1;
+}
+
+static uint8_t rx_buffer[4096];
+static size_t rx_length = 0;
+static double rx_host_us;                 // Arrival of the last bytes read
+
+/* Takes a frame out of the buffer, dropping bytes until one checks */
+static int harp_parse(harp_msg_t *m)
+{
+	while (rx_length >= 2)
+	{
+		size_t length = rx_buffer[1] + 2;
+		uint8_t sum = 0;
+
+		if (rx_buffer[0] < HARP_READ || (rx_buffer[0] & ~HARP_ERROR) > HARP_EVENT || rx_buffer[1] < 4)
+		{
+			memmove(rx_buffer, rx_buffer + 1, --rx_length);
+			continue;
+		}
+
+		if (rx_length < length)
+			return 0;
+
+		for (size_t i = 0; i < length - 1; i++)
+			sum += rx_buffer[i];
+
+		if (sum != rx_buffer[length - 1])
+		{
+			memmove(rx_buffer, rx_buffer + 1, --rx_length);
+			continue;
+		}
+
+		size_t start = (rx_buffer[4] & MSK_TIMESTAMP_AT_PAYLOAD) ? 11 : 5;
+		uint32_t seconds = 0;
+		uint16_t useconds = 0;
+
+		if (start == 11)
+		{
+			memcpy(&seconds, rx_buffer + 5, 4);
+			memcpy(&useconds, rx_buffer + 9, 2);
+		}
+
+		m->type = rx_buffer[0];
+		m->add = rx_buffer[2];
+		m->payload_type = rx_buffer[4] & ~MSK_TIMESTAMP_AT_PAYLOAD;
+		m->length = (length - 1 > start) ? length - 1 - start : 0;
+		memcpy(m->payload, rx_buffer + start, m->length);
+		m->device_us = seconds * 1e6 + useconds * 32.0;
+		m->host_us = rx_host_us;
+
+		rx_length -= length;
+		memmove(rx_buffer, rx_buffer + length, rx_length);
+		return 1;
+	}
+
+	return 0;
+}
+
+/* Waits for any frame, returns 0 on timeout */
+static int harp_receive(harp_msg_t *m, double deadline_us)
+{
+	for (;;)
+	{
+		if (harp_parse(m))
+			return 1;
+
+		double left = deadline_us - host_us();
+		struct pollfd pfd = {fd, POLLIN, 0};
+
+		if (left <= 0 || poll(&pfd, 1, (int)(left / 1000) + 1) <= 0)
+			return 0;
+
+		ssize_t n = read(fd, rx_buffer + rx_length, sizeof(rx_buffer) - rx_length);
+
+		if (n <= 0)
+			return 0;
+
+		/* Every frame parsed from this read arrived now */
+		rx_host_us = host_us();
+		rx_length += n;
+	}
+}
+
+/************************************************************************/
+/* Commands                                                             */
+/*                                                                      */
+/* The events that arrive while waiting for a reply are kept, up to a   */
+/* limit, for the event test.                                           */
+/************************************************************************/
+#define MAX_EVENTS 64
+
+static harp_msg_t events[MAX_EVENTS];
+static int n_events = 0;
+
+static int wait_reply(uint8_t add, harp_msg_t *reply)
+{
+	double deadline = host_us() + timeout_ms * 1000.0;
+
+	while (harp_receive(reply, deadline))
+	{
+		if (reply->type == HARP_EVENT)
+		{
+			if (n_events < MAX_EVENTS)
+				events[n_events++] = *reply;
+			continue;
+		}
+
+		if (reply->add == add)
+			return 0;
+	}
+
+	return -1;
+}
+
+/* Returns the round trip in us, -1 on timeout and -2 on an error reply */
+static double command(uint8_t type, uint8_t add, uint8_t payload_type, const void *payload, uint8_t length, harp_msg_t *reply)
+{
+	double start = host_us();
+
+	if (harp_send(type, add, payload_type, payload, length) || wait_reply(add, reply))
+		return -1;
+
+	return (reply->type & HARP_ERROR) ? -2 : reply->host_us - start;
+}
+
+static int read_register(uint8_t add, uint8_t payload_type, harp_msg_t *reply)
+{
+	return command(HARP_READ, add, payload_type, NULL, 0, reply) < 0 ? -1 : 0;
+}
+
+static int write_register(uint8_t add, uint8_t payload_type, const void *payload, uint8_t length)
+{
+	harp_msg_t reply;
+
+	return command(HARP_WRITE, add, payload_type, payload, length, &reply) < 0 ? -1 : 0;
+}
+
+/************************************************************************/
+/* Results                                                              */
+/************************************************************************/
+#define MAX_RESULTS 32
+
+typedef struct
+{
+	char name[32];
+	const char *unit;
+	int n;
+	int errors;
+	int timeouts;
+	double min, p50, p90, p99, max, mean;
+	double rate;                              // Only for the throughput tests
+} result_t;
+
+static result_t results[MAX_RESULTS];
+static int n_results = 0;
+
+static int compare_double(const void *a, const void *b)
+{
+	double x = *(const double*)a, y = *(const double*)b;
+
+	return (x > y) - (x < y);
+}
+
+static result_t *add_result(const char *name, const char *unit)
+{
+	result_t *r = &results[n_results < MAX_RESULTS - 1 ? n_results++ : n_results];
+
+	memset(r, 0, sizeof(*r));
+	snprintf(r->name, sizeof(r->name), "%s", name);
+	r->unit = unit;
+	return r;
+}
+
+static void add_latencies(const char *name, double *samples, int n, int errors, int timeouts)
+{
+	result_t *r = add_result(name, "us");
+
+	r->n = n;
+	r->errors = errors;
+	r->timeouts = timeouts;
+
+	if (n == 0)
+		return;
+
+	qsort(samples, n, sizeof(double), compare_double);
+
+	for (int i = 0; i < n; i++)
+		r->mean += samples[i] / n;
+
+	/* Nearest rank */
+	r->min = samples[0];
+	r->p50 = samples[(n * 50 + 99) / 100 - 1];
+	r->p90 = samples[(n * 90 + 99) / 100 - 1];
+	r->p99 = samples[(n * 99 + 99) / 100 - 1];
+	r->max = samples[n - 1];
+}
+
+static void print_results(void)
+{
+	printf("%-24s %6s %6s %6s %9s %9s %9s %9s %9s %9s\n", "test", "n", "errors", "lost", "min", "p50", "p90", "p99", "max", "mean");
+
+	for (int i = 0; i < n_results; i++)
+	{
+		result_t *r = &results[i];
+
+		printf("%-24s %6d %6d %6d ", r->name, r->n, r->errors, r->timeouts);
+
+		if (r->rate > 0)
+			printf("%9.1f %s\n", r->rate, r->unit);
+		else
+			printf("%9.1f %9.1f %9.1f %9.1f %9.1f %9.1f %s\n", r->min, r->p50, r->p90, r->p99, r->max, r->mean, r->unit);
+	}
+}
+
+static int write_json(const char *path, const char *port, uint16_t who_am_i, uint8_t fw_h, uint8_t fw_l, int n_samples, int window)
+{
+	FILE *f = fopen(path, "w");
+
+	if (!f)
+		return -1;
+
+	fprintf(f, "{\n  \"time\": %ld,\n  \"port\": \"%s\",\n  \"who_am_i\": %u,\n  \"firmware\": \"%u.%u\",\n", (long)time(NULL), port, who_am_i, fw_h, fw_l);
+	fprintf(f, "  \"samples\": %d,\n  \"window\": %d,\n  \"results\": [\n", n_samples, window);
+
+	for (int i = 0; i < n_results; i++)
+	{
+		result_t *r = &results[i];
+
+		fprintf(f, "    {\"test\": \"%s\", \"unit\": \"%s\", \"n\": %d, \"errors\": %d, \"lost\": %d, ", r->name, r->unit, r->n, r->errors, r->timeouts);
+
+		if (r->rate > 0)
+			fprintf(f, "\"rate\": %.1f}", r->rate);
+		else
+			fprintf(f, "\"min\": %.1f, \"p50\": %.1f, \"p90\": %.1f, \"p99\": %.1f, \"max\": %.1f, \"mean\": %.1f}", r->min, r->p50, r->p90, r->p99, r->max, r->mean);
+
+		fprintf(f, "%s\n", i < n_results - 1 ? "," : "");
+	}
+
+	fprintf(f, "  ]\n}\n");
+	return fclose(f);
+}
+
+/************************************************************************/
+/* Tests                                                                */
+/************************************************************************/
+typedef struct
+{
+	const char *name;
+	uint8_t type;
+	uint8_t add;
+	uint8_t payload_type;
+} rtt_test_t;
+
+static const rtt_test_t rtt_tests[] = {
+	{"read_common_u32", HARP_READ, ADD_R_TIMESTAMP_SECOND, TYPE_U32},
+	{"read_u8", HARP_READ, ADD_REG_CH_ENABLE, TYPE_U8},
+	{"read_u16_array", HARP_READ, ADD_REG_CH_EXT_PERIOD, TYPE_U16},
+	{"read_u32", HARP_READ, ADD_REG_CH0_COUNTS, TYPE_U32},
+	{"read_float", HARP_READ, ADD_REG_CH0_FREQ, TYPE_FLOAT},
+	{"read_float_array", HARP_READ, ADD_REG_CH_CONFIG_ALL, TYPE_FLOAT},
+	{"write_u8", HARP_WRITE, ADD_REG_CH_ENABLE, TYPE_U8},
+	{"write_u32_counts", HARP_WRITE, ADD_REG_CH0_COUNTS, TYPE_U32},
+	{"write_float_duty", HARP_WRITE, ADD_REG_CH0_DUTYCYCLE, TYPE_FLOAT},
+	{"write_float_freq", HARP_WRITE, ADD_REG_CH0_FREQ, TYPE_FLOAT},
+	{"write_float_config", HARP_WRITE, ADD_REG_CH0_CONFIG, TYPE_FLOAT}
+};
+
+static int run_rtt_test(const rtt_test_t *t, int n_samples)
+{
+	harp_msg_t reply;
+	double *samples = malloc(n_samples * sizeof(double));
+	int n = 0, errors = 0, timeouts = 0;
+
+	/* The payload of a write is the register's current contents */
+	if (!samples || read_register(t->add, t->payload_type, &reply))
+	{
+		free(samples);
+		return -1;
+	}
+
+	uint8_t payload[MAX_PAYLOAD];
+	uint8_t length = (t->type == HARP_WRITE) ? reply.length : 0;
+
+	memcpy(payload, reply.payload, reply.length);
+
+	for (int i = 0; i < n_samples; i++)
+	{
+		double rtt = command(t->type, t->add, t->payload_type, payload, length, &reply);
+
+		if (rtt == -1)
+			timeouts++;
+		else if (rtt == -2)
+			errors++;
+		else
+			samples[n++] = rtt;
+	}
+
+	add_latencies(t->name, samples, n, errors, timeouts);
+	free(samples);
+	return 0;
+}
+
+/* Keeps window commands on the way, sending the next one at each reply */
+static int run_pipelined_test(const rtt_test_t *t, int n_commands, int window)
+{
+	harp_msg_t reply;
+	int sent = 0, received = 0, errors = 0;
+
+	if (read_register(t->add, t->payload_type, &reply))
+		return -1;
+
+	uint8_t payload[MAX_PAYLOAD];
+	uint8_t length = (t->type == HARP_WRITE) ? reply.length : 0;
+
+	memcpy(payload, reply.payload, reply.length);
+
+	double start = host_us();
+
+	while (sent < window && sent < n_commands)
+	{
+		harp_send(t->type, t->add, t->payload_type, payload, length);
+		sent++;
+	}
+
+	while (received < sent)
+	{
+		if (wait_reply(t->add, &reply))
+			break;
+
+		received++;
+
+		if (reply.type & HARP_ERROR)
+			errors++;
+
+		if (sent < n_commands)
+		{
+			harp_send(t->type, t->add, t->payload_type, payload, length);
+			sent++;
+		}
+	}
+
+	result_t *r = add_result(t->name, t->type == HARP_WRITE ? "writes/s" : "reads/s");
+
+	r->n = received;
+	r->errors = errors;
+	r->timeouts = sent - received;
+	r->rate = received / ((host_us() - start) / 1e6);
+
+	/* Let the lost replies, if any, arrive before the next test */
+	while (wait_reply(t->add, &reply) == 0);
+
+	return 0;
+}
+
+/* Waits for the EXEC_STATE event with channel 0 on the given state */
+static harp_msg_t *wait_exec_state(uint8_t running, int *first)
+{
+	harp_msg_t m;
+	double deadline = host_us() + timeout_ms * 1000.0;
+
+	for (;;)
+	{
+		for (int i = *first; i < n_events; i++)
+			if (events[i].add == ADD_REG_EXEC_STATE && events[i].length && (events[i].payload[0] & 1) == running)
+			{
+				*first = i + 1;
+				return &events[i];
+			}
+
+		*first = n_events;
+
+		if (!harp_receive(&m, deadline))
+			return NULL;
+
+		if (m.type == HARP_EVENT && n_events < MAX_EVENTS)
+			events[n_events++] = m;
+	}
+}
+
+typedef struct
+{
+	uint8_t add;
+	uint8_t payload_type;
+	harp_msg_t saved;
+} saved_reg_t;
+
+static saved_reg_t event_regs[] = {
+	{ADD_REG_CH0_FREQ, TYPE_FLOAT, {0}},
+	{ADD_REG_CH0_DUTYCYCLE, TYPE_FLOAT, {0}},
+	{ADD_REG_CH0_COUNTS, TYPE_U32, {0}},
+	{ADD_REG_CH0_MODE, TYPE_U8, {0}},
+	{ADD_REG_TRG0_MASK, TYPE_U8, {0}},
+	{ADD_REG_EVNT_ENABLE, TYPE_U8, {0}}
+};
+
+#define N_EVENT_REGS (sizeof(event_regs) / sizeof(event_regs[0]))
+
+/* Starts a one pulse train on channel 0, at 1 kHz, and waits for its start and stop events */
+static int run_event_test(int n_samples)
+{
+	float freq = 1000, duty = 50;
+	uint32_t counts = 1;
+	uint8_t mode = 0, mask = 1, start = 1, evnt_enable;
+	double *start_samples = malloc(n_samples * sizeof(double));
+	double *stop_samples = malloc(n_samples * sizeof(double));
+	int n_start = 0, n_stop = 0, lost_start = 0, lost_stop = 0, errors = 0;
+
+	for (unsigned i = 0; i < N_EVENT_REGS; i++)
+		if (read_register(event_regs[i].add, event_regs[i].payload_type, &event_regs[i].saved))
+			return -1;
+
+	evnt_enable = event_regs[N_EVENT_REGS - 1].saved.payload[0] | B_EVT0;
+
+	if (!start_samples || !stop_samples ||
+		write_register(ADD_REG_CH0_FREQ, TYPE_FLOAT, &freq, 4) ||
+		write_register(ADD_REG_CH0_DUTYCYCLE, TYPE_FLOAT, &duty, 4) ||
+		write_register(ADD_REG_CH0_COUNTS, TYPE_U32, &counts, 4) ||
+		write_register(ADD_REG_CH0_MODE, TYPE_U8, &mode, 1) ||
+		write_register(ADD_REG_TRG0_MASK, TYPE_U8, &mask, 1) ||
+		write_register(ADD_REG_EVNT_ENABLE, TYPE_U8, &evnt_enable, 1))
+	{
+		errors = -1;
+	}
+
+	for (int i = 0; i < n_samples && errors >= 0; i++)
+	{
+		harp_msg_t reply;
+		harp_msg_t *event;
+		int first = 0;
+
+		n_events = 0;
+
+		/* Out of phase with the device's queue, which is sent every 500 us */
+		usleep(rand() % 1000);
+
+		if (command(HARP_WRITE, ADD_REG_START_PWM, TYPE_U8, &start, 1, &reply) < 0)
+		{
+			errors++;
+			continue;
+		}
+
+		if ((event = wait_exec_state(1, &first)) != NULL)
+			start_samples[n_start++] = (event->host_us - reply.host_us) - (event->device_us - reply.device_us);
+		else
+			lost_start++;
+
+		if ((event = wait_exec_state(0, &first)) != NULL)
+			stop_samples[n_stop++] = (event->host_us - reply.host_us) - (event->device_us - reply.device_us);
+		else
+			lost_stop++;
+	}
+
+	if (errors >= 0)
+	{
+		add_latencies("event_exec_state_start", start_samples, n_start, errors, lost_start);
+		add_latencies("event_exec_state_stop", stop_samples, n_stop, errors, lost_stop);
+	}
+
+	/* Back to the configuration found */
+	write_register(ADD_REG_STOP_PWM, TYPE_U8, &start, 1);
+
+	for (unsigned i = 0; i < N_EVENT_REGS; i++)
+		write_register(event_regs[i].add, event_regs[i].payload_type, event_regs[i].saved.payload, event_regs[i].saved.length);
+
+	free(start_samples);
+	free(stop_samples);
+	return errors < 0 ? -1 : 0;
+}
+
+/************************************************************************/
+/* Serial port                                                          */
+/************************************************************************/
+static int open_port(const char *path)
+{
+	struct termios tio;
+
+	if ((fd = open(path, O_RDWR | O_NOCTTY)) < 0 || tcgetattr(fd, &tio))
+		return -1;
+
+	/* Harp devices talk at 1 Mbps */
+	cfmakeraw(&tio);
+	cfsetspeed(&tio, B1000000);
+	tio.c_cflag |= CLOCAL | CREAD;
+
+	if (tcsetattr(fd, TCSANOW, &tio))
+		return -1;
+
+	tcflush(fd, TCIOFLUSH);
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	const char *json_path = NULL;
+	int n_samples = 1000;
+	int window = 8;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "n:w:t:o:h")) != -1)
+	{
+		switch (opt)
+		{
+			case 'n': n_samples = atoi(optarg); break;
+			case 'w': window = atoi(optarg); break;
+			case 't': timeout_ms = atoi(optarg); break;
+			case 'o': json_path = optarg; break;
+			default:
+				fprintf(stderr, "usage: %s [-n samples] [-w window] [-t timeout_ms] [-o results.json] port\n", argv[0]);
+				return opt == 'h' ? 0 : 1;
+		}
+	}
+
+	if (optind >= argc || n_samples <= 0 || window <= 0 || timeout_ms <= 0)
+		return 1;
+
+	if (open_port(argv[optind]))
+	{
+		perror(argv[optind]);
+		return 1;
+	}
+
+	/* Device */
+	harp_msg_t reply;
+	uint16_t who_am_i;
+	uint8_t fw_h, fw_l, op_ctrl;
+
+	if (read_register(ADD_R_WHO_AM_I, TYPE_U16, &reply))
+	{
+		fprintf(stderr, "no reply from %s\n", argv[optind]);
+		return 1;
+	}
+
+	memcpy(&who_am_i, reply.payload, 2);
+
+	if (who_am_i != MULTIPWM_WHO_AM_I)
+	{
+		fprintf(stderr, "%s is the device %u, not a MultiPwm\n", argv[optind], who_am_i);
+		return 1;
+	}
+
+	if (read_register(ADD_R_FW_VERSION_H, TYPE_U8, &reply))
+		return 1;
+	fw_h = reply.payload[0];
+
+	if (read_register(ADD_R_FW_VERSION_L, TYPE_U8, &reply))
+		return 1;
+	fw_l = reply.payload[0];
+
+	/* The events are only sent on Active Mode, and the replies are needed */
+	if (read_register(ADD_R_OPERATION_CTRL, TYPE_U8, &reply))
+		return 1;
+	op_ctrl = reply.payload[0];
+
+	uint8_t active = (op_ctrl & ~(MSK_OP_MODE | B_MUTE_RPL)) | GM_OP_MODE_ACTIVE;
+
+	if (harp_send(HARP_WRITE, ADD_R_OPERATION_CTRL, TYPE_U8, &active, 1) || wait_reply(ADD_R_OPERATION_CTRL, &reply))
+		return 1;
+
+	/* Round trips */
+	for (unsigned i = 0; i < sizeof(rtt_tests) / sizeof(rtt_tests[0]); i++)
+		if (run_rtt_test(&rtt_tests[i], n_samples))
+			fprintf(stderr, "%s failed\n", rtt_tests[i].name);
+
+	/* Throughput */
+	const rtt_test_t pipelined[] = {
+		{"pipelined_read_float", HARP_READ, ADD_REG_CH0_FREQ, TYPE_FLOAT},
+		{"pipelined_write_u8", HARP_WRITE, ADD_REG_CH_ENABLE, TYPE_U8},
+		{"pipelined_write_float", HARP_WRITE, ADD_REG_CH0_FREQ, TYPE_FLOAT}
+	};
+
+	for (unsigned i = 0; i < sizeof(pipelined) / sizeof(pipelined[0]); i++)
+		if (run_pipelined_test(&pipelined[i], n_samples, window))
+			fprintf(stderr, "%s failed\n", pipelined[i].name);
+
+	/* Events */
+	if (run_event_test(n_samples < 200 ? n_samples : 200))
+		fprintf(stderr, "event test failed\n");
+
+	write_register(ADD_R_OPERATION_CTRL, TYPE_U8, &op_ctrl, 1);
+
+	print_results();
+
+	if (json_path && write_json(json_path, argv[optind], who_am_i, fw_h, fw_l, n_samples, window))
+	{
+		perror(json_path);
+		return 1;
+	}
+
+	close(fd);
+	return 0;
+}
@@ -0,0 +1,32 @@
+#ifndef _HOST_AVR_INTERRUPT_H_
+#define _HOST_AVR_INTERRUPT_H_
+
+/************************************************************************/
+/* Host build of the interrupts                                         */
+/*                                                                      */
+/* An interrupt handler is a plain function, called by the host model   */
+/* when the CPU takes the interrupt. The model never calls the firmware */
+/* while it is already running, so there's no nesting and nothing to    */
+/* disable.                                                             */
+/************************************************************************/
+#define ISR(vector, ...) void vector(void); void vector(void)
+#define ISR_NAKED
+#define reti() return
+#define sei()
+#define cli()
+
+#define TCC0_OVF_vect isr_TCC0_OVF
+#define TCC0_CCA_vect isr_TCC0_CCA
+#define TCD0_OVF_vect isr_TCD0_OVF
+#define TCD0_CCA_vect isr_TCD0_CCA
+#define TCE0_OVF_vect isr_TCE0_OVF
+#define TCE0_CCA_vect isr_TCE0_CCA
+#define TCF0_OVF_vect isr_TCF0_OVF
+#define TCF0_CCA_vect isr_TCF0_CCA
+#define PORTF_INT0_vect isr_PORTF_INT0
+#define PORTF_INT1_vect isr_PORTF_INT1
+#define PORTH_INT0_vect isr_PORTH_INT0
+#define PORTK_INT0_vect isr_PORTK_INT0
+#define PORTQ_INT0_vect isr_PORTQ_INT0
+
+#endif /* _HOST_AVR_INTERRUPT_H_ */
@@ -0,0 +1,192 @@
+#ifndef _HOST_AVR_IO_H_
+#define _HOST_AVR_IO_H_
+#include <stdint.h>
+
+/************************************************************************/
+/* Host build of the ATxmega128A1U peripherals                          */
+/*                                                                      */
+/* Only the registers and bit fields used by the firmware are declared. */
+/* The peripherals are plain structures in memory, defined and driven   */
+/* by the host model, which looks at them before and after every call   */
+/* to the firmware. The layouts follow the datasheet, the addresses     */
+/* don't.                                                               */
+/*                                                                      */
+/* The writes to OUTSET, OUTCLR and OUTTGL go to logs of the port       */
+/* instead, at the position of the write among the writes to the        */
+/* strobes of all ports, so the model applies them in their order.      */
+/************************************************************************/
+typedef volatile uint8_t register8_t;
+typedef volatile uint16_t register16_t;
+
+typedef struct
+{
+	register8_t DIR, DIRSET, DIRCLR, DIRTGL;
+	register8_t OUT, OUTSET, OUTCLR, OUTTGL;
+	register8_t IN, INTCTRL, INT0MASK, INT1MASK, INTFLAGS;
+	register8_t reserved_0x0D, reserved_0x0E, reserved_0x0F;
+	register8_t PIN0CTRL, PIN1CTRL, PIN2CTRL, PIN3CTRL, PIN4CTRL, PIN5CTRL, PIN6CTRL, PIN7CTRL;
+	/* Beyond the datasheet's registers */
+	register8_t outset_log[64], outclr_log[64], outtgl_log[64];
+} PORT_t;
+
+#define PORT_STROBES_LOG 64
+
+extern uint16_t port_strobes;
+
+#define OUTSET outset_log[port_strobes++ % PORT_STROBES_LOG]
+#define OUTCLR outclr_log[port_strobes++ % PORT_STROBES_LOG]
+#define OUTTGL outtgl_log[port_strobes++ % PORT_STROBES_LOG]
+
+typedef struct
+{
+	register8_t CTRLA, CTRLB, CTRLC, CTRLD, CTRLE, reserved_0x05;
+	register8_t INTCTRLA, INTCTRLB, CTRLFCLR, CTRLFSET, CTRLGCLR, CTRLGSET, INTFLAGS;
+	register16_t TEMP, CNT, PER, CCA, CCB, CCC, CCD;
+	register16_t PERBUF, CCABUF, CCBBUF, CCCBUF, CCDBUF;
+} TC0_t;
+
+typedef struct
+{
+	register8_t CTRLA, CTRLB, CTRLC, CTRLD, CTRLE, reserved_0x05;
+	register8_t INTCTRLA, INTCTRLB, CTRLFCLR, CTRLFSET, CTRLGCLR, CTRLGSET, INTFLAGS;
+	register16_t TEMP, CNT, PER, CCA, CCB;
+	register16_t PERBUF, CCABUF, CCBBUF;
+} TC1_t;
+
+typedef struct
+{
+	register8_t CH0MUX, CH1MUX, CH2MUX, CH3MUX, CH4MUX, CH5MUX, CH6MUX, CH7MUX;
+	register8_t CH0CTRL, CH1CTRL, CH2CTRL, CH3CTRL, CH4CTRL, CH5CTRL, CH6CTRL, CH7CTRL;
+	register8_t STROBE, DATA;
+} EVSYS_t;
+
+typedef struct
+{
+	register8_t CTRL, reserved_0x01, FDEMASK, FDCTRL, STATUS, STATUSSET;
+	register8_t DTBOTH, DTBOTHBUF, DTLS, DTHS, DTLSBUF, DTHSBUF, OUTOVEN;
+} AWEX_t;
+
+typedef struct
+{
+	register8_t STATUS, INTPRI, CTRL;
+} PMIC_t;
+
+/* Only named by the CPU library's declarations */
+typedef struct ADC_struct ADC_t;
+
+extern PORT_t PORTA, PORTB, PORTC, PORTD, PORTE, PORTF, PORTH, PORTJ, PORTK, PORTQ;
+extern TC0_t TCC0, TCD0, TCE0, TCF0;
+extern TC1_t TCC1, TCD1, TCE1, TCF1;
+extern EVSYS_t EVSYS;
+extern AWEX_t AWEXC, AWEXE;
+extern PMIC_t PMIC;
+extern register8_t SREG;
+
+#define CPU_SREG SREG
+#define PMIC_CTRL PMIC.CTRL
+
+/* PMIC */
+#define PMIC_LOLVLEN_bm 0x01
+#define PMIC_MEDLVLEN_bm 0x02
+#define PMIC_HILVLEN_bm 0x04
+#define PMIC_RREN_bm 0x80
+#define PMIC_LOLVLEX_bm 0x01
+#define PMIC_MEDLVLEX_bm 0x02
+#define PMIC_HILVLEX_bm 0x04
+
+/* PORT */
+#define PORT_INT0IF_bm 0x01
+#define PORT_INT1IF_bm 0x02
+#define PORT_ISC_gm 0x07
+#define PORT_ISC_BOTHEDGES_gc 0x00
+#define PORT_ISC_RISING_gc 0x01
+#define PORT_ISC_FALLING_gc 0x02
+#define PORT_ISC_LEVEL_gc 0x03
+#define PORT_OPC_gm 0x38
+#define PORT_OPC_PULLUP_gc 0x18
+#define PORT_INVEN_bm 0x40
+
+/* TC0 and TC1 */
+#define TC0_CLKSEL_gm 0x0F
+#define TC1_CLKSEL_gm 0x0F
+#define TC_CLKSEL_OFF_gc 0x00
+#define TC_CLKSEL_DIV1_gc 0x01
+#define TC_CLKSEL_DIV2_gc 0x02
+#define TC_CLKSEL_DIV4_gc 0x03
+#define TC_CLKSEL_DIV8_gc 0x04
+#define TC_CLKSEL_DIV64_gc 0x05
+#define TC_CLKSEL_DIV256_gc 0x06
+#define TC_CLKSEL_DIV1024_gc 0x07
+#define TC_CLKSEL_EVCH0_gc 0x08
+#define TC_CLKSEL_EVCH1_gc 0x09
+#define TC_CLKSEL_EVCH2_gc 0x0A
+#define TC_CLKSEL_EVCH3_gc 0x0B
+#define TC_CLKSEL_EVCH4_gc 0x0C
+#define TC_CLKSEL_EVCH5_gc 0x0D
+#define TC_CLKSEL_EVCH6_gc 0x0E
+#define TC_CLKSEL_EVCH7_gc 0x0F
+
+#define TC0_CCAEN_bm 0x10
+#define TC1_CCAEN_bm 0x10
+#define TC1_CCBEN_bm 0x20
+#define TC_WGMODE_gm 0x07
+#define TC_WGMODE_NORMAL_gc 0x00
+#define TC_WGMODE_FRQ_gc 0x01
+#define TC_WGMODE_SS_gc 0x03
+
+#define TC_EVACT_gm 0xE0
+#define TC_EVACT_OFF_gc 0x00
+#define TC_EVACT_CAPT_gc 0x20
+#define TC_EVACT_UPDOWN_gc 0x40
+#define TC_EVACT_QDEC_gc 0x60
+#define TC_EVACT_RESTART_gc 0x80
+#define TC_EVACT_FRQ_gc 0xA0
+#define TC_EVACT_PW_gc 0xC0
+#define TC_EVSEL_gm 0x0F
+#define TC_EVSEL_OFF_gc 0x00
+#define TC_EVSEL_CH0_gc 0x08
+#define TC_EVSEL_CH1_gc 0x09
+#define TC_EVSEL_CH2_gc 0x0A
+#define TC_EVSEL_CH3_gc 0x0B
+
+#define TC_OVFINTLVL_gm 0x03
+#define TC_OVFINTLVL_LO_gc 0x01
+#define TC_CCAINTLVL_gm 0x03
+#define TC_CCAINTLVL_LO_gc 0x01
+
+#define TC_CMD_gm 0x0C
+#define TC_CMD_UPDATE_gc 0x04
+#define TC_CMD_RESTART_gc 0x08
+#define TC_CMD_RESET_gc 0x0C
+#define TC0_PERBV_bm 0x01
+#define TC0_CCABV_bm 0x02
+#define TC0_CMPA_bm 0x01
+
+#define TC0_OVFIF_bm 0x01
+#define TC0_ERRIF_bm 0x02
+#define TC0_CCAIF_bm 0x10
+#define TC1_OVFIF_bm 0x01
+#define TC1_ERRIF_bm 0x02
+#define TC1_CCAIF_bm 0x10
+#define TC1_CCBIF_bm 0x20
+
+/* EVSYS */
+#define EVSYS_CHMUX_OFF_gc 0x00
+#define EVSYS_CHMUX_PORTF_PIN5_gc 0x7D
+#define EVSYS_CHMUX_PORTF_PIN6_gc 0x7E
+#define EVSYS_CHMUX_TCC0_OVF_gc 0xC0
+#define EVSYS_CHMUX_TCC0_CCA_gc 0xC4
+#define EVSYS_CHMUX_TCD0_CCA_gc 0xD4
+#define EVSYS_CHMUX_TCE0_CCA_gc 0xE4
+#define EVSYS_CHMUX_TCF0_CCA_gc 0xF4
+#define EVSYS_DIGFILT_1SAMPLE_gc 0x00
+#define EVSYS_DIGFILT_2SAMPLES_gc 0x01
+
+/* AWEX */
+#define AWEX_DTICCAEN_bm 0x01
+#define AWEX_FDMODE_bm 0x04
+#define AWEX_FDACT_NONE_gc 0x00
+#define AWEX_FDACT_CLEAROE_gc 0x01
+#define AWEX_FDF_bm 0x04
+
+#endif /* _HOST_AVR_IO_H_ */
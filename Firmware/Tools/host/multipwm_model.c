@@ -0,0 +1,1699 @@
+/************************************************************************/
+/* MultiPwm host model                                                  */
+/*                                                                      */
+/* The firmware's application code built against the host headers of    */
+/* this folder, with models of the peripherals it drives, the functions */
+/* of the CPU library it calls and the Harp core, on a virtual clock    */
+/* counting the CPU cycles at 32 MHz. Included by the host tools of the */
+/* Tools folder, which drive it with run_until(), trig_set() and        */
+/* harp_process() and read the Harp frames it sends from out_buffer.    */
+/************************************************************************/
+#ifndef _MULTIPWM_MODEL_C_
+#define _MULTIPWM_MODEL_C_
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+/************************************************************************/
+/* Firmware                                                             */
+/*                                                                      */
+/* Built against the host headers. The peripherals, the functions of    */
+/* the CPU library and the Harp core are below.                         */
+/************************************************************************/
+#include "../../MultiPwm/app.c"
+#include "../../MultiPwm/app_funcs.c"
+#include "../../MultiPwm/app_ios_and_regs.c"
+#include "../../MultiPwm/app_regs_desc.c"
+#include "../../MultiPwm/event_queue_functions.c"
+#include "../../MultiPwm/freq_meter_functions.c"
+#include "../../MultiPwm/preset_functions.c"
+#include "../../MultiPwm/profiling_functions.c"
+#include "../../MultiPwm/pwm_gen_functions.c"
+#include "../../MultiPwm/timer_solver_functions.c"
+
+#define F_CPU 32000000ULL
+#define NEVER UINT64_MAX
+
+PORT_t PORTA, PORTB, PORTC, PORTD, PORTE, PORTF, PORTH, PORTJ, PORTK, PORTQ;
+TC0_t TCC0, TCD0, TCE0, TCF0;
+TC1_t TCC1, TCD1, TCE1, TCF1;
+EVSYS_t EVSYS;
+AWEX_t AWEXC, AWEXE;
+PMIC_t PMIC;
+register8_t SREG;
+
+static uint64_t now;                      // CPU cycles since the start
+static int verbose = 0;
+
+static void firmware_enter(void);
+static void firmware_leave(void);
+static void run_until(uint64_t target);
+
+/************************************************************************/
+/* CPU library                                                          */
+/************************************************************************/
+void io_pin2in(PORT_t* port, uint8_t pin, uint8_t pull, uint8_t sense)
+{
+	port->DIR &= ~(1 << pin);
+	(&port->PIN0CTRL)[pin] = pull | sense;
+}
+
+void io_pin2out(PORT_t* port, uint8_t pin, uint8_t out, bool input_en)
+{
+	port->DIR |= (1 << pin);
+	(&port->PIN0CTRL)[pin] = out;
+}
+
+void io_set_int(PORT_t* port, uint8_t int_level, uint8_t int_n, uint8_t mask, bool reset_mask)
+{
+	if (int_n == 0)
+	{
+		port->INTCTRL = (port->INTCTRL & ~0x03) | int_level;
+		port->INT0MASK = reset_mask ? mask : (port->INT0MASK | mask);
+	}
+	else
+	{
+		port->INTCTRL = (port->INTCTRL & ~0x0C) | (int_level << 2);
+		port->INT1MASK = reset_mask ? mask : (port->INT1MASK | mask);
+	}
+}
+
+void timer_type0_pwm(TC0_t* timer, uint8_t prescaler, uint16_t target_count, uint16_t duty_cycle_count, uint8_t int_level_ovf, uint8_t int_level_cca)
+{
+	timer->CTRLA = 0;
+	timer->CTRLB = TC0_CCAEN_bm | TC_WGMODE_SS_gc;
+	timer->CNT = 0;
+	timer->PER = target_count - 1;
+	timer->CCA = duty_cycle_count;
+	timer->INTCTRLA = int_level_ovf;
+	timer->INTCTRLB = int_level_cca;
+	timer->CTRLA = prescaler;
+}
+
+void timer_type0_stop(TC0_t* timer)
+{
+	timer->CTRLA = 0;
+	timer->CTRLB = 0;
+	timer->INTCTRLA = 0;
+	timer->INTCTRLB = 0;
+	timer->CNT = 0;
+}
+
+void timer_type1_stop(TC1_t* timer)
+{
+	timer->CTRLA = 0;
+	timer->CTRLB = 0;
+	timer->INTCTRLA = 0;
+	timer->INTCTRLB = 0;
+	timer->CNT = 0;
+}
+
+/************************************************************************/
+/* EEPROM                                                               */
+/*                                                                      */
+/* The writes are done at once, so it is never busy. The registers      */
+/* saved by the core go on the first bytes, below the presets.          */
+/************************************************************************/
+#define EEPROM_SIZE 2048
+#define EEPROM_REGS_MARK 0xA55A
+#define EEPROM_REGS_ADD 2
+
+#if EEPROM_REGS_ADD + APP_NBYTES_OF_REG_BANK > PRESETS_EEPROM_ADD
+	#error The saved registers overlap the presets
+#endif
+
+static uint8_t eeprom[EEPROM_SIZE];
+static int eeprom_fd = -1;
+
+bool eeprom_is_busy(void)
+{
+	return false;
+}
+
+uint8_t eeprom_rd_byte(uint16_t addr)
+{
+	return (addr < EEPROM_SIZE) ? eeprom[addr] : 0xFF;
+}
+
+void eeprom_wr_byte(uint16_t addr, uint8_t byte)
+{
+	if (addr >= EEPROM_SIZE)
+		return;
+
+	eeprom[addr] = byte;
+
+	if (eeprom_fd >= 0 && pwrite(eeprom_fd, &byte, 1, addr) != 1)
+		perror("eeprom");
+}
+
+/************************************************************************/
+/* Interrupts                                                           */
+/*                                                                      */
+/* A request sets the interrupt's flag, and the CPU takes the pending   */
+/* one of lowest vector number, as the PMIC does with a single level    */
+/* and without round robin. Taking it clears the flag, and its handler  */
+/* runs isr_entry_cycles later, plus up to isr_entry_spread cycles to   */
+/* end the instruction the CPU was on. The next one is taken after the  */
+/* handler's cycles and isr_exit_cycles for the reti. A request of a    */
+/* pending interrupt is merged with it. The core's tick isn't one of    */
+/* these, it runs at its time, or after the handler on at that time.    */
+/* The costs are 0 by default, so the handlers run at the time of their */
+/* request.                                                             */
+/*                                                                      */
+/* A handler's cycles are the ones of the functions it ran, when their  */
+/* cycles are loaded (see below), or its body_cycles if longer. Its     */
+/* writes to the peripherals are held back, and each is done when the   */
+/* cycles of the functions run before the next call are up, so the      */
+/* outputs it changes move with the path it took. The core's tick and   */
+/* the commands wait for the last of them.                              */
+/************************************************************************/
+typedef struct
+{
+	const char *name;
+	uint8_t vector;                           // Number on iox128a1u.h
+	void (*handler)(void);
+	uint32_t body_cycles;                     // From the handler's first instruction to its reti
+	uint64_t requested;                       // NEVER if not pending
+} emu_isr_t;
+
+/* By vector number */
+enum {ISR_TCC0_CCA, ISR_TCE0_CCA, ISR_TCD0_CCA, ISR_PORTQ_INT0, ISR_PORTH_INT0, ISR_PORTK_INT0, ISR_PORTF_INT0, ISR_PORTF_INT1, ISR_TCF0_CCA, N_ISRS};
+
+static emu_isr_t isrs[N_ISRS] = {
+	{"TCC0_CCA", 16, TCC0_CCA_vect, 0, NEVER},
+	{"TCE0_CCA", 49, TCE0_CCA_vect, 0, NEVER},
+	{"TCD0_CCA", 79, TCD0_CCA_vect, 0, NEVER},
+	{"PORTQ_INT0", 94, PORTQ_INT0_vect, 0, NEVER},
+	{"PORTH_INT0", 96, PORTH_INT0_vect, 0, NEVER},
+	{"PORTK_INT0", 100, PORTK_INT0_vect, 0, NEVER},
+	{"PORTF_INT0", 104, PORTF_INT0_vect, 0, NEVER},
+	{"PORTF_INT1", 105, PORTF_INT1_vect, 0, NEVER},
+	{"TCF0_CCA", 110, TCF0_CCA_vect, 0, NEVER}
+};
+
+static uint32_t isr_entry_cycles = 0;
+static uint32_t isr_entry_spread = 0;
+static uint32_t isr_exit_cycles = 0;
+
+static int8_t isr_taken = -1;             // Interrupt whose handler runs at isr_run
+static uint64_t isr_run;
+static uint64_t isr_cpu_free = 0;         // End of the last handler's reti
+static uint64_t isr_start;               // Time the last handler ran
+static uint64_t isr_done = NEVER;         // Time of its next writes held back
+
+/* Cycles of the functions run, counted by the hooks of the firmware's cycles */
+typedef struct
+{
+	uintptr_t addr;
+	uint32_t cycles;
+} fw_cost_t;
+
+static fw_cost_t *fw_costs = NULL;
+static uint32_t n_fw_costs = 0;
+static uint32_t fw_cycles = 0;
+static uint8_t fw_counting = 0;
+
+static void port_strobes_replay(void) __attribute__((no_instrument_function));
+
+/* The peripherals before the handler, and after each of its writes */
+typedef struct
+{
+	void *p;
+	size_t size;
+} io_region_t;
+
+#define IO_REGION(x) {(void*)&(x), sizeof(x)}
+
+static const io_region_t io_regions[] = {
+	IO_REGION(PORTA), IO_REGION(PORTB), IO_REGION(PORTC), IO_REGION(PORTD), IO_REGION(PORTE),
+	IO_REGION(PORTF), IO_REGION(PORTH), IO_REGION(PORTJ), IO_REGION(PORTK), IO_REGION(PORTQ),
+	IO_REGION(TCC0), IO_REGION(TCD0), IO_REGION(TCE0), IO_REGION(TCF0),
+	IO_REGION(TCC1), IO_REGION(TCD1), IO_REGION(TCE1), IO_REGION(TCF1),
+	IO_REGION(EVSYS), IO_REGION(AWEXC), IO_REGION(AWEXE), IO_REGION(PMIC)
+};
+
+#define N_IO_REGIONS (sizeof(io_regions) / sizeof(io_regions[0]))
+#define IO_SIZE (10 * sizeof(PORT_t) + 4 * sizeof(TC0_t) + 4 * sizeof(TC1_t) + sizeof(EVSYS_t) + 2 * sizeof(AWEX_t) + sizeof(PMIC_t))
+
+typedef struct
+{
+	uint32_t cycles;                          // From the start of the handler
+	uint8_t io[IO_SIZE];
+} io_writes_t;
+
+static io_writes_t io_before;
+static io_writes_t *io_writes = NULL;
+static uint32_t n_io_writes = 0, max_io_writes = 0;
+static uint32_t io_next;                  // Writes done next
+
+static void io_save(uint8_t *to) __attribute__((no_instrument_function));
+static int io_differs(const uint8_t *from) __attribute__((no_instrument_function));
+static void io_mark(void) __attribute__((no_instrument_function));
+
+static void io_save(uint8_t *to)
+{
+	for (uint8_t r = 0; r < N_IO_REGIONS; r++)
+	{
+		memcpy(to, io_regions[r].p, io_regions[r].size);
+		to += io_regions[r].size;
+	}
+}
+
+static void io_restore(const uint8_t *from)
+{
+	for (uint8_t r = 0; r < N_IO_REGIONS; r++)
+	{
+		memcpy(io_regions[r].p, from, io_regions[r].size);
+		from += io_regions[r].size;
+	}
+}
+
+static int io_differs(const uint8_t *from)
+{
+	for (uint8_t r = 0; r < N_IO_REGIONS; r++)
+	{
+		if (memcmp(io_regions[r].p, from, io_regions[r].size))
+			return 1;
+		from += io_regions[r].size;
+	}
+
+	return 0;
+}
+
+/* Keeps what the handler wrote up to now, at the cycles it has run */
+static void io_mark(void)
+{
+	io_writes_t *last = n_io_writes ? &io_writes[n_io_writes - 1] : &io_before;
+
+	/* The strobes are on OUT already, as the firmware reads it back */
+	port_strobes_replay();
+
+	if (!io_differs(last->io))
+		return;
+
+	if (n_io_writes == 0 || last->cycles != fw_cycles)
+	{
+		if (n_io_writes == max_io_writes)
+		{
+			max_io_writes = max_io_writes ? max_io_writes * 2 : 16;
+			io_writes = realloc(io_writes, sizeof(io_writes_t) * max_io_writes);
+		}
+
+		last = &io_writes[n_io_writes++];
+		last->cycles = fw_cycles;
+	}
+
+	io_save(last->io);
+}
+
+/* Does the next writes of the handler, on top of what the peripherals did since */
+static void isr_writes_done(void)
+{
+	const uint8_t *before = io_next ? io_writes[io_next - 1].io : io_before.io;
+	const uint8_t *after = io_writes[io_next].io;
+	uint16_t k = 0;
+
+	io_next++;
+	isr_done = NEVER;
+	firmware_enter();
+
+	for (uint8_t r = 0; r < N_IO_REGIONS; r++)
+		for (size_t i = 0; i < io_regions[r].size; i++, k++)
+			if (after[k] != before[k])
+				((uint8_t*)io_regions[r].p)[i] = after[k];
+
+	firmware_leave();
+
+	if (io_next < n_io_writes)
+		isr_done = isr_start + io_writes[io_next].cycles;
+}
+
+static void isr_request(uint8_t i)
+{
+	if (isrs[i].requested == NEVER)
+		isrs[i].requested = now;
+}
+
+static uint64_t isr_next_time(void)
+{
+	uint64_t t = NEVER;
+
+	/* Nothing is taken before the end of the handler */
+	if (isr_done != NEVER)
+		return isr_done;
+
+	if (isr_taken >= 0)
+		return isr_run;
+
+	for (uint8_t i = 0; i < N_ISRS; i++)
+		if (isrs[i].requested < t)
+			t = isrs[i].requested;
+
+	return (t != NEVER && t < isr_cpu_free) ? isr_cpu_free : t;
+}
+
+/* Takes the next interrupt, or runs the handler of the one taken */
+static void isr_run_event(void)
+{
+	if (isr_done != NEVER)
+	{
+		isr_writes_done();
+		return;
+	}
+
+	if (isr_taken < 0)
+	{
+		uint8_t i = 0;
+
+		while (isrs[i].requested > now)
+			i++;
+
+		isrs[i].requested = NEVER;
+		isr_taken = i;
+		isr_run = now + isr_entry_cycles + (isr_entry_spread ? rand() % (isr_entry_spread + 1) : 0);
+		return;
+	}
+
+	emu_isr_t *isr = &isrs[isr_taken];
+
+	isr_taken = -1;
+	firmware_enter();
+
+	fw_cycles = 0;
+	n_io_writes = 0;
+
+	if (n_fw_costs)
+	{
+		io_save(io_before.io);
+		fw_counting = 1;
+	}
+
+	isr->handler();
+
+	if (fw_counting)
+	{
+		fw_counting = 0;
+		io_mark();
+	}
+
+	if (n_io_writes)
+	{
+		io_restore(io_before.io);
+		io_next = 0;
+		isr_start = now;
+		isr_done = now + io_writes[0].cycles;
+	}
+	else
+	{
+		firmware_leave();
+	}
+
+	isr_cpu_free = now + ((fw_cycles > isr->body_cycles) ? fw_cycles : isr->body_cycles) + isr_exit_cycles;
+}
+
+static void reset_isrs(void)
+{
+	for (uint8_t i = 0; i < N_ISRS; i++)
+		isrs[i].requested = NEVER;
+
+	isr_taken = -1;
+	isr_cpu_free = now;
+	isr_done = NEVER;
+}
+
+/************************************************************************/
+/* Cycles of the firmware                                               */
+/*                                                                      */
+/* A table of the device's cycles of each function, as isr_analysis -f  */
+/* writes it from the firmware's listing, is matched by name with the   */
+/* functions of the host build, which nm lists, and with the handlers   */
+/* by their vector number. With a build of -finstrument-functions, each */
+/* function the firmware runs calls the hook below, which adds its      */
+/* cycles while a handler runs. So a handler is charged the functions   */
+/* of the path it took, each with its worst case. A function inlined on */
+/* the device isn't on the table and costs nothing, as its caller's     */
+/* cycles have it.                                                      */
+/************************************************************************/
+static unsigned long fw_hooks = 0;       // Calls of the hook, 0 if not built for it
+
+void __cyg_profile_func_enter(void *fn, void *site) __attribute__((no_instrument_function));
+void __cyg_profile_func_exit(void *fn, void *site) __attribute__((no_instrument_function));
+
+void __cyg_profile_func_enter(void *fn, void *site)
+{
+	uint32_t lo = 0, hi = n_fw_costs;
+
+	fw_hooks++;
+
+	if (!fw_counting)
+		return;
+
+	io_mark();
+
+	while (lo < hi)
+	{
+		uint32_t mid = (lo + hi) / 2;
+
+		if (fw_costs[mid].addr < (uintptr_t)fn)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	if (lo < n_fw_costs && fw_costs[lo].addr == (uintptr_t)fn)
+		fw_cycles += fw_costs[lo].cycles;
+}
+
+void __cyg_profile_func_exit(void *fn, void *site)
+{
+}
+
+static void fw_cost_add(uintptr_t addr, uint32_t cycles)
+{
+	fw_costs = realloc(fw_costs, sizeof(fw_cost_t) * (n_fw_costs + 1));
+	fw_costs[n_fw_costs++] = (fw_cost_t){addr, cycles};
+}
+
+static int fw_cost_compare(const void *a, const void *b)
+{
+	uintptr_t x = ((const fw_cost_t*)a)->addr, y = ((const fw_cost_t*)b)->addr;
+
+	return (x > y) - (x < y);
+}
+
+/* The name without the suffix of a clone made by the compiler, NULL for a part of a function */
+static char *function_name(char *name)
+{
+	char *suffix = strchr(name, '.');
+
+	if (suffix)
+	{
+		if (strncmp(suffix, ".constprop", 10) && strncmp(suffix, ".isra", 5))
+			return NULL;
+
+		*suffix = 0;
+	}
+
+	return name;
+}
+
+int main(int argc, char *argv[]);
+
+/* Returns the number of functions found, or -1 if the table or the symbols can't be read */
+int fw_costs_load(const char *path)
+{
+	FILE *f = fopen(path, "r");
+	char line[256], name[128], exe[1024], cmd[1100];
+	char (*names)[128] = NULL;
+	uint32_t *cycles = NULL;
+	uint32_t n = 0;
+	unsigned long value;
+	unsigned long long addr;
+	uintptr_t main_addr = 0;
+	char type;
+
+	if (f == NULL)
+		return -1;
+
+	while (fgets(line, sizeof(line), f))
+	{
+		unsigned vector;
+
+		if (line[0] == '#' || sscanf(line, "%127s %lu", name, &value) != 2)
+			continue;
+
+		if (sscanf(name, "__vector_%u", &vector) == 1)
+		{
+			for (uint8_t i = 0; i < N_ISRS; i++)
+				if (isrs[i].vector == vector)
+					fw_cost_add((uintptr_t)isrs[i].handler, value);
+			continue;
+		}
+
+		if (function_name(name) == NULL)
+			continue;
+
+		names = realloc(names, sizeof(*names) * (n + 1));
+		cycles = realloc(cycles, sizeof(uint32_t) * (n + 1));
+		snprintf(names[n], sizeof(names[n]), "%s", name);
+		cycles[n++] = value;
+	}
+
+	fclose(f);
+
+	/* The addresses of nm are moved by where the program was loaded, which main gives */
+	ssize_t length = readlink("/proc/self/exe", exe, sizeof(exe) - 1);
+
+	if (length < 0)
+		return -1;
+
+	exe[length] = 0;
+	snprintf(cmd, sizeof(cmd), "nm \"%s\"", exe);
+
+	uint32_t first = n_fw_costs;
+
+	if ((f = popen(cmd, "r")) == NULL)
+		return -1;
+
+	while (fgets(line, sizeof(line), f))
+	{
+		if (sscanf(line, "%llx %c %127s", &addr, &type, name) != 3 || (type != 't' && type != 'T'))
+			continue;
+
+		if (!strcmp(name, "main"))
+			main_addr = addr;
+
+		if (function_name(name) == NULL)
+			continue;
+
+		for (uint32_t i = 0; i < n; i++)
+			if (!strcmp(names[i], name))
+				fw_cost_add(addr, cycles[i]);
+	}
+
+	if (pclose(f) || main_addr == 0)
+		return -1;
+
+	for (uint32_t i = first; i < n_fw_costs; i++)
+		fw_costs[i].addr += (uintptr_t)main - main_addr;
+
+	qsort(fw_costs, n_fw_costs, sizeof(fw_cost_t), fw_cost_compare);
+
+	free(names);
+	free(cycles);
+
+	return n_fw_costs;
+}
+
+/************************************************************************/
+/* Channel timers                                                       */
+/*                                                                      */
+/* A TC0 on single slope PWM. The counter is only computed when needed, */
+/* from its value at the last event and the cycles since then, and the  */
+/* next event is either the compare match, which calls the CCA          */
+/* interrupt, or the update at TOP, which loads PERBUF and CCABUF. A    */
+/* timer clocked by an event channel counts on the rising edges of the  */
+/* channel's input and one clocked by event channel 7 is frozen.        */
+/*                                                                      */
+/* The AWeX of channels 0 and 2, when on, drives PWM_OUTx only while    */
+/* the bit 0 of OUTOVEN is set, and a high level on one of the event    */
+/* channels of FDEMASK clears it. In the cycle-by-cycle mode the device */
+/* sets it back on the first UPDATE without the fault, unless the       */
+/* firmware writes OUTOVEN before.                                      */
+/************************************************************************/
+typedef struct
+{
+	TC0_t *tc;
+	PORT_t *port;                             // PWM_OUTx is pin 0
+	AWEX_t *awex;
+	uint8_t cca_isr;
+	uint16_t cnt;                             // Counter at time last
+	uint64_t last;
+	uint64_t next;                            // Next event on the internal clock
+	uint8_t perbv;
+	uint8_t ccabv;
+	uint8_t fault_oe;                         // OUTOVEN cleared by the fault
+	/* Registers given to the firmware */
+	uint8_t ctrla;
+	uint16_t cnt_reg, per, cca, perbuf, ccabuf;
+} emu_tc0_t;
+
+static emu_tc0_t tc0s[4] = {
+	{.tc = &TCC0, .port = &PORTC, .awex = &AWEXC, .cca_isr = ISR_TCC0_CCA, .next = NEVER},
+	{.tc = &TCD0, .port = &PORTD, .cca_isr = ISR_TCD0_CCA, .next = NEVER},
+	{.tc = &TCE0, .port = &PORTE, .awex = &AWEXE, .cca_isr = ISR_TCE0_CCA, .next = NEVER},
+	{.tc = &TCF0, .port = &PORTF, .cca_isr = ISR_TCF0_CCA, .next = NEVER}
+};
+
+static uint8_t event_channel_level(uint8_t evch);
+
+static uint16_t clock_divider(uint8_t ctrla)
+{
+	return (ctrla >= TC_CLKSEL_DIV1_gc && ctrla <= TC_CLKSEL_DIV1024_gc) ? get_divider(ctrla) : 0;
+}
+
+static uint16_t tc0_top(emu_tc0_t *t)
+{
+	/* A counter above PER runs up to 0xFFFF */
+	return (t->cnt > t->tc->PER) ? 0xFFFF : t->tc->PER;
+}
+
+/* Ticks of the clock since the last event, up to the next event */
+static uint64_t tc0_ticks(emu_tc0_t *t, uint8_t ctrla, uint64_t time)
+{
+	uint16_t div = clock_divider(ctrla);
+	uint64_t ticks = div ? (time - t->last) / div : 0;
+	uint16_t top = tc0_top(t);
+
+	return (t->cnt + ticks > top) ? top - t->cnt : ticks;
+}
+
+static uint8_t awex_fault(AWEX_t *awex)
+{
+	for (uint8_t c = 0; c < 8; c++)
+		if ((awex->FDEMASK & (1 << c)) && event_channel_level(c))
+			return 1;
+
+	return 0;
+}
+
+static uint8_t awex_cuts(AWEX_t *awex)
+{
+	if (!awex || !(awex->CTRL & AWEX_DTICCAEN_bm))
+		return 0;
+
+	return !(awex->OUTOVEN & (1<<0)) || awex_fault(awex);
+}
+
+static void awex_event(emu_tc0_t *t, uint8_t evch, uint8_t level)
+{
+	AWEX_t *awex = t->awex;
+
+	if (!awex || !(awex->CTRL & AWEX_DTICCAEN_bm) || !(awex->FDEMASK & (1 << evch)) || !level)
+		return;
+
+	if (awex->OUTOVEN)
+		t->fault_oe = awex->OUTOVEN;
+	awex->OUTOVEN = 0;
+	awex->STATUS |= AWEX_FDF_bm;
+}
+
+static void awex_update(emu_tc0_t *t)
+{
+	AWEX_t *awex = t->awex;
+
+	if (!awex || !t->fault_oe || !(awex->FDCTRL & AWEX_FDMODE_bm) || awex_fault(awex))
+		return;
+
+	if (awex->CTRL & AWEX_DTICCAEN_bm)
+		awex->OUTOVEN |= t->fault_oe;
+	t->fault_oe = 0;
+}
+
+static uint8_t tc0_output(emu_tc0_t *t)
+{
+	TC0_t *tc = t->tc;
+
+	if (awex_cuts(t->awex))
+		return 0;
+
+	return tc->CTRLA && (tc->CTRLB & TC0_CCAEN_bm) && t->cnt + tc0_ticks(t, tc->CTRLA, now) < tc->CCA;
+}
+
+static void tc0_schedule(emu_tc0_t *t)
+{
+	uint16_t div = clock_divider(t->tc->CTRLA);
+	uint16_t top = tc0_top(t);
+	uint32_t n;
+
+	if (!div)
+	{
+		t->next = NEVER;
+		return;
+	}
+
+	if (t->cnt < t->tc->CCA && t->tc->CCA <= top)
+		n = t->tc->CCA - t->cnt;
+	else
+		n = top - t->cnt + 1;
+
+	t->next = t->last + (uint64_t)n * div;
+}
+
+static void tc0_tick(emu_tc0_t *t)
+{
+	TC0_t *tc = t->tc;
+
+	if (t->cnt >= tc0_top(t))
+	{
+		t->cnt = 0;
+
+		if (t->perbv)
+			tc->PER = tc->PERBUF;
+		if (t->ccabv)
+			tc->CCA = tc->CCABUF;
+
+		t->perbv = 0;
+		t->ccabv = 0;
+		awex_update(t);
+	}
+	else
+	{
+		t->cnt++;
+	}
+
+	if (t->cnt == tc->CCA && (tc->INTCTRLB & TC_CCAINTLVL_gm))
+		isr_request(t->cca_isr);
+
+	tc0_schedule(t);
+}
+
+static void tc0_run_event(emu_tc0_t *t)
+{
+	uint16_t div = clock_divider(t->tc->CTRLA);
+
+	t->cnt += (t->next - t->last) / div - 1;
+	t->last = t->next;
+	tc0_tick(t);
+}
+
+static void tc0_before_firmware(emu_tc0_t *t)
+{
+	TC0_t *tc = t->tc;
+
+	tc->CNT = t->cnt_reg = t->cnt + tc0_ticks(t, tc->CTRLA, now);
+	t->ctrla = tc->CTRLA;
+	t->per = tc->PER;
+	t->cca = tc->CCA;
+	t->perbuf = tc->PERBUF;
+	t->ccabuf = tc->CCABUF;
+}
+
+static void tc0_after_firmware(emu_tc0_t *t)
+{
+	TC0_t *tc = t->tc;
+	uint8_t rebase = (tc->CTRLA != t->ctrla);
+
+	/* A write to PER or CCA also writes the buffer */
+	if (tc->PER != t->per || tc->CCA != t->cca)
+	{
+		tc->PERBUF = tc->PER;
+		tc->CCABUF = tc->CCA;
+		t->perbv = 0;
+		t->ccabv = 0;
+		rebase = 1;
+	}
+	else
+	{
+		if (tc->PERBUF != t->perbuf)
+			t->perbv = 1;
+		if (tc->CCABUF != t->ccabuf)
+			t->ccabv = 1;
+	}
+
+	if (tc->CNT != t->cnt_reg)
+	{
+		t->cnt = tc->CNT;
+		t->last = now;
+	}
+	else if (rebase && now > t->last)
+	{
+		/* On the same clock, up to the tick before now, so an event due now still happens */
+		uint16_t div = clock_divider(t->ctrla);
+		uint8_t same_clock = (tc->CTRLA == t->ctrla);
+		uint64_t ticks = tc0_ticks(t, t->ctrla, same_clock ? now - 1 : now);
+
+		t->cnt += ticks;
+		t->last = (div && same_clock) ? t->last + ticks * div : now;
+	}
+
+	tc0_schedule(t);
+}
+
+/************************************************************************/
+/* Frequency meter timers                                               */
+/*                                                                      */
+/* A TC1 capturing on its event channel, on frequency capture (restart  */
+/* and capture on the rising edge) or pulse width capture (restart on   */
+/* the rising edge, capture on the falling one). Its counter is only    */
+/* computed from the cycles since the last restart. The bit 7 of        */
+/* INTFLAGS, unused, tells if the firmware wrote it to clear flags.     */
+/* Only the last write of a call is seen, so the overflow flag, which   */
+/* the firmware clears on each of its restarts, is cleared with them.   */
+/************************************************************************/
+#define INTFLAGS_NOT_WRITTEN 0x80
+
+typedef struct
+{
+	TC1_t *tc;
+	uint64_t start;                           // Time of the last restart
+	uint64_t wraps;                           // Overflows since the last restart
+	uint8_t flags;
+	uint8_t ctrla;
+} emu_tc1_t;
+
+static emu_tc1_t tc1s[2] = {
+	{.tc = &TCD1},
+	{.tc = &TCE1}
+};
+
+static uint64_t tc1_ticks(emu_tc1_t *t)
+{
+	uint16_t div = clock_divider(t->tc->CTRLA);
+
+	return div ? (now - t->start) / div : 0;
+}
+
+static uint16_t tc1_count(emu_tc1_t *t)
+{
+	uint64_t ticks = tc1_ticks(t);
+	uint64_t wraps = ticks / ((uint32_t)t->tc->PER + 1);
+
+	if (wraps > t->wraps)
+	{
+		t->flags |= TC1_OVFIF_bm;
+		t->wraps = wraps;
+	}
+
+	return ticks % ((uint32_t)t->tc->PER + 1);
+}
+
+static void tc1_restart(emu_tc1_t *t)
+{
+	t->start = now;
+	t->wraps = 0;
+}
+
+static void tc1_event(emu_tc1_t *t, uint8_t evch, uint8_t rising)
+{
+	TC1_t *tc = t->tc;
+	uint8_t action = tc->CTRLD & TC_EVACT_gm;
+
+	if (!tc->CTRLA || (tc->CTRLD & TC_EVSEL_gm) != TC_EVSEL_CH0_gc + evch)
+		return;
+
+	uint16_t cnt = tc1_count(t);
+
+	if ((action == TC_EVACT_FRQ_gc && rising) || (action == TC_EVACT_PW_gc && !rising))
+	{
+		if (tc->CTRLB & TC1_CCAEN_bm)
+		{
+			tc->CCA = cnt;
+			t->flags |= TC1_CCAIF_bm;
+		}
+	}
+
+	if ((action == TC_EVACT_FRQ_gc || action == TC_EVACT_PW_gc) && rising)
+		tc1_restart(t);
+}
+
+static void tc1_before_firmware(emu_tc1_t *t)
+{
+	TC1_t *tc = t->tc;
+
+	tc->CNT = tc1_count(t);
+	tc->INTFLAGS = t->flags | INTFLAGS_NOT_WRITTEN;
+	tc->CTRLFSET = 0;
+	t->ctrla = tc->CTRLA;
+}
+
+static void tc1_after_firmware(emu_tc1_t *t)
+{
+	TC1_t *tc = t->tc;
+
+	if (!(tc->INTFLAGS & INTFLAGS_NOT_WRITTEN))
+		t->flags &= ~tc->INTFLAGS;
+
+	if (tc->CTRLA != t->ctrla || (tc->CTRLFSET & TC_CMD_gm) == TC_CMD_RESTART_gc)
+	{
+		tc1_restart(t);
+		t->flags &= ~TC1_OVFIF_bm;
+	}
+}
+
+/************************************************************************/
+/* Trigger inputs                                                       */
+/*                                                                      */
+/* A level change goes through the event system first, clocking the     */
+/* timers and the captures on the pin's event channels, and then to the */
+/* pin change interrupt, if the pin's mask and sense ask for it. The    */
+/* PINnCTRL inversion applies to both, as on the device.                */
+/************************************************************************/
+typedef struct
+{
+	const char *name;
+	PORT_t *port;
+	uint8_t pin;
+	uint8_t int_n;
+	uint8_t isr;
+	uint8_t chmux;                            // EVSYS_CHMUX of the pin, 0 if it can't make events
+	uint8_t level;
+	/* Generators */
+	uint64_t pulse_end;
+	double wave_freq;
+	double wave_duty;
+	uint64_t wave_start;
+	uint64_t wave_edge;                       // Even edges rise, odd ones fall
+	uint64_t wave_next;
+} emu_trig_t;
+
+static emu_trig_t trigs[5] = {
+	{"0", &PORTF, 5, 0, ISR_PORTF_INT0, EVSYS_CHMUX_PORTF_PIN5_gc, 0, NEVER, 0, 0, 0, 0, NEVER},
+	{"1", &PORTF, 6, 1, ISR_PORTF_INT1, EVSYS_CHMUX_PORTF_PIN6_gc, 0, NEVER, 0, 0, 0, 0, NEVER},
+	{"2", &PORTH, 4, 0, ISR_PORTH_INT0, 0, 0, NEVER, 0, 0, 0, 0, NEVER},
+	{"3", &PORTK, 1, 0, ISR_PORTK_INT0, 0, 0, NEVER, 0, 0, 0, 0, NEVER},
+	{"all", &PORTQ, 2, 0, ISR_PORTQ_INT0, 0, 0, NEVER, 0, 0, 0, 0, NEVER}
+};
+
+static uint8_t trig_in(emu_trig_t *p)
+{
+	return p->level ^ (((&p->port->PIN0CTRL)[p->pin] & PORT_INVEN_bm) ? 1 : 0);
+}
+
+static uint8_t event_channel_level(uint8_t evch)
+{
+	for (uint8_t i = 0; i < 5; i++)
+		if (trigs[i].chmux && (&EVSYS.CH0MUX)[evch] == trigs[i].chmux)
+			return trig_in(&trigs[i]);
+
+	return 0;
+}
+
+static void event_channel_edge(uint8_t evch, uint8_t rising)
+{
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		awex_event(&tc0s[i], evch, rising);
+
+		if (rising && tc0s[i].tc->CTRLA == TC_CLKSEL_EVCH0_gc + evch)
+		{
+			tc0s[i].last = now;
+			tc0_tick(&tc0s[i]);
+		}
+	}
+
+	for (uint8_t i = 0; i < 2; i++)
+		tc1_event(&tc1s[i], evch, rising);
+}
+
+static void trig_set(emu_trig_t *p, uint8_t level)
+{
+	PORT_t *port = p->port;
+
+	if (p->level == level)
+		return;
+
+	p->level = level;
+	uint8_t in = trig_in(p);
+
+	if (p->chmux)
+		for (uint8_t c = 0; c < 8; c++)
+			if ((&EVSYS.CH0MUX)[c] == p->chmux)
+				event_channel_edge(c, in);
+
+	uint8_t sense = (&port->PIN0CTRL)[p->pin] & PORT_ISC_gm;
+	uint8_t mask = p->int_n ? port->INT1MASK : port->INT0MASK;
+	uint8_t int_level = (port->INTCTRL >> (2 * p->int_n)) & 0x03;
+
+	if (!(mask & (1 << p->pin)) || !int_level)
+		return;
+
+	if (sense == PORT_ISC_BOTHEDGES_gc || (sense == PORT_ISC_RISING_gc && in) || (sense == PORT_ISC_FALLING_gc && !in))
+		isr_request(p->isr);
+}
+
+static uint64_t wave_edge_time(emu_trig_t *p, uint64_t edge)
+{
+	double period = F_CPU / p->wave_freq;
+	double t = (edge / 2) * period + ((edge & 1) ? period * p->wave_duty / 100 : 0);
+
+	return p->wave_start + (uint64_t)(t + 0.5);
+}
+
+/************************************************************************/
+/* Calls to the firmware                                                */
+/*                                                                      */
+/* The peripherals are brought to the current time before the firmware  */
+/* runs, and what it wrote is applied to their models afterwards. The   */
+/* logs of the ports' OUTSET, OUTCLR and OUTTGL strobes are replayed on */
+/* OUT when it returns. IN reads the output pins back.                  */
+/************************************************************************/
+static PORT_t * const ports[] = {&PORTA, &PORTB, &PORTC, &PORTD, &PORTE, &PORTF, &PORTH, &PORTJ, &PORTK, &PORTQ};
+
+uint16_t port_strobes = 0;
+
+#define N_PORTS (sizeof(ports) / sizeof(ports[0]))
+
+static void firmware_enter(void)
+{
+	while (isr_done != NEVER)
+		isr_writes_done();
+
+	for (uint8_t i = 0; i < N_PORTS; i++)
+		ports[i]->IN = (ports[i]->IN & ~ports[i]->DIR) | (ports[i]->OUT & ports[i]->DIR);
+
+	for (uint8_t i = 0; i < 5; i++)
+	{
+		emu_trig_t *p = &trigs[i];
+
+		if (trig_in(p))
+			p->port->IN |= (1 << p->pin);
+		else
+			p->port->IN &= ~(1 << p->pin);
+	}
+
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		if (tc0_output(&tc0s[i]))
+			tc0s[i].port->IN |= (1 << 0);
+		else
+			tc0s[i].port->IN &= ~(1 << 0);
+
+		tc0_before_firmware(&tc0s[i]);
+	}
+
+	for (uint8_t i = 0; i < 2; i++)
+		tc1_before_firmware(&tc1s[i]);
+}
+
+static void port_strobes_replay(void)
+{
+	if (port_strobes > PORT_STROBES_LOG)
+		fprintf(stderr, "%u writes to the ports' strobes on one call, the first ones are lost\n", port_strobes);
+
+	for (uint16_t k = 0; k < port_strobes && k < PORT_STROBES_LOG; k++)
+	{
+		uint16_t n = (port_strobes > PORT_STROBES_LOG) ? (port_strobes + k) % PORT_STROBES_LOG : k;
+
+		for (uint8_t i = 0; i < N_PORTS; i++)
+		{
+			PORT_t *port = ports[i];
+
+			port->OUT = ((port->OUT | port->outset_log[n]) & ~port->outclr_log[n]) ^ port->outtgl_log[n];
+			port->outset_log[n] = port->outclr_log[n] = port->outtgl_log[n] = 0;
+		}
+	}
+
+	port_strobes = 0;
+}
+
+static void firmware_leave(void)
+{
+	port_strobes_replay();
+
+	for (uint8_t i = 0; i < 4; i++)
+		tc0_after_firmware(&tc0s[i]);
+
+	for (uint8_t i = 0; i < 2; i++)
+		tc1_after_firmware(&tc1s[i]);
+}
+
+static void reset_peripherals(void)
+{
+	for (uint8_t i = 0; i < N_PORTS; i++)
+		memset((void*)ports[i], 0, sizeof(PORT_t));
+
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		memset((void*)tc0s[i].tc, 0, sizeof(TC0_t));
+		tc0s[i].tc->PER = tc0s[i].tc->PERBUF = 0xFFFF;
+		tc0s[i].cnt = 0;
+		tc0s[i].last = now;
+		tc0s[i].next = NEVER;
+		tc0s[i].perbv = tc0s[i].ccabv = 0;
+		tc0s[i].fault_oe = 0;
+	}
+
+	for (uint8_t i = 0; i < 2; i++)
+	{
+		memset((void*)tc1s[i].tc, 0, sizeof(TC1_t));
+		tc1s[i].tc->PER = 0xFFFF;
+		tc1s[i].flags = 0;
+		tc1_restart(&tc1s[i]);
+	}
+
+	memset((void*)&EVSYS, 0, sizeof(EVSYS));
+	memset((void*)&AWEXC, 0, sizeof(AWEXC));
+	memset((void*)&AWEXE, 0, sizeof(AWEXE));
+
+	reset_isrs();
+}
+
+/************************************************************************/
+/* Harp frames                                                          */
+/*                                                                      */
+/* [type][length][address][port][payload type][timestamp][payload][sum] */
+/* The device always sends the timestamp, 32 bits of seconds and 16     */
+/* bits of 32 us, and the host may send it. The sum is modulo 256.      */
+/************************************************************************/
+#define HARP_READ 1
+#define HARP_WRITE 2
+#define HARP_EVENT 3
+#define HARP_ERROR 0x08
+#define HARP_PORT_DEVICE 255
+
+#define OUT_BUFFER_SIZE (1 << 20)
+
+static uint8_t out_buffer[OUT_BUFFER_SIZE];
+static size_t out_length = 0;
+static unsigned long n_dropped = 0;
+
+static void log_frame(const char *direction, const uint8_t *frame, size_t length)
+{
+	fprintf(stderr, "%12.6f %s", (double)now / F_CPU, direction);
+
+	for (size_t i = 0; i < length; i++)
+		fprintf(stderr, " %02X", frame[i]);
+
+	fprintf(stderr, "\n");
+}
+
+static void harp_send(uint8_t type, uint8_t add, uint8_t payload_type, const uint8_t *payload, uint16_t length, uint32_t seconds, uint16_t useconds)
+{
+	uint8_t frame[MAX_PACKET_SIZE + 2];
+	uint8_t sum = 0;
+
+	if (length > MAX_PACKET_SIZE - 10)
+		return;
+
+	frame[0] = type;
+	frame[1] = length + 10;
+	frame[2] = add;
+	frame[3] = HARP_PORT_DEVICE;
+	frame[4] = payload_type | MSK_TIMESTAMP_AT_PAYLOAD;
+	memcpy(frame + 5, &seconds, 4);
+	memcpy(frame + 9, &useconds, 2);
+	memcpy(frame + 11, payload, length);
+
+	for (uint16_t i = 0; i < length + 11; i++)
+		sum += frame[i];
+	frame[length + 11] = sum;
+
+	if (verbose)
+		log_frame(">", frame, length + 12);
+
+	/* A host that doesn't read loses the frames, as on a full UART */
+	if (out_length + length + 12 > OUT_BUFFER_SIZE)
+	{
+		n_dropped++;
+		return;
+	}
+
+	memcpy(out_buffer + out_length, frame, length + 12);
+	out_length += length + 12;
+}
+
+/************************************************************************/
+/* Harp core                                                            */
+/*                                                                      */
+/* The common registers, the operation modes, the timestamp and the     */
+/* timer callbacks, every 500 us, as done by the core library on the    */
+/* device. The device can't repeat or generate the clock, so it is      */
+/* never synchronized. A reset reboots the application: the peripherals */
+/* and the registers start over but the firmware's static variables     */
+/* keep their values.                                                   */
+/************************************************************************/
+#define CORE_TICK_CYCLES (F_CPU / 2000)
+
+static struct CommonBank common;
+static const uint8_t *default_name;
+static uint8_t *app_bank;
+static uint16_t app_bank_size;
+static uint8_t n_app_registers;
+
+static uint32_t seconds_offset = 0;       // R_TIMESTAMP_SECOND minus the seconds since the start
+static uint32_t user_seconds;
+static uint16_t user_useconds;
+static uint64_t next_core_tick = CORE_TICK_CYCLES;
+static uint8_t core_phase = 0;
+static uint32_t last_second = 0;
+
+static uint8_t dump_requested = 0;
+static uint8_t reset_requested = 0;
+
+typedef struct
+{
+	uint8_t *pointer;
+	uint8_t type;
+	uint8_t n_elements;
+	uint8_t writable;
+} common_reg_t;
+
+static const common_reg_t common_regs[COMMON_BANK_ADD_MAX + 1] = {
+	{(uint8_t*)&common.R_WHO_AM_I, TYPE_U16, 1, 0},
+	{&common.R_HW_VERSION_H, TYPE_U8, 1, 0},
+	{&common.R_HW_VERSION_L, TYPE_U8, 1, 0},
+	{&common.R_ASSEMBLY_VERSION, TYPE_U8, 1, 0},
+	{&common.R_CORE_VERSION_H, TYPE_U8, 1, 0},
+	{&common.R_CORE_VERSION_L, TYPE_U8, 1, 0},
+	{&common.R_FW_VERSION_H, TYPE_U8, 1, 0},
+	{&common.R_FW_VERSION_L, TYPE_U8, 1, 0},
+	{(uint8_t*)&common.R_TIMESTAMP_SECOND, TYPE_U32, 1, 1},
+	{(uint8_t*)&common.R_TIMESTAMP_MICRO, TYPE_U16, 1, 0},
+	{&common.R_OPERATION_CTRL, TYPE_U8, 1, 1},
+	{&common.R_RESET_DEV, TYPE_U8, 1, 1},
+	{common.R_DEVICE_NAME, TYPE_U8, 25, 1},
+	{(uint8_t*)&common.R_SERIAL_NUMBER, TYPE_U16, 1, 1},
+	{&common.R_CLOCK_CONFIG, TYPE_U8, 1, 1},
+	{&common.R_TIMESTAMP_OFFSET, TYPE_U8, 1, 1},
+	{common.R_UID, TYPE_U8, 16, 0},
+	{common.R_TAG, TYPE_U8, 8, 0},
+	{(uint8_t*)&common.R_HEARTBEAT, TYPE_U16, 1, 0},
+	{common.R_VERSION, TYPE_U8, 32, 0}
+};
+
+static void timestamp_at(uint64_t time, uint32_t *seconds, uint16_t *useconds)
+{
+	*seconds = (uint32_t)(time / F_CPU) + seconds_offset;
+	*useconds = (time % F_CPU) / (32 * (F_CPU / 1000000));
+}
+
+static uint8_t device_is_active(void)
+{
+	return (common.R_OPERATION_CTRL & MSK_OP_MODE) == GM_OP_MODE_ACTIVE;
+}
+
+static uint8_t register_info(uint8_t add, uint8_t **pointer, uint8_t *type, uint16_t *n_elements)
+{
+	if (add <= COMMON_BANK_ADD_MAX)
+	{
+		/* The registers that change by themselves */
+		timestamp_at(now, &common.R_TIMESTAMP_SECOND, &common.R_TIMESTAMP_MICRO);
+		common.R_HEARTBEAT = device_is_active() ? B_IS_ACTIVE : 0;
+
+		*pointer = common_regs[add].pointer;
+		*type = common_regs[add].type;
+		*n_elements = common_regs[add].n_elements;
+		return 1;
+	}
+
+	if (add >= APP_REGS_ADD_MIN && add < APP_REGS_ADD_MIN + n_app_registers)
+	{
+		*pointer = app_regs_pointer[add - APP_REGS_ADD_MIN];
+		*type = app_regs_type[add - APP_REGS_ADD_MIN];
+		*n_elements = app_regs_n_elements[add - APP_REGS_ADD_MIN];
+		return 1;
+	}
+
+	return 0;
+}
+
+static void send_register(uint8_t type, uint8_t add, uint32_t seconds, uint16_t useconds)
+{
+	uint8_t *pointer;
+	uint8_t reg_type;
+	uint16_t n_elements;
+
+	if (register_info(add, &pointer, &reg_type, &n_elements))
+		harp_send(type, add, reg_type, pointer, n_elements * (reg_type & MSK_TYPE_LEN), seconds, useconds);
+}
+
+static void reply(uint8_t type, uint8_t add, uint8_t payload_type, uint8_t ok)
+{
+	uint32_t seconds;
+	uint16_t useconds;
+
+	if (common.R_OPERATION_CTRL & B_MUTE_RPL)
+		return;
+
+	timestamp_at(now, &seconds, &useconds);
+
+	if (ok)
+		send_register(type, add, seconds, useconds);
+	else if (add <= COMMON_BANK_ADD_MAX || (add >= APP_REGS_ADD_MIN && add < APP_REGS_ADD_MIN + n_app_registers))
+		send_register(type | HARP_ERROR, add, seconds, useconds);
+	else
+		harp_send(type | HARP_ERROR, add, payload_type, NULL, 0, seconds, useconds);
+}
+
+uint32_t core_func_read_R_TIMESTAMP_SECOND(void)
+{
+	uint32_t seconds;
+	uint16_t useconds;
+
+	timestamp_at(now, &seconds, &useconds);
+	return seconds;
+}
+
+uint16_t core_func_read_R_TIMESTAMP_MICRO(void)
+{
+	uint32_t seconds;
+	uint16_t useconds;
+
+	timestamp_at(now, &seconds, &useconds);
+	return useconds;
+}
+
+void core_func_update_user_timestamp(uint32_t seconds, uint16_t useconds)
+{
+	user_seconds = seconds;
+	user_useconds = useconds;
+}
+
+void core_func_send_event(uint8_t add, bool use_core_timestamp)
+{
+	uint32_t seconds = user_seconds;
+	uint16_t useconds = user_useconds;
+
+	if (!device_is_active())
+		return;
+
+	if (use_core_timestamp)
+		timestamp_at(now, &seconds, &useconds);
+
+	send_register(HARP_EVENT, add, seconds, useconds);
+}
+
+bool core_bool_is_visual_enabled(void)
+{
+	return (common.R_OPERATION_CTRL & B_VISUALEN) ? true : false;
+}
+
+static uint8_t eeprom_has_registers(void)
+{
+	return eeprom[0] == (EEPROM_REGS_MARK >> 8) && eeprom[1] == (EEPROM_REGS_MARK & 0xFF);
+}
+
+static void boot(uint8_t from_eeprom)
+{
+	reset_peripherals();
+
+	common.R_OPERATION_CTRL = GM_OP_MODE_STANDBY | B_VISUALEN | B_OPLEDEN;
+
+	firmware_enter();
+	core_callback_define_clock_default();
+	core_callback_initialize_hardware();
+
+	if (from_eeprom && eeprom_has_registers())
+	{
+		memcpy(app_bank, eeprom + EEPROM_REGS_ADD, app_bank_size);
+		common.R_RESET_DEV = B_BOOT_EE;
+	}
+	else
+	{
+		memset(app_bank, 0, app_bank_size);
+		core_callback_reset_registers();
+		common.R_RESET_DEV = B_BOOT_DEF;
+	}
+
+	core_callback_registers_were_reinitialized();
+	firmware_leave();
+}
+
+void core_func_start_core(const uint16_t who_am_i, const uint8_t hwH, const uint8_t hwL, const uint8_t fwH, const uint8_t fwL, const uint8_t assembly, uint8_t *pointer_to_app_regs, const uint16_t app_mem_size_to_save, const uint8_t num_of_app_registers, const uint8_t *device_name, const bool device_is_able_to_repeat_clock, const bool device_is_able_to_generate_clock, const uint8_t default_timestamp_offset)
+{
+	common.R_WHO_AM_I = who_am_i;
+	common.R_HW_VERSION_H = hwH;
+	common.R_HW_VERSION_L = hwL;
+	common.R_ASSEMBLY_VERSION = assembly;
+	common.R_CORE_VERSION_H = 1;                  // The core library the firmware links, libATxmega128A1U-1.15
+	common.R_CORE_VERSION_L = 15;
+	common.R_FW_VERSION_H = fwH;
+	common.R_FW_VERSION_L = fwL;
+	common.R_TIMESTAMP_OFFSET = default_timestamp_offset;
+	common.R_CLOCK_CONFIG = (device_is_able_to_repeat_clock ? B_REP_ABLE : 0) | (device_is_able_to_generate_clock ? B_GEN_ABLE : 0) | B_CLK_UNLOCK;
+
+	default_name = device_name;
+	strncpy((char*)common.R_DEVICE_NAME, (const char*)device_name, sizeof(common.R_DEVICE_NAME) - 1);
+
+	app_bank = pointer_to_app_regs;
+	app_bank_size = app_mem_size_to_save;
+	n_app_registers = num_of_app_registers;
+
+	boot(true);
+}
+
+static void save_registers(void)
+{
+	eeprom_wr_byte(0, EEPROM_REGS_MARK >> 8);
+	eeprom_wr_byte(1, EEPROM_REGS_MARK & 0xFF);
+
+	for (uint16_t i = 0; i < app_bank_size; i++)
+		eeprom_wr_byte(EEPROM_REGS_ADD + i, app_bank[i]);
+}
+
+static uint8_t write_operation_ctrl(uint8_t value)
+{
+	uint8_t changed = common.R_OPERATION_CTRL ^ value;
+	uint8_t mode = value & MSK_OP_MODE;
+
+	/* No Speed Mode on this device */
+	if (mode != GM_OP_MODE_STANDBY && mode != GM_OP_MODE_ACTIVE)
+		return false;
+
+	common.R_OPERATION_CTRL = value & ~B_DUMP;
+
+	if (changed & MSK_OP_MODE)
+	{
+		if (mode == GM_OP_MODE_ACTIVE)
+			core_callback_device_to_active();
+		else
+			core_callback_device_to_standby();
+	}
+
+	if (changed & B_VISUALEN)
+	{
+		if (value & B_VISUALEN)
+			core_callback_visualen_to_on();
+		else
+			core_callback_visualen_to_off();
+	}
+
+	if (value & B_DUMP)
+		dump_requested = 1;
+
+	return true;
+}
+
+static uint8_t write_common_register(uint8_t add, uint8_t type, uint8_t *content, uint16_t n_elements)
+{
+	const common_reg_t *reg = &common_regs[add];
+
+	if (!reg->writable || type != reg->type || n_elements != reg->n_elements)
+		return false;
+
+	switch (add)
+	{
+		case ADD_R_TIMESTAMP_SECOND:
+		{
+			uint32_t seconds;
+
+			memcpy(&seconds, content, 4);
+			seconds_offset = seconds - (uint32_t)(now / F_CPU);
+			last_second = seconds;
+			return true;
+		}
+
+		case ADD_R_OPERATION_CTRL:
+			return write_operation_ctrl(content[0]);
+
+		case ADD_R_RESET_DEV:
+			if (content[0] & B_NAME_TO_DEFAULT)
+			{
+				memset(common.R_DEVICE_NAME, 0, sizeof(common.R_DEVICE_NAME));
+				strncpy((char*)common.R_DEVICE_NAME, (const char*)default_name, sizeof(common.R_DEVICE_NAME) - 1);
+			}
+
+			reset_requested = content[0] & (B_RST_DEF | B_RST_EE | B_SAVE);
+			return true;
+
+		case ADD_R_CONFIG:
+			if (content[0] & B_CLK_LOCK)
+				common.R_CLOCK_CONFIG = (common.R_CLOCK_CONFIG & ~B_CLK_UNLOCK) | B_CLK_LOCK;
+			else if (content[0] & B_CLK_UNLOCK)
+				common.R_CLOCK_CONFIG = (common.R_CLOCK_CONFIG & ~B_CLK_LOCK) | B_CLK_UNLOCK;
+			return true;
+
+		default:
+			memcpy(reg->pointer, content, n_elements * (type & MSK_TYPE_LEN));
+			return true;
+	}
+}
+
+static void dump_registers(void)
+{
+	uint32_t seconds;
+	uint16_t useconds;
+
+	timestamp_at(now, &seconds, &useconds);
+
+	for (uint8_t add = 0; add <= COMMON_BANK_ADD_MAX; add++)
+		send_register(HARP_READ, add, seconds, useconds);
+
+	for (uint8_t add = APP_REGS_ADD_MIN; add < APP_REGS_ADD_MIN + n_app_registers; add++)
+		if (core_read_app_register(add, app_regs_type[add - APP_REGS_ADD_MIN]))
+			send_register(HARP_READ, add, seconds, useconds);
+}
+
+static void harp_process(const uint8_t *frame, uint16_t length)
+{
+	uint8_t type = frame[0];
+	uint8_t add = frame[2];
+	uint8_t payload_type = frame[4] & ~MSK_TIMESTAMP_AT_PAYLOAD;
+	uint16_t start = (frame[4] & MSK_TIMESTAMP_AT_PAYLOAD) ? 11 : 5;
+	uint32_t content[MAX_PACKET_SIZE / 4 + 1];
+	uint16_t size = payload_type & MSK_TYPE_LEN;
+	uint8_t ok;
+
+	if (frame[3] != HARP_PORT_DEVICE || start >= length)
+		return;
+
+	/* Aligned, since the application casts it to its registers' types */
+	uint16_t n_bytes = length - 1 - start;
+	memcpy(content, frame + start, n_bytes);
+
+	/* The command waits for the end of a handler */
+	if (isr_done != NEVER)
+		run_until(isr_done);
+
+	firmware_enter();
+
+	if (type == HARP_READ)
+	{
+		if (add <= COMMON_BANK_ADD_MAX)
+			ok = (payload_type == common_regs[add].type);
+		else
+			ok = core_read_app_register(add, payload_type);
+	}
+	else if (size == 0 || n_bytes % size)
+	{
+		ok = false;
+	}
+	else if (add <= COMMON_BANK_ADD_MAX)
+	{
+		ok = write_common_register(add, payload_type, (uint8_t*)content, n_bytes / size);
+	}
+	else
+	{
+		ok = core_write_app_register(add, payload_type, (uint8_t*)content, n_bytes / size);
+	}
+
+	reply(type, add, payload_type, ok);
+
+	if (dump_requested)
+	{
+		dump_requested = 0;
+		dump_registers();
+	}
+
+	firmware_leave();
+
+	if (reset_requested)
+	{
+		if (reset_requested & B_SAVE)
+			save_registers();
+		else if (reset_requested & B_RST_DEF)
+			eeprom_wr_byte(0, 0xFF);
+
+		boot(!(reset_requested & B_RST_DEF));
+		reset_requested = 0;
+	}
+}
+
+static void core_tick(void)
+{
+	firmware_enter();
+
+	core_callback_t_before_exec();
+
+	if ((core_phase ^= 1))
+		core_callback_t_500us();
+	else
+		core_callback_t_1ms();
+
+	core_callback_t_after_exec();
+
+	uint32_t second = core_func_read_R_TIMESTAMP_SECOND();
+
+	if (second != last_second)
+	{
+		uint32_t seconds;
+		uint16_t useconds;
+
+		last_second = second;
+		core_callback_t_new_second();
+
+		timestamp_at(now, &seconds, &useconds);
+
+		if (common.R_OPERATION_CTRL & B_HEARTBEAT_EN)
+			send_register(HARP_EVENT, ADD_R_HEARTBEAT, seconds, useconds);
+
+		if ((common.R_OPERATION_CTRL & B_ALIVE_EN) && device_is_active())
+			send_register(HARP_EVENT, ADD_R_TIMESTAMP_SECOND, seconds, useconds);
+	}
+
+	firmware_leave();
+
+	next_core_tick += CORE_TICK_CYCLES;
+}
+
+/************************************************************************/
+/* Event loop                                                           */
+/*                                                                      */
+/* The events are run in order of their time. The firmware sees the     */
+/* time of its event, so it doesn't matter if the caller is late to run */
+/* them.                                                                */
+/************************************************************************/
+static uint64_t next_event_time(void)
+{
+	uint64_t t = next_core_tick;
+
+	/* The tick waits for the end of a handler */
+	if (isr_done != NEVER && t < isr_done)
+		t = isr_done;
+
+	if (isr_next_time() < t)
+		t = isr_next_time();
+
+	for (uint8_t i = 0; i < 4; i++)
+		if (tc0s[i].next < t)
+			t = tc0s[i].next;
+
+	for (uint8_t i = 0; i < 5; i++)
+	{
+		if (trigs[i].pulse_end < t)
+			t = trigs[i].pulse_end;
+		if (trigs[i].wave_next < t)
+			t = trigs[i].wave_next;
+	}
+
+	return t;
+}
+
+static void run_until(uint64_t target)
+{
+	uint64_t t;
+
+	while ((t = next_event_time()) <= target)
+	{
+		/* A tick that waited for a handler is late */
+		if (t > now)
+			now = t;
+
+		/* An interrupt requested by an event runs before the other events of its time */
+		if (isr_next_time() == t)
+		{
+			isr_run_event();
+			continue;
+		}
+
+		for (uint8_t i = 0; i < 4; i++)
+			if (tc0s[i].next == t)
+			{
+				tc0_run_event(&tc0s[i]);
+				goto next_event;
+			}
+
+		for (uint8_t i = 0; i < 5; i++)
+		{
+			emu_trig_t *p = &trigs[i];
+
+			if (p->pulse_end == t)
+			{
+				p->pulse_end = NEVER;
+				trig_set(p, 0);
+				goto next_event;
+			}
+
+			if (p->wave_next == t)
+			{
+				trig_set(p, !(p->wave_edge & 1));
+				p->wave_next = wave_edge_time(p, ++p->wave_edge);
+				goto next_event;
+			}
+		}
+
+		core_tick();
+
+		next_event:;
+	}
+
+	if (target > now)
+		now = target;
+}
+
+
+#endif /* _MULTIPWM_MODEL_C_ */
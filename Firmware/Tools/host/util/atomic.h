@@ -0,0 +1,14 @@
+#ifndef _HOST_UTIL_ATOMIC_H_
+#define _HOST_UTIL_ATOMIC_H_
+
+/************************************************************************/
+/* Host build of the atomic blocks                                      */
+/*                                                                      */
+/* The interrupts never preempt the firmware on the emulator, so the    */
+/* block only runs its body once.                                       */
+/************************************************************************/
+#define ATOMIC_RESTORESTATE
+#define ATOMIC_FORCEON
+#define ATOMIC_BLOCK(type) for (uint8_t atomic_once = 1; atomic_once; atomic_once = 0)
+
+#endif /* _HOST_UTIL_ATOMIC_H_ */
@@ -0,0 +1,598 @@
+/************************************************************************/
+/* Static worst-case ISR cycles and stack analysis                      */
+/*                                                                      */
+/* Host tool that disassembles the firmware with avr-objdump, walks the */
+/* call graph from every interrupt vector and reports, for each one,    */
+/* the worst-case cycles from the interrupt request to the reti and the */
+/* stack it takes. It fails when one of the budgets is exceeded.        */
+/*                                                                      */
+/* Build: gcc -O2 -std=gnu99 -o isr_analysis isr_analysis.c             */
+/*                                                                      */
+/* Usage: isr_analysis [-b budget.txt] [-L loop_bound] [-r ret_bytes]   */
+/*            [-x avr-objdump] [-f cycles.txt] [-l] firmware.elf        */
+/*                                                                      */
+/* With -l, the input is a listing already made by avr-objdump -d. The  */
+/* Atmel Studio project runs it after the build when the IsrAnalysis    */
+/* property is true, with isr_budget.txt from this folder. -f writes    */
+/* the cycles of every function without the functions it calls, for     */
+/* latency_harness to charge the handlers the functions they run.       */
+/*                                                                      */
+/* The cycles are the longest path through each function, with the      */
+/* XMEGA worst case of each instruction. The body of a loop, found by   */
+/* its backward branch, counts loop_bound times (default 8). A function */
+/* reached by an indirect call can't be known, so the ISRs with one     */
+/* are flagged and their results are a lower bound. The nesting of      */
+/* interrupts of different levels is not taken into account.            */
+/************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Interrupt response and jmp on the vector table */
+#define ISR_ENTRY_CYCLES (5 + 3)
+
+#define F_INDIRECT  (1<<0)
+#define F_LOOP      (1<<1)
+#define F_RECURSIVE (1<<2)
+
+typedef struct
+{
+	uint32_t addr;
+	char mnemonic[8];
+	uint32_t target;            // Branch, jump or call destination
+	uint8_t has_target;
+	int32_t immediate;          // Last numeric operand, for the frame size
+	char operands[32];
+} insn_t;
+
+typedef struct
+{
+	char name[128];
+	uint32_t start;             // Index of the first instruction
+	uint32_t end;               // Index after the last instruction
+	uint8_t state;              // 0 not done, 1 on the way, 2 done
+	uint8_t flags;
+	uint64_t cycles;
+	uint64_t own_cycles;        // Without the called functions
+	uint32_t stack;
+} func_t;
+
+static insn_t *insns;
+static uint32_t n_insns, max_insns;
+static func_t *funcs;
+static uint32_t n_funcs, max_funcs;
+
+static uint32_t loop_bound = 8;
+static uint32_t ret_bytes = 2;  // 16 bits PC up to 128 KB of flash
+
+/************************************************************************/
+/* Instruction timing                                                   */
+/*                                                                      */
+/* Worst case of the XMEGA column of the AVR instruction set manual,    */
+/* with taken branches and skips over a two words instruction.          */
+/************************************************************************/
+typedef struct
+{
+	const char *mnemonic;
+	uint8_t cycles;
+} timing_t;
+
+static const timing_t timings[] = {
+	{"adiw", 2}, {"sbiw", 2}, {"mul", 2}, {"muls", 2}, {"mulsu", 2},
+	{"fmul", 2}, {"fmuls", 2}, {"fmulsu", 2},
+	{"rjmp", 2}, {"ijmp", 2}, {"eijmp", 2}, {"jmp", 3},
+	{"rcall", 2}, {"icall", 2}, {"eicall", 3}, {"call", 3},
+	{"ret", 4}, {"reti", 4},
+	{"cpse", 3}, {"sbrc", 3}, {"sbrs", 3}, {"sbic", 4}, {"sbis", 4},
+	{"ld", 3}, {"ldd", 3}, {"lds", 3}, {"st", 2}, {"std", 2}, {"sts", 2},
+	{"lpm", 3}, {"elpm", 3}, {"spm", 4},
+	{"pop", 2}, {"xch", 2}, {"las", 2}, {"lac", 2}, {"lat", 2},
+	{NULL, 0}
+};
+
+static uint8_t insn_cycles(const insn_t *in)
+{
+	if (in->mnemonic[0] == 'b' && in->mnemonic[1] == 'r' && strcmp(in->mnemonic, "break"))
+		return 2;
+
+	for (const timing_t *t = timings; t->mnemonic; t++)
+		if (!strcmp(t->mnemonic, in->mnemonic))
+			return t->cycles;
+
+	return 1;
+}
+
+static int is_mnemonic(const insn_t *in, const char *m)
+{
+	return !strcmp(in->mnemonic, m);
+}
+
+static int is_branch(const insn_t *in)
+{
+	return in->mnemonic[0] == 'b' && in->mnemonic[1] == 'r' && !is_mnemonic(in, "break");
+}
+
+static int is_skip(const insn_t *in)
+{
+	return is_mnemonic(in, "cpse") || is_mnemonic(in, "sbrc") || is_mnemonic(in, "sbrs") ||
+		is_mnemonic(in, "sbic") || is_mnemonic(in, "sbis");
+}
+
+static int is_call(const insn_t *in)
+{
+	return is_mnemonic(in, "call") || is_mnemonic(in, "rcall");
+}
+
+static int is_jump(const insn_t *in)
+{
+	return is_mnemonic(in, "jmp") || is_mnemonic(in, "rjmp");
+}
+
+static int is_end(const insn_t *in)
+{
+	return is_mnemonic(in, "ret") || is_mnemonic(in, "reti") || is_mnemonic(in, "ijmp") || is_mnemonic(in, "eijmp");
+}
+
+/************************************************************************/
+/* Listing parser                                                       */
+/*                                                                      */
+/* 00000228 <__vector_16>:                                              */
+/*     23a:   0e 94 12 34   call  0x6824  ; 0x6824 <hwbp_app_...>       */
+/*     240:   f1 f7         brne  .-4     ; 0x23e <__vector_16+0x16>    */
+/************************************************************************/
+static void add_func(const char *name, uint32_t start)
+{
+	if (n_funcs == max_funcs)
+	{
+		max_funcs = max_funcs ? max_funcs * 2 : 256;
+		funcs = realloc(funcs, sizeof(func_t) * max_funcs);
+	}
+
+	if (n_funcs)
+		funcs[n_funcs - 1].end = start;
+
+	memset(&funcs[n_funcs], 0, sizeof(func_t));
+	snprintf(funcs[n_funcs].name, sizeof(funcs[n_funcs].name), "%s", name);
+	funcs[n_funcs].start = start;
+	funcs[n_funcs].end = start;
+	n_funcs++;
+}
+
+static void parse_insn(char *line)
+{
+	insn_t in;
+	char *p, *fields[4];
+	int n_fields = 0;
+
+	memset(&in, 0, sizeof(in));
+	in.addr = strtoul(line, &p, 16);
+
+	if (*p != ':')
+		return;
+
+	/* Address, bytes, mnemonic and operands are separated by tabs */
+	for (char *tok = strtok(p + 1, "\t"); tok && n_fields < 4; tok = strtok(NULL, "\t"))
+		fields[n_fields++] = tok;
+
+	if (n_fields < 2)
+		return;
+
+	sscanf(fields[1], "%7s", in.mnemonic);
+
+	if (in.mnemonic[0] == '.')
+		return;
+
+	if (n_fields > 2)
+	{
+		snprintf(in.operands, sizeof(in.operands), "%s", fields[2]);
+
+		/* The comment has the destination of the relative branches */
+		char *comment = (n_fields > 3) ? strstr(fields[3], "0x") : NULL;
+		char *last = strrchr(fields[2], ',');
+		char *operand = last ? last + 1 : fields[2];
+
+		if (comment || (comment = strstr(fields[2], "0x")) != NULL)
+		{
+			in.target = strtoul(comment, NULL, 16);
+			in.has_target = 1;
+		}
+
+		while (*operand == ' ')
+			operand++;
+		in.immediate = strtol(operand, NULL, 0);
+	}
+
+	if (!(is_branch(&in) || is_call(&in) || is_jump(&in)))
+		in.has_target = 0;
+
+	if (n_insns == max_insns)
+	{
+		max_insns = max_insns ? max_insns * 2 : 4096;
+		insns = realloc(insns, sizeof(insn_t) * max_insns);
+	}
+
+	insns[n_insns++] = in;
+	funcs[n_funcs - 1].end = n_insns;
+}
+
+static void parse_listing(FILE *f)
+{
+	char line[512], name[128];
+	uint32_t addr;
+
+	while (fgets(line, sizeof(line), f))
+	{
+		line[strcspn(line, "\r\n")] = 0;
+
+		if (sscanf(line, "%x <%127[^>]>:", &addr, name) == 2)
+			add_func(name, n_insns);
+		else if (n_funcs && line[0] == ' ')
+			parse_insn(line);
+	}
+}
+
+/************************************************************************/
+/* Call graph                                                           */
+/************************************************************************/
+static func_t *func_at(uint32_t addr)
+{
+	for (uint32_t i = 0; i < n_funcs; i++)
+		if (funcs[i].start < funcs[i].end && insns[funcs[i].start].addr == addr)
+			return &funcs[i];
+
+	return NULL;
+}
+
+static int32_t insn_at(const func_t *fn, uint32_t addr)
+{
+	for (uint32_t i = fn->start; i < fn->end; i++)
+		if (insns[i].addr == addr)
+			return i;
+
+	return -1;
+}
+
+static void analyse(func_t *fn);
+
+/* Cycles and stack of a call or a jump out of the function */
+static uint64_t callee_cost(func_t *fn, const insn_t *in, uint32_t *stack)
+{
+	func_t *callee = func_at(in->target);
+
+	*stack = 0;
+
+	if (!callee)
+	{
+		fn->flags |= F_INDIRECT;
+		return 0;
+	}
+
+	analyse(callee);
+	fn->flags |= callee->flags;
+	*stack = callee->stack + (is_call(in) ? ret_bytes : 0);
+
+	return callee->cycles;
+}
+
+static void analyse(func_t *fn)
+{
+	if (fn->state == 2)
+		return;
+
+	if (fn->state == 1)
+	{
+		fn->flags |= F_RECURSIVE;
+		return;
+	}
+
+	fn->state = 1;
+
+	uint32_t n = fn->end - fn->start;
+	uint64_t *weight = malloc(sizeof(uint64_t) * (n + 1));
+	uint64_t *cost = calloc(n + 2, sizeof(uint64_t));
+	uint64_t *own = calloc(n + 2, sizeof(uint64_t));
+	uint32_t frame = 0, stack = 0;
+
+	/* Loop bodies, from the target of a backward branch to the branch */
+	for (uint32_t i = 0; i < n; i++)
+		weight[i] = 1;
+
+	for (uint32_t i = 0; i < n; i++)
+	{
+		insn_t *in = &insns[fn->start + i];
+		int32_t head;
+
+		if (!in->has_target || is_call(in) || in->target > in->addr)
+			continue;
+
+		if ((head = insn_at(fn, in->target)) < 0)
+			continue;
+
+		fn->flags |= F_LOOP;
+
+		for (uint32_t j = head - fn->start; j <= i; j++)
+			weight[j] *= loop_bound;
+	}
+
+	/* Frame: pushes, rcall .+0 and the SP adjustment on the prologue */
+	for (uint32_t i = 0; i < n; i++)
+	{
+		insn_t *in = &insns[fn->start + i];
+
+		if (is_mnemonic(in, "push"))
+			frame += 1;
+		else if (is_mnemonic(in, "rcall") && strstr(in->operands, ".+0"))
+			frame += ret_bytes;
+		else if (i > 0 && is_mnemonic(&insns[fn->start + i - 1], "in") && strstr(insns[fn->start + i - 1].operands, "0x3d"))
+		{
+			if (is_mnemonic(in, "sbiw"))
+				frame += in->immediate;
+			else if (is_mnemonic(in, "subi"))
+				frame += (uint8_t)in->immediate + ((i + 1 < n && is_mnemonic(&insns[fn->start + i + 1], "sbci")) ? (uint8_t)insns[fn->start + i + 1].immediate * 256 : 0);
+		}
+	}
+
+	/* Longest path, from the last instruction up */
+	for (int32_t i = n - 1; i >= 0; i--)
+	{
+		insn_t *in = &insns[fn->start + i];
+		uint64_t c = insn_cycles(in);
+		uint64_t own_c = c;
+		uint64_t next = cost[i + 1];
+		uint64_t own_next = own[i + 1];
+		uint32_t callee_stack = 0;
+
+		if (is_mnemonic(in, "icall") || is_mnemonic(in, "eicall") || is_mnemonic(in, "ijmp") || is_mnemonic(in, "eijmp"))
+			fn->flags |= F_INDIRECT;
+
+		if (is_end(in))
+		{
+			next = 0;
+			own_next = 0;
+		}
+		else if (is_call(in) && !strstr(in->operands, ".+0"))
+		{
+			c += callee_cost(fn, in, &callee_stack);
+		}
+		else if (in->has_target)
+		{
+			int32_t target = insn_at(fn, in->target);
+			uint64_t taken, own_taken;
+
+			if (target < 0)
+			{
+				/* A jump to another function is a tail call */
+				taken = callee_cost(fn, in, &callee_stack);
+				own_taken = 0;
+			}
+			else
+			{
+				/* The backward branches were counted by the loop weights */
+				taken = (in->target > in->addr) ? cost[target - fn->start] : 0;
+				own_taken = (in->target > in->addr) ? own[target - fn->start] : 0;
+			}
+
+			if (is_jump(in))
+			{
+				next = taken;
+				own_next = own_taken;
+			}
+			else
+			{
+				if (taken > next)
+					next = taken;
+				if (own_taken > own_next)
+					own_next = own_taken;
+			}
+		}
+		else if (is_skip(in))
+		{
+			if (cost[i + 2] > next)
+				next = cost[i + 2];
+			if (own[i + 2] > own_next)
+				own_next = own[i + 2];
+		}
+
+		if (callee_stack > stack)
+			stack = callee_stack;
+
+		cost[i] = c * weight[i] + next;
+		own[i] = own_c * weight[i] + own_next;
+	}
+
+	fn->cycles = n ? cost[0] : 0;
+	fn->own_cycles = n ? own[0] : 0;
+	fn->stack = frame + stack;
+	fn->state = 2;
+
+	free(weight);
+	free(cost);
+	free(own);
+}
+
+/************************************************************************/
+/* Budgets                                                              */
+/************************************************************************/
+typedef struct
+{
+	char name[64];
+	uint64_t cycles;
+	uint32_t stack;
+	uint8_t found;
+} budget_t;
+
+static budget_t *budgets;
+static uint32_t n_budgets;
+
+static int read_budgets(const char *path)
+{
+	FILE *f = fopen(path, "r");
+	char line[256];
+
+	if (!f)
+	{
+		perror(path);
+		return 0;
+	}
+
+	while (fgets(line, sizeof(line), f))
+	{
+		budget_t b;
+		unsigned long long cycles;
+
+		memset(&b, 0, sizeof(b));
+
+		if (line[0] == '#' || sscanf(line, "%63s %llu %u", b.name, &cycles, &b.stack) != 3)
+			continue;
+
+		b.cycles = cycles;
+		budgets = realloc(budgets, sizeof(budget_t) * (n_budgets + 1));
+		budgets[n_budgets++] = b;
+	}
+
+	fclose(f);
+	return 1;
+}
+
+static budget_t *find_budget(const char *name)
+{
+	for (uint32_t i = 0; i < n_budgets; i++)
+		if (!strcmp(budgets[i].name, name))
+			return &budgets[i];
+
+	return NULL;
+}
+
+/************************************************************************/
+/* Cycles of the functions                                              */
+/*                                                                      */
+/* One line per function, its name and its worst-case cycles without    */
+/* the ones of the functions it calls, which are on their own lines.    */
+/************************************************************************/
+static int write_own_cycles(const char *path)
+{
+	FILE *f = fopen(path, "w");
+
+	if (!f)
+	{
+		perror(path);
+		return 0;
+	}
+
+	fprintf(f, "# Worst-case cycles of each function without its calls, by isr_analysis\n");
+	fprintf(f, "# loop bound %u\n", loop_bound);
+
+	for (uint32_t i = 0; i < n_funcs; i++)
+	{
+		func_t *fn = &funcs[i];
+
+		if (fn->start == fn->end)
+			continue;
+
+		analyse(fn);
+		fprintf(f, "%-47s %llu\n", fn->name, (unsigned long long)fn->own_cycles);
+	}
+
+	return fclose(f) == 0;
+}
+
+int main(int argc, char *argv[])
+{
+	const char *budget_path = NULL;
+	const char *cycles_path = NULL;
+	const char *objdump = "avr-objdump";
+	int is_listing = 0;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "b:L:r:x:f:lh")) != -1)
+	{
+		switch (opt)
+		{
+			case 'b': budget_path = optarg; break;
+			case 'L': loop_bound = strtoul(optarg, NULL, 0); break;
+			case 'r': ret_bytes = strtoul(optarg, NULL, 0); break;
+			case 'x': objdump = optarg; break;
+			case 'f': cycles_path = optarg; break;
+			case 'l': is_listing = 1; break;
+			default:
+				fprintf(stderr, "usage: %s [-b budget.txt] [-L loop_bound] [-r ret_bytes] [-x avr-objdump] [-f cycles.txt] [-l] firmware.elf\n", argv[0]);
+				return opt == 'h' ? 0 : 1;
+		}
+	}
+
+	if (optind >= argc || (budget_path && !read_budgets(budget_path)))
+		return 1;
+
+	FILE *f;
+
+	if (is_listing)
+	{
+		f = fopen(argv[optind], "r");
+	}
+	else
+	{
+		char cmd[1024];
+		snprintf(cmd, sizeof(cmd), "\"%s\" -d \"%s\"", objdump, argv[optind]);
+		f = popen(cmd, "r");
+	}
+
+	if (!f)
+	{
+		perror(argv[optind]);
+		return 1;
+	}
+
+	parse_listing(f);
+
+	if (is_listing ? fclose(f) : pclose(f))
+	{
+		fprintf(stderr, "could not disassemble %s\n", argv[optind]);
+		return 1;
+	}
+
+	int failed = 0;
+
+	printf("%-16s %10s %10s %7s %7s  %s\n", "vector", "cycles", "budget", "stack", "budget", "notes");
+
+	for (uint32_t i = 0; i < n_funcs; i++)
+	{
+		func_t *fn = &funcs[i];
+		budget_t *b;
+
+		if (strncmp(fn->name, "__vector_", 9) || fn->start == fn->end)
+			continue;
+
+		analyse(fn);
+
+		uint64_t cycles = fn->cycles + ISR_ENTRY_CYCLES;
+		uint32_t stack = fn->stack + ret_bytes;
+		int over = 0;
+
+		if ((b = find_budget(fn->name)) != NULL)
+		{
+			b->found = 1;
+			over = cycles > b->cycles || stack > b->stack || (fn->flags & F_RECURSIVE);
+			failed |= over;
+		}
+
+		printf("%-16s %10llu ", fn->name, (unsigned long long)cycles);
+		b ? printf("%10llu ", (unsigned long long)b->cycles) : printf("%10s ", "-");
+		printf("%7u ", stack);
+		b ? printf("%7u ", b->stack) : printf("%7s ", "-");
+		printf(" %s%s%s%s\n", over ? "OVER BUDGET " : "",
+			(fn->flags & F_LOOP) ? "loop " : "",
+			(fn->flags & F_INDIRECT) ? "indirect (lower bound) " : "",
+			(fn->flags & F_RECURSIVE) ? "recursive " : "");
+	}
+
+	for (uint32_t i = 0; i < n_budgets; i++)
+		if (!budgets[i].found)
+			fprintf(stderr, "warning: %s has a budget but is not on the firmware\n", budgets[i].name);
+
+	if (cycles_path && !write_own_cycles(cycles_path))
+		return 1;
+
+	return failed;
+}
@@ -0,0 +1,723 @@
+/************************************************************************/
+/* Trigger latency, skew and jitter harness                             */
+/*                                                                      */
+/* Host tool that runs the firmware on the host model shared with the   */
+/* emulator and the tests, since simavr has no model of the XMEGA A1U,  */
+/* and measures, for every trigger mode, the cycles from the trigger's  */
+/* edge to the edges of PWM_OUTx and SYNC_OUTx it makes. Each mode gets */
+/* many edges at random times, so they fall on every phase of the core  */
+/* tick and of the other interrupts. The latency, the skew between the  */
+/* channels started by the same edge and the jitter, the spread of the  */
+/* latency, are reported in cycles at 32 MHz (31.25 ns).                */
+/*                                                                      */
+/* The model takes an interrupt isr_entry cycles after its request,     */
+/* plus a random wait of up to -j cycles for the instruction the CPU is */
+/* on, and serializes the pending ones by vector number. The entry is   */
+/* what the profiling registers PROF_LATENCY_MIN, PROF_LATENCY_HIST and */
+/* PROF_SKEW_MAX miss, as they start counting in the handler.           */
+/*                                                                      */
+/* The firmware only takes time with -c, the cycles of each function    */
+/* written by isr_analysis -f from the build's listing. Each handler is */
+/* then charged the functions it ran on its path, with the worst case   */
+/* of each, and its writes to the timers and the ports are done at the  */
+/* end of them. So the results are an upper bound of the firmware's     */
+/* latency, by the cycles it runs after its last write. Without -c, the */
+/* handlers take no time and the results are only the interrupt's       */
+/* entry and its spread, which no change of the firmware moves. With    */
+/* -b, each handler keeps the CPU for at least its budget, to see the   */
+/* worst case of an edge waiting for another interrupt.                 */
+/*                                                                      */
+/* Build: gcc -O2 -std=gnu99 -fsingle-precision-constant -Ihost         */
+/*            -finstrument-functions -o latency_harness                 */
+/*            latency_harness.c -lm                                     */
+/*        from this folder, since it includes the firmware's sources.   */
+/*                                                                      */
+/* Usage: latency_harness [-n edges] [-e entry] [-j spread]             */
+/*            [-c cycles.txt] [-b budget.txt] [-m mode] [-r seed]       */
+/*            [-w trace.vcd] [-v]                                       */
+/*                                                                      */
+/* -n is the number of edges of each mode (default 1000), -e the cycles */
+/* of the interrupt's entry (default 8, the response and the jmp of the */
+/* vector table) and -j the longest wait for the instruction the CPU is */
+/* on (default 4). -m only runs the modes whose name has the given      */
+/* text, and -r seeds the random times (default 1), so the results can  */
+/* be compared between versions of the firmware. -w writes the outputs  */
+/* and the trigger inputs to a VCD file. The ENABLE modes of TRIG_ALL   */
+/* only change CH_ENABLE, so they have no edge to measure.              */
+/************************************************************************/
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+
+#include "host/multipwm_model.c"
+
+#define US(us) ((uint64_t)(us) * (F_CPU / 1000000))
+
+/* reti of a 22 bits PC and the instruction run before the next interrupt */
+#define RETI_CYCLES (5 + 1)
+
+/* Longest wait for an output, and longest random time between edges */
+#define WINDOW US(2000)
+#define PHASE US(1000)
+
+#define NONE 0xFF
+
+/************************************************************************/
+/* Harp commands                                                        */
+/************************************************************************/
+static void sample(void);
+
+static int write_reg(uint8_t add, uint8_t type, const void *values, uint8_t n_elements)
+{
+	uint8_t frame[MAX_PACKET_SIZE];
+	uint8_t length = n_elements * (type & MSK_TYPE_LEN);
+	uint8_t sum = 0;
+
+	frame[0] = HARP_WRITE;
+	frame[1] = length + 4;
+	frame[2] = add;
+	frame[3] = HARP_PORT_DEVICE;
+	frame[4] = type;
+	memcpy(frame + 5, values, length);
+
+	for (uint8_t i = 0; i < length + 5; i++)
+		sum += frame[i];
+	frame[length + 5] = sum;
+
+	out_length = 0;
+	harp_process(frame, length + 6);
+	sample();
+
+	return out_length && out_buffer[0] == HARP_WRITE;
+}
+
+/* A mode that can't be set up has nothing to measure */
+static void set_reg(uint8_t add, uint8_t type, const void *values, uint8_t n_elements)
+{
+	if (!write_reg(add, type, values, n_elements))
+	{
+		fprintf(stderr, "write of register %u refused\n", add);
+		exit(1);
+	}
+}
+
+static void set_u8(uint8_t add, uint8_t value) {set_reg(add, TYPE_U8, &value, 1);}
+static void set_u32(uint8_t add, uint32_t value) {set_reg(add, TYPE_U32, &value, 1);}
+static void set_float(uint8_t add, float value) {set_reg(add, TYPE_FLOAT, &value, 1);}
+
+/************************************************************************/
+/* Signals                                                              */
+/*                                                                      */
+/* The model runs event by event and the signals are looked at after    */
+/* each one, so every edge is seen at its time. An armed signal keeps   */
+/* the time of its first edge to the expected level.                    */
+/************************************************************************/
+enum {
+	SIG_PWM_OUT0, SIG_PWM_OUT1, SIG_PWM_OUT2, SIG_PWM_OUT3,
+	SIG_SYNC_OUT0, SIG_SYNC_OUT1, SIG_SYNC_OUT2, SIG_SYNC_OUT3, SIG_SYNC_OUTALL,
+	SIG_TRIG_IN0, SIG_TRIG_IN1, SIG_TRIG_IN2, SIG_TRIG_IN3, SIG_TRIG_ALL,
+	N_SIGNALS
+};
+
+static const char *signal_names[N_SIGNALS] = {
+	"PWM_OUT0", "PWM_OUT1", "PWM_OUT2", "PWM_OUT3",
+	"SYNC_OUT0", "SYNC_OUT1", "SYNC_OUT2", "SYNC_OUT3", "SYNC_OUTALL",
+	"TRIG_IN0", "TRIG_IN1", "TRIG_IN2", "TRIG_IN3", "TRIG_ALL"
+};
+
+#define PWM_OUTS(channels) ((uint16_t)(channels) << SIG_PWM_OUT0)
+#define SYNC_OUTS(channels) ((uint16_t)(channels) << SIG_SYNC_OUT0)
+
+static uint8_t levels[N_SIGNALS];
+static uint8_t expect[N_SIGNALS];
+static uint64_t seen[N_SIGNALS];
+
+static FILE *vcd = NULL;
+static uint64_t vcd_time = NEVER;
+
+static uint8_t signal_level(uint8_t s)
+{
+	if (s <= SIG_PWM_OUT3)
+		return tc0_output(&tc0s[s - SIG_PWM_OUT0]);
+
+	if (s <= SIG_SYNC_OUT3)
+		return (tc0s[s - SIG_SYNC_OUT0].port->OUT & (1<<1)) ? 1 : 0;
+
+	if (s == SIG_SYNC_OUTALL)
+		return (PORTC.OUT & (1<<2)) ? 1 : 0;
+
+	return trigs[s - SIG_TRIG_IN0].level;
+}
+
+static void vcd_open(const char *path)
+{
+	if ((vcd = fopen(path, "w")) == NULL)
+	{
+		perror(path);
+		exit(1);
+	}
+
+	fprintf(vcd, "$version MultiPwm latency_harness $end\n$timescale 1 ps $end\n$scope module multipwm $end\n");
+	for (uint8_t s = 0; s < N_SIGNALS; s++)
+		fprintf(vcd, "$var wire 1 %c %s $end\n", '!' + s, signal_names[s]);
+	fprintf(vcd, "$upscope $end\n$enddefinitions $end\n#0\n$dumpvars\n");
+	for (uint8_t s = 0; s < N_SIGNALS; s++)
+		fprintf(vcd, "%u%c\n", levels[s], '!' + s);
+	fprintf(vcd, "$end\n");
+
+	vcd_time = 0;
+}
+
+static void sample(void)
+{
+	for (uint8_t s = 0; s < N_SIGNALS; s++)
+	{
+		uint8_t level = signal_level(s);
+
+		if (level == levels[s])
+			continue;
+
+		levels[s] = level;
+
+		if (vcd)
+		{
+			if (vcd_time != now)
+				fprintf(vcd, "#%llu\n", (unsigned long long)(now * (1000000000000ULL / F_CPU)));
+			fprintf(vcd, "%u%c\n", level, '!' + s);
+			vcd_time = now;
+		}
+
+		if (expect[s] == level && seen[s] == NEVER)
+			seen[s] = now;
+	}
+}
+
+static void arm(uint16_t signals, uint8_t level)
+{
+	for (uint8_t s = 0; s < N_SIGNALS; s++)
+	{
+		expect[s] = (signals & (1 << s)) ? level : NONE;
+		seen[s] = NEVER;
+	}
+}
+
+/* Signals at the level given */
+static uint16_t signals_at(uint16_t signals, uint8_t level)
+{
+	uint16_t at = 0;
+
+	for (uint8_t s = 0; s < N_SIGNALS; s++)
+		if ((signals & (1 << s)) && levels[s] == level)
+			at |= (1 << s);
+
+	return at;
+}
+
+static void run_for(uint64_t cycles)
+{
+	uint64_t end = now + cycles;
+
+	while (1)
+	{
+		uint64_t t = next_event_time();
+
+		run_until(t < end ? t : end);
+		sample();
+
+		/* The events sent aren't read */
+		out_length = 0;
+
+		if (t >= end)
+			break;
+	}
+}
+
+static void drive(uint8_t input, uint8_t level)
+{
+	trig_set(&trigs[input], level);
+	sample();
+}
+
+/************************************************************************/
+/* Statistics                                                           */
+/************************************************************************/
+typedef struct
+{
+	unsigned n;
+	unsigned missed;
+	uint64_t min, max;
+	double sum, sum2;
+} stats_t;
+
+/* Of one edge of a mode */
+typedef struct
+{
+	stats_t pwm;
+	stats_t sync;
+	stats_t sync_all;
+	stats_t skew;
+} edge_stats_t;
+
+static void stats_add(stats_t *st, uint64_t x)
+{
+	if (st->n == 0 || x < st->min)
+		st->min = x;
+	if (st->n == 0 || x > st->max)
+		st->max = x;
+
+	st->n++;
+	st->sum += x;
+	st->sum2 += (double)x * x;
+}
+
+static void stats_print(const char *label, const stats_t *st)
+{
+	if (st->n == 0 && st->missed == 0)
+		return;
+
+	printf("  %-30s %6u %6u", label, st->n, st->missed);
+
+	if (st->n)
+	{
+		double mean = st->sum / st->n;
+		double var = st->sum2 / st->n - mean * mean;
+
+		printf(" %7lu %9.1f %7lu %7lu %7.2f", (unsigned long)st->min, mean, (unsigned long)st->max, (unsigned long)(st->max - st->min), sqrt(var > 0 ? var : 0));
+	}
+
+	printf("\n");
+}
+
+/* Adds the times from t0 of the armed outputs and disarms them */
+static void collect(edge_stats_t *e, uint64_t t0)
+{
+	uint64_t first = NEVER, last = 0;
+	uint8_t n_pwm = 0;
+
+	for (uint8_t s = 0; s <= SIG_SYNC_OUTALL; s++)
+	{
+		if (expect[s] == NONE)
+			continue;
+
+		stats_t *st = (s <= SIG_PWM_OUT3) ? &e->pwm : (s <= SIG_SYNC_OUT3) ? &e->sync : &e->sync_all;
+
+		expect[s] = NONE;
+
+		if (seen[s] == NEVER || t0 == NEVER)
+		{
+			st->missed++;
+			continue;
+		}
+
+		stats_add(st, seen[s] - t0);
+
+		if (s <= SIG_PWM_OUT3)
+		{
+			n_pwm++;
+			if (seen[s] < first)
+				first = seen[s];
+			if (seen[s] > last)
+				last = seen[s];
+		}
+	}
+
+	if (n_pwm >= 2)
+		stats_add(&e->skew, last - first);
+}
+
+static void edge_print(const char *edge, const edge_stats_t *e)
+{
+	char label[64];
+
+	snprintf(label, sizeof(label), "%s to PWM_OUTx", edge);
+	stats_print(label, &e->pwm);
+	snprintf(label, sizeof(label), "%s to SYNC_OUTx", edge);
+	stats_print(label, &e->sync);
+	snprintf(label, sizeof(label), "%s to SYNC_OUTALL", edge);
+	stats_print(label, &e->sync_all);
+	snprintf(label, sizeof(label), "%s, skew of PWM_OUTx", edge);
+	stats_print(label, &e->skew);
+}
+
+/************************************************************************/
+/* Trigger modes                                                        */
+/*                                                                      */
+/* The channels run at 100 Hz, so no edge of their own falls in the     */
+/* time an edge of the trigger is waited for. The active edge starts    */
+/* the channels, or opens the gate, and when the mode also acts on the  */
+/* inactive edge, it is given at a random time later. The channels are  */
+/* stopped before the next active edge. The chained channels are timed  */
+/* from the end of channel 0's pulse.                                   */
+/************************************************************************/
+enum {KIND_INPUT, KIND_ALL, KIND_VIRTUAL, KIND_CHAIN, KIND_LOADED};
+
+typedef struct
+{
+	char name[64];
+	uint8_t kind;
+	uint8_t input;                            // TRIG_INx, or 4 for TRIG_ALL
+	uint8_t mode;                             // Of the trigger, TRIG_ALL or the virtual trigger
+	uint8_t channels;                         // Measured
+	uint8_t stop;                             // STOP_PWM bits that stop them
+} trigger_mode_t;
+
+static unsigned n_edges = 1000;
+static const char *only = NULL;
+
+static void reset_device(void)
+{
+	/* The model keeps the firmware's variables on a reset, so the channels are stopped first */
+	for (uint8_t i = 0; i < 5; i++)
+	{
+		trigs[i].pulse_end = trigs[i].wave_next = NEVER;
+		trig_set(&trigs[i], 0);
+	}
+
+	run_until(now);
+
+	firmware_enter();
+	for (uint8_t j = 0; j < 4; j++)
+		hwbp_app_pwm_gen_stop(j);
+	hwbp_app_pwm_gen_clear_trains(B_TRGCH0 | B_TRGCH1 | B_TRGCH2 | B_TRGCH3);
+	firmware_leave();
+
+	write_reg(ADD_R_RESET_DEV, TYPE_U8, &(uint8_t){B_RST_DEF}, 1);
+	write_reg(ADD_R_OPERATION_CTRL, TYPE_U8, &(uint8_t){GM_OP_MODE_ACTIVE}, 1);
+	run_for(US(1000));
+}
+
+static void configure(uint8_t ch, float freq, uint32_t counts, uint8_t mode)
+{
+	set_float(ADD_REG_CH0_FREQ + ch, freq);
+	set_float(ADD_REG_CH0_DUTYCYCLE + ch, 50);
+	set_u32(ADD_REG_CH0_COUNTS + ch, counts);
+	set_u8(ADD_REG_CH0_MODE + ch, mode);
+}
+
+/* STOP_PWM and START_PWM act on the triggers' masks, so the modes that don't drive TRIG_IN0 and TRIG_IN1 start and stop through theirs */
+static void setup(trigger_mode_t *m)
+{
+	reset_device();
+
+	for (uint8_t j = 0; j < 4; j++)
+	{
+		configure(j, 100, 1, GM_CH_MODE_INFINITE);
+		set_u8(ADD_REG_TRG0_MASK + j, 0);
+	}
+
+	switch (m->kind)
+	{
+		case KIND_INPUT:
+		case KIND_LOADED:
+			set_u8(ADD_REG_TRG0_MASK + m->input, m->channels);
+			set_u8(ADD_REG_TRG0_MODE + m->input, m->mode);
+			m->stop = B_STOP_TRG0 << m->input;
+			break;
+
+		case KIND_ALL:
+			set_u8(ADD_REG_TRGALL_MODE, m->mode);
+			break;
+
+		case KIND_VIRTUAL:
+		{
+			/* Active with TRIG_IN2 and TRIG_IN3 high, TRIG_IN2 is held high */
+			uint32_t table[2] = {1UL << (B_LTRG2 | B_LTRG3), 0};
+			uint8_t mask[2] = {m->channels, 0};
+			uint8_t mode[2] = {m->mode, GM_TRG_MODE_START};
+
+			set_reg(ADD_REG_VTRG_TABLE, TYPE_U32, table, 2);
+			set_reg(ADD_REG_VTRG_MASK, TYPE_U8, mask, 2);
+			set_reg(ADD_REG_VTRG_MODE, TYPE_U8, mode, 2);
+			drive(2, 1);
+			break;
+		}
+
+		case KIND_CHAIN:
+		{
+			/* One pulse of 500 us on channel 0, chained to the others */
+			uint8_t chain[4] = {m->channels, 0, 0, 0};
+
+			configure(0, 1000, 1, GM_CH_MODE_COUNT);
+			set_reg(ADD_REG_CH_CHAIN, TYPE_U8, chain, 4);
+			set_u8(ADD_REG_TRG0_MASK, B_TRGCH0);
+			break;
+		}
+	}
+
+	if (m->kind == KIND_ALL || m->kind == KIND_VIRTUAL || m->kind == KIND_CHAIN)
+	{
+		set_u8(ADD_REG_TRG1_MASK, m->channels);
+		m->stop = B_STOP_TRG1;
+	}
+
+	/* The other channels keep their CCA interrupts coming */
+	if (m->kind == KIND_LOADED)
+	{
+		uint8_t others = ~m->channels & (B_TRGCH0 | B_TRGCH1 | B_TRGCH2 | B_TRGCH3);
+
+		for (uint8_t j = 0; j < 4; j++)
+			if (others & (B_TRGCH0 << j))
+				configure(j, 1000, 1, GM_CH_MODE_INFINITE);
+
+		set_u8(ADD_REG_TRG0_MASK, others);
+		set_u8(ADD_REG_START_PWM, B_START_TRG0);
+	}
+}
+
+static uint8_t active_level(const trigger_mode_t *m)
+{
+	if (m->kind == KIND_ALL)
+		return (m->mode & B_NEG) ? 0 : 1;
+
+	if (m->kind == KIND_VIRTUAL)
+		return 1;
+
+	return (m->mode & B_NTRG) ? 0 : 1;
+}
+
+/* Signals of the inactive edge, none if the mode doesn't act on it */
+static uint16_t release_signals(const trigger_mode_t *m)
+{
+	uint16_t outputs = PWM_OUTS(m->channels);
+
+	if (m->kind == KIND_ALL)
+		return ((m->mode & MSK_ALL_MODE) == GM_ALL_MODE_TRIG_ALL_AND_STOP) ? outputs | SYNC_OUTS(m->channels) | (1 << SIG_SYNC_OUTALL) : 0;
+
+	if (m->kind == KIND_CHAIN)
+		return 0;
+
+	/* The gate freezes the channels without stopping them */
+	if ((m->mode & MSK_TRG_MODE) == GM_TRG_MODE_GATE)
+		return outputs;
+
+	return ((m->mode & MSK_TRG_MODE) == GM_TRG_MODE_START_AND_STOP) ? outputs | SYNC_OUTS(m->channels) : 0;
+}
+
+static void run_mode(trigger_mode_t *m)
+{
+	edge_stats_t active = {0}, inactive = {0};
+	uint8_t input = (m->kind == KIND_VIRTUAL) ? 3 : m->input;
+	uint8_t level = active_level(m);
+	uint16_t starts = PWM_OUTS(m->channels) | SYNC_OUTS(m->channels) | ((m->kind == KIND_ALL) ? (1 << SIG_SYNC_OUTALL) : 0);
+	uint16_t stops = release_signals(m);
+
+	if (only && !strstr(m->name, only))
+		return;
+
+	if (vcd)
+		fprintf(vcd, "$comment %s $end\n", m->name);
+
+	setup(m);
+
+	if (m->kind != KIND_CHAIN)
+		drive(input, !level);
+
+	for (unsigned k = 0; k < n_edges; k++)
+	{
+		run_for(rand() % PHASE);
+
+		if (m->kind == KIND_CHAIN)
+		{
+			/* From the end of channel 0's pulse */
+			arm(starts, 1);
+			expect[SIG_PWM_OUT0] = 0;
+			set_u8(ADD_REG_START_PWM, B_START_TRG0);
+			run_for(US(500) + WINDOW);
+
+			uint64_t t0 = seen[SIG_PWM_OUT0];
+
+			expect[SIG_PWM_OUT0] = NONE;
+			collect(&active, t0);
+		}
+		else
+		{
+			uint64_t t0 = now;
+
+			arm(signals_at(starts, 0), 1);
+			drive(input, level);
+			run_for(WINDOW);
+			collect(&active, t0);
+
+			if (stops)
+				run_for(rand() % PHASE);
+
+			t0 = now;
+			arm(signals_at(stops, 1), 0);
+			drive(input, !level);
+			run_for(WINDOW);
+			collect(&inactive, t0);
+		}
+
+		set_u8(ADD_REG_STOP_PWM, m->stop);
+	}
+
+	printf("%s\n", m->name);
+	edge_print(level ? "rising" : "falling", &active);
+	edge_print(level ? "falling" : "rising", &inactive);
+}
+
+static void run_modes(void)
+{
+	static const uint8_t trg_modes[3] = {GM_TRG_MODE_START, GM_TRG_MODE_START_AND_STOP, GM_TRG_MODE_GATE};
+	static const char *trg_names[3] = {"START", "START_AND_STOP", "GATE"};
+	static const uint8_t all_modes[2] = {GM_ALL_MODE_TRIG_ALL, GM_ALL_MODE_TRIG_ALL_AND_STOP};
+	static const char *all_names[2] = {"TRIG_ALL", "TRIG_ALL_AND_STOP"};
+	const uint8_t all_channels = B_TRGCH0 | B_TRGCH1 | B_TRGCH2 | B_TRGCH3;
+	trigger_mode_t m;
+
+	for (uint8_t i = 0; i < 4; i++)
+		for (uint8_t k = 0; k < 3; k++)
+			for (uint8_t inverted = 0; inverted < 2; inverted++)
+			{
+				m = (trigger_mode_t){.kind = KIND_INPUT, .input = i, .mode = trg_modes[k] | (inverted ? B_NTRG : 0), .channels = all_channels};
+				snprintf(m.name, sizeof(m.name), "TRIG_IN%u, %s%s", i, trg_names[k], inverted ? ", inverted" : "");
+				run_mode(&m);
+			}
+
+	for (uint8_t k = 0; k < 2; k++)
+		for (uint8_t inverted = 0; inverted < 2; inverted++)
+		{
+			m = (trigger_mode_t){.kind = KIND_ALL, .input = 4, .mode = all_modes[k] | (inverted ? B_NEG : 0), .channels = all_channels};
+			snprintf(m.name, sizeof(m.name), "TRIG_ALL, %s%s", all_names[k], inverted ? ", inverted" : "");
+			run_mode(&m);
+		}
+
+	for (uint8_t k = 0; k < 3; k++)
+	{
+		m = (trigger_mode_t){.kind = KIND_VIRTUAL, .mode = trg_modes[k], .channels = all_channels};
+		snprintf(m.name, sizeof(m.name), "Virtual trigger 0, %s", trg_names[k]);
+		run_mode(&m);
+	}
+
+	m = (trigger_mode_t){.kind = KIND_CHAIN, .channels = B_TRGCH1 | B_TRGCH2 | B_TRGCH3};
+	snprintf(m.name, sizeof(m.name), "Channel 0 chained to 1 to 3");
+	run_mode(&m);
+
+	m = (trigger_mode_t){.kind = KIND_LOADED, .input = 3, .mode = GM_TRG_MODE_START_AND_STOP, .channels = B_TRGCH3};
+	snprintf(m.name, sizeof(m.name), "TRIG_IN3, START_AND_STOP, channels 0 to 2 at 1 kHz");
+	run_mode(&m);
+}
+
+/************************************************************************/
+/* Budgets                                                              */
+/*                                                                      */
+/* The cycles of isr_budget.txt are from the request to the reti, so    */
+/* the entry is taken out of the handler's time.                        */
+/************************************************************************/
+static int read_budgets(const char *path)
+{
+	FILE *f = fopen(path, "r");
+	char line[256];
+
+	if (f == NULL)
+		return -1;
+
+	while (fgets(line, sizeof(line), f))
+	{
+		unsigned vector, cycles;
+
+		if (sscanf(line, "__vector_%u %u", &vector, &cycles) != 2)
+			continue;
+
+		for (uint8_t i = 0; i < N_ISRS; i++)
+			if (isrs[i].vector == vector)
+				isrs[i].body_cycles = (cycles > isr_entry_cycles) ? cycles - isr_entry_cycles : 0;
+	}
+
+	fclose(f);
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	const char *budget_path = NULL;
+	const char *cycles_path = NULL;
+	const char *vcd_path = NULL;
+	unsigned seed = 1;
+	int opt;
+
+	isr_entry_cycles = 5 + 3;
+	isr_entry_spread = 4;
+	isr_exit_cycles = RETI_CYCLES;
+
+	while ((opt = getopt(argc, argv, "n:e:j:c:b:m:r:w:vh")) != -1)
+	{
+		switch (opt)
+		{
+			case 'n': n_edges = strtoul(optarg, NULL, 0); break;
+			case 'e': isr_entry_cycles = strtoul(optarg, NULL, 0); break;
+			case 'j': isr_entry_spread = strtoul(optarg, NULL, 0); break;
+			case 'c': cycles_path = optarg; break;
+			case 'b': budget_path = optarg; break;
+			case 'm': only = optarg; break;
+			case 'r': seed = strtoul(optarg, NULL, 0); break;
+			case 'w': vcd_path = optarg; break;
+			case 'v': verbose = 1; break;
+			default:
+				fprintf(stderr, "usage: %s [-n edges] [-e entry] [-j spread] [-c cycles.txt] [-b budget.txt] [-m mode] [-r seed] [-w trace.vcd] [-v]\n", argv[0]);
+				return opt == 'h' ? 0 : 1;
+		}
+	}
+
+	if (n_edges == 0)
+		return 1;
+
+	if (budget_path && read_budgets(budget_path))
+	{
+		perror(budget_path);
+		return 1;
+	}
+
+	int n_costs = 0;
+
+	if (cycles_path && (n_costs = fw_costs_load(cycles_path)) < 0)
+	{
+		perror(cycles_path);
+		return 1;
+	}
+
+	srand(seed);
+
+	/* An erased EEPROM, so the registers start from their defaults */
+	memset(eeprom, 0xFF, sizeof(eeprom));
+	hwbp_app_initialize();
+
+	if (cycles_path && fw_hooks == 0)
+	{
+		fprintf(stderr, "the cycles of %s need a build with -finstrument-functions\n", cycles_path);
+		return 1;
+	}
+
+	for (uint8_t s = 0; s < N_SIGNALS; s++)
+		levels[s] = signal_level(s);
+
+	arm(0, NONE);
+
+	if (vcd_path)
+		vcd_open(vcd_path);
+
+	printf("Trigger latency on the host model, %u edges of each mode, seed %u\n", n_edges, seed);
+	printf("Interrupt entry of %u to %u cycles, reti of %u cycles\n", isr_entry_cycles, isr_entry_cycles + isr_entry_spread, isr_exit_cycles);
+
+	if (cycles_path)
+		printf("Handlers charged the cycles of their functions, %d of them on %s\n", n_costs, cycles_path);
+	else
+		printf("Handlers take no time, so the results are only the interrupt's entry, not the firmware's latency\n");
+
+	if (budget_path)
+		printf("Handlers keep the CPU for at least their budgets\n");
+
+	printf("Cycles at 32 MHz from the edge of the trigger\n\n");
+	printf("  %-30s %6s %6s %7s %9s %7s %7s %7s\n", "", "n", "missed", "min", "mean", "max", "p-p", "stdev");
+
+	run_modes();
+
+	if (vcd)
+		fclose(vcd);
+
+	return 0;
+}
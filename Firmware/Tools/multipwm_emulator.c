@@ -0,0 +1,399 @@
+/************************************************************************/
+/* MultiPwm device emulator                                             */
+/*                                                                      */
+/* Host tool that runs the firmware's application code on Linux and     */
+/* serves it as a Harp device on a pseudo-terminal, so the host side    */
+/* can be developed and tested without a board. The registers, the      */
+/* quantization of the real values, the triggers and the events are     */
+/* the firmware's own, since its sources are built in.                  */
+/*                                                                      */
+/* Build: gcc -O2 -std=gnu99 -fsingle-precision-constant -Ihost         */
+/*            -o multipwm_emulator multipwm_emulator.c                  */
+/*        from this folder, since it includes the firmware's sources.   */
+/*                                                                      */
+/* Usage: multipwm_emulator [-l link] [-s speed] [-e eeprom.bin] [-v]   */
+/*                                                                      */
+/* The path of the pseudo-terminal is printed on stdout, and -l links   */
+/* it to a fixed name. The virtual clock counts the CPU cycles at 32    */
+/* MHz and runs -s times faster than the wall clock (default 1). Every  */
+/* timestamp comes from it, so the events keep the timing they have on  */
+/* the device even when the host reads them late. With -e, the EEPROM   */
+/* (presets and saved registers) is kept on a file.                     */
+/*                                                                      */
+/* The trigger inputs are driven from stdin, one command per line:      */
+/*     trig <0-3|all> <0|1>        level of TRIG_INx or TRIG_ALL        */
+/*     pulse <0-3|all> <us>        high during us microseconds          */
+/*     wave <0-3|all> <Hz> [duty]  square wave, "wave <in> off" stops   */
+/*     time                        print the virtual time               */
+/*     quit                                                             */
+/* The inputs start low. -v logs the Harp frames on stderr.             */
+/************************************************************************/
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <time.h>
+#include <termios.h>
+
+/************************************************************************/
+/* Firmware                                                             */
+/*                                                                      */
+/* The application code, the models of the peripherals and the Harp     */
+/* core are shared with the other host tools.                           */
+/************************************************************************/
+#include "host/multipwm_model.c"
+
+/************************************************************************/
+/* EEPROM file                                                          */
+/************************************************************************/
+static int eeprom_open(const char *path)
+{
+	memset(eeprom, 0xFF, sizeof(eeprom));
+
+	if ((eeprom_fd = open(path, O_RDWR | O_CREAT, 0644)) < 0)
+		return -1;
+
+	/* A new file is an erased EEPROM */
+	ssize_t n = read(eeprom_fd, eeprom, EEPROM_SIZE);
+
+	if (n < EEPROM_SIZE && pwrite(eeprom_fd, eeprom + (n > 0 ? n : 0), EEPROM_SIZE - (n > 0 ? n : 0), (n > 0 ? n : 0)) < 0)
+		return -1;
+
+	return 0;
+}
+
+/************************************************************************/
+/* Serial port                                                          */
+/************************************************************************/
+static int master_fd = -1;
+
+static void harp_flush(void)
+{
+	while (out_length)
+	{
+		ssize_t n = write(master_fd, out_buffer, out_length);
+
+		if (n <= 0)
+			break;
+
+		memmove(out_buffer, out_buffer + n, out_length - n);
+		out_length -= n;
+	}
+}
+
+static uint8_t rx_buffer[1024];
+static size_t rx_length = 0;
+
+static void harp_receive(void)
+{
+	while (rx_length >= 2)
+	{
+		uint16_t length = rx_buffer[1] + 2;
+		uint8_t sum = 0;
+
+		/* Out of sync, drop a byte and look again */
+		if ((rx_buffer[0] != HARP_READ && rx_buffer[0] != HARP_WRITE) || rx_buffer[1] < 4)
+		{
+			memmove(rx_buffer, rx_buffer + 1, --rx_length);
+			continue;
+		}
+
+		if (rx_length < length)
+			break;
+
+		for (uint16_t i = 0; i < length - 1; i++)
+			sum += rx_buffer[i];
+
+		if (sum != rx_buffer[length - 1])
+		{
+			memmove(rx_buffer, rx_buffer + 1, --rx_length);
+			continue;
+		}
+
+		if (verbose)
+			log_frame("<", rx_buffer, length);
+
+		harp_process(rx_buffer, length);
+
+		rx_length -= length;
+		memmove(rx_buffer, rx_buffer + length, rx_length);
+	}
+}
+
+/************************************************************************/
+/* Virtual clock                                                        */
+/*                                                                      */
+/* The model runs its events up to the time given by the wall clock,    */
+/* -s times faster.                                                     */
+/************************************************************************/
+static double speed = 1;
+static struct timespec wall_start;
+
+static uint64_t virtual_time(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+
+	double ns = (double)(t.tv_sec - wall_start.tv_sec) * 1000000000 + (t.tv_nsec - wall_start.tv_nsec);
+	return (uint64_t)(ns * speed * (F_CPU / 1000000) / 1000);
+}
+
+/************************************************************************/
+/* Commands                                                             */
+/************************************************************************/
+static emu_trig_t *find_trig(const char *name)
+{
+	for (uint8_t i = 0; i < 5; i++)
+		if (!strcmp(trigs[i].name, name))
+			return &trigs[i];
+
+	fprintf(stderr, "unknown input %s, use 0 to 3 or all\n", name);
+	return NULL;
+}
+
+static int run_command(char *line)
+{
+	char command[16], input[8], arg[32];
+	double value, duty = 50;
+	emu_trig_t *p;
+	int n = sscanf(line, "%15s %7s %31s %lf", command, input, arg, &duty);
+
+	if (n <= 0)
+		return 0;
+
+	if (!strcmp(command, "quit"))
+		return 1;
+
+	if (!strcmp(command, "time"))
+	{
+		uint32_t seconds;
+		uint16_t useconds;
+
+		timestamp_at(now, &seconds, &useconds);
+		printf("%.6f s, timestamp %u + %u * 32 us\n", (double)now / F_CPU, seconds, useconds);
+		fflush(stdout);
+		return 0;
+	}
+
+	if (n < 3 || (p = find_trig(input)) == NULL)
+	{
+		fprintf(stderr, "bad command: %s\n", line);
+		return 0;
+	}
+
+	value = strtod(arg, NULL);
+
+	if (!strcmp(command, "trig"))
+	{
+		p->wave_next = NEVER;
+		p->pulse_end = NEVER;
+		trig_set(p, value != 0);
+	}
+	else if (!strcmp(command, "pulse") && value > 0)
+	{
+		p->wave_next = NEVER;
+		trig_set(p, 1);
+		p->pulse_end = now + (uint64_t)(value * (F_CPU / 1000000));
+	}
+	else if (!strcmp(command, "wave") && !strcmp(arg, "off"))
+	{
+		p->wave_next = NEVER;
+		trig_set(p, 0);
+	}
+	else if (!strcmp(command, "wave") && value > 0 && duty > 0 && duty < 100)
+	{
+		p->pulse_end = NEVER;
+		p->wave_freq = value;
+		p->wave_duty = duty;
+		p->wave_start = now;
+		p->wave_edge = 0;
+		p->wave_next = now;
+	}
+	else
+	{
+		fprintf(stderr, "bad command: %s\n", line);
+	}
+
+	return 0;
+}
+
+/************************************************************************/
+/* Pseudo-terminal                                                      */
+/************************************************************************/
+static volatile sig_atomic_t quit = 0;
+
+static void on_signal(int signal)
+{
+	quit = 1;
+}
+
+static int open_pty(const char **slave_name, int *slave_fd)
+{
+	struct termios tio;
+
+	if ((master_fd = posix_openpt(O_RDWR | O_NOCTTY)) < 0 || grantpt(master_fd) || unlockpt(master_fd))
+		return -1;
+
+	if ((*slave_name = ptsname(master_fd)) == NULL)
+		return -1;
+
+	/* Kept open, so the settings stay and the host can close and reopen it */
+	if ((*slave_fd = open(*slave_name, O_RDWR | O_NOCTTY)) < 0 || tcgetattr(*slave_fd, &tio))
+		return -1;
+
+	cfmakeraw(&tio);
+	cfsetspeed(&tio, B1000000);
+
+	if (tcsetattr(*slave_fd, TCSANOW, &tio))
+		return -1;
+
+	return fcntl(master_fd, F_SETFL, fcntl(master_fd, F_GETFL) | O_NONBLOCK);
+}
+
+int main(int argc, char *argv[])
+{
+	const char *link_path = NULL;
+	const char *eeprom_path = NULL;
+	const char *slave_name;
+	int slave_fd;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "l:s:e:vh")) != -1)
+	{
+		switch (opt)
+		{
+			case 'l': link_path = optarg; break;
+			case 's': speed = strtod(optarg, NULL); break;
+			case 'e': eeprom_path = optarg; break;
+			case 'v': verbose = 1; break;
+			default:
+				fprintf(stderr, "usage: %s [-l link] [-s speed] [-e eeprom.bin] [-v]\n", argv[0]);
+				return opt == 'h' ? 0 : 1;
+		}
+	}
+
+	if (speed <= 0)
+		return 1;
+
+	memset(eeprom, 0xFF, sizeof(eeprom));
+
+	if (eeprom_path && eeprom_open(eeprom_path))
+	{
+		perror(eeprom_path);
+		return 1;
+	}
+
+	if (open_pty(&slave_name, &slave_fd))
+	{
+		perror("pty");
+		return 1;
+	}
+
+	if (link_path)
+	{
+		unlink(link_path);
+
+		if (symlink(slave_name, link_path))
+		{
+			perror(link_path);
+			return 1;
+		}
+	}
+
+	signal(SIGINT, on_signal);
+	signal(SIGTERM, on_signal);
+
+	/* Boot at time 0 */
+	clock_gettime(CLOCK_MONOTONIC, &wall_start);
+	hwbp_app_initialize();
+
+	printf("%s\n", link_path ? link_path : slave_name);
+	fflush(stdout);
+
+	char line[256];
+	size_t line_length = 0;
+	int stdin_open = 1;
+
+	while (!quit)
+	{
+		run_until(virtual_time());
+		harp_flush();
+
+		/* Sleep until the next event, the host or a command */
+		uint64_t next = next_event_time();
+		double wait_ns = (next > now) ? (double)(next - now) * 1000 / (F_CPU / 1000000) / speed : 0;
+
+		if (wait_ns > 100000000)
+			wait_ns = 100000000;
+
+		struct timespec timeout = {0, (long)wait_ns};
+		struct pollfd fds[2] = {
+			{master_fd, POLLIN | (out_length ? POLLOUT : 0), 0},
+			{STDIN_FILENO, POLLIN, 0}
+		};
+
+		if (ppoll(fds, stdin_open ? 2 : 1, &timeout, NULL) < 0 && errno != EINTR)
+			break;
+
+		run_until(virtual_time());
+
+		if (fds[0].revents & POLLIN)
+		{
+			ssize_t n = read(master_fd, rx_buffer + rx_length, sizeof(rx_buffer) - rx_length);
+
+			if (n > 0)
+			{
+				rx_length += n;
+				harp_receive();
+			}
+		}
+
+		if (stdin_open && (fds[1].revents & (POLLIN | POLLHUP)))
+		{
+			ssize_t n = read(STDIN_FILENO, line + line_length, sizeof(line) - 1 - line_length);
+
+			/* Without stdin, the emulator runs until it gets a signal */
+			if (n <= 0)
+			{
+				stdin_open = 0;
+				continue;
+			}
+
+			line_length += n;
+			line[line_length] = 0;
+
+			char *end;
+
+			while ((end = strchr(line, '\n')) != NULL)
+			{
+				*end = 0;
+				quit |= run_command(line);
+				line_length -= end + 1 - line;
+				memmove(line, end + 1, line_length + 1);
+			}
+
+			if (line_length == sizeof(line) - 1)
+				line_length = 0;
+		}
+	}
+
+	harp_flush();
+
+	if (n_dropped)
+		fprintf(stderr, "%lu frames dropped, the host didn't read them\n", n_dropped);
+
+	if (link_path)
+		unlink(link_path);
+
+	close(slave_fd);
+	close(master_fd);
+
+	return 0;
+}
@@ -0,0 +1,750 @@
+/************************************************************************/
+/* Host tests and benchmarks of the PWM logic                           */
+/*                                                                      */
+/* Host tool that runs the firmware on the host model shared with the   */
+/* emulator, so the channels reach the model's timers and ports through */
+/* pwm_hal.h as they reach the device's. It checks the start, the stop, */
+/* the end of the Count mode trains, the gate, the chaining, the        */
+/* routing of the triggers and the real values against the timers and   */
+/* the outputs of the model. Each test starts from the default          */
+/* registers.                                                           */
+/*                                                                      */
+/* With -b, it also measures the host time of the configuration paths,  */
+/* from the Harp command to its reply: the writes of a frequency and of */
+/* a whole channel, the read of a real value, a stage and its commit    */
+/* and the queueing of a train. The host times only compare versions of */
+/* the code, the device's cycles are given by isr_analysis and by the   */
+/* profiling registers.                                                 */
+/*                                                                      */
+/* Build: gcc -O2 -std=gnu99 -fsingle-precision-constant -Ihost         */
+/*            -o pwm_host_tests pwm_host_tests.c                        */
+/*        from this folder, since it includes the firmware's sources.   */
+/*                                                                      */
+/* Usage: pwm_host_tests [-b] [-n iterations] [-v]                      */
+/*                                                                      */
+/* Each failed check is printed and the exit status is 1 if any failed. */
+/* -v logs the Harp frames on stderr.                                   */
+/************************************************************************/
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "host/multipwm_model.c"
+
+#define US(us) ((uint64_t)(us) * (F_CPU / 1000000))
+
+static const char *test_name;
+static unsigned n_checks = 0;
+static unsigned n_failed = 0;
+
+#define check(condition, ...) do { \
+	n_checks++; \
+	if (!(condition)) \
+	{ \
+		n_failed++; \
+		printf("%s, line %d: ", test_name, __LINE__); \
+		printf(__VA_ARGS__); \
+		printf("\n"); \
+	} } while (0)
+
+/************************************************************************/
+/* Harp commands                                                        */
+/*                                                                      */
+/* The commands go through the core's whole path, as if received on the */
+/* serial port. The reply is the first frame sent, since the events are */
+/* only sent by the core's timer callbacks.                             */
+/************************************************************************/
+static void watch_sample(void);
+
+static int command(uint8_t type, uint8_t add, uint8_t payload_type, const void *payload, uint8_t n_elements, void *contents)
+{
+	uint8_t frame[MAX_PACKET_SIZE];
+	uint8_t length = n_elements * (payload_type & MSK_TYPE_LEN);
+	uint8_t sum = 0;
+
+	frame[0] = type;
+	frame[1] = length + 4;
+	frame[2] = add;
+	frame[3] = HARP_PORT_DEVICE;
+	frame[4] = payload_type;
+	memcpy(frame + 5, payload, length);
+
+	for (uint8_t i = 0; i < length + 5; i++)
+		sum += frame[i];
+	frame[length + 5] = sum;
+
+	out_length = 0;
+	harp_process(frame, length + 6);
+	watch_sample();
+
+	if (out_length == 0 || out_buffer[0] != type)
+		return 0;
+
+	if (contents)
+		memcpy(contents, out_buffer + 11, out_buffer[1] - 10);
+
+	return 1;
+}
+
+static int write_reg(uint8_t add, uint8_t type, const void *values, uint8_t n_elements)
+{
+	return command(HARP_WRITE, add, type, values, n_elements, NULL);
+}
+
+static int read_reg(uint8_t add, uint8_t type, void *values)
+{
+	return command(HARP_READ, add, type, NULL, 0, values);
+}
+
+static int write_u8(uint8_t add, uint8_t value) {return write_reg(add, TYPE_U8, &value, 1);}
+static int write_u32(uint8_t add, uint32_t value) {return write_reg(add, TYPE_U32, &value, 1);}
+static int write_float(uint8_t add, float value) {return write_reg(add, TYPE_FLOAT, &value, 1);}
+
+static uint8_t read_u8(uint8_t add)
+{
+	uint8_t value = 0xFF;
+
+	read_reg(add, TYPE_U8, &value);
+	return value;
+}
+
+static float read_float(uint8_t add)
+{
+	float value = NAN;
+
+	read_reg(add, TYPE_FLOAT, &value);
+	return value;
+}
+
+/* Counts the events of a register sent since the last command and keeps the first byte of the last one */
+static unsigned take_events(uint8_t add, uint8_t *last)
+{
+	unsigned n = 0;
+
+	for (size_t i = 0; i + 1 < out_length; i += out_buffer[i + 1] + 2)
+		if (out_buffer[i] == HARP_EVENT && out_buffer[i + 2] == add)
+		{
+			n++;
+			if (last)
+				*last = out_buffer[i + 11];
+		}
+
+	out_length = 0;
+	return n;
+}
+
+/************************************************************************/
+/* Outputs                                                              */
+/*                                                                      */
+/* The model runs event by event, and PWM_OUTx is looked at after each  */
+/* one, so every edge is seen at its time.                              */
+/************************************************************************/
+typedef struct
+{
+	uint8_t level;
+	uint32_t rising;
+	uint64_t first_rise;
+	uint64_t last_rise;
+	uint64_t last_fall;
+	uint64_t high;                            // Cycles spent high
+} watch_t;
+
+static watch_t watches[4];
+
+static uint8_t pwm_out(uint8_t ch)
+{
+	return tc0_output(&tc0s[ch]);
+}
+
+static uint8_t sync_out(uint8_t ch)
+{
+	return (tc0s[ch].port->OUT & (1<<1)) ? 1 : 0;
+}
+
+static void watch_start(void)
+{
+	for (uint8_t j = 0; j < 4; j++)
+	{
+		memset(&watches[j], 0, sizeof(watch_t));
+		watches[j].level = pwm_out(j);
+		watches[j].last_rise = now;
+	}
+}
+
+static void watch_sample(void)
+{
+	for (uint8_t j = 0; j < 4; j++)
+	{
+		watch_t *w = &watches[j];
+		uint8_t level = pwm_out(j);
+
+		if (level == w->level)
+			continue;
+
+		if (level)
+		{
+			if (w->rising++ == 0)
+				w->first_rise = now;
+			w->last_rise = now;
+		}
+		else
+		{
+			w->high += now - w->last_rise;
+			w->last_fall = now;
+		}
+
+		w->level = level;
+	}
+}
+
+static void run_for(uint64_t cycles)
+{
+	uint64_t end = now + cycles;
+
+	while (1)
+	{
+		uint64_t t = next_event_time();
+
+		run_until(t < end ? t : end);
+		watch_sample();
+
+		if (t >= end)
+			break;
+	}
+}
+
+static void trig(uint8_t i, uint8_t level)
+{
+	trig_set(&trigs[i], level);
+	run_until(now);
+	watch_sample();
+}
+
+/************************************************************************/
+/* Tests                                                                */
+/************************************************************************/
+static void reset_device(const char *name)
+{
+	test_name = name;
+
+	/* The model keeps the firmware's variables on a reset, so the channels are stopped first */
+	for (uint8_t i = 0; i < 5; i++)
+	{
+		trigs[i].pulse_end = trigs[i].wave_next = NEVER;
+		trig_set(&trigs[i], 0);
+	}
+
+	run_until(now);
+
+	firmware_enter();
+	for (uint8_t j = 0; j < 4; j++)
+		hwbp_app_pwm_gen_stop(j);
+	hwbp_app_pwm_gen_clear_trains(B_TRGCH0 | B_TRGCH1 | B_TRGCH2 | B_TRGCH3);
+	firmware_leave();
+
+	write_u8(ADD_R_RESET_DEV, B_RST_DEF);
+	write_u8(ADD_R_OPERATION_CTRL, GM_OP_MODE_ACTIVE | B_VISUALEN);
+	run_for(US(1000));
+	out_length = 0;
+	watch_start();
+}
+
+static void configure(uint8_t ch, float freq, float dutycycle, uint32_t counts, uint8_t mode)
+{
+	check(write_float(ADD_REG_CH0_FREQ + ch, freq), "frequency %g refused", freq);
+	check(write_float(ADD_REG_CH0_DUTYCYCLE + ch, dutycycle), "duty cycle %g refused", dutycycle);
+	check(write_u32(ADD_REG_CH0_COUNTS + ch, counts), "counts %u refused", counts);
+	check(write_u8(ADD_REG_CH0_MODE + ch, mode), "mode 0x%02X refused", mode);
+}
+
+static void test_start_stop(void)
+{
+	reset_device("start and stop");
+	configure(0, 1000, 25, 1, GM_CH_MODE_INFINITE);
+	check(write_u8(ADD_REG_TRG0_MASK, B_TRGCH0), "TRG0_MASK refused");
+
+	check(write_u8(ADD_REG_START_PWM, B_START_TRG0), "START_PWM refused");
+	check(hal_ch_timer_running(HAL_CH0_TIMER), "timer 0 not running");
+	check(!hal_ch_timer_running(HAL_CH1_TIMER), "timer 1 running");
+	check(read_u8(ADD_REG_EXEC_STATE) == B_PWM0STATE, "EXEC_STATE 0x%02X", read_u8(ADD_REG_EXEC_STATE));
+	check(sync_out(0) && (PORTC.OUT & (1<<2)), "SYNC_OUT0 or SYNC_OUTALL low");
+
+	run_for(US(10000) - 1);
+	check(watches[0].rising == 10, "%u pulses in 10 ms", watches[0].rising);
+	check(watches[0].high == US(2500), "%lu cycles high in 10 ms", (unsigned long)watches[0].high);
+	check(take_events(ADD_REG_EXEC_STATE, NULL) == 1, "no EXEC_STATE event for the start");
+
+	/* A start of a running channel is counted as busy */
+	check(write_u8(ADD_REG_START_PWM, B_START_TRG0), "START_PWM refused");
+	run_for(US(1000));
+	check(watches[0].rising == 11, "restarted by a start while running");
+
+	check(write_u8(ADD_REG_STOP_PWM, B_STOP_TRG0), "STOP_PWM refused");
+	check(!hal_ch_timer_running(HAL_CH0_TIMER), "timer 0 still running");
+	check(!pwm_out(0) && !sync_out(0) && !(PORTC.OUT & (1<<2)), "outputs high after the stop");
+	check(read_u8(ADD_REG_EXEC_STATE) == 0, "EXEC_STATE 0x%02X", read_u8(ADD_REG_EXEC_STATE));
+
+	uint32_t stats[20];
+	read_reg(ADD_REG_CH_STATS, TYPE_U32, stats);
+	check(stats[CH_STATS_ACCEPTED] == 1 && stats[CH_STATS_BUSY] == 1, "accepted %u, busy %u", stats[CH_STATS_ACCEPTED], stats[CH_STATS_BUSY]);
+
+	/* A channel that requires the enable isn't started without it */
+	check(write_u8(ADD_REG_CH_CONFEN, B_USEEN0), "CH_CONFEN refused");
+	write_u8(ADD_REG_START_PWM, B_START_TRG0);
+	check(!hal_ch_timer_running(HAL_CH0_TIMER), "disabled channel started");
+	check(write_u8(ADD_REG_CH_ENABLE, B_EN0), "CH_ENABLE refused");
+	write_u8(ADD_REG_START_PWM, B_START_TRG0);
+	check(hal_ch_timer_running(HAL_CH0_TIMER), "enabled channel not started");
+}
+
+static void test_count(void)
+{
+	reset_device("count");
+	configure(1, 1000, 50, 5, GM_CH_MODE_COUNT);
+	check(write_u8(ADD_REG_TRG1_MASK, B_TRGCH1), "TRG1_MASK refused");
+	check(write_u8(ADD_REG_START_PWM, B_START_TRG1), "START_PWM refused");
+
+	uint64_t start = now;
+	run_for(US(20000));
+
+	uint8_t state = 0xFF;
+	check(watches[1].rising == 5, "%u pulses instead of 5", watches[1].rising);
+	check(watches[1].last_fall - start == US(4500), "last pulse ends at %lu cycles", (unsigned long)(watches[1].last_fall - start));
+	check(!hal_ch_timer_running(HAL_CH1_TIMER) && !sync_out(1), "channel still running");
+	check(take_events(ADD_REG_EXEC_STATE, &state) == 2 && state == 0, "EXEC_STATE events don't end with the stop");
+
+	uint32_t stats[20];
+	read_reg(ADD_REG_CH_STATS, TYPE_U32, stats);
+	check(stats[CH_STATS_N + CH_STATS_PULSES] == 5 && stats[CH_STATS_N + CH_STATS_TRAINS] == 1, "pulses %u, trains %u", stats[CH_STATS_N + CH_STATS_PULSES], stats[CH_STATS_N + CH_STATS_TRAINS]);
+
+	/* A queued train follows without a gap */
+	float train[3] = {1000, 25, 3};
+	check(write_reg(ADD_REG_CH1_TRAIN, TYPE_FLOAT, train, 3), "train refused");
+	watch_start();
+	write_u8(ADD_REG_START_PWM, B_START_TRG1);
+	start = now;
+	run_for(US(20000));
+	check(watches[1].rising == 8, "%u pulses instead of 5 + 3", watches[1].rising);
+	check(watches[1].last_rise - start == US(7000), "last train's pulse at %lu cycles", (unsigned long)(watches[1].last_rise - start));
+	check(watches[1].high == US(5 * 500 + 3 * 250), "%lu cycles high", (unsigned long)watches[1].high);
+}
+
+static void test_events(void)
+{
+	reset_device("event queue");
+	configure(0, 1000, 50, 1, GM_CH_MODE_INFINITE);
+	check(write_u8(ADD_REG_TRG0_MASK, B_TRGCH0), "TRG0_MASK refused");
+
+	/* Without a drain in between, the ring keeps its first EVT_QUEUE_SIZE - 1 entries */
+	for (uint8_t i = 0; i < EVT_QUEUE_SIZE; i++)
+	{
+		write_u8(ADD_REG_START_PWM, B_START_TRG0);
+		write_u8(ADD_REG_STOP_PWM, B_STOP_TRG0);
+	}
+
+	/* The events carry the state of their change, the register the current one */
+	uint8_t state = 0xFF;
+	run_for(US(1000));
+	check(take_events(ADD_REG_EXEC_STATE, &state) == EVT_QUEUE_SIZE - 1 && state == B_PWM0STATE, "EXEC_STATE events not kept in order");
+	check(read_u8(ADD_REG_EXEC_STATE) == 0, "EXEC_STATE 0x%02X", read_u8(ADD_REG_EXEC_STATE));
+
+	uint16_t dropped = 0;
+	read_reg(ADD_REG_EVNT_DROPPED, TYPE_U16, &dropped);
+	check(dropped == EVT_QUEUE_SIZE + 1, "%u events dropped", dropped);
+}
+
+static void test_reals(void)
+{
+	static const float freqs[] = {0.5, 1, 7.3, 10, 999.9, 1000, 12345.6, 32768};
+	static const float dutycycles[] = {0.1, 25, 50, 99.9};
+
+	reset_device("real values");
+
+	for (uint8_t i = 0; i < sizeof(freqs) / sizeof(freqs[0]); i++)
+	{
+		for (uint8_t k = 0; k < sizeof(dutycycles) / sizeof(dutycycles[0]); k++)
+		{
+			configure(2, freqs[i], dutycycles[k], 1, GM_CH_MODE_INFINITE);
+
+			float real_freq = read_float(ADD_REG_CH2_REAL_FREQ);
+			float real_dutycycle = read_float(ADD_REG_CH2_REAL_DUTYCYCLE);
+
+			check(fabsf(real_freq - freqs[i]) <= freqs[i] * 0.001, "%g Hz gives %g Hz", freqs[i], real_freq);
+
+			/* The real values are the ones the timer runs */
+			watch_start();
+			write_u8(ADD_REG_TRG2_MASK, B_TRGCH2);
+			write_u8(ADD_REG_START_PWM, B_START_TRG2);
+
+			TC0_t *timer = HAL_CH2_TIMER;
+			double period = (double)get_divider(hal_ch_timer_clksel(timer)) * ((uint32_t)timer->PER + 1);
+
+			check(fabs(F_CPU / period - real_freq) <= real_freq * 1e-6, "%g Hz reported, %g Hz run", real_freq, F_CPU / period);
+			check(fabs(100.0 * timer->CCA / (timer->PER + 1) - real_dutycycle) <= 1e-3, "%g %% reported, %g %% run", real_dutycycle, 100.0 * timer->CCA / (timer->PER + 1));
+			check(fabsf(real_dutycycle - dutycycles[k]) <= 100.0 / (timer->PER + 1), "%g %% gives %g %%", dutycycles[k], real_dutycycle);
+
+			/* The output follows them on the fast channels */
+			if (freqs[i] >= 100)
+			{
+				run_for((uint64_t)(period * 3.5));
+				check(watches[2].rising == 4 && fabs((watches[2].last_rise - watches[2].first_rise) / 3.0 - period) < 1, "%g Hz, %u edges", real_freq, watches[2].rising);
+			}
+
+			write_u8(ADD_REG_STOP_PWM, B_STOP_TRG2);
+		}
+	}
+
+	/* Out of range values are refused and keep the previous ones */
+	configure(2, 1000, 50, 1, GM_CH_MODE_INFINITE);
+	check(!write_float(ADD_REG_CH2_FREQ, 0.4), "0.4 Hz accepted");
+	check(!write_float(ADD_REG_CH2_FREQ, 40000), "40 kHz accepted");
+	check(!write_float(ADD_REG_CH2_DUTYCYCLE, 100), "100 %% accepted");
+	check(read_float(ADD_REG_CH2_REAL_FREQ) == 1000, "real frequency changed by a refused write");
+
+	/* A channel clocked by TRIG_IN1 reports its period as a negative frequency */
+	uint16_t ext_periods[4] = {10, 10, 8, 10};
+	check(write_reg(ADD_REG_CH_EXT_PERIOD, TYPE_U16, ext_periods, 4), "EXT_PERIOD refused");
+	check(write_u8(ADD_REG_CH2_MODE, GM_CH_MODE_INFINITE | GM_CH_CLK_TRIG1), "TRIG_IN1 clock refused");
+	check(read_float(ADD_REG_CH2_REAL_FREQ) == -8 && read_float(ADD_REG_CH2_REAL_DUTYCYCLE) == 50, "real values %g and %g", read_float(ADD_REG_CH2_REAL_FREQ), read_float(ADD_REG_CH2_REAL_DUTYCYCLE));
+}
+
+static void test_gate(void)
+{
+	reset_device("gate");
+	configure(0, 1000, 50, 1, GM_CH_MODE_INFINITE);
+	configure(1, 1000, 50, 1, GM_CH_MODE_INFINITE);
+	check(write_u8(ADD_REG_TRG0_MASK, B_TRGCH0), "TRG0_MASK refused");
+	check(write_u8(ADD_REG_TRG1_MASK, B_TRGCH1), "TRG1_MASK refused");
+	check(write_u8(ADD_REG_TRG0_MODE, GM_TRG_MODE_GATE), "gate on TRG0 refused");
+	check(write_u8(ADD_REG_TRG1_MODE, GM_TRG_MODE_GATE), "gate on TRG1 refused");
+
+	/* Channel 0 is also cut by its AWeX, on the fault of event channel 0 */
+	check(HAL_CH0_AWEX->CTRL && HAL_CH0_AWEX->FDEMASK == (1<<0), "AWEXC not on event channel 0");
+	check(!HAL_CH2_AWEX->CTRL, "AWEXE on without a gate");
+	check(PORTF.PIN5CTRL & PORT_INVEN_bm, "TRIG_IN0 not inverted for the fault");
+
+	trig(0, 1);
+	trig(1, 1);
+	check(read_u8(ADD_REG_EXEC_STATE) == (B_PWM0STATE | B_PWM1STATE), "not started by the gates");
+	run_for(US(2250));
+	check(watches[0].rising == 3 && watches[1].rising == 3, "%u and %u pulses", watches[0].rising, watches[1].rising);
+
+	/* Closed in the middle of a pulse, the outputs fall and the timers freeze */
+	uint16_t cnt = tc0s[1].cnt + tc0_ticks(&tc0s[1], hal_ch_timer_clksel(HAL_CH1_TIMER), now);
+	trig(0, 0);
+	trig(1, 0);
+	check(!pwm_out(0) && !pwm_out(1), "outputs high with the gates closed");
+	check(hal_ch_timer_clksel(HAL_CH1_TIMER) == HAL_CLKSEL_FROZEN, "timer 1 not frozen");
+	check(read_u8(ADD_REG_EXEC_STATE) == (B_PWM0STATE | B_PWM1STATE), "stopped by the gates");
+	run_for(US(5000));
+	check(watches[0].rising == 3 && watches[1].rising == 3, "pulses with the gates closed");
+
+	/* And resume where they were */
+	trig(0, 1);
+	trig(1, 1);
+	check(tc0s[1].cnt == cnt, "timer 1 resumed from %u instead of %u", tc0s[1].cnt, cnt);
+	check(pwm_out(0) && pwm_out(1), "outputs don't resume the pulse");
+	run_for(US(1000));
+	/* The pulse cut by the gate, resumed, and the next one */
+	check(watches[0].rising == 5 && watches[1].rising == 5, "%u and %u pulses after the gates opened", watches[0].rising, watches[1].rising);
+	check(watches[1].high == US(1500), "%lu cycles high", (unsigned long)watches[1].high);
+
+	/* Without the gate, the AWeX is released */
+	check(write_u8(ADD_REG_TRG0_MODE, GM_TRG_MODE_START), "TRG0_MODE refused");
+	check(!HAL_CH0_AWEX->CTRL && !(PORTF.PIN5CTRL & PORT_INVEN_bm), "AWEXC still on");
+}
+
+static void test_chaining(void)
+{
+	reset_device("chaining");
+	configure(0, 1000, 50, 3, GM_CH_MODE_COUNT);
+	configure(2, 2000, 50, 2, GM_CH_MODE_COUNT);
+	configure(3, 2000, 50, 2, GM_CH_MODE_COUNT);
+
+	uint8_t chain[4] = {B_TRGCH2 | B_TRGCH3, 0, 0, 0};
+	check(write_reg(ADD_REG_CH_CHAIN, TYPE_U8, chain, 4), "CH_CHAIN refused");
+	check(write_u8(ADD_REG_TRG0_MASK, B_TRGCH0), "TRG0_MASK refused");
+	write_u8(ADD_REG_START_PWM, B_START_TRG0);
+	run_for(US(10000));
+
+	check(watches[0].rising == 3 && watches[2].rising == 2 && watches[3].rising == 2, "%u, %u and %u pulses", watches[0].rising, watches[2].rising, watches[3].rising);
+
+	/* The chained channels start on the compare match of the last pulse */
+	check(watches[2].first_rise == watches[0].last_fall && watches[3].first_rise == watches[0].last_fall, "chained start %ld cycles after the last pulse", (long)(watches[2].first_rise - watches[0].last_fall));
+	check(read_u8(ADD_REG_EXEC_STATE) == 0 && !(PORTC.OUT & (1<<2)), "channels still running");
+
+	/* A channel chained to itself runs until stopped, its restart joins the last pulse to the first one */
+	chain[0] = B_TRGCH0;
+	write_reg(ADD_REG_CH_CHAIN, TYPE_U8, chain, 4);
+	uint32_t stats[20] = {0};
+	check(write_reg(ADD_REG_CH_STATS, TYPE_U32, stats, 20), "CH_STATS clear refused");
+	write_u8(ADD_REG_START_PWM, B_START_TRG0);
+	run_for(US(9800));
+
+	read_reg(ADD_REG_CH_STATS, TYPE_U32, stats);
+	check(stats[CH_STATS_PULSES] == 11 && stats[CH_STATS_TRAINS] == 3, "%u pulses and %u trains chained to itself", stats[CH_STATS_PULSES], stats[CH_STATS_TRAINS]);
+	check(hal_ch_timer_running(HAL_CH0_TIMER) && sync_out(0) && (PORTC.OUT & (1<<2)), "stopped on the restart");
+	write_u8(ADD_REG_STOP_PWM, B_STOP_TRG0);
+}
+
+static void test_routing(void)
+{
+	reset_device("trigger routing");
+
+	for (uint8_t j = 0; j < 4; j++)
+		configure(j, 1000, 50, 1, GM_CH_MODE_INFINITE);
+
+	check(write_u8(ADD_REG_TRG2_MASK, B_TRGCH1 | B_TRGCH3), "TRG2_MASK refused");
+	check(write_u8(ADD_REG_TRG3_MASK, B_TRGCH2), "TRG3_MASK refused");
+	check(write_u8(ADD_REG_TRG3_MODE, GM_TRG_MODE_START_AND_STOP | B_NTRG), "TRG3_MODE refused");
+
+	trig(2, 1);
+	check(read_u8(ADD_REG_EXEC_STATE) == (B_PWM1STATE | B_PWM3STATE), "TRIG_IN2 started 0x%02X", read_u8(ADD_REG_EXEC_STATE));
+	trig(2, 0);
+	check(read_u8(ADD_REG_EXEC_STATE) == (B_PWM1STATE | B_PWM3STATE), "TRIG_IN2 stopped on its falling edge");
+
+	/* Inverted, TRIG_IN3 starts on the falling edge and stops on the rising one */
+	trig(3, 1);
+	check(!hal_ch_timer_running(HAL_CH2_TIMER), "TRIG_IN3 started on its rising edge");
+	trig(3, 0);
+	check(hal_ch_timer_running(HAL_CH2_TIMER), "TRIG_IN3 didn't start on its falling edge");
+	trig(3, 1);
+	check(!hal_ch_timer_running(HAL_CH2_TIMER) && read_u8(ADD_REG_EXEC_STATE) == (B_PWM1STATE | B_PWM3STATE), "TRIG_IN3 didn't stop channel 2 only");
+
+	/* A virtual trigger on TRIG_IN2 and TRIG_IN3 both high */
+	reset_device("trigger routing, virtual triggers");
+	configure(0, 1000, 50, 1, GM_CH_MODE_INFINITE);
+	write_u8(ADD_REG_TRG2_MASK, 0);
+	write_u8(ADD_REG_TRG3_MASK, 0);
+	uint32_t table[2] = {1UL << (B_LTRG2 | B_LTRG3), 0};
+	uint8_t vmask[2] = {B_TRGCH0, 0};
+	check(write_reg(ADD_REG_VTRG_TABLE, TYPE_U32, table, 2), "VTRG_TABLE refused");
+	check(write_reg(ADD_REG_VTRG_MASK, TYPE_U8, vmask, 2), "VTRG_MASK refused");
+	trig(2, 1);
+	check(!hal_ch_timer_running(HAL_CH0_TIMER), "virtual trigger started on TRIG_IN2 alone");
+	trig(2, 0);
+	trig(3, 1);
+	check(!hal_ch_timer_running(HAL_CH0_TIMER), "virtual trigger started on TRIG_IN3 alone");
+	trig(2, 1);
+	check(hal_ch_timer_running(HAL_CH0_TIMER), "virtual trigger didn't start");
+
+	/* A TRIG input used as a clock stops being a trigger */
+	reset_device("trigger routing, clock input");
+	configure(1, 1000, 50, 2, GM_CH_MODE_COUNT | GM_CH_CLK_TRIG0);
+	uint16_t ext_periods[4] = {10, 4, 10, 10};
+	check(write_reg(ADD_REG_CH_EXT_PERIOD, TYPE_U16, ext_periods, 4), "EXT_PERIOD refused");
+	check((PORTF.PIN5CTRL & PORT_ISC_gm) == PORT_ISC_RISING_gc && !(PORTF.INT0MASK & (1<<5)), "TRIG_IN0 still a trigger");
+	check((PORTF.PIN6CTRL & PORT_ISC_gm) == PORT_ISC_BOTHEDGES_gc && (PORTF.INT1MASK & (1<<6)), "TRIG_IN1 not a trigger");
+	check(write_u8(ADD_REG_TRG1_MASK, B_TRGCH1), "TRG1_MASK refused");
+	write_u8(ADD_REG_START_PWM, B_START_TRG1);
+	check(hal_ch_timer_clksel(HAL_CH1_TIMER) == HAL_CLKSEL_TRIG0, "timer 1 not clocked by TRIG_IN0");
+
+	for (uint8_t k = 0; k < 12; k++)
+	{
+		trig(0, 1);
+		run_for(US(10));
+		trig(0, 0);
+		run_for(US(10));
+	}
+
+	check(watches[1].rising == 2 && !hal_ch_timer_running(HAL_CH1_TIMER), "%u pulses on 12 clock edges", watches[1].rising);
+	check(read_u8(ADD_REG_EXEC_STATE) == 0, "started by its clock input");
+}
+
+static void test_stage(void)
+{
+	reset_device("stage and commit");
+	configure(0, 1000, 50, 1, GM_CH_MODE_INFINITE);
+	configure(1, 1000, 50, 1, GM_CH_MODE_INFINITE);
+	write_u8(ADD_REG_TRG0_MASK, B_TRGCH0 | B_TRGCH1);
+	write_u8(ADD_REG_START_PWM, B_START_TRG0);
+	run_for(US(1500));
+
+	/* Channel 0 keeps its prescaler and channel 1 changes it */
+	float stage[12] = {2000, 25, 1, 1, 50, 1};
+	check(write_reg(ADD_REG_STAGE_CONFIG, TYPE_FLOAT, stage, 12), "STAGE_CONFIG refused");
+	check(HAL_CH0_TIMER->PER == 31999 && HAL_CH1_TIMER->PER == 31999, "staged values applied before the commit");
+	check(write_u8(ADD_REG_STAGE_COMMIT, B_TRGCH0 | B_TRGCH1 | B_COMMIT_ON_TRIG), "STAGE_COMMIT refused");
+	write_u8(ADD_REG_STAGE_TRIGGER, B_LTRG2);
+	write_u8(ADD_REG_TRG2_MASK, 0);
+	trig(2, 1);
+
+	check(HAL_CH0_TIMER->PERBUF == 15999 && HAL_CH0_TIMER->CCABUF == 4000, "channel 0 not loaded on the next period");
+	check(hal_ch_timer_clksel(HAL_CH1_TIMER) != TC_CLKSEL_DIV1_gc && tc0s[1].cnt == 0, "channel 1 not restarted");
+	check(read_float(ADD_REG_CH0_REAL_FREQ) == 2000 && read_float(ADD_REG_CH1_REAL_FREQ) == 1, "real values not committed");
+	check(read_u8(ADD_REG_STAGE_COMMIT) == 0, "commit still armed");
+
+	watch_start();
+	run_for(US(4500));
+	check(watches[0].rising == 9, "%u pulses at 2 kHz after the commit", watches[0].rising);
+}
+
+static void test_presets(void)
+{
+	uint8_t *saved = eeprom + PRESETS_EEPROM_ADD;
+	const uint16_t last = (PRESETS_N - 1) * sizeof(preset_t);
+
+	reset_device("presets");
+	configure(0, 1000, 50, 1, GM_CH_MODE_INFINITE);
+
+	/* Only the two presets saved are written, one byte per millisecond */
+	memset(saved, 0x5A, sizeof(presets_cache_t));
+	check(write_u8(ADD_REG_PRESET_SAVE, 0), "PRESET_SAVE 0 refused");
+	check(write_u8(ADD_REG_PRESET_SAVE, PRESETS_N - 1), "PRESET_SAVE %u refused", PRESETS_N - 1);
+	run_for(US(1000) * (2 * sizeof(preset_t) + 2));
+	check(memcmp(saved, &cache.presets[0], sizeof(preset_t)) == 0, "preset 0 not written");
+	check(memcmp(saved + last, &cache.presets[PRESETS_N - 1], sizeof(preset_t)) == 0, "preset %u not written", PRESETS_N - 1);
+	check(saved[sizeof(preset_t)] == 0x5A && saved[last - 1] == 0x5A, "presets in between rewritten");
+
+	/* A preset of another layout is seen as empty */
+	saved[last + 1] = PRESET_VERSION + 1;
+	firmware_enter();
+	hwbp_app_preset_init();
+	firmware_leave();
+	check(write_u8(ADD_REG_PRESET_LOAD, 0), "PRESET_LOAD 0 refused");
+	check(!write_u8(ADD_REG_PRESET_LOAD, 1), "empty preset 1 loaded");
+	check(!write_u8(ADD_REG_PRESET_LOAD, PRESETS_N - 1), "preset %u of another version loaded", PRESETS_N - 1);
+}
+
+/************************************************************************/
+/* Benchmarks                                                           */
+/************************************************************************/
+static double elapsed_ns(const struct timespec *start)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (double)(t.tv_sec - start->tv_sec) * 1e9 + (t.tv_nsec - start->tv_nsec);
+}
+
+/* Keeps the compiler from dropping the calls whose results are unused */
+static volatile uint16_t bench_sink;
+
+static void bench_report(const char *name, double ns, unsigned iterations)
+{
+	printf("%-34s %10.0f ns\n", name, ns / iterations);
+}
+
+static void benchmarks(unsigned iterations)
+{
+	struct timespec start;
+	float freq;
+
+	reset_device("benchmarks");
+	configure(0, 1000, 50, 1, GM_CH_MODE_INFINITE);
+	printf("\nHost time of the configuration paths, %u iterations\n", iterations);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		freq = 1 + (i % 30000);
+		write_float(ADD_REG_CH0_FREQ, freq);
+	}
+	bench_report("CH0_FREQ write", elapsed_ns(&start), iterations);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		freq = 1 + (i % 30000);
+		write_float(ADD_REG_CH0_FREQ, freq);
+		read_float(ADD_REG_CH0_REAL_FREQ);
+	}
+	bench_report("CH0_FREQ write, REAL_FREQ read", elapsed_ns(&start), iterations);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		float config[6] = {1 + (i % 30000), 50, 10, GM_CH_MODE_COUNT, 0, 0};
+		write_reg(ADD_REG_CH0_CONFIG, TYPE_FLOAT, config, 6);
+	}
+	bench_report("CH0_CONFIG write", elapsed_ns(&start), iterations);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		float stage[12] = {1 + (i % 30000), 50, 10, 500, 25, 5, 2000, 75, 1, 10, 50, 100};
+		write_reg(ADD_REG_STAGE_CONFIG, TYPE_FLOAT, stage, 12);
+	}
+	bench_report("STAGE_CONFIG write", elapsed_ns(&start), iterations);
+
+	write_u8(ADD_REG_TRG0_MASK, B_TRGCH0);
+	configure(0, 1000, 50, 1, GM_CH_MODE_INFINITE);
+	write_u8(ADD_REG_START_PWM, B_START_TRG0);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (unsigned i = 0; i < iterations; i++)
+		write_u8(ADD_REG_STAGE_COMMIT, B_TRGCH0 | B_TRGCH1 | B_TRGCH2 | B_TRGCH3);
+	bench_report("STAGE_COMMIT write, running", elapsed_ns(&start), iterations);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		float train[3] = {1000, 1 + (i % 98), 10};
+		write_reg(ADD_REG_CH0_TRAIN, TYPE_FLOAT, train, 3);
+		if ((i & (TRAIN_QUEUE_SIZE - 1)) == TRAIN_QUEUE_SIZE - 1)
+			write_u8(ADD_REG_TRAIN_LEVEL, 0);
+	}
+	bench_report("CH0_TRAIN write", elapsed_ns(&start), iterations);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (unsigned i = 0; i < iterations; i++)
+	{
+		uint8_t prescaler;
+		uint16_t target_count, duty_cycle;
+
+		timer_solver_solve(32000000, 0.5 + (i % 65536) * 0.5, 50, &prescaler, &target_count, &duty_cycle);
+		bench_sink = prescaler + target_count + duty_cycle;
+	}
+	bench_report("timer_solver_solve", elapsed_ns(&start), iterations);
+
+	write_u8(ADD_REG_STOP_PWM, B_STOP_TRG0);
+}
+
+int main(int argc, char *argv[])
+{
+	unsigned iterations = 20000;
+	int bench = 0;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "bn:vh")) != -1)
+	{
+		switch (opt)
+		{
+			case 'b': bench = 1; break;
+			case 'n': iterations = strtoul(optarg, NULL, 0); break;
+			case 'v': verbose = 1; break;
+			default:
+				fprintf(stderr, "usage: %s [-b] [-n iterations] [-v]\n", argv[0]);
+				return opt == 'h' ? 0 : 1;
+		}
+	}
+
+	if (iterations == 0)
+		return 1;
+
+	/* An erased EEPROM, so the registers start from their defaults */
+	memset(eeprom, 0xFF, sizeof(eeprom));
+	hwbp_app_initialize();
+
+	test_start_stop();
+	test_count();
+	test_events();
+	test_reals();
+	test_gate();
+	test_chaining();
+	test_routing();
+	test_stage();
+	test_presets();
+
+	printf("%u checks, %u failed\n", n_checks, n_failed);
+
+	if (bench)
+		benchmarks(iterations);
+
+	return n_failed ? 1 : 0;
+}
@@ -0,0 +1,288 @@
+/************************************************************************/
+/* Frequency and duty cycle quantization sweep                          */
+/*                                                                      */
+/* Host tool that computes, for a grid of requested frequencies and     */
+/* duty cycles, the timer values the firmware would use and the error   */
+/* of the real output. It also searches every TC0 prescaler for the     */
+/* pair with the smallest error and flags the points where it differs   */
+/* from the firmware's choice.                                          */
+/*                                                                      */
+/* Build: gcc -O2 -std=gnu99 -pthread -o quantization_sweep             */
+/*            quantization_sweep.c -lm                                  */
+/*        from this folder, since it includes the firmware's solver.    */
+/*                                                                      */
+/* Usage: quantization_sweep [-f freq_steps] [-d duty_steps]            */
+/*            [-j threads] [-c out.csv] [-b out.bin]                    */
+/*                                                                      */
+/* The frequencies are log spaced from 0.5 to 32768 Hz and the duty     */
+/* cycles linearly spaced from 0.1 to 99.9 %. The AVR uses 32 bits      */
+/* floats for double, so all the math below is done on float. The       */
+/* binary output is the array of sweep_point_t as laid out by the host. */
+/************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+#include <pthread.h>
+
+#define F_CPU 32000000UL
+#define N_PRESCALERS 7
+
+/* TIMER_PRESCALER_DIV1 to TIMER_PRESCALER_DIV1024 from cpu.h */
+static const uint16_t dividers[N_PRESCALERS] = {1, 2, 4, 8, 64, 256, 1024};
+
+typedef struct
+{
+	float freq;
+	float dutycycle;
+	uint8_t prescaler;          // 1 to 7 as TIMER_PRESCALER_DIVx, 0 if refused
+	uint16_t target_count;
+	uint16_t duty_cycle;
+	float real_freq;
+	float real_dutycycle;
+	float freq_error_ppm;
+	float duty_error;           // Percentage points
+	uint8_t best_prescaler;
+	float best_freq_error_ppm;
+	float best_duty_error;
+} sweep_point_t;
+
+/************************************************************************/
+/* Firmware's selection                                                 */
+/*                                                                      */
+/* The firmware's own solver is built in, so the timer values are the   */
+/* ones the device uses.                                                */
+/************************************************************************/
+#include "../MultiPwm/timer_solver_functions.c"
+
+/* Same math as hwbp_app_pwm_gen_update_reals_chx() */
+static void compute_reals(uint8_t prescaler, uint16_t target_count, uint16_t duty_cycle, float *real_freq, float *real_dutycycle)
+{
+	*real_freq = (float)F_CPU / ((uint32_t)dividers[prescaler - 1] * (uint32_t)target_count);
+	*real_dutycycle = 100.0f * ((float)duty_cycle / target_count);
+
+	if (*real_dutycycle <= 0 || *real_dutycycle >= 100)
+	{
+		*real_freq = 0;
+		*real_dutycycle = 0;
+	}
+}
+
+static void evaluate(sweep_point_t *p)
+{
+	float real_freq, real_dutycycle;
+	uint16_t duty_cycle;
+
+	p->prescaler = 0;
+	p->best_prescaler = 0;
+	p->freq_error_ppm = p->best_freq_error_ppm = NAN;
+	p->duty_error = p->best_duty_error = NAN;
+
+	if (timer_solver_solve(F_CPU, p->freq, p->dutycycle, &p->prescaler, &p->target_count, &p->duty_cycle))
+	{
+		compute_reals(p->prescaler, p->target_count, p->duty_cycle, &p->real_freq, &p->real_dutycycle);
+
+		if (p->real_freq != 0)
+		{
+			p->freq_error_ppm = 1e6f * (p->real_freq - p->freq) / p->freq;
+			p->duty_error = p->real_dutycycle - p->dutycycle;
+		}
+	}
+
+	/* Independent search of every prescaler with the target counts around the ideal one */
+	float best_score = INFINITY;
+
+	for (uint8_t i = 0; i < N_PRESCALERS; i++)
+	{
+		double ideal = (double)F_CPU / dividers[i] / p->freq;
+
+		for (int32_t target = (int32_t)floor(ideal); target <= (int32_t)floor(ideal) + 1; target++)
+		{
+			if (target < 2 || target > 65535)
+				continue;
+
+			duty_cycle = p->dutycycle / 100.0f * target + 0.5f;
+			compute_reals(i + 1, target, duty_cycle, &real_freq, &real_dutycycle);
+
+			if (real_freq == 0)
+				continue;
+
+			float freq_error_ppm = 1e6f * (real_freq - p->freq) / p->freq;
+			float duty_error = real_dutycycle - p->dutycycle;
+
+			/* A percentage point of duty cycle weights as 1 % of frequency */
+			float score = fabsf(freq_error_ppm) / 10000.0f + fabsf(duty_error);
+
+			if (score < best_score)
+			{
+				best_score = score;
+				p->best_prescaler = i + 1;
+				p->best_freq_error_ppm = freq_error_ppm;
+				p->best_duty_error = duty_error;
+			}
+		}
+	}
+}
+
+static int is_flagged(const sweep_point_t *p)
+{
+	return p->best_prescaler && p->best_prescaler != p->prescaler &&
+		fabsf(p->best_freq_error_ppm) / 10000.0f + fabsf(p->best_duty_error) <
+		fabsf(p->freq_error_ppm) / 10000.0f + fabsf(p->duty_error);
+}
+
+/************************************************************************/
+/* Sweep                                                                */
+/*                                                                      */
+/* The grid is computed a block of frequencies at a time. Each thread   */
+/* takes every n_threads-th frequency of the block and the block is     */
+/* written in order once all the threads are done.                      */
+/************************************************************************/
+#define BLOCK_FREQS 256
+
+static uint32_t freq_steps = 4096;
+static uint32_t duty_steps = 999;
+static uint32_t n_threads = 0;
+
+static sweep_point_t *block;
+static uint32_t block_start, block_length;
+
+typedef struct
+{
+	uint32_t index;
+} worker_t;
+
+static float grid_freq(uint32_t i)
+{
+	return (freq_steps > 1) ? 0.5f * powf(65536.0f, (float)i / (freq_steps - 1)) : 0.5f;
+}
+
+static float grid_dutycycle(uint32_t i)
+{
+	return (duty_steps > 1) ? 0.1f + 99.8f * i / (duty_steps - 1) : 50.0f;
+}
+
+static void *worker(void *arg)
+{
+	worker_t *w = arg;
+
+	for (uint32_t i = w->index; i < block_length; i += n_threads)
+	{
+		float freq = grid_freq(block_start + i);
+
+		for (uint32_t j = 0; j < duty_steps; j++)
+		{
+			sweep_point_t *p = &block[(size_t)i * duty_steps + j];
+
+			p->freq = freq;
+			p->dutycycle = grid_dutycycle(j);
+			evaluate(p);
+		}
+	}
+
+	return NULL;
+}
+
+int main(int argc, char *argv[])
+{
+	const char *csv_path = "quantization_sweep.csv";
+	const char *bin_path = NULL;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "f:d:j:c:b:h")) != -1)
+	{
+		switch (opt)
+		{
+			case 'f': freq_steps = strtoul(optarg, NULL, 0); break;
+			case 'd': duty_steps = strtoul(optarg, NULL, 0); break;
+			case 'j': n_threads = strtoul(optarg, NULL, 0); break;
+			case 'c': csv_path = optarg; break;
+			case 'b': bin_path = optarg; break;
+			default:
+				fprintf(stderr, "usage: %s [-f freq_steps] [-d duty_steps] [-j threads] [-c out.csv] [-b out.bin]\n", argv[0]);
+				return opt == 'h' ? 0 : 1;
+		}
+	}
+
+	if (freq_steps == 0 || duty_steps == 0)
+		return 1;
+
+	if (n_threads == 0)
+		n_threads = sysconf(_SC_NPROCESSORS_ONLN);
+
+	FILE *csv = fopen(csv_path, "w");
+	FILE *bin = bin_path ? fopen(bin_path, "wb") : NULL;
+
+	if (!csv || (bin_path && !bin))
+	{
+		perror("fopen");
+		return 1;
+	}
+
+	fprintf(csv, "freq,dutycycle,prescaler,target_count,duty_cycle,real_freq,real_dutycycle,freq_error_ppm,duty_error,best_prescaler,best_freq_error_ppm,best_duty_error,flagged\n");
+
+	block = malloc(sizeof(sweep_point_t) * BLOCK_FREQS * duty_steps);
+	pthread_t *threads = malloc(sizeof(pthread_t) * n_threads);
+	worker_t *workers = malloc(sizeof(worker_t) * n_threads);
+
+	if (!block || !threads || !workers)
+		return 1;
+
+	uint64_t n_points = 0, n_refused = 0, n_flagged = 0;
+	float max_freq_error_ppm = 0, max_duty_error = 0;
+
+	for (block_start = 0; block_start < freq_steps; block_start += BLOCK_FREQS)
+	{
+		block_length = (freq_steps - block_start < BLOCK_FREQS) ? freq_steps - block_start : BLOCK_FREQS;
+
+		for (uint32_t t = 0; t < n_threads; t++)
+		{
+			workers[t].index = t;
+			pthread_create(&threads[t], NULL, worker, &workers[t]);
+		}
+
+		for (uint32_t t = 0; t < n_threads; t++)
+			pthread_join(threads[t], NULL);
+
+		for (size_t k = 0; k < (size_t)block_length * duty_steps; k++)
+		{
+			sweep_point_t *p = &block[k];
+			int flagged = is_flagged(p);
+
+			n_points++;
+
+			if (p->prescaler == 0 || isnan(p->freq_error_ppm))
+			{
+				n_refused++;
+			}
+			else
+			{
+				if (fabsf(p->freq_error_ppm) > max_freq_error_ppm)
+					max_freq_error_ppm = fabsf(p->freq_error_ppm);
+				if (fabsf(p->duty_error) > max_duty_error)
+					max_duty_error = fabsf(p->duty_error);
+			}
+
+			n_flagged += flagged;
+
+			fprintf(csv, "%.9g,%.9g,%u,%u,%u,%.9g,%.9g,%.9g,%.9g,%u,%.9g,%.9g,%d\n",
+				p->freq, p->dutycycle, p->prescaler, p->target_count, p->duty_cycle,
+				p->real_freq, p->real_dutycycle, p->freq_error_ppm, p->duty_error,
+				p->best_prescaler, p->best_freq_error_ppm, p->best_duty_error, flagged);
+
+			if (bin)
+				fwrite(p, sizeof(sweep_point_t), 1, bin);
+		}
+	}
+
+	fclose(csv);
+	if (bin)
+		fclose(bin);
+
+	fprintf(stderr, "points: %llu, refused: %llu, flagged: %llu\n", (unsigned long long)n_points, (unsigned long long)n_refused, (unsigned long long)n_flagged);
+	fprintf(stderr, "max frequency error: %.3f ppm, max duty cycle error: %.4f %%\n", max_freq_error_ppm, max_duty_error);
+
+	return 0;
+}
@@ -79,7 +79,50 @@ namespace Harp.MultiPwm
             { 71, typeof(TriggerChannelState) },
             { 72, typeof(PwmChannelState) },
             { 73, typeof(PwmState) },
-            { 74, typeof(EnableEvents) }
+            { 74, typeof(EnableEvents) },
+            { 75, typeof(FrequencyMeterEnable) },
+            { 76, typeof(FrequencyMeterWindow) },
+            { 77, typeof(TriggerPeriod) },
+            { 78, typeof(TriggerFrequency) },
+            { 79, typeof(TriggerDutyCycle) },
+            { 80, typeof(PwmExternalClockPeriod) },
+            { 81, typeof(PwmChainedChannels) },
+            { 82, typeof(VirtualTriggerTable) },
+            { 83, typeof(VirtualTriggerMask) },
+            { 84, typeof(VirtualTriggerMode) },
+            { 85, typeof(EventCoalesceWindow) },
+            { 86, typeof(PwmStateBatch) },
+            { 87, typeof(PwmStatistics) },
+            { 88, typeof(PwmStatisticsControl) },
+            { 89, typeof(PwmRemainingCount) },
+            { 90, typeof(PwmProgressInterval) },
+            { 91, typeof(ProfilingInterruptCount) },
+            { 92, typeof(ProfilingInterruptMaxCycles) },
+            { 93, typeof(ProfilingInterruptMeanCycles) },
+            { 94, typeof(ProfilingMaxLatency) },
+            { 95, typeof(ProfilingCpuLoad) },
+            { 96, typeof(Channel0Configuration) },
+            { 97, typeof(Channel1Configuration) },
+            { 98, typeof(Channel2Configuration) },
+            { 99, typeof(Channel3Configuration) },
+            { 100, typeof(ChannelsConfiguration) },
+            { 101, typeof(StagedConfiguration) },
+            { 102, typeof(CommitStagedConfiguration) },
+            { 103, typeof(CommitTriggers) },
+            { 104, typeof(SavePreset) },
+            { 105, typeof(LoadPreset) },
+            { 106, typeof(PresetNames) },
+            { 107, typeof(PresetTriggers) },
+            { 108, typeof(Channel0Train) },
+            { 109, typeof(Channel1Train) },
+            { 110, typeof(Channel2Train) },
+            { 111, typeof(Channel3Train) },
+            { 112, typeof(TrainQueueLevel) },
+            { 113, typeof(TrainQueueLow) },
+            { 114, typeof(ProfilingMinLatency) },
+            { 115, typeof(ProfilingLatencyHistogram) },
+            { 116, typeof(ProfilingMaxSkew) },
+            { 117, typeof(DroppedEvents) }
         };
 
         /// <summary>
@@ -185,6 +228,49 @@ namespace Harp.MultiPwm
     /// <seealso cref="PwmChannelState"/>
     /// <seealso cref="PwmState"/>
     /// <seealso cref="EnableEvents"/>
+    /// <seealso cref="FrequencyMeterEnable"/>
+    /// <seealso cref="FrequencyMeterWindow"/>
+    /// <seealso cref="TriggerPeriod"/>
+    /// <seealso cref="TriggerFrequency"/>
+    /// <seealso cref="TriggerDutyCycle"/>
+    /// <seealso cref="PwmExternalClockPeriod"/>
+    /// <seealso cref="PwmChainedChannels"/>
+    /// <seealso cref="VirtualTriggerTable"/>
+    /// <seealso cref="VirtualTriggerMask"/>
+    /// <seealso cref="VirtualTriggerMode"/>
+    /// <seealso cref="EventCoalesceWindow"/>
+    /// <seealso cref="PwmStateBatch"/>
+    /// <seealso cref="PwmStatistics"/>
+    /// <seealso cref="PwmStatisticsControl"/>
+    /// <seealso cref="PwmRemainingCount"/>
+    /// <seealso cref="PwmProgressInterval"/>
+    /// <seealso cref="ProfilingInterruptCount"/>
+    /// <seealso cref="ProfilingInterruptMaxCycles"/>
+    /// <seealso cref="ProfilingInterruptMeanCycles"/>
+    /// <seealso cref="ProfilingMaxLatency"/>
+    /// <seealso cref="ProfilingCpuLoad"/>
+    /// <seealso cref="Channel0Configuration"/>
+    /// <seealso cref="Channel1Configuration"/>
+    /// <seealso cref="Channel2Configuration"/>
+    /// <seealso cref="Channel3Configuration"/>
+    /// <seealso cref="ChannelsConfiguration"/>
+    /// <seealso cref="StagedConfiguration"/>
+    /// <seealso cref="CommitStagedConfiguration"/>
+    /// <seealso cref="CommitTriggers"/>
+    /// <seealso cref="SavePreset"/>
+    /// <seealso cref="LoadPreset"/>
+    /// <seealso cref="PresetNames"/>
+    /// <seealso cref="PresetTriggers"/>
+    /// <seealso cref="Channel0Train"/>
+    /// <seealso cref="Channel1Train"/>
+    /// <seealso cref="Channel2Train"/>
+    /// <seealso cref="Channel3Train"/>
+    /// <seealso cref="TrainQueueLevel"/>
+    /// <seealso cref="TrainQueueLow"/>
+    /// <seealso cref="ProfilingMinLatency"/>
+    /// <seealso cref="ProfilingLatencyHistogram"/>
+    /// <seealso cref="ProfilingMaxSkew"/>
+    /// <seealso cref="DroppedEvents"/>
     [XmlInclude(typeof(PwmChannel0Frequency))]
     [XmlInclude(typeof(PwmChannel1Frequency))]
     [XmlInclude(typeof(PwmChannel2Frequency))]
@@ -227,6 +313,49 @@ namespace Harp.MultiPwm
     [XmlInclude(typeof(PwmChannelState))]
     [XmlInclude(typeof(PwmState))]
     [XmlInclude(typeof(EnableEvents))]
+    [XmlInclude(typeof(FrequencyMeterEnable))]
+    [XmlInclude(typeof(FrequencyMeterWindow))]
+    [XmlInclude(typeof(TriggerPeriod))]
+    [XmlInclude(typeof(TriggerFrequency))]
+    [XmlInclude(typeof(TriggerDutyCycle))]
+    [XmlInclude(typeof(PwmExternalClockPeriod))]
+    [XmlInclude(typeof(PwmChainedChannels))]
+    [XmlInclude(typeof(VirtualTriggerTable))]
+    [XmlInclude(typeof(VirtualTriggerMask))]
+    [XmlInclude(typeof(VirtualTriggerMode))]
+    [XmlInclude(typeof(EventCoalesceWindow))]
+    [XmlInclude(typeof(PwmStateBatch))]
+    [XmlInclude(typeof(PwmStatistics))]
+    [XmlInclude(typeof(PwmStatisticsControl))]
+    [XmlInclude(typeof(PwmRemainingCount))]
+    [XmlInclude(typeof(PwmProgressInterval))]
+    [XmlInclude(typeof(ProfilingInterruptCount))]
+    [XmlInclude(typeof(ProfilingInterruptMaxCycles))]
+    [XmlInclude(typeof(ProfilingInterruptMeanCycles))]
+    [XmlInclude(typeof(ProfilingMaxLatency))]
+    [XmlInclude(typeof(ProfilingCpuLoad))]
+    [XmlInclude(typeof(Channel0Configuration))]
+    [XmlInclude(typeof(Channel1Configuration))]
+    [XmlInclude(typeof(Channel2Configuration))]
+    [XmlInclude(typeof(Channel3Configuration))]
+    [XmlInclude(typeof(ChannelsConfiguration))]
+    [XmlInclude(typeof(StagedConfiguration))]
+    [XmlInclude(typeof(CommitStagedConfiguration))]
+    [XmlInclude(typeof(CommitTriggers))]
+    [XmlInclude(typeof(SavePreset))]
+    [XmlInclude(typeof(LoadPreset))]
+    [XmlInclude(typeof(PresetNames))]
+    [XmlInclude(typeof(PresetTriggers))]
+    [XmlInclude(typeof(Channel0Train))]
+    [XmlInclude(typeof(Channel1Train))]
+    [XmlInclude(typeof(Channel2Train))]
+    [XmlInclude(typeof(Channel3Train))]
+    [XmlInclude(typeof(TrainQueueLevel))]
+    [XmlInclude(typeof(TrainQueueLow))]
+    [XmlInclude(typeof(ProfilingMinLatency))]
+    [XmlInclude(typeof(ProfilingLatencyHistogram))]
+    [XmlInclude(typeof(ProfilingMaxSkew))]
+    [XmlInclude(typeof(DroppedEvents))]
     [Description("Filters register-specific messages reported by the MultiPwm device.")]
     public class FilterRegister : FilterRegisterBuilder, INamedElement
     {
@@ -290,6 +419,49 @@ namespace Harp.MultiPwm
     /// <seealso cref="PwmChannelState"/>
     /// <seealso cref="PwmState"/>
     /// <seealso cref="EnableEvents"/>
+    /// <seealso cref="FrequencyMeterEnable"/>
+    /// <seealso cref="FrequencyMeterWindow"/>
+    /// <seealso cref="TriggerPeriod"/>
+    /// <seealso cref="TriggerFrequency"/>
+    /// <seealso cref="TriggerDutyCycle"/>
+    /// <seealso cref="PwmExternalClockPeriod"/>
+    /// <seealso cref="PwmChainedChannels"/>
+    /// <seealso cref="VirtualTriggerTable"/>
+    /// <seealso cref="VirtualTriggerMask"/>
+    /// <seealso cref="VirtualTriggerMode"/>
+    /// <seealso cref="EventCoalesceWindow"/>
+    /// <seealso cref="PwmStateBatch"/>
+    /// <seealso cref="PwmStatistics"/>
+    /// <seealso cref="PwmStatisticsControl"/>
+    /// <seealso cref="PwmRemainingCount"/>
+    /// <seealso cref="PwmProgressInterval"/>
+    /// <seealso cref="ProfilingInterruptCount"/>
+    /// <seealso cref="ProfilingInterruptMaxCycles"/>
+    /// <seealso cref="ProfilingInterruptMeanCycles"/>
+    /// <seealso cref="ProfilingMaxLatency"/>
+    /// <seealso cref="ProfilingCpuLoad"/>
+    /// <seealso cref="Channel0Configuration"/>
+    /// <seealso cref="Channel1Configuration"/>
+    /// <seealso cref="Channel2Configuration"/>
+    /// <seealso cref="Channel3Configuration"/>
+    /// <seealso cref="ChannelsConfiguration"/>
+    /// <seealso cref="StagedConfiguration"/>
+    /// <seealso cref="CommitStagedConfiguration"/>
+    /// <seealso cref="CommitTriggers"/>
+    /// <seealso cref="SavePreset"/>
+    /// <seealso cref="LoadPreset"/>
+    /// <seealso cref="PresetNames"/>
+    /// <seealso cref="PresetTriggers"/>
+    /// <seealso cref="Channel0Train"/>
+    /// <seealso cref="Channel1Train"/>
+    /// <seealso cref="Channel2Train"/>
+    /// <seealso cref="Channel3Train"/>
+    /// <seealso cref="TrainQueueLevel"/>
+    /// <seealso cref="TrainQueueLow"/>
+    /// <seealso cref="ProfilingMinLatency"/>
+    /// <seealso cref="ProfilingLatencyHistogram"/>
+    /// <seealso cref="ProfilingMaxSkew"/>
+    /// <seealso cref="DroppedEvents"/>
     [XmlInclude(typeof(PwmChannel0Frequency))]
     [XmlInclude(typeof(PwmChannel1Frequency))]
     [XmlInclude(typeof(PwmChannel2Frequency))]
@@ -332,6 +504,49 @@ namespace Harp.MultiPwm
     [XmlInclude(typeof(PwmChannelState))]
     [XmlInclude(typeof(PwmState))]
     [XmlInclude(typeof(EnableEvents))]
+    [XmlInclude(typeof(FrequencyMeterEnable))]
+    [XmlInclude(typeof(FrequencyMeterWindow))]
+    [XmlInclude(typeof(TriggerPeriod))]
+    [XmlInclude(typeof(TriggerFrequency))]
+    [XmlInclude(typeof(TriggerDutyCycle))]
+    [XmlInclude(typeof(PwmExternalClockPeriod))]
+    [XmlInclude(typeof(PwmChainedChannels))]
+    [XmlInclude(typeof(VirtualTriggerTable))]
+    [XmlInclude(typeof(VirtualTriggerMask))]
+    [XmlInclude(typeof(VirtualTriggerMode))]
+    [XmlInclude(typeof(EventCoalesceWindow))]
+    [XmlInclude(typeof(PwmStateBatch))]
+    [XmlInclude(typeof(PwmStatistics))]
+    [XmlInclude(typeof(PwmStatisticsControl))]
+    [XmlInclude(typeof(PwmRemainingCount))]
+    [XmlInclude(typeof(PwmProgressInterval))]
+    [XmlInclude(typeof(ProfilingInterruptCount))]
+    [XmlInclude(typeof(ProfilingInterruptMaxCycles))]
+    [XmlInclude(typeof(ProfilingInterruptMeanCycles))]
+    [XmlInclude(typeof(ProfilingMaxLatency))]
+    [XmlInclude(typeof(ProfilingCpuLoad))]
+    [XmlInclude(typeof(Channel0Configuration))]
+    [XmlInclude(typeof(Channel1Configuration))]
+    [XmlInclude(typeof(Channel2Configuration))]
+    [XmlInclude(typeof(Channel3Configuration))]
+    [XmlInclude(typeof(ChannelsConfiguration))]
+    [XmlInclude(typeof(StagedConfiguration))]
+    [XmlInclude(typeof(CommitStagedConfiguration))]
+    [XmlInclude(typeof(CommitTriggers))]
+    [XmlInclude(typeof(SavePreset))]
+    [XmlInclude(typeof(LoadPreset))]
+    [XmlInclude(typeof(PresetNames))]
+    [XmlInclude(typeof(PresetTriggers))]
+    [XmlInclude(typeof(Channel0Train))]
+    [XmlInclude(typeof(Channel1Train))]
+    [XmlInclude(typeof(Channel2Train))]
+    [XmlInclude(typeof(Channel3Train))]
+    [XmlInclude(typeof(TrainQueueLevel))]
+    [XmlInclude(typeof(TrainQueueLow))]
+    [XmlInclude(typeof(ProfilingMinLatency))]
+    [XmlInclude(typeof(ProfilingLatencyHistogram))]
+    [XmlInclude(typeof(ProfilingMaxSkew))]
+    [XmlInclude(typeof(DroppedEvents))]
     [XmlInclude(typeof(TimestampedPwmChannel0Frequency))]
     [XmlInclude(typeof(TimestampedPwmChannel1Frequency))]
     [XmlInclude(typeof(TimestampedPwmChannel2Frequency))]
@@ -374,6 +589,49 @@ namespace Harp.MultiPwm
     [XmlInclude(typeof(TimestampedPwmChannelState))]
     [XmlInclude(typeof(TimestampedPwmState))]
     [XmlInclude(typeof(TimestampedEnableEvents))]
+    [XmlInclude(typeof(TimestampedFrequencyMeterEnable))]
+    [XmlInclude(typeof(TimestampedFrequencyMeterWindow))]
+    [XmlInclude(typeof(TimestampedTriggerPeriod))]
+    [XmlInclude(typeof(TimestampedTriggerFrequency))]
+    [XmlInclude(typeof(TimestampedTriggerDutyCycle))]
+    [XmlInclude(typeof(TimestampedPwmExternalClockPeriod))]
+    [XmlInclude(typeof(TimestampedPwmChainedChannels))]
+    [XmlInclude(typeof(TimestampedVirtualTriggerTable))]
+    [XmlInclude(typeof(TimestampedVirtualTriggerMask))]
+    [XmlInclude(typeof(TimestampedVirtualTriggerMode))]
+    [XmlInclude(typeof(TimestampedEventCoalesceWindow))]
+    [XmlInclude(typeof(TimestampedPwmStateBatch))]
+    [XmlInclude(typeof(TimestampedPwmStatistics))]
+    [XmlInclude(typeof(TimestampedPwmStatisticsControl))]
+    [XmlInclude(typeof(TimestampedPwmRemainingCount))]
+    [XmlInclude(typeof(TimestampedPwmProgressInterval))]
+    [XmlInclude(typeof(TimestampedProfilingInterruptCount))]
+    [XmlInclude(typeof(TimestampedProfilingInterruptMaxCycles))]
+    [XmlInclude(typeof(TimestampedProfilingInterruptMeanCycles))]
+    [XmlInclude(typeof(TimestampedProfilingMaxLatency))]
+    [XmlInclude(typeof(TimestampedProfilingCpuLoad))]
+    [XmlInclude(typeof(TimestampedChannel0Configuration))]
+    [XmlInclude(typeof(TimestampedChannel1Configuration))]
+    [XmlInclude(typeof(TimestampedChannel2Configuration))]
+    [XmlInclude(typeof(TimestampedChannel3Configuration))]
+    [XmlInclude(typeof(TimestampedChannelsConfiguration))]
+    [XmlInclude(typeof(TimestampedStagedConfiguration))]
+    [XmlInclude(typeof(TimestampedCommitStagedConfiguration))]
+    [XmlInclude(typeof(TimestampedCommitTriggers))]
+    [XmlInclude(typeof(TimestampedSavePreset))]
+    [XmlInclude(typeof(TimestampedLoadPreset))]
+    [XmlInclude(typeof(TimestampedPresetNames))]
+    [XmlInclude(typeof(TimestampedPresetTriggers))]
+    [XmlInclude(typeof(TimestampedChannel0Train))]
+    [XmlInclude(typeof(TimestampedChannel1Train))]
+    [XmlInclude(typeof(TimestampedChannel2Train))]
+    [XmlInclude(typeof(TimestampedChannel3Train))]
+    [XmlInclude(typeof(TimestampedTrainQueueLevel))]
+    [XmlInclude(typeof(TimestampedTrainQueueLow))]
+    [XmlInclude(typeof(TimestampedProfilingMinLatency))]
+    [XmlInclude(typeof(TimestampedProfilingLatencyHistogram))]
+    [XmlInclude(typeof(TimestampedProfilingMaxSkew))]
+    [XmlInclude(typeof(TimestampedDroppedEvents))]
     [Description("Filters and selects specific messages reported by the MultiPwm device.")]
     public partial class Parse : ParseBuilder, INamedElement
     {
@@ -434,6 +692,49 @@ namespace Harp.MultiPwm
     /// <seealso cref="PwmChannelState"/>
     /// <seealso cref="PwmState"/>
     /// <seealso cref="EnableEvents"/>
+    /// <seealso cref="FrequencyMeterEnable"/>
+    /// <seealso cref="FrequencyMeterWindow"/>
+    /// <seealso cref="TriggerPeriod"/>
+    /// <seealso cref="TriggerFrequency"/>
+    /// <seealso cref="TriggerDutyCycle"/>
+    /// <seealso cref="PwmExternalClockPeriod"/>
+    /// <seealso cref="PwmChainedChannels"/>
+    /// <seealso cref="VirtualTriggerTable"/>
+    /// <seealso cref="VirtualTriggerMask"/>
+    /// <seealso cref="VirtualTriggerMode"/>
+    /// <seealso cref="EventCoalesceWindow"/>
+    /// <seealso cref="PwmStateBatch"/>
+    /// <seealso cref="PwmStatistics"/>
+    /// <seealso cref="PwmStatisticsControl"/>
+    /// <seealso cref="PwmRemainingCount"/>
+    /// <seealso cref="PwmProgressInterval"/>
+    /// <seealso cref="ProfilingInterruptCount"/>
+    /// <seealso cref="ProfilingInterruptMaxCycles"/>
+    /// <seealso cref="ProfilingInterruptMeanCycles"/>
+    /// <seealso cref="ProfilingMaxLatency"/>
+    /// <seealso cref="ProfilingCpuLoad"/>
+    /// <seealso cref="Channel0Configuration"/>
+    /// <seealso cref="Channel1Configuration"/>
+    /// <seealso cref="Channel2Configuration"/>
+    /// <seealso cref="Channel3Configuration"/>
+    /// <seealso cref="ChannelsConfiguration"/>
+    /// <seealso cref="StagedConfiguration"/>
+    /// <seealso cref="CommitStagedConfiguration"/>
+    /// <seealso cref="CommitTriggers"/>
+    /// <seealso cref="SavePreset"/>
+    /// <seealso cref="LoadPreset"/>
+    /// <seealso cref="PresetNames"/>
+    /// <seealso cref="PresetTriggers"/>
+    /// <seealso cref="Channel0Train"/>
+    /// <seealso cref="Channel1Train"/>
+    /// <seealso cref="Channel2Train"/>
+    /// <seealso cref="Channel3Train"/>
+    /// <seealso cref="TrainQueueLevel"/>
+    /// <seealso cref="TrainQueueLow"/>
+    /// <seealso cref="ProfilingMinLatency"/>
+    /// <seealso cref="ProfilingLatencyHistogram"/>
+    /// <seealso cref="ProfilingMaxSkew"/>
+    /// <seealso cref="DroppedEvents"/>
     [XmlInclude(typeof(PwmChannel0Frequency))]
     [XmlInclude(typeof(PwmChannel1Frequency))]
     [XmlInclude(typeof(PwmChannel2Frequency))]
@@ -476,6 +777,49 @@ namespace Harp.MultiPwm
     [XmlInclude(typeof(PwmChannelState))]
     [XmlInclude(typeof(PwmState))]
     [XmlInclude(typeof(EnableEvents))]
+    [XmlInclude(typeof(FrequencyMeterEnable))]
+    [XmlInclude(typeof(FrequencyMeterWindow))]
+    [XmlInclude(typeof(TriggerPeriod))]
+    [XmlInclude(typeof(TriggerFrequency))]
+    [XmlInclude(typeof(TriggerDutyCycle))]
+    [XmlInclude(typeof(PwmExternalClockPeriod))]
+    [XmlInclude(typeof(PwmChainedChannels))]
+    [XmlInclude(typeof(VirtualTriggerTable))]
+    [XmlInclude(typeof(VirtualTriggerMask))]
+    [XmlInclude(typeof(VirtualTriggerMode))]
+    [XmlInclude(typeof(EventCoalesceWindow))]
+    [XmlInclude(typeof(PwmStateBatch))]
+    [XmlInclude(typeof(PwmStatistics))]
+    [XmlInclude(typeof(PwmStatisticsControl))]
+    [XmlInclude(typeof(PwmRemainingCount))]
+    [XmlInclude(typeof(PwmProgressInterval))]
+    [XmlInclude(typeof(ProfilingInterruptCount))]
+    [XmlInclude(typeof(ProfilingInterruptMaxCycles))]
+    [XmlInclude(typeof(ProfilingInterruptMeanCycles))]
+    [XmlInclude(typeof(ProfilingMaxLatency))]
+    [XmlInclude(typeof(ProfilingCpuLoad))]
+    [XmlInclude(typeof(Channel0Configuration))]
+    [XmlInclude(typeof(Channel1Configuration))]
+    [XmlInclude(typeof(Channel2Configuration))]
+    [XmlInclude(typeof(Channel3Configuration))]
+    [XmlInclude(typeof(ChannelsConfiguration))]
+    [XmlInclude(typeof(StagedConfiguration))]
+    [XmlInclude(typeof(CommitStagedConfiguration))]
+    [XmlInclude(typeof(CommitTriggers))]
+    [XmlInclude(typeof(SavePreset))]
+    [XmlInclude(typeof(LoadPreset))]
+    [XmlInclude(typeof(PresetNames))]
+    [XmlInclude(typeof(PresetTriggers))]
+    [XmlInclude(typeof(Channel0Train))]
+    [XmlInclude(typeof(Channel1Train))]
+    [XmlInclude(typeof(Channel2Train))]
+    [XmlInclude(typeof(Channel3Train))]
+    [XmlInclude(typeof(TrainQueueLevel))]
+    [XmlInclude(typeof(TrainQueueLow))]
+    [XmlInclude(typeof(ProfilingMinLatency))]
+    [XmlInclude(typeof(ProfilingLatencyHistogram))]
+    [XmlInclude(typeof(ProfilingMaxSkew))]
+    [XmlInclude(typeof(DroppedEvents))]
     [Description("Formats a sequence of values as specific MultiPwm register messages.")]
     public partial class Format : FormatBuilder, INamedElement
     {
@@ -2411,9 +2755,9 @@ namespace Harp.MultiPwm
     }
 
     /// <summary>
-    /// Represents a register that playback mode of channel 0.
+    /// Represents a register that playback mode and clock source of channel 0.
     /// </summary>
-    [Description("Playback mode of channel 0.")]
+    [Description("Playback mode and clock source of channel 0.")]
     public partial class PwmChannel0PlaybackMode
     {
         /// <summary>
@@ -2431,14 +2775,30 @@ namespace Harp.MultiPwm
         /// </summary>
         public const int RegisterLength = 1;
 
+        static PwmChannel0PlaybackModePayload ParsePayload(byte payload)
+        {
+            PwmChannel0PlaybackModePayload result;
+            result.PlaybackMode = (PlaybackMode)(byte)(payload & 0x1);
+            result.ClockSource = (ClockSource)(byte)((payload & 0x30) >> 4);
+            return result;
+        }
+
+        static byte FormatPayload(PwmChannel0PlaybackModePayload value)
+        {
+            byte result;
+            result = (byte)((byte)value.PlaybackMode & 0x1);
+            result |= (byte)(((byte)value.ClockSource << 4) & 0x30);
+            return result;
+        }
+
         /// <summary>
         /// Returns the payload data for <see cref="PwmChannel0PlaybackMode"/> register messages.
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the message payload.</returns>
-        public static PlaybackMode GetPayload(HarpMessage message)
+        public static PwmChannel0PlaybackModePayload GetPayload(HarpMessage message)
         {
-            return (PlaybackMode)message.GetPayloadByte();
+            return ParsePayload(message.GetPayloadByte());
         }
 
         /// <summary>
@@ -2446,10 +2806,10 @@ namespace Harp.MultiPwm
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
-        public static Timestamped<PlaybackMode> GetTimestampedPayload(HarpMessage message)
+        public static Timestamped<PwmChannel0PlaybackModePayload> GetTimestampedPayload(HarpMessage message)
         {
             var payload = message.GetTimestampedPayloadByte();
-            return Timestamped.Create((PlaybackMode)payload.Value, payload.Seconds);
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
         }
 
         /// <summary>
@@ -2461,9 +2821,9 @@ namespace Harp.MultiPwm
         /// A <see cref="HarpMessage"/> object for the <see cref="PwmChannel0PlaybackMode"/> register
         /// with the specified message type and payload.
         /// </returns>
-        public static HarpMessage FromPayload(MessageType messageType, PlaybackMode value)
+        public static HarpMessage FromPayload(MessageType messageType, PwmChannel0PlaybackModePayload value)
         {
-            return HarpMessage.FromByte(Address, messageType, (byte)value);
+            return HarpMessage.FromByte(Address, messageType, FormatPayload(value));
         }
 
         /// <summary>
@@ -2477,9 +2837,9 @@ namespace Harp.MultiPwm
         /// A <see cref="HarpMessage"/> object for the <see cref="PwmChannel0PlaybackMode"/> register
         /// with the specified message type, timestamp, and payload.
         /// </returns>
-        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PlaybackMode value)
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PwmChannel0PlaybackModePayload value)
         {
-            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+            return HarpMessage.FromByte(Address, timestamp, messageType, FormatPayload(value));
         }
     }
 
@@ -2501,16 +2861,16 @@ namespace Harp.MultiPwm
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
-        public static Timestamped<PlaybackMode> GetPayload(HarpMessage message)
+        public static Timestamped<PwmChannel0PlaybackModePayload> GetPayload(HarpMessage message)
         {
             return PwmChannel0PlaybackMode.GetTimestampedPayload(message);
         }
     }
 
     /// <summary>
-    /// Represents a register that playback mode of channel 1.
+    /// Represents a register that playback mode and clock source of channel 1.
     /// </summary>
-    [Description("Playback mode of channel 1.")]
+    [Description("Playback mode and clock source of channel 1.")]
     public partial class PwmChannel1PlaybackMode
     {
         /// <summary>
@@ -2528,14 +2888,30 @@ namespace Harp.MultiPwm
         /// </summary>
         public const int RegisterLength = 1;
 
+        static PwmChannel1PlaybackModePayload ParsePayload(byte payload)
+        {
+            PwmChannel1PlaybackModePayload result;
+            result.PlaybackMode = (PlaybackMode)(byte)(payload & 0x1);
+            result.ClockSource = (ClockSource)(byte)((payload & 0x30) >> 4);
+            return result;
+        }
+
+        static byte FormatPayload(PwmChannel1PlaybackModePayload value)
+        {
+            byte result;
+            result = (byte)((byte)value.PlaybackMode & 0x1);
+            result |= (byte)(((byte)value.ClockSource << 4) & 0x30);
+            return result;
+        }
+
         /// <summary>
         /// Returns the payload data for <see cref="PwmChannel1PlaybackMode"/> register messages.
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the message payload.</returns>
-        public static PlaybackMode GetPayload(HarpMessage message)
+        public static PwmChannel1PlaybackModePayload GetPayload(HarpMessage message)
         {
-            return (PlaybackMode)message.GetPayloadByte();
+            return ParsePayload(message.GetPayloadByte());
         }
 
         /// <summary>
@@ -2543,10 +2919,10 @@ namespace Harp.MultiPwm
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
-        public static Timestamped<PlaybackMode> GetTimestampedPayload(HarpMessage message)
+        public static Timestamped<PwmChannel1PlaybackModePayload> GetTimestampedPayload(HarpMessage message)
         {
             var payload = message.GetTimestampedPayloadByte();
-            return Timestamped.Create((PlaybackMode)payload.Value, payload.Seconds);
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
         }
 
         /// <summary>
@@ -2558,9 +2934,9 @@ namespace Harp.MultiPwm
         /// A <see cref="HarpMessage"/> object for the <see cref="PwmChannel1PlaybackMode"/> register
         /// with the specified message type and payload.
         /// </returns>
-        public static HarpMessage FromPayload(MessageType messageType, PlaybackMode value)
+        public static HarpMessage FromPayload(MessageType messageType, PwmChannel1PlaybackModePayload value)
         {
-            return HarpMessage.FromByte(Address, messageType, (byte)value);
+            return HarpMessage.FromByte(Address, messageType, FormatPayload(value));
         }
 
         /// <summary>
@@ -2574,9 +2950,9 @@ namespace Harp.MultiPwm
         /// A <see cref="HarpMessage"/> object for the <see cref="PwmChannel1PlaybackMode"/> register
         /// with the specified message type, timestamp, and payload.
         /// </returns>
-        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PlaybackMode value)
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PwmChannel1PlaybackModePayload value)
         {
-            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+            return HarpMessage.FromByte(Address, timestamp, messageType, FormatPayload(value));
         }
     }
 
@@ -2598,16 +2974,16 @@ namespace Harp.MultiPwm
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
-        public static Timestamped<PlaybackMode> GetPayload(HarpMessage message)
+        public static Timestamped<PwmChannel1PlaybackModePayload> GetPayload(HarpMessage message)
         {
             return PwmChannel1PlaybackMode.GetTimestampedPayload(message);
         }
     }
 
     /// <summary>
-    /// Represents a register that playback mode of channel 2.
+    /// Represents a register that playback mode and clock source of channel 2.
     /// </summary>
-    [Description("Playback mode of channel 2.")]
+    [Description("Playback mode and clock source of channel 2.")]
     public partial class PwmChannel2PlaybackMode
     {
         /// <summary>
@@ -2625,14 +3001,30 @@ namespace Harp.MultiPwm
         /// </summary>
         public const int RegisterLength = 1;
 
+        static PwmChannel2PlaybackModePayload ParsePayload(byte payload)
+        {
+            PwmChannel2PlaybackModePayload result;
+            result.PlaybackMode = (PlaybackMode)(byte)(payload & 0x1);
+            result.ClockSource = (ClockSource)(byte)((payload & 0x30) >> 4);
+            return result;
+        }
+
+        static byte FormatPayload(PwmChannel2PlaybackModePayload value)
+        {
+            byte result;
+            result = (byte)((byte)value.PlaybackMode & 0x1);
+            result |= (byte)(((byte)value.ClockSource << 4) & 0x30);
+            return result;
+        }
+
         /// <summary>
         /// Returns the payload data for <see cref="PwmChannel2PlaybackMode"/> register messages.
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the message payload.</returns>
-        public static PlaybackMode GetPayload(HarpMessage message)
+        public static PwmChannel2PlaybackModePayload GetPayload(HarpMessage message)
         {
-            return (PlaybackMode)message.GetPayloadByte();
+            return ParsePayload(message.GetPayloadByte());
         }
 
         /// <summary>
@@ -2640,10 +3032,10 @@ namespace Harp.MultiPwm
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
-        public static Timestamped<PlaybackMode> GetTimestampedPayload(HarpMessage message)
+        public static Timestamped<PwmChannel2PlaybackModePayload> GetTimestampedPayload(HarpMessage message)
         {
             var payload = message.GetTimestampedPayloadByte();
-            return Timestamped.Create((PlaybackMode)payload.Value, payload.Seconds);
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
         }
 
         /// <summary>
@@ -2655,9 +3047,9 @@ namespace Harp.MultiPwm
         /// A <see cref="HarpMessage"/> object for the <see cref="PwmChannel2PlaybackMode"/> register
         /// with the specified message type and payload.
         /// </returns>
-        public static HarpMessage FromPayload(MessageType messageType, PlaybackMode value)
+        public static HarpMessage FromPayload(MessageType messageType, PwmChannel2PlaybackModePayload value)
         {
-            return HarpMessage.FromByte(Address, messageType, (byte)value);
+            return HarpMessage.FromByte(Address, messageType, FormatPayload(value));
         }
 
         /// <summary>
@@ -2671,9 +3063,9 @@ namespace Harp.MultiPwm
         /// A <see cref="HarpMessage"/> object for the <see cref="PwmChannel2PlaybackMode"/> register
         /// with the specified message type, timestamp, and payload.
         /// </returns>
-        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PlaybackMode value)
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PwmChannel2PlaybackModePayload value)
         {
-            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+            return HarpMessage.FromByte(Address, timestamp, messageType, FormatPayload(value));
         }
     }
 
@@ -2695,16 +3087,16 @@ namespace Harp.MultiPwm
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
-        public static Timestamped<PlaybackMode> GetPayload(HarpMessage message)
+        public static Timestamped<PwmChannel2PlaybackModePayload> GetPayload(HarpMessage message)
         {
             return PwmChannel2PlaybackMode.GetTimestampedPayload(message);
         }
     }
 
     /// <summary>
-    /// Represents a register that playback mode of channel 3.
+    /// Represents a register that playback mode and clock source of channel 3.
     /// </summary>
-    [Description("Playback mode of channel 3.")]
+    [Description("Playback mode and clock source of channel 3.")]
     public partial class PwmChannel3PlaybackMode
     {
         /// <summary>
@@ -2722,14 +3114,30 @@ namespace Harp.MultiPwm
         /// </summary>
         public const int RegisterLength = 1;
 
+        static PwmChannel3PlaybackModePayload ParsePayload(byte payload)
+        {
+            PwmChannel3PlaybackModePayload result;
+            result.PlaybackMode = (PlaybackMode)(byte)(payload & 0x1);
+            result.ClockSource = (ClockSource)(byte)((payload & 0x30) >> 4);
+            return result;
+        }
+
+        static byte FormatPayload(PwmChannel3PlaybackModePayload value)
+        {
+            byte result;
+            result = (byte)((byte)value.PlaybackMode & 0x1);
+            result |= (byte)(((byte)value.ClockSource << 4) & 0x30);
+            return result;
+        }
+
         /// <summary>
         /// Returns the payload data for <see cref="PwmChannel3PlaybackMode"/> register messages.
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the message payload.</returns>
-        public static PlaybackMode GetPayload(HarpMessage message)
+        public static PwmChannel3PlaybackModePayload GetPayload(HarpMessage message)
         {
-            return (PlaybackMode)message.GetPayloadByte();
+            return ParsePayload(message.GetPayloadByte());
         }
 
         /// <summary>
@@ -2737,10 +3145,10 @@ namespace Harp.MultiPwm
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
-        public static Timestamped<PlaybackMode> GetTimestampedPayload(HarpMessage message)
+        public static Timestamped<PwmChannel3PlaybackModePayload> GetTimestampedPayload(HarpMessage message)
         {
             var payload = message.GetTimestampedPayloadByte();
-            return Timestamped.Create((PlaybackMode)payload.Value, payload.Seconds);
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
         }
 
         /// <summary>
@@ -2752,9 +3160,9 @@ namespace Harp.MultiPwm
         /// A <see cref="HarpMessage"/> object for the <see cref="PwmChannel3PlaybackMode"/> register
         /// with the specified message type and payload.
         /// </returns>
-        public static HarpMessage FromPayload(MessageType messageType, PlaybackMode value)
+        public static HarpMessage FromPayload(MessageType messageType, PwmChannel3PlaybackModePayload value)
         {
-            return HarpMessage.FromByte(Address, messageType, (byte)value);
+            return HarpMessage.FromByte(Address, messageType, FormatPayload(value));
         }
 
         /// <summary>
@@ -2768,9 +3176,9 @@ namespace Harp.MultiPwm
         /// A <see cref="HarpMessage"/> object for the <see cref="PwmChannel3PlaybackMode"/> register
         /// with the specified message type, timestamp, and payload.
         /// </returns>
-        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PlaybackMode value)
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PwmChannel3PlaybackModePayload value)
         {
-            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+            return HarpMessage.FromByte(Address, timestamp, messageType, FormatPayload(value));
         }
     }
 
@@ -2792,7 +3200,7 @@ namespace Harp.MultiPwm
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
-        public static Timestamped<PlaybackMode> GetPayload(HarpMessage message)
+        public static Timestamped<PwmChannel3PlaybackModePayload> GetPayload(HarpMessage message)
         {
             return PwmChannel3PlaybackMode.GetTimestampedPayload(message);
         }
@@ -3524,7 +3932,7 @@ namespace Harp.MultiPwm
         {
             Trigger0ModePayload result;
             result.TriggerMode = (TriggerModeConfig)(byte)(payload & 0x3);
-            result.Polarity = (TriggerPolarity)(byte)((payload & 0x10) >> 4);
+            result.Polarity = (TriggerPolarity)(byte)((payload & 0x8) >> 3);
             return result;
         }
 
@@ -3532,7 +3940,7 @@ namespace Harp.MultiPwm
         {
             byte result;
             result = (byte)((byte)value.TriggerMode & 0x3);
-            result |= (byte)(((byte)value.Polarity << 4) & 0x10);
+            result |= (byte)(((byte)value.Polarity << 3) & 0x8);
             return result;
         }
 
@@ -3637,7 +4045,7 @@ namespace Harp.MultiPwm
         {
             Trigger1ModePayload result;
             result.TriggerMode = (TriggerModeConfig)(byte)(payload & 0x3);
-            result.Polarity = (TriggerPolarity)(byte)((payload & 0x10) >> 4);
+            result.Polarity = (TriggerPolarity)(byte)((payload & 0x8) >> 3);
             return result;
         }
 
@@ -3645,7 +4053,7 @@ namespace Harp.MultiPwm
         {
             byte result;
             result = (byte)((byte)value.TriggerMode & 0x3);
-            result |= (byte)(((byte)value.Polarity << 4) & 0x10);
+            result |= (byte)(((byte)value.Polarity << 3) & 0x8);
             return result;
         }
 
@@ -3750,7 +4158,7 @@ namespace Harp.MultiPwm
         {
             Trigger2ModePayload result;
             result.TriggerMode = (TriggerModeConfig)(byte)(payload & 0x3);
-            result.Polarity = (TriggerPolarity)(byte)((payload & 0x10) >> 4);
+            result.Polarity = (TriggerPolarity)(byte)((payload & 0x8) >> 3);
             return result;
         }
 
@@ -3758,7 +4166,7 @@ namespace Harp.MultiPwm
         {
             byte result;
             result = (byte)((byte)value.TriggerMode & 0x3);
-            result |= (byte)(((byte)value.Polarity << 4) & 0x10);
+            result |= (byte)(((byte)value.Polarity << 3) & 0x8);
             return result;
         }
 
@@ -3863,7 +4271,7 @@ namespace Harp.MultiPwm
         {
             Trigger3ModePayload result;
             result.TriggerMode = (TriggerModeConfig)(byte)(payload & 0x3);
-            result.Polarity = (TriggerPolarity)(byte)((payload & 0x10) >> 4);
+            result.Polarity = (TriggerPolarity)(byte)((payload & 0x8) >> 3);
             return result;
         }
 
@@ -3871,7 +4279,7 @@ namespace Harp.MultiPwm
         {
             byte result;
             result = (byte)((byte)value.TriggerMode & 0x3);
-            result |= (byte)(((byte)value.Polarity << 4) & 0x10);
+            result |= (byte)(((byte)value.Polarity << 3) & 0x8);
             return result;
         }
 
@@ -4170,7 +4578,7 @@ namespace Harp.MultiPwm
         {
             TriggerAllModePayload result;
             result.TriggerMode = (TriggerAllModeConfig)(byte)(payload & 0x3);
-            result.Polarity = (TriggerPolarity)(byte)((payload & 0x10) >> 4);
+            result.Polarity = (TriggerPolarity)(byte)((payload & 0x8) >> 3);
             return result;
         }
 
@@ -4178,7 +4586,7 @@ namespace Harp.MultiPwm
         {
             byte result;
             result = (byte)((byte)value.TriggerMode & 0x3);
-            result |= (byte)(((byte)value.Polarity << 4) & 0x10);
+            result |= (byte)(((byte)value.Polarity << 3) & 0x8);
             return result;
         }
 
@@ -4647,2467 +5055,9293 @@ namespace Harp.MultiPwm
     }
 
     /// <summary>
-    /// Represents an operator which creates standard message payloads for the
-    /// MultiPwm device.
+    /// Represents a register that enables the hardware frequency meter on the specified trigger inputs. Only trigger inputs 0 and 1 can be measured.
     /// </summary>
-    /// <seealso cref="CreatePwmChannel0FrequencyPayload"/>
-    /// <seealso cref="CreatePwmChannel1FrequencyPayload"/>
-    /// <seealso cref="CreatePwmChannel2FrequencyPayload"/>
-    /// <seealso cref="CreatePwmChannel3FrequencyPayload"/>
-    /// <seealso cref="CreatePwmChannel0DutyCyclePayload"/>
-    /// <seealso cref="CreatePwmChannel1DutyCyclePayload"/>
-    /// <seealso cref="CreatePwmChannel2DutyCyclePayload"/>
-    /// <seealso cref="CreatePwmChannel3DutyCyclePayload"/>
-    /// <seealso cref="CreatePwmChannel0PulseCountPayload"/>
-    /// <seealso cref="CreatePwmChannel1PulseCountPayload"/>
-    /// <seealso cref="CreatePwmChannel2PulseCountPayload"/>
-    /// <seealso cref="CreatePwmChannel3PulseCountPayload"/>
-    /// <seealso cref="CreatePwmChannel0RealFrequencyPayload"/>
-    /// <seealso cref="CreatePwmChannel1RealFrequencyPayload"/>
-    /// <seealso cref="CreatePwmChannel2RealFrequencyPayload"/>
-    /// <seealso cref="CreatePwmChannel3RealFrequencyPayload"/>
-    /// <seealso cref="CreatePwmChannel0RealDutyCyclePayload"/>
-    /// <seealso cref="CreatePwmChannel1RealDutyCyclePayload"/>
-    /// <seealso cref="CreatePwmChannel2RealDutyCyclePayload"/>
-    /// <seealso cref="CreatePwmChannel3RealDutyCyclePayload"/>
-    /// <seealso cref="CreatePwmChannel0PlaybackModePayload"/>
-    /// <seealso cref="CreatePwmChannel1PlaybackModePayload"/>
-    /// <seealso cref="CreatePwmChannel2PlaybackModePayload"/>
-    /// <seealso cref="CreatePwmChannel3PlaybackModePayload"/>
-    /// <seealso cref="CreateTrigger0TargetsPayload"/>
-    /// <seealso cref="CreateTrigger1TargetsPayload"/>
-    /// <seealso cref="CreateTrigger2TargetsPayload"/>
-    /// <seealso cref="CreateTrigger3TargetsPayload"/>
-    /// <seealso cref="CreateStartSoftwareTriggerPayload"/>
-    /// <seealso cref="CreateStopSoftwareTriggerPayload"/>
-    /// <seealso cref="CreateArmPwmChannelsPayload"/>
-    /// <seealso cref="CreateTrigger0ModePayload"/>
-    /// <seealso cref="CreateTrigger1ModePayload"/>
-    /// <seealso cref="CreateTrigger2ModePayload"/>
-    /// <seealso cref="CreateTrigger3ModePayload"/>
-    /// <seealso cref="CreateRequestEnablePayload"/>
-    /// <seealso cref="CreateEnablePwmChannelsPayload"/>
-    /// <seealso cref="CreateTriggerAllModePayload"/>
-    /// <seealso cref="CreateTriggerChannelStatePayload"/>
-    /// <seealso cref="CreatePwmChannelStatePayload"/>
-    /// <seealso cref="CreatePwmStatePayload"/>
-    /// <seealso cref="CreateEnableEventsPayload"/>
-    [XmlInclude(typeof(CreatePwmChannel0FrequencyPayload))]
-    [XmlInclude(typeof(CreatePwmChannel1FrequencyPayload))]
-    [XmlInclude(typeof(CreatePwmChannel2FrequencyPayload))]
-    [XmlInclude(typeof(CreatePwmChannel3FrequencyPayload))]
-    [XmlInclude(typeof(CreatePwmChannel0DutyCyclePayload))]
-    [XmlInclude(typeof(CreatePwmChannel1DutyCyclePayload))]
-    [XmlInclude(typeof(CreatePwmChannel2DutyCyclePayload))]
-    [XmlInclude(typeof(CreatePwmChannel3DutyCyclePayload))]
-    [XmlInclude(typeof(CreatePwmChannel0PulseCountPayload))]
-    [XmlInclude(typeof(CreatePwmChannel1PulseCountPayload))]
-    [XmlInclude(typeof(CreatePwmChannel2PulseCountPayload))]
-    [XmlInclude(typeof(CreatePwmChannel3PulseCountPayload))]
-    [XmlInclude(typeof(CreatePwmChannel0RealFrequencyPayload))]
-    [XmlInclude(typeof(CreatePwmChannel1RealFrequencyPayload))]
-    [XmlInclude(typeof(CreatePwmChannel2RealFrequencyPayload))]
-    [XmlInclude(typeof(CreatePwmChannel3RealFrequencyPayload))]
-    [XmlInclude(typeof(CreatePwmChannel0RealDutyCyclePayload))]
-    [XmlInclude(typeof(CreatePwmChannel1RealDutyCyclePayload))]
-    [XmlInclude(typeof(CreatePwmChannel2RealDutyCyclePayload))]
-    [XmlInclude(typeof(CreatePwmChannel3RealDutyCyclePayload))]
-    [XmlInclude(typeof(CreatePwmChannel0PlaybackModePayload))]
-    [XmlInclude(typeof(CreatePwmChannel1PlaybackModePayload))]
-    [XmlInclude(typeof(CreatePwmChannel2PlaybackModePayload))]
-    [XmlInclude(typeof(CreatePwmChannel3PlaybackModePayload))]
-    [XmlInclude(typeof(CreateTrigger0TargetsPayload))]
-    [XmlInclude(typeof(CreateTrigger1TargetsPayload))]
-    [XmlInclude(typeof(CreateTrigger2TargetsPayload))]
-    [XmlInclude(typeof(CreateTrigger3TargetsPayload))]
-    [XmlInclude(typeof(CreateStartSoftwareTriggerPayload))]
-    [XmlInclude(typeof(CreateStopSoftwareTriggerPayload))]
-    [XmlInclude(typeof(CreateArmPwmChannelsPayload))]
-    [XmlInclude(typeof(CreateTrigger0ModePayload))]
-    [XmlInclude(typeof(CreateTrigger1ModePayload))]
-    [XmlInclude(typeof(CreateTrigger2ModePayload))]
-    [XmlInclude(typeof(CreateTrigger3ModePayload))]
-    [XmlInclude(typeof(CreateRequestEnablePayload))]
-    [XmlInclude(typeof(CreateEnablePwmChannelsPayload))]
-    [XmlInclude(typeof(CreateTriggerAllModePayload))]
-    [XmlInclude(typeof(CreateTriggerChannelStatePayload))]
-    [XmlInclude(typeof(CreatePwmChannelStatePayload))]
-    [XmlInclude(typeof(CreatePwmStatePayload))]
-    [XmlInclude(typeof(CreateEnableEventsPayload))]
-    [XmlInclude(typeof(CreateTimestampedPwmChannel0FrequencyPayload))]
-    [XmlInclude(typeof(CreateTimestampedPwmChannel1FrequencyPayload))]
-    [XmlInclude(typeof(CreateTimestampedPwmChannel2FrequencyPayload))]
-    [XmlInclude(typeof(CreateTimestampedPwmChannel3FrequencyPayload))]
-    [XmlInclude(typeof(CreateTimestampedPwmChannel0DutyCyclePayload))]
-    [XmlInclude(typeof(CreateTimestampedPwmChannel1DutyCyclePayload))]
-    [XmlInclude(typeof(CreateTimestampedPwmChannel2DutyCyclePayload))]
-    [XmlInclude(typeof(CreateTimestampedPwmChannel3DutyCyclePayload))]
-    [XmlInclude(typeof(CreateTimestampedPwmChannel0PulseCountPayload))]
-    [XmlInclude(typeof(CreateTimestampedPwmChannel1PulseCountPayload))]
-    [XmlInclude(typeof(CreateTimestampedPwmChannel2PulseCountPayload))]
-    [XmlInclude(typeof(CreateTimestampedPwmChannel3PulseCountPayload))]
-    [XmlInclude(typeof(CreateTimestampedPwmChannel0RealFrequencyPayload))]
-    [XmlInclude(typeof(CreateTimestampedPwmChannel1RealFrequencyPayload))]
-    [XmlInclude(typeof(CreateTimestampedPwmChannel2RealFrequencyPayload))]
-    [XmlInclude(typeof(CreateTimestampedPwmChannel3RealFrequencyPayload))]
-    [XmlInclude(typeof(CreateTimestampedPwmChannel0RealDutyCyclePayload))]
-    [XmlInclude(typeof(CreateTimestampedPwmChannel1RealDutyCyclePayload))]
-    [XmlInclude(typeof(CreateTimestampedPwmChannel2RealDutyCyclePayload))]
-    [XmlInclude(typeof(CreateTimestampedPwmChannel3RealDutyCyclePayload))]
-    [XmlInclude(typeof(CreateTimestampedPwmChannel0PlaybackModePayload))]
-    [XmlInclude(typeof(CreateTimestampedPwmChannel1PlaybackModePayload))]
-    [XmlInclude(typeof(CreateTimestampedPwmChannel2PlaybackModePayload))]
-    [XmlInclude(typeof(CreateTimestampedPwmChannel3PlaybackModePayload))]
-    [XmlInclude(typeof(CreateTimestampedTrigger0TargetsPayload))]
-    [XmlInclude(typeof(CreateTimestampedTrigger1TargetsPayload))]
-    [XmlInclude(typeof(CreateTimestampedTrigger2TargetsPayload))]
-    [XmlInclude(typeof(CreateTimestampedTrigger3TargetsPayload))]
-    [XmlInclude(typeof(CreateTimestampedStartSoftwareTriggerPayload))]
-    [XmlInclude(typeof(CreateTimestampedStopSoftwareTriggerPayload))]
-    [XmlInclude(typeof(CreateTimestampedArmPwmChannelsPayload))]
-    [XmlInclude(typeof(CreateTimestampedTrigger0ModePayload))]
-    [XmlInclude(typeof(CreateTimestampedTrigger1ModePayload))]
-    [XmlInclude(typeof(CreateTimestampedTrigger2ModePayload))]
-    [XmlInclude(typeof(CreateTimestampedTrigger3ModePayload))]
-    [XmlInclude(typeof(CreateTimestampedRequestEnablePayload))]
-    [XmlInclude(typeof(CreateTimestampedEnablePwmChannelsPayload))]
-    [XmlInclude(typeof(CreateTimestampedTriggerAllModePayload))]
-    [XmlInclude(typeof(CreateTimestampedTriggerChannelStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedPwmChannelStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedPwmStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedEnableEventsPayload))]
-    [Description("Creates standard message payloads for the MultiPwm device.")]
-    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    [Description("Enables the hardware frequency meter on the specified trigger inputs. Only trigger inputs 0 and 1 can be measured.")]
+    public partial class FrequencyMeterEnable
     {
         /// <summary>
-        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// Represents the address of the <see cref="FrequencyMeterEnable"/> register. This field is constant.
         /// </summary>
-        public CreateMessage()
+        public const int Address = 75;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="FrequencyMeterEnable"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="FrequencyMeterEnable"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="FrequencyMeterEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static FrequencyMeterInputs GetPayload(HarpMessage message)
         {
-            Payload = new CreatePwmChannel0FrequencyPayload();
+            return (FrequencyMeterInputs)message.GetPayloadByte();
         }
 
-        string INamedElement.Name => $"{nameof(MultiPwm)}.{GetElementDisplayName(Payload)}";
-    }
-
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that frequency (Hz) of PWM pulses in channel 0.
-    /// </summary>
-    [DisplayName("PwmChannel0FrequencyPayload")]
-    [Description("Creates a message payload that frequency (Hz) of PWM pulses in channel 0.")]
-    public partial class CreatePwmChannel0FrequencyPayload
-    {
         /// <summary>
-        /// Gets or sets the value that frequency (Hz) of PWM pulses in channel 0.
+        /// Returns the timestamped payload data for <see cref="FrequencyMeterEnable"/> register messages.
         /// </summary>
-        [Description("The value that frequency (Hz) of PWM pulses in channel 0.")]
-        public float PwmChannel0Frequency { get; set; }
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<FrequencyMeterInputs> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((FrequencyMeterInputs)payload.Value, payload.Seconds);
+        }
 
         /// <summary>
-        /// Creates a message payload for the PwmChannel0Frequency register.
+        /// Returns a Harp message for the <see cref="FrequencyMeterEnable"/> register.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FrequencyMeterEnable"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, FrequencyMeterInputs value)
         {
-            return PwmChannel0Frequency;
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
         }
 
         /// <summary>
-        /// Creates a message that frequency (Hz) of PWM pulses in channel 0.
+        /// Returns a timestamped Harp message for the <see cref="FrequencyMeterEnable"/>
+        /// register.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PwmChannel0Frequency register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FrequencyMeterEnable"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, FrequencyMeterInputs value)
         {
-            return Harp.MultiPwm.PwmChannel0Frequency.FromPayload(messageType, GetPayload());
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that frequency (Hz) of PWM pulses in channel 0.
+    /// Provides methods for manipulating timestamped messages from the
+    /// FrequencyMeterEnable register.
     /// </summary>
-    [DisplayName("TimestampedPwmChannel0FrequencyPayload")]
-    [Description("Creates a timestamped message payload that frequency (Hz) of PWM pulses in channel 0.")]
-    public partial class CreateTimestampedPwmChannel0FrequencyPayload : CreatePwmChannel0FrequencyPayload
+    /// <seealso cref="FrequencyMeterEnable"/>
+    [Description("Filters and selects timestamped messages from the FrequencyMeterEnable register.")]
+    public partial class TimestampedFrequencyMeterEnable
     {
         /// <summary>
-        /// Creates a timestamped message that frequency (Hz) of PWM pulses in channel 0.
+        /// Represents the address of the <see cref="FrequencyMeterEnable"/> register. This field is constant.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        public const int Address = FrequencyMeterEnable.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="FrequencyMeterEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<FrequencyMeterInputs> GetPayload(HarpMessage message)
+        {
+            return FrequencyMeterEnable.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of measured periods averaged before the frequency meter registers are updated.
+    /// </summary>
+    [Description("Number of measured periods averaged before the frequency meter registers are updated.")]
+    public partial class FrequencyMeterWindow
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FrequencyMeterWindow"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 76;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="FrequencyMeterWindow"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="FrequencyMeterWindow"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="FrequencyMeterWindow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="FrequencyMeterWindow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="FrequencyMeterWindow"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FrequencyMeterWindow"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="FrequencyMeterWindow"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FrequencyMeterWindow"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// FrequencyMeterWindow register.
+    /// </summary>
+    /// <seealso cref="FrequencyMeterWindow"/>
+    [Description("Filters and selects timestamped messages from the FrequencyMeterWindow register.")]
+    public partial class TimestampedFrequencyMeterWindow
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FrequencyMeterWindow"/> register. This field is constant.
+        /// </summary>
+        public const int Address = FrequencyMeterWindow.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="FrequencyMeterWindow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return FrequencyMeterWindow.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that measured period (ns) of the signal on trigger inputs 0 and 1. Zero if no signal is detected.
+    /// </summary>
+    [Description("Measured period (ns) of the signal on trigger inputs 0 and 1. Zero if no signal is detected.")]
+    public partial class TriggerPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TriggerPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 77;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TriggerPeriod"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TriggerPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TriggerPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TriggerPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TriggerPeriod"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TriggerPeriod"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TriggerPeriod"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TriggerPeriod"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TriggerPeriod register.
+    /// </summary>
+    /// <seealso cref="TriggerPeriod"/>
+    [Description("Filters and selects timestamped messages from the TriggerPeriod register.")]
+    public partial class TimestampedTriggerPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TriggerPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TriggerPeriod.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TriggerPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return TriggerPeriod.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that measured frequency (Hz) of the signal on trigger inputs 0 and 1. Emits an event each time a measurement window completes.
+    /// </summary>
+    [Description("Measured frequency (Hz) of the signal on trigger inputs 0 and 1. Emits an event each time a measurement window completes.")]
+    public partial class TriggerFrequency
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TriggerFrequency"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 78;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TriggerFrequency"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.Float;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TriggerFrequency"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TriggerFrequency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static float[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TriggerFrequency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TriggerFrequency"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TriggerFrequency"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TriggerFrequency"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TriggerFrequency"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TriggerFrequency register.
+    /// </summary>
+    /// <seealso cref="TriggerFrequency"/>
+    [Description("Filters and selects timestamped messages from the TriggerFrequency register.")]
+    public partial class TimestampedTriggerFrequency
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TriggerFrequency"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TriggerFrequency.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TriggerFrequency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetPayload(HarpMessage message)
+        {
+            return TriggerFrequency.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that measured duty cycle (0-100) of the signal on trigger inputs 0 and 1.
+    /// </summary>
+    [Description("Measured duty cycle (0-100) of the signal on trigger inputs 0 and 1.")]
+    public partial class TriggerDutyCycle
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TriggerDutyCycle"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 79;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TriggerDutyCycle"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.Float;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TriggerDutyCycle"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TriggerDutyCycle"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static float[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TriggerDutyCycle"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TriggerDutyCycle"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TriggerDutyCycle"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TriggerDutyCycle"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TriggerDutyCycle"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TriggerDutyCycle register.
+    /// </summary>
+    /// <seealso cref="TriggerDutyCycle"/>
+    [Description("Filters and selects timestamped messages from the TriggerDutyCycle register.")]
+    public partial class TimestampedTriggerDutyCycle
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TriggerDutyCycle"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TriggerDutyCycle.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TriggerDutyCycle"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetPayload(HarpMessage message)
+        {
+            return TriggerDutyCycle.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that period, in external clock cycles, of the channels clocked by a trigger input. When in use, the real frequency register reports the negative of this value.
+    /// </summary>
+    [Description("Period, in external clock cycles, of the channels clocked by a trigger input. When in use, the real frequency register reports the negative of this value.")]
+    public partial class PwmExternalClockPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PwmExternalClockPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 80;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PwmExternalClockPeriod"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PwmExternalClockPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PwmExternalClockPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PwmExternalClockPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PwmExternalClockPeriod"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PwmExternalClockPeriod"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PwmExternalClockPeriod"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PwmExternalClockPeriod"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PwmExternalClockPeriod register.
+    /// </summary>
+    /// <seealso cref="PwmExternalClockPeriod"/>
+    [Description("Filters and selects timestamped messages from the PwmExternalClockPeriod register.")]
+    public partial class TimestampedPwmExternalClockPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PwmExternalClockPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PwmExternalClockPeriod.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PwmExternalClockPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return PwmExternalClockPeriod.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that for each channel, the channels started as soon as it completes its pulse train in Count mode. Only the bits of the PwmChannels mask are valid.
+    /// </summary>
+    [Description("For each channel, the channels started as soon as it completes its pulse train in Count mode. Only the bits of the PwmChannels mask are valid.")]
+    public partial class PwmChainedChannels
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PwmChainedChannels"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 81;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PwmChainedChannels"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PwmChainedChannels"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PwmChainedChannels"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PwmChainedChannels"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PwmChainedChannels"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PwmChainedChannels"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PwmChainedChannels"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PwmChainedChannels"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PwmChainedChannels register.
+    /// </summary>
+    /// <seealso cref="PwmChainedChannels"/>
+    [Description("Filters and selects timestamped messages from the PwmChainedChannels register.")]
+    public partial class TimestampedPwmChainedChannels
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PwmChainedChannels"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PwmChainedChannels.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PwmChainedChannels"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return PwmChainedChannels.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that truth table of each virtual trigger. Bit n is set when the virtual trigger is active for the input levels n, where bit 0 of n is TRIG_IN0, bit 3 is TRIG_IN3 and bit 4 is TRIG_ALL. Evaluated on every edge of the trigger inputs used as interrupts.
+    /// </summary>
+    [Description("Truth table of each virtual trigger. Bit n is set when the virtual trigger is active for the input levels n, where bit 0 of n is TRIG_IN0, bit 3 is TRIG_IN3 and bit 4 is TRIG_ALL. Evaluated on every edge of the trigger inputs used as interrupts.")]
+    public partial class VirtualTriggerTable
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="VirtualTriggerTable"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 82;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="VirtualTriggerTable"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="VirtualTriggerTable"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="VirtualTriggerTable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="VirtualTriggerTable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="VirtualTriggerTable"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="VirtualTriggerTable"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="VirtualTriggerTable"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="VirtualTriggerTable"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// VirtualTriggerTable register.
+    /// </summary>
+    /// <seealso cref="VirtualTriggerTable"/>
+    [Description("Filters and selects timestamped messages from the VirtualTriggerTable register.")]
+    public partial class TimestampedVirtualTriggerTable
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="VirtualTriggerTable"/> register. This field is constant.
+        /// </summary>
+        public const int Address = VirtualTriggerTable.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="VirtualTriggerTable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return VirtualTriggerTable.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that channels affected by each virtual trigger. Only the bits of the PwmChannels mask are valid.
+    /// </summary>
+    [Description("Channels affected by each virtual trigger. Only the bits of the PwmChannels mask are valid.")]
+    public partial class VirtualTriggerMask
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="VirtualTriggerMask"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 83;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="VirtualTriggerMask"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="VirtualTriggerMask"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="VirtualTriggerMask"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="VirtualTriggerMask"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="VirtualTriggerMask"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="VirtualTriggerMask"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="VirtualTriggerMask"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="VirtualTriggerMask"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// VirtualTriggerMask register.
+    /// </summary>
+    /// <seealso cref="VirtualTriggerMask"/>
+    [Description("Filters and selects timestamped messages from the VirtualTriggerMask register.")]
+    public partial class TimestampedVirtualTriggerMask
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="VirtualTriggerMask"/> register. This field is constant.
+        /// </summary>
+        public const int Address = VirtualTriggerMask.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="VirtualTriggerMask"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return VirtualTriggerMask.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that mode of each virtual trigger. Uses the values of TriggerModeConfig.
+    /// </summary>
+    [Description("Mode of each virtual trigger. Uses the values of TriggerModeConfig.")]
+    public partial class VirtualTriggerMode
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="VirtualTriggerMode"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 84;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="VirtualTriggerMode"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="VirtualTriggerMode"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="VirtualTriggerMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="VirtualTriggerMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="VirtualTriggerMode"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="VirtualTriggerMode"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="VirtualTriggerMode"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="VirtualTriggerMode"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// VirtualTriggerMode register.
+    /// </summary>
+    /// <seealso cref="VirtualTriggerMode"/>
+    [Description("Filters and selects timestamped messages from the VirtualTriggerMode register.")]
+    public partial class TimestampedVirtualTriggerMode
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="VirtualTriggerMode"/> register. This field is constant.
+        /// </summary>
+        public const int Address = VirtualTriggerMode.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="VirtualTriggerMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return VirtualTriggerMode.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that window, in microseconds, used to merge the changes of PwmState into a single PwmStateBatch event. The window starts at the first change, has a resolution of 500 us and is at most 50 ms. Zero disables the merging and PwmState events are sent instead.
+    /// </summary>
+    [Description("Window, in microseconds, used to merge the changes of PwmState into a single PwmStateBatch event. The window starts at the first change, has a resolution of 500 us and is at most 50 ms. Zero disables the merging and PwmState events are sent instead.")]
+    public partial class EventCoalesceWindow
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EventCoalesceWindow"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 85;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EventCoalesceWindow"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EventCoalesceWindow"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EventCoalesceWindow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EventCoalesceWindow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EventCoalesceWindow"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EventCoalesceWindow"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EventCoalesceWindow"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EventCoalesceWindow"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EventCoalesceWindow register.
+    /// </summary>
+    /// <seealso cref="EventCoalesceWindow"/>
+    [Description("Filters and selects timestamped messages from the EventCoalesceWindow register.")]
+    public partial class TimestampedEventCoalesceWindow
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EventCoalesceWindow"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EventCoalesceWindow.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EventCoalesceWindow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return EventCoalesceWindow.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that changes of PwmState merged over EventCoalesceWindow. Holds the state of the channels at the end of the window, the channels that started and the channels that stopped. The event carries the timestamp of the first change.
+    /// </summary>
+    [Description("Changes of PwmState merged over EventCoalesceWindow. Holds the state of the channels at the end of the window, the channels that started and the channels that stopped. The event carries the timestamp of the first change.")]
+    public partial class PwmStateBatch
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PwmStateBatch"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 86;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PwmStateBatch"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PwmStateBatch"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 3;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PwmStateBatch"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PwmStateBatch"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PwmStateBatch"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PwmStateBatch"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PwmStateBatch"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PwmStateBatch"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PwmStateBatch register.
+    /// </summary>
+    /// <seealso cref="PwmStateBatch"/>
+    [Description("Filters and selects timestamped messages from the PwmStateBatch register.")]
+    public partial class TimestampedPwmStateBatch
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PwmStateBatch"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PwmStateBatch.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PwmStateBatch"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return PwmStateBatch.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that five counters for each channel, channel 0 first. Pulses emitted, trains completed, accepted starts, starts ignored because the channel was running and starts ignored because the channel was disabled. Writing any value clears all counters.
+    /// </summary>
+    [Description("Five counters for each channel, channel 0 first. Pulses emitted, trains completed, accepted starts, starts ignored because the channel was running and starts ignored because the channel was disabled. Writing any value clears all counters.")]
+    public partial class PwmStatistics
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PwmStatistics"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 87;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PwmStatistics"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PwmStatistics"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 20;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PwmStatistics"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PwmStatistics"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PwmStatistics"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PwmStatistics"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PwmStatistics"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PwmStatistics"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PwmStatistics register.
+    /// </summary>
+    /// <seealso cref="PwmStatistics"/>
+    [Description("Filters and selects timestamped messages from the PwmStatistics register.")]
+    public partial class TimestampedPwmStatistics
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PwmStatistics"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PwmStatistics.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PwmStatistics"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return PwmStatistics.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the channels' statistics.
+    /// </summary>
+    [Description("Configures the channels' statistics.")]
+    public partial class PwmStatisticsControl
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PwmStatisticsControl"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 88;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PwmStatisticsControl"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PwmStatisticsControl"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PwmStatisticsControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static StatisticsControl GetPayload(HarpMessage message)
+        {
+            return (StatisticsControl)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PwmStatisticsControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<StatisticsControl> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((StatisticsControl)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PwmStatisticsControl"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PwmStatisticsControl"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, StatisticsControl value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PwmStatisticsControl"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PwmStatisticsControl"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, StatisticsControl value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PwmStatisticsControl register.
+    /// </summary>
+    /// <seealso cref="PwmStatisticsControl"/>
+    [Description("Filters and selects timestamped messages from the PwmStatisticsControl register.")]
+    public partial class TimestampedPwmStatisticsControl
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PwmStatisticsControl"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PwmStatisticsControl.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PwmStatisticsControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<StatisticsControl> GetPayload(HarpMessage message)
+        {
+            return PwmStatisticsControl.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that for each running channel, the pulses left to emit in Count mode or the pulses emitted since the start in Infinite mode. Zero when the channel is stopped.
+    /// </summary>
+    [Description("For each running channel, the pulses left to emit in Count mode or the pulses emitted since the start in Infinite mode. Zero when the channel is stopped.")]
+    public partial class PwmRemainingCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PwmRemainingCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 89;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PwmRemainingCount"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PwmRemainingCount"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PwmRemainingCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PwmRemainingCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PwmRemainingCount"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PwmRemainingCount"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PwmRemainingCount"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PwmRemainingCount"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PwmRemainingCount register.
+    /// </summary>
+    /// <seealso cref="PwmRemainingCount"/>
+    [Description("Filters and selects timestamped messages from the PwmRemainingCount register.")]
+    public partial class TimestampedPwmRemainingCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PwmRemainingCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PwmRemainingCount.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PwmRemainingCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return PwmRemainingCount.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that for each channel, the number of pulses between PwmRemainingCount events. Zero disables the events of the channel.
+    /// </summary>
+    [Description("For each channel, the number of pulses between PwmRemainingCount events. Zero disables the events of the channel.")]
+    public partial class PwmProgressInterval
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PwmProgressInterval"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 90;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PwmProgressInterval"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PwmProgressInterval"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PwmProgressInterval"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PwmProgressInterval"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PwmProgressInterval"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PwmProgressInterval"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PwmProgressInterval"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PwmProgressInterval"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PwmProgressInterval register.
+    /// </summary>
+    /// <seealso cref="PwmProgressInterval"/>
+    [Description("Filters and selects timestamped messages from the PwmProgressInterval register.")]
+    public partial class TimestampedPwmProgressInterval
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PwmProgressInterval"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PwmProgressInterval.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PwmProgressInterval"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return PwmProgressInterval.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of calls of the channel 0 to 3 compare interrupts, the trigger input 0 to 3 interrupts and the trigger all interrupt. Writing any value restarts the profiling. Only available on firmware built with PWM_PROFILING, reads as zero otherwise.
+    /// </summary>
+    [Description("Number of calls of the channel 0 to 3 compare interrupts, the trigger input 0 to 3 interrupts and the trigger all interrupt. Writing any value restarts the profiling. Only available on firmware built with PWM_PROFILING, reads as zero otherwise.")]
+    public partial class ProfilingInterruptCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProfilingInterruptCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 91;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ProfilingInterruptCount"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ProfilingInterruptCount"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 9;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ProfilingInterruptCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ProfilingInterruptCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ProfilingInterruptCount"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProfilingInterruptCount"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ProfilingInterruptCount"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProfilingInterruptCount"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProfilingInterruptCount register.
+    /// </summary>
+    /// <seealso cref="ProfilingInterruptCount"/>
+    [Description("Filters and selects timestamped messages from the ProfilingInterruptCount register.")]
+    public partial class TimestampedProfilingInterruptCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProfilingInterruptCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ProfilingInterruptCount.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProfilingInterruptCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return ProfilingInterruptCount.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that maximum CPU cycles spent on each of the profiled interrupts. Only available on firmware built with PWM_PROFILING.
+    /// </summary>
+    [Description("Maximum CPU cycles spent on each of the profiled interrupts. Only available on firmware built with PWM_PROFILING.")]
+    public partial class ProfilingInterruptMaxCycles
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProfilingInterruptMaxCycles"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 92;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ProfilingInterruptMaxCycles"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ProfilingInterruptMaxCycles"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 9;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ProfilingInterruptMaxCycles"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ProfilingInterruptMaxCycles"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ProfilingInterruptMaxCycles"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProfilingInterruptMaxCycles"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ProfilingInterruptMaxCycles"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProfilingInterruptMaxCycles"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProfilingInterruptMaxCycles register.
+    /// </summary>
+    /// <seealso cref="ProfilingInterruptMaxCycles"/>
+    [Description("Filters and selects timestamped messages from the ProfilingInterruptMaxCycles register.")]
+    public partial class TimestampedProfilingInterruptMaxCycles
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProfilingInterruptMaxCycles"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ProfilingInterruptMaxCycles.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProfilingInterruptMaxCycles"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return ProfilingInterruptMaxCycles.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that mean CPU cycles spent on each of the profiled interrupts. Only available on firmware built with PWM_PROFILING.
+    /// </summary>
+    [Description("Mean CPU cycles spent on each of the profiled interrupts. Only available on firmware built with PWM_PROFILING.")]
+    public partial class ProfilingInterruptMeanCycles
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProfilingInterruptMeanCycles"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 93;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ProfilingInterruptMeanCycles"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ProfilingInterruptMeanCycles"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 9;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ProfilingInterruptMeanCycles"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ProfilingInterruptMeanCycles"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ProfilingInterruptMeanCycles"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProfilingInterruptMeanCycles"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ProfilingInterruptMeanCycles"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProfilingInterruptMeanCycles"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProfilingInterruptMeanCycles register.
+    /// </summary>
+    /// <seealso cref="ProfilingInterruptMeanCycles"/>
+    [Description("Filters and selects timestamped messages from the ProfilingInterruptMeanCycles register.")]
+    public partial class TimestampedProfilingInterruptMeanCycles
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProfilingInterruptMeanCycles"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ProfilingInterruptMeanCycles.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProfilingInterruptMeanCycles"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return ProfilingInterruptMeanCycles.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that maximum CPU cycles from the start of a trigger interrupt to the start of a channel. Only available on firmware built with PWM_PROFILING.
+    /// </summary>
+    [Description("Maximum CPU cycles from the start of a trigger interrupt to the start of a channel. Only available on firmware built with PWM_PROFILING.")]
+    public partial class ProfilingMaxLatency
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProfilingMaxLatency"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 94;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ProfilingMaxLatency"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ProfilingMaxLatency"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ProfilingMaxLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ProfilingMaxLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ProfilingMaxLatency"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProfilingMaxLatency"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ProfilingMaxLatency"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProfilingMaxLatency"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProfilingMaxLatency register.
+    /// </summary>
+    /// <seealso cref="ProfilingMaxLatency"/>
+    [Description("Filters and selects timestamped messages from the ProfilingMaxLatency register.")]
+    public partial class TimestampedProfilingMaxLatency
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProfilingMaxLatency"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ProfilingMaxLatency.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProfilingMaxLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return ProfilingMaxLatency.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that cPU load on the last second, in percentage, relative to the most idle second observed. Only available on firmware built with PWM_PROFILING.
+    /// </summary>
+    [Description("CPU load on the last second, in percentage, relative to the most idle second observed. Only available on firmware built with PWM_PROFILING.")]
+    public partial class ProfilingCpuLoad
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProfilingCpuLoad"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 95;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ProfilingCpuLoad"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.Float;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ProfilingCpuLoad"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ProfilingCpuLoad"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static float GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadSingle();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ProfilingCpuLoad"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadSingle();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ProfilingCpuLoad"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProfilingCpuLoad"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, float value)
+        {
+            return HarpMessage.FromSingle(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ProfilingCpuLoad"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProfilingCpuLoad"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, float value)
+        {
+            return HarpMessage.FromSingle(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProfilingCpuLoad register.
+    /// </summary>
+    /// <seealso cref="ProfilingCpuLoad"/>
+    [Description("Filters and selects timestamped messages from the ProfilingCpuLoad register.")]
+    public partial class TimestampedProfilingCpuLoad
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProfilingCpuLoad"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ProfilingCpuLoad.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProfilingCpuLoad"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float> GetPayload(HarpMessage message)
+        {
+            return ProfilingCpuLoad.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 0. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.
+    /// </summary>
+    [Description("Frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 0. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.")]
+    public partial class Channel0Configuration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Channel0Configuration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 96;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Channel0Configuration"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.Float;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Channel0Configuration"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 6;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Channel0Configuration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static float[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Channel0Configuration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Channel0Configuration"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Channel0Configuration"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Channel0Configuration"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Channel0Configuration"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Channel0Configuration register.
+    /// </summary>
+    /// <seealso cref="Channel0Configuration"/>
+    [Description("Filters and selects timestamped messages from the Channel0Configuration register.")]
+    public partial class TimestampedChannel0Configuration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Channel0Configuration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Channel0Configuration.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Channel0Configuration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetPayload(HarpMessage message)
+        {
+            return Channel0Configuration.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 1. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.
+    /// </summary>
+    [Description("Frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 1. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.")]
+    public partial class Channel1Configuration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Channel1Configuration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 97;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Channel1Configuration"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.Float;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Channel1Configuration"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 6;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Channel1Configuration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static float[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Channel1Configuration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Channel1Configuration"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Channel1Configuration"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Channel1Configuration"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Channel1Configuration"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Channel1Configuration register.
+    /// </summary>
+    /// <seealso cref="Channel1Configuration"/>
+    [Description("Filters and selects timestamped messages from the Channel1Configuration register.")]
+    public partial class TimestampedChannel1Configuration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Channel1Configuration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Channel1Configuration.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Channel1Configuration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetPayload(HarpMessage message)
+        {
+            return Channel1Configuration.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 2. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.
+    /// </summary>
+    [Description("Frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 2. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.")]
+    public partial class Channel2Configuration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Channel2Configuration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 98;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Channel2Configuration"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.Float;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Channel2Configuration"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 6;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Channel2Configuration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static float[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Channel2Configuration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Channel2Configuration"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Channel2Configuration"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Channel2Configuration"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Channel2Configuration"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Channel2Configuration register.
+    /// </summary>
+    /// <seealso cref="Channel2Configuration"/>
+    [Description("Filters and selects timestamped messages from the Channel2Configuration register.")]
+    public partial class TimestampedChannel2Configuration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Channel2Configuration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Channel2Configuration.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Channel2Configuration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetPayload(HarpMessage message)
+        {
+            return Channel2Configuration.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 3. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.
+    /// </summary>
+    [Description("Frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 3. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.")]
+    public partial class Channel3Configuration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Channel3Configuration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 99;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Channel3Configuration"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.Float;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Channel3Configuration"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 6;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Channel3Configuration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static float[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Channel3Configuration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Channel3Configuration"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Channel3Configuration"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Channel3Configuration"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Channel3Configuration"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Channel3Configuration register.
+    /// </summary>
+    /// <seealso cref="Channel3Configuration"/>
+    [Description("Filters and selects timestamped messages from the Channel3Configuration register.")]
+    public partial class TimestampedChannel3Configuration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Channel3Configuration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Channel3Configuration.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Channel3Configuration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetPayload(HarpMessage message)
+        {
+            return Channel3Configuration.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the Channel0Configuration to Channel3Configuration registers in a single register. All channels are validated before any of them is applied.
+    /// </summary>
+    [Description("The Channel0Configuration to Channel3Configuration registers in a single register. All channels are validated before any of them is applied.")]
+    public partial class ChannelsConfiguration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ChannelsConfiguration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 100;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ChannelsConfiguration"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.Float;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ChannelsConfiguration"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 24;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ChannelsConfiguration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static float[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ChannelsConfiguration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ChannelsConfiguration"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ChannelsConfiguration"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ChannelsConfiguration"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ChannelsConfiguration"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ChannelsConfiguration register.
+    /// </summary>
+    /// <seealso cref="ChannelsConfiguration"/>
+    [Description("Filters and selects timestamped messages from the ChannelsConfiguration register.")]
+    public partial class TimestampedChannelsConfiguration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ChannelsConfiguration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ChannelsConfiguration.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ChannelsConfiguration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetPayload(HarpMessage message)
+        {
+            return ChannelsConfiguration.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that staged frequency, duty cycle and counts of each channel, channel 0 first. A channel written with a zero frequency keeps its staged configuration. Written values only take effect when committed with CommitStagedConfiguration.
+    /// </summary>
+    [Description("Staged frequency, duty cycle and counts of each channel, channel 0 first. A channel written with a zero frequency keeps its staged configuration. Written values only take effect when committed with CommitStagedConfiguration.")]
+    public partial class StagedConfiguration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StagedConfiguration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 101;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="StagedConfiguration"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.Float;
+
+        /// <summary>
+        /// Represents the length of the <see cref="StagedConfiguration"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 12;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="StagedConfiguration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static float[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="StagedConfiguration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="StagedConfiguration"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StagedConfiguration"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="StagedConfiguration"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StagedConfiguration"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// StagedConfiguration register.
+    /// </summary>
+    /// <seealso cref="StagedConfiguration"/>
+    [Description("Filters and selects timestamped messages from the StagedConfiguration register.")]
+    public partial class TimestampedStagedConfiguration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StagedConfiguration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = StagedConfiguration.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="StagedConfiguration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetPayload(HarpMessage message)
+        {
+            return StagedConfiguration.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that applies the staged configuration of the selected channels at the same time. Running channels that keep their prescaler change at the end of their current period, and count the new number of pulses from the commit. If CommitOnTrigger is set, the commit waits for the next active edge of one of the CommitTriggers inputs and the register reads the pending commit until then.
+    /// </summary>
+    [Description("Applies the staged configuration of the selected channels at the same time. Running channels that keep their prescaler change at the end of their current period, and count the new number of pulses from the commit. If CommitOnTrigger is set, the commit waits for the next active edge of one of the CommitTriggers inputs and the register reads the pending commit until then.")]
+    public partial class CommitStagedConfiguration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CommitStagedConfiguration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 102;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="CommitStagedConfiguration"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="CommitStagedConfiguration"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="CommitStagedConfiguration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static StagedCommit GetPayload(HarpMessage message)
+        {
+            return (StagedCommit)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="CommitStagedConfiguration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<StagedCommit> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((StagedCommit)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="CommitStagedConfiguration"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CommitStagedConfiguration"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, StagedCommit value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="CommitStagedConfiguration"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CommitStagedConfiguration"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, StagedCommit value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// CommitStagedConfiguration register.
+    /// </summary>
+    /// <seealso cref="CommitStagedConfiguration"/>
+    [Description("Filters and selects timestamped messages from the CommitStagedConfiguration register.")]
+    public partial class TimestampedCommitStagedConfiguration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CommitStagedConfiguration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = CommitStagedConfiguration.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="CommitStagedConfiguration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<StagedCommit> GetPayload(HarpMessage message)
+        {
+            return CommitStagedConfiguration.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that trigger inputs whose active edge applies a pending staged configuration.
+    /// </summary>
+    [Description("Trigger inputs whose active edge applies a pending staged configuration.")]
+    public partial class CommitTriggers
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CommitTriggers"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 103;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="CommitTriggers"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="CommitTriggers"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="CommitTriggers"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static TriggerSources GetPayload(HarpMessage message)
+        {
+            return (TriggerSources)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="CommitTriggers"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<TriggerSources> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((TriggerSources)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="CommitTriggers"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CommitTriggers"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, TriggerSources value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="CommitTriggers"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CommitTriggers"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, TriggerSources value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// CommitTriggers register.
+    /// </summary>
+    /// <seealso cref="CommitTriggers"/>
+    [Description("Filters and selects timestamped messages from the CommitTriggers register.")]
+    public partial class TimestampedCommitTriggers
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CommitTriggers"/> register. This field is constant.
+        /// </summary>
+        public const int Address = CommitTriggers.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="CommitTriggers"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<TriggerSources> GetPayload(HarpMessage message)
+        {
+            return CommitTriggers.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that saves the current configuration of the channels and triggers on the specified preset. The preset is kept in the EEPROM.
+    /// </summary>
+    [Description("Saves the current configuration of the channels and triggers on the specified preset. The preset is kept in the EEPROM.")]
+    public partial class SavePreset
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SavePreset"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 104;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SavePreset"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SavePreset"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SavePreset"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SavePreset"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SavePreset"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SavePreset"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SavePreset"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SavePreset"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SavePreset register.
+    /// </summary>
+    /// <seealso cref="SavePreset"/>
+    [Description("Filters and selects timestamped messages from the SavePreset register.")]
+    public partial class TimestampedSavePreset
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SavePreset"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SavePreset.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SavePreset"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return SavePreset.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that loads the specified preset. Reads the last loaded preset, or 255 if none was loaded since the last reset.
+    /// </summary>
+    [Description("Loads the specified preset. Reads the last loaded preset, or 255 if none was loaded since the last reset.")]
+    public partial class LoadPreset
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LoadPreset"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 105;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="LoadPreset"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="LoadPreset"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="LoadPreset"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="LoadPreset"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="LoadPreset"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LoadPreset"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="LoadPreset"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LoadPreset"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// LoadPreset register.
+    /// </summary>
+    /// <seealso cref="LoadPreset"/>
+    [Description("Filters and selects timestamped messages from the LoadPreset register.")]
+    public partial class TimestampedLoadPreset
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LoadPreset"/> register. This field is constant.
+        /// </summary>
+        public const int Address = LoadPreset.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="LoadPreset"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return LoadPreset.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that name of each preset, with 8 characters per preset. The names are kept in the EEPROM.
+    /// </summary>
+    [Description("Name of each preset, with 8 characters per preset. The names are kept in the EEPROM.")]
+    public partial class PresetNames
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PresetNames"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 106;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PresetNames"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PresetNames"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 32;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PresetNames"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PresetNames"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PresetNames"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PresetNames"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PresetNames"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PresetNames"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PresetNames register.
+    /// </summary>
+    /// <seealso cref="PresetNames"/>
+    [Description("Filters and selects timestamped messages from the PresetNames register.")]
+    public partial class TimestampedPresetNames
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PresetNames"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PresetNames.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PresetNames"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return PresetNames.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that trigger inputs whose active edge loads the next saved preset.
+    /// </summary>
+    [Description("Trigger inputs whose active edge loads the next saved preset.")]
+    public partial class PresetTriggers
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PresetTriggers"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 107;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PresetTriggers"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PresetTriggers"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PresetTriggers"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static TriggerSources GetPayload(HarpMessage message)
+        {
+            return (TriggerSources)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PresetTriggers"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<TriggerSources> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((TriggerSources)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PresetTriggers"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PresetTriggers"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, TriggerSources value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PresetTriggers"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PresetTriggers"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, TriggerSources value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PresetTriggers register.
+    /// </summary>
+    /// <seealso cref="PresetTriggers"/>
+    [Description("Filters and selects timestamped messages from the PresetTriggers register.")]
+    public partial class TimestampedPresetTriggers
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PresetTriggers"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PresetTriggers.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PresetTriggers"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<TriggerSources> GetPayload(HarpMessage message)
+        {
+            return PresetTriggers.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that queues a train on channel 0 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.
+    /// </summary>
+    [Description("Queues a train on channel 0 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.")]
+    public partial class Channel0Train
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Channel0Train"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 108;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Channel0Train"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.Float;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Channel0Train"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 3;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Channel0Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static float[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Channel0Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Channel0Train"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Channel0Train"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Channel0Train"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Channel0Train"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Channel0Train register.
+    /// </summary>
+    /// <seealso cref="Channel0Train"/>
+    [Description("Filters and selects timestamped messages from the Channel0Train register.")]
+    public partial class TimestampedChannel0Train
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Channel0Train"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Channel0Train.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Channel0Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetPayload(HarpMessage message)
+        {
+            return Channel0Train.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that queues a train on channel 1 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.
+    /// </summary>
+    [Description("Queues a train on channel 1 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.")]
+    public partial class Channel1Train
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Channel1Train"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 109;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Channel1Train"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.Float;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Channel1Train"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 3;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Channel1Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static float[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Channel1Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Channel1Train"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Channel1Train"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Channel1Train"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Channel1Train"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Channel1Train register.
+    /// </summary>
+    /// <seealso cref="Channel1Train"/>
+    [Description("Filters and selects timestamped messages from the Channel1Train register.")]
+    public partial class TimestampedChannel1Train
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Channel1Train"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Channel1Train.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Channel1Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetPayload(HarpMessage message)
+        {
+            return Channel1Train.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that queues a train on channel 2 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.
+    /// </summary>
+    [Description("Queues a train on channel 2 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.")]
+    public partial class Channel2Train
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Channel2Train"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 110;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Channel2Train"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.Float;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Channel2Train"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 3;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Channel2Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static float[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Channel2Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Channel2Train"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Channel2Train"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Channel2Train"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Channel2Train"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Channel2Train register.
+    /// </summary>
+    /// <seealso cref="Channel2Train"/>
+    [Description("Filters and selects timestamped messages from the Channel2Train register.")]
+    public partial class TimestampedChannel2Train
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Channel2Train"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Channel2Train.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Channel2Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetPayload(HarpMessage message)
+        {
+            return Channel2Train.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that queues a train on channel 3 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.
+    /// </summary>
+    [Description("Queues a train on channel 3 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.")]
+    public partial class Channel3Train
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Channel3Train"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 111;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Channel3Train"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.Float;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Channel3Train"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 3;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Channel3Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static float[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Channel3Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Channel3Train"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Channel3Train"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Channel3Train"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Channel3Train"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Channel3Train register.
+    /// </summary>
+    /// <seealso cref="Channel3Train"/>
+    [Description("Filters and selects timestamped messages from the Channel3Train register.")]
+    public partial class TimestampedChannel3Train
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Channel3Train"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Channel3Train.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Channel3Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetPayload(HarpMessage message)
+        {
+            return Channel3Train.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of trains waiting on each channel's queue. Writing zeros empties all the queues, other values are refused. The queue is also emptied, with an event, when its next train is due and the channel's frequency was changed to one that needs another prescaler.
+    /// </summary>
+    [Description("Number of trains waiting on each channel's queue. Writing zeros empties all the queues, other values are refused. The queue is also emptied, with an event, when its next train is due and the channel's frequency was changed to one that needs another prescaler.")]
+    public partial class TrainQueueLevel
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TrainQueueLevel"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 112;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TrainQueueLevel"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TrainQueueLevel"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TrainQueueLevel"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TrainQueueLevel"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TrainQueueLevel"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TrainQueueLevel"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TrainQueueLevel"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TrainQueueLevel"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TrainQueueLevel register.
+    /// </summary>
+    /// <seealso cref="TrainQueueLevel"/>
+    [Description("Filters and selects timestamped messages from the TrainQueueLevel register.")]
+    public partial class TimestampedTrainQueueLevel
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TrainQueueLevel"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TrainQueueLevel.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TrainQueueLevel"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return TrainQueueLevel.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that a TrainQueueLevel event is sent when a queued train starts and leaves this number of trains or less on the queue.
+    /// </summary>
+    [Description("A TrainQueueLevel event is sent when a queued train starts and leaves this number of trains or less on the queue.")]
+    public partial class TrainQueueLow
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TrainQueueLow"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 113;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TrainQueueLow"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TrainQueueLow"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TrainQueueLow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TrainQueueLow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TrainQueueLow"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TrainQueueLow"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TrainQueueLow"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TrainQueueLow"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TrainQueueLow register.
+    /// </summary>
+    /// <seealso cref="TrainQueueLow"/>
+    [Description("Filters and selects timestamped messages from the TrainQueueLow register.")]
+    public partial class TimestampedTrainQueueLow
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TrainQueueLow"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TrainQueueLow.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TrainQueueLow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return TrainQueueLow.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that minimum CPU cycles from the start of a trigger interrupt to the start of a channel. Only available on firmware built with PWM_PROFILING.
+    /// </summary>
+    [Description("Minimum CPU cycles from the start of a trigger interrupt to the start of a channel. Only available on firmware built with PWM_PROFILING.")]
+    public partial class ProfilingMinLatency
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProfilingMinLatency"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 114;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ProfilingMinLatency"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ProfilingMinLatency"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ProfilingMinLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ProfilingMinLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ProfilingMinLatency"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProfilingMinLatency"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ProfilingMinLatency"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProfilingMinLatency"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProfilingMinLatency register.
+    /// </summary>
+    /// <seealso cref="ProfilingMinLatency"/>
+    [Description("Filters and selects timestamped messages from the ProfilingMinLatency register.")]
+    public partial class TimestampedProfilingMinLatency
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProfilingMinLatency"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ProfilingMinLatency.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProfilingMinLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return ProfilingMinLatency.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of channel starts by latency from the start of the trigger interrupt, in buckets of 64 CPU cycles (2 us). The last bucket also counts the longer latencies. Only available on firmware built with PWM_PROFILING.
+    /// </summary>
+    [Description("Number of channel starts by latency from the start of the trigger interrupt, in buckets of 64 CPU cycles (2 us). The last bucket also counts the longer latencies. Only available on firmware built with PWM_PROFILING.")]
+    public partial class ProfilingLatencyHistogram
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProfilingLatencyHistogram"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 115;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ProfilingLatencyHistogram"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ProfilingLatencyHistogram"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 8;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ProfilingLatencyHistogram"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ProfilingLatencyHistogram"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ProfilingLatencyHistogram"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProfilingLatencyHistogram"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ProfilingLatencyHistogram"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProfilingLatencyHistogram"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProfilingLatencyHistogram register.
+    /// </summary>
+    /// <seealso cref="ProfilingLatencyHistogram"/>
+    [Description("Filters and selects timestamped messages from the ProfilingLatencyHistogram register.")]
+    public partial class TimestampedProfilingLatencyHistogram
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProfilingLatencyHistogram"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ProfilingLatencyHistogram.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProfilingLatencyHistogram"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return ProfilingLatencyHistogram.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that maximum CPU cycles between the first and the last channel started by the same trigger interrupt. Only available on firmware built with PWM_PROFILING.
+    /// </summary>
+    [Description("Maximum CPU cycles between the first and the last channel started by the same trigger interrupt. Only available on firmware built with PWM_PROFILING.")]
+    public partial class ProfilingMaxSkew
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProfilingMaxSkew"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 116;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ProfilingMaxSkew"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ProfilingMaxSkew"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ProfilingMaxSkew"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ProfilingMaxSkew"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ProfilingMaxSkew"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProfilingMaxSkew"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ProfilingMaxSkew"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProfilingMaxSkew"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProfilingMaxSkew register.
+    /// </summary>
+    /// <seealso cref="ProfilingMaxSkew"/>
+    [Description("Filters and selects timestamped messages from the ProfilingMaxSkew register.")]
+    public partial class TimestampedProfilingMaxSkew
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProfilingMaxSkew"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ProfilingMaxSkew.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProfilingMaxSkew"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return ProfilingMaxSkew.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of events dropped because the queue of their interrupt level was full. Saturates at 65535 and is cleared on reset.
+    /// </summary>
+    [Description("Number of events dropped because the queue of their interrupt level was full. Saturates at 65535 and is cleared on reset.")]
+    public partial class DroppedEvents
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DroppedEvents"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 117;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DroppedEvents"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DroppedEvents"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DroppedEvents"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DroppedEvents"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DroppedEvents"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DroppedEvents"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DroppedEvents"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DroppedEvents"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DroppedEvents register.
+    /// </summary>
+    /// <seealso cref="DroppedEvents"/>
+    [Description("Filters and selects timestamped messages from the DroppedEvents register.")]
+    public partial class TimestampedDroppedEvents
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DroppedEvents"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DroppedEvents.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DroppedEvents"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return DroppedEvents.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator which creates standard message payloads for the
+    /// MultiPwm device.
+    /// </summary>
+    /// <seealso cref="CreatePwmChannel0FrequencyPayload"/>
+    /// <seealso cref="CreatePwmChannel1FrequencyPayload"/>
+    /// <seealso cref="CreatePwmChannel2FrequencyPayload"/>
+    /// <seealso cref="CreatePwmChannel3FrequencyPayload"/>
+    /// <seealso cref="CreatePwmChannel0DutyCyclePayload"/>
+    /// <seealso cref="CreatePwmChannel1DutyCyclePayload"/>
+    /// <seealso cref="CreatePwmChannel2DutyCyclePayload"/>
+    /// <seealso cref="CreatePwmChannel3DutyCyclePayload"/>
+    /// <seealso cref="CreatePwmChannel0PulseCountPayload"/>
+    /// <seealso cref="CreatePwmChannel1PulseCountPayload"/>
+    /// <seealso cref="CreatePwmChannel2PulseCountPayload"/>
+    /// <seealso cref="CreatePwmChannel3PulseCountPayload"/>
+    /// <seealso cref="CreatePwmChannel0RealFrequencyPayload"/>
+    /// <seealso cref="CreatePwmChannel1RealFrequencyPayload"/>
+    /// <seealso cref="CreatePwmChannel2RealFrequencyPayload"/>
+    /// <seealso cref="CreatePwmChannel3RealFrequencyPayload"/>
+    /// <seealso cref="CreatePwmChannel0RealDutyCyclePayload"/>
+    /// <seealso cref="CreatePwmChannel1RealDutyCyclePayload"/>
+    /// <seealso cref="CreatePwmChannel2RealDutyCyclePayload"/>
+    /// <seealso cref="CreatePwmChannel3RealDutyCyclePayload"/>
+    /// <seealso cref="CreatePwmChannel0PlaybackModePayload"/>
+    /// <seealso cref="CreatePwmChannel1PlaybackModePayload"/>
+    /// <seealso cref="CreatePwmChannel2PlaybackModePayload"/>
+    /// <seealso cref="CreatePwmChannel3PlaybackModePayload"/>
+    /// <seealso cref="CreateTrigger0TargetsPayload"/>
+    /// <seealso cref="CreateTrigger1TargetsPayload"/>
+    /// <seealso cref="CreateTrigger2TargetsPayload"/>
+    /// <seealso cref="CreateTrigger3TargetsPayload"/>
+    /// <seealso cref="CreateStartSoftwareTriggerPayload"/>
+    /// <seealso cref="CreateStopSoftwareTriggerPayload"/>
+    /// <seealso cref="CreateArmPwmChannelsPayload"/>
+    /// <seealso cref="CreateTrigger0ModePayload"/>
+    /// <seealso cref="CreateTrigger1ModePayload"/>
+    /// <seealso cref="CreateTrigger2ModePayload"/>
+    /// <seealso cref="CreateTrigger3ModePayload"/>
+    /// <seealso cref="CreateRequestEnablePayload"/>
+    /// <seealso cref="CreateEnablePwmChannelsPayload"/>
+    /// <seealso cref="CreateTriggerAllModePayload"/>
+    /// <seealso cref="CreateTriggerChannelStatePayload"/>
+    /// <seealso cref="CreatePwmChannelStatePayload"/>
+    /// <seealso cref="CreatePwmStatePayload"/>
+    /// <seealso cref="CreateEnableEventsPayload"/>
+    /// <seealso cref="CreateFrequencyMeterEnablePayload"/>
+    /// <seealso cref="CreateFrequencyMeterWindowPayload"/>
+    /// <seealso cref="CreateTriggerPeriodPayload"/>
+    /// <seealso cref="CreateTriggerFrequencyPayload"/>
+    /// <seealso cref="CreateTriggerDutyCyclePayload"/>
+    /// <seealso cref="CreatePwmExternalClockPeriodPayload"/>
+    /// <seealso cref="CreatePwmChainedChannelsPayload"/>
+    /// <seealso cref="CreateVirtualTriggerTablePayload"/>
+    /// <seealso cref="CreateVirtualTriggerMaskPayload"/>
+    /// <seealso cref="CreateVirtualTriggerModePayload"/>
+    /// <seealso cref="CreateEventCoalesceWindowPayload"/>
+    /// <seealso cref="CreatePwmStateBatchPayload"/>
+    /// <seealso cref="CreatePwmStatisticsPayload"/>
+    /// <seealso cref="CreatePwmStatisticsControlPayload"/>
+    /// <seealso cref="CreatePwmRemainingCountPayload"/>
+    /// <seealso cref="CreatePwmProgressIntervalPayload"/>
+    /// <seealso cref="CreateProfilingInterruptCountPayload"/>
+    /// <seealso cref="CreateProfilingInterruptMaxCyclesPayload"/>
+    /// <seealso cref="CreateProfilingInterruptMeanCyclesPayload"/>
+    /// <seealso cref="CreateProfilingMaxLatencyPayload"/>
+    /// <seealso cref="CreateProfilingCpuLoadPayload"/>
+    /// <seealso cref="CreateChannel0ConfigurationPayload"/>
+    /// <seealso cref="CreateChannel1ConfigurationPayload"/>
+    /// <seealso cref="CreateChannel2ConfigurationPayload"/>
+    /// <seealso cref="CreateChannel3ConfigurationPayload"/>
+    /// <seealso cref="CreateChannelsConfigurationPayload"/>
+    /// <seealso cref="CreateStagedConfigurationPayload"/>
+    /// <seealso cref="CreateCommitStagedConfigurationPayload"/>
+    /// <seealso cref="CreateCommitTriggersPayload"/>
+    /// <seealso cref="CreateSavePresetPayload"/>
+    /// <seealso cref="CreateLoadPresetPayload"/>
+    /// <seealso cref="CreatePresetNamesPayload"/>
+    /// <seealso cref="CreatePresetTriggersPayload"/>
+    /// <seealso cref="CreateChannel0TrainPayload"/>
+    /// <seealso cref="CreateChannel1TrainPayload"/>
+    /// <seealso cref="CreateChannel2TrainPayload"/>
+    /// <seealso cref="CreateChannel3TrainPayload"/>
+    /// <seealso cref="CreateTrainQueueLevelPayload"/>
+    /// <seealso cref="CreateTrainQueueLowPayload"/>
+    /// <seealso cref="CreateProfilingMinLatencyPayload"/>
+    /// <seealso cref="CreateProfilingLatencyHistogramPayload"/>
+    /// <seealso cref="CreateProfilingMaxSkewPayload"/>
+    /// <seealso cref="CreateDroppedEventsPayload"/>
+    [XmlInclude(typeof(CreatePwmChannel0FrequencyPayload))]
+    [XmlInclude(typeof(CreatePwmChannel1FrequencyPayload))]
+    [XmlInclude(typeof(CreatePwmChannel2FrequencyPayload))]
+    [XmlInclude(typeof(CreatePwmChannel3FrequencyPayload))]
+    [XmlInclude(typeof(CreatePwmChannel0DutyCyclePayload))]
+    [XmlInclude(typeof(CreatePwmChannel1DutyCyclePayload))]
+    [XmlInclude(typeof(CreatePwmChannel2DutyCyclePayload))]
+    [XmlInclude(typeof(CreatePwmChannel3DutyCyclePayload))]
+    [XmlInclude(typeof(CreatePwmChannel0PulseCountPayload))]
+    [XmlInclude(typeof(CreatePwmChannel1PulseCountPayload))]
+    [XmlInclude(typeof(CreatePwmChannel2PulseCountPayload))]
+    [XmlInclude(typeof(CreatePwmChannel3PulseCountPayload))]
+    [XmlInclude(typeof(CreatePwmChannel0RealFrequencyPayload))]
+    [XmlInclude(typeof(CreatePwmChannel1RealFrequencyPayload))]
+    [XmlInclude(typeof(CreatePwmChannel2RealFrequencyPayload))]
+    [XmlInclude(typeof(CreatePwmChannel3RealFrequencyPayload))]
+    [XmlInclude(typeof(CreatePwmChannel0RealDutyCyclePayload))]
+    [XmlInclude(typeof(CreatePwmChannel1RealDutyCyclePayload))]
+    [XmlInclude(typeof(CreatePwmChannel2RealDutyCyclePayload))]
+    [XmlInclude(typeof(CreatePwmChannel3RealDutyCyclePayload))]
+    [XmlInclude(typeof(CreatePwmChannel0PlaybackModePayload))]
+    [XmlInclude(typeof(CreatePwmChannel1PlaybackModePayload))]
+    [XmlInclude(typeof(CreatePwmChannel2PlaybackModePayload))]
+    [XmlInclude(typeof(CreatePwmChannel3PlaybackModePayload))]
+    [XmlInclude(typeof(CreateTrigger0TargetsPayload))]
+    [XmlInclude(typeof(CreateTrigger1TargetsPayload))]
+    [XmlInclude(typeof(CreateTrigger2TargetsPayload))]
+    [XmlInclude(typeof(CreateTrigger3TargetsPayload))]
+    [XmlInclude(typeof(CreateStartSoftwareTriggerPayload))]
+    [XmlInclude(typeof(CreateStopSoftwareTriggerPayload))]
+    [XmlInclude(typeof(CreateArmPwmChannelsPayload))]
+    [XmlInclude(typeof(CreateTrigger0ModePayload))]
+    [XmlInclude(typeof(CreateTrigger1ModePayload))]
+    [XmlInclude(typeof(CreateTrigger2ModePayload))]
+    [XmlInclude(typeof(CreateTrigger3ModePayload))]
+    [XmlInclude(typeof(CreateRequestEnablePayload))]
+    [XmlInclude(typeof(CreateEnablePwmChannelsPayload))]
+    [XmlInclude(typeof(CreateTriggerAllModePayload))]
+    [XmlInclude(typeof(CreateTriggerChannelStatePayload))]
+    [XmlInclude(typeof(CreatePwmChannelStatePayload))]
+    [XmlInclude(typeof(CreatePwmStatePayload))]
+    [XmlInclude(typeof(CreateEnableEventsPayload))]
+    [XmlInclude(typeof(CreateFrequencyMeterEnablePayload))]
+    [XmlInclude(typeof(CreateFrequencyMeterWindowPayload))]
+    [XmlInclude(typeof(CreateTriggerPeriodPayload))]
+    [XmlInclude(typeof(CreateTriggerFrequencyPayload))]
+    [XmlInclude(typeof(CreateTriggerDutyCyclePayload))]
+    [XmlInclude(typeof(CreatePwmExternalClockPeriodPayload))]
+    [XmlInclude(typeof(CreatePwmChainedChannelsPayload))]
+    [XmlInclude(typeof(CreateVirtualTriggerTablePayload))]
+    [XmlInclude(typeof(CreateVirtualTriggerMaskPayload))]
+    [XmlInclude(typeof(CreateVirtualTriggerModePayload))]
+    [XmlInclude(typeof(CreateEventCoalesceWindowPayload))]
+    [XmlInclude(typeof(CreatePwmStateBatchPayload))]
+    [XmlInclude(typeof(CreatePwmStatisticsPayload))]
+    [XmlInclude(typeof(CreatePwmStatisticsControlPayload))]
+    [XmlInclude(typeof(CreatePwmRemainingCountPayload))]
+    [XmlInclude(typeof(CreatePwmProgressIntervalPayload))]
+    [XmlInclude(typeof(CreateProfilingInterruptCountPayload))]
+    [XmlInclude(typeof(CreateProfilingInterruptMaxCyclesPayload))]
+    [XmlInclude(typeof(CreateProfilingInterruptMeanCyclesPayload))]
+    [XmlInclude(typeof(CreateProfilingMaxLatencyPayload))]
+    [XmlInclude(typeof(CreateProfilingCpuLoadPayload))]
+    [XmlInclude(typeof(CreateChannel0ConfigurationPayload))]
+    [XmlInclude(typeof(CreateChannel1ConfigurationPayload))]
+    [XmlInclude(typeof(CreateChannel2ConfigurationPayload))]
+    [XmlInclude(typeof(CreateChannel3ConfigurationPayload))]
+    [XmlInclude(typeof(CreateChannelsConfigurationPayload))]
+    [XmlInclude(typeof(CreateStagedConfigurationPayload))]
+    [XmlInclude(typeof(CreateCommitStagedConfigurationPayload))]
+    [XmlInclude(typeof(CreateCommitTriggersPayload))]
+    [XmlInclude(typeof(CreateSavePresetPayload))]
+    [XmlInclude(typeof(CreateLoadPresetPayload))]
+    [XmlInclude(typeof(CreatePresetNamesPayload))]
+    [XmlInclude(typeof(CreatePresetTriggersPayload))]
+    [XmlInclude(typeof(CreateChannel0TrainPayload))]
+    [XmlInclude(typeof(CreateChannel1TrainPayload))]
+    [XmlInclude(typeof(CreateChannel2TrainPayload))]
+    [XmlInclude(typeof(CreateChannel3TrainPayload))]
+    [XmlInclude(typeof(CreateTrainQueueLevelPayload))]
+    [XmlInclude(typeof(CreateTrainQueueLowPayload))]
+    [XmlInclude(typeof(CreateProfilingMinLatencyPayload))]
+    [XmlInclude(typeof(CreateProfilingLatencyHistogramPayload))]
+    [XmlInclude(typeof(CreateProfilingMaxSkewPayload))]
+    [XmlInclude(typeof(CreateDroppedEventsPayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmChannel0FrequencyPayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmChannel1FrequencyPayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmChannel2FrequencyPayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmChannel3FrequencyPayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmChannel0DutyCyclePayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmChannel1DutyCyclePayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmChannel2DutyCyclePayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmChannel3DutyCyclePayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmChannel0PulseCountPayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmChannel1PulseCountPayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmChannel2PulseCountPayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmChannel3PulseCountPayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmChannel0RealFrequencyPayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmChannel1RealFrequencyPayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmChannel2RealFrequencyPayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmChannel3RealFrequencyPayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmChannel0RealDutyCyclePayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmChannel1RealDutyCyclePayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmChannel2RealDutyCyclePayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmChannel3RealDutyCyclePayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmChannel0PlaybackModePayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmChannel1PlaybackModePayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmChannel2PlaybackModePayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmChannel3PlaybackModePayload))]
+    [XmlInclude(typeof(CreateTimestampedTrigger0TargetsPayload))]
+    [XmlInclude(typeof(CreateTimestampedTrigger1TargetsPayload))]
+    [XmlInclude(typeof(CreateTimestampedTrigger2TargetsPayload))]
+    [XmlInclude(typeof(CreateTimestampedTrigger3TargetsPayload))]
+    [XmlInclude(typeof(CreateTimestampedStartSoftwareTriggerPayload))]
+    [XmlInclude(typeof(CreateTimestampedStopSoftwareTriggerPayload))]
+    [XmlInclude(typeof(CreateTimestampedArmPwmChannelsPayload))]
+    [XmlInclude(typeof(CreateTimestampedTrigger0ModePayload))]
+    [XmlInclude(typeof(CreateTimestampedTrigger1ModePayload))]
+    [XmlInclude(typeof(CreateTimestampedTrigger2ModePayload))]
+    [XmlInclude(typeof(CreateTimestampedTrigger3ModePayload))]
+    [XmlInclude(typeof(CreateTimestampedRequestEnablePayload))]
+    [XmlInclude(typeof(CreateTimestampedEnablePwmChannelsPayload))]
+    [XmlInclude(typeof(CreateTimestampedTriggerAllModePayload))]
+    [XmlInclude(typeof(CreateTimestampedTriggerChannelStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmChannelStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedEnableEventsPayload))]
+    [XmlInclude(typeof(CreateTimestampedFrequencyMeterEnablePayload))]
+    [XmlInclude(typeof(CreateTimestampedFrequencyMeterWindowPayload))]
+    [XmlInclude(typeof(CreateTimestampedTriggerPeriodPayload))]
+    [XmlInclude(typeof(CreateTimestampedTriggerFrequencyPayload))]
+    [XmlInclude(typeof(CreateTimestampedTriggerDutyCyclePayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmExternalClockPeriodPayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmChainedChannelsPayload))]
+    [XmlInclude(typeof(CreateTimestampedVirtualTriggerTablePayload))]
+    [XmlInclude(typeof(CreateTimestampedVirtualTriggerMaskPayload))]
+    [XmlInclude(typeof(CreateTimestampedVirtualTriggerModePayload))]
+    [XmlInclude(typeof(CreateTimestampedEventCoalesceWindowPayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmStateBatchPayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmStatisticsPayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmStatisticsControlPayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmRemainingCountPayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmProgressIntervalPayload))]
+    [XmlInclude(typeof(CreateTimestampedProfilingInterruptCountPayload))]
+    [XmlInclude(typeof(CreateTimestampedProfilingInterruptMaxCyclesPayload))]
+    [XmlInclude(typeof(CreateTimestampedProfilingInterruptMeanCyclesPayload))]
+    [XmlInclude(typeof(CreateTimestampedProfilingMaxLatencyPayload))]
+    [XmlInclude(typeof(CreateTimestampedProfilingCpuLoadPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel0ConfigurationPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel1ConfigurationPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel2ConfigurationPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel3ConfigurationPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannelsConfigurationPayload))]
+    [XmlInclude(typeof(CreateTimestampedStagedConfigurationPayload))]
+    [XmlInclude(typeof(CreateTimestampedCommitStagedConfigurationPayload))]
+    [XmlInclude(typeof(CreateTimestampedCommitTriggersPayload))]
+    [XmlInclude(typeof(CreateTimestampedSavePresetPayload))]
+    [XmlInclude(typeof(CreateTimestampedLoadPresetPayload))]
+    [XmlInclude(typeof(CreateTimestampedPresetNamesPayload))]
+    [XmlInclude(typeof(CreateTimestampedPresetTriggersPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel0TrainPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel1TrainPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel2TrainPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel3TrainPayload))]
+    [XmlInclude(typeof(CreateTimestampedTrainQueueLevelPayload))]
+    [XmlInclude(typeof(CreateTimestampedTrainQueueLowPayload))]
+    [XmlInclude(typeof(CreateTimestampedProfilingMinLatencyPayload))]
+    [XmlInclude(typeof(CreateTimestampedProfilingLatencyHistogramPayload))]
+    [XmlInclude(typeof(CreateTimestampedProfilingMaxSkewPayload))]
+    [XmlInclude(typeof(CreateTimestampedDroppedEventsPayload))]
+    [Description("Creates standard message payloads for the MultiPwm device.")]
+    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// </summary>
+        public CreateMessage()
+        {
+            Payload = new CreatePwmChannel0FrequencyPayload();
+        }
+
+        string INamedElement.Name => $"{nameof(MultiPwm)}.{GetElementDisplayName(Payload)}";
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that frequency (Hz) of PWM pulses in channel 0.
+    /// </summary>
+    [DisplayName("PwmChannel0FrequencyPayload")]
+    [Description("Creates a message payload that frequency (Hz) of PWM pulses in channel 0.")]
+    public partial class CreatePwmChannel0FrequencyPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that frequency (Hz) of PWM pulses in channel 0.
+        /// </summary>
+        [Range(min: 0.5, max: 32768)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that frequency (Hz) of PWM pulses in channel 0.")]
+        public float PwmChannel0Frequency { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PwmChannel0Frequency register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return PwmChannel0Frequency;
+        }
+
+        /// <summary>
+        /// Creates a message that frequency (Hz) of PWM pulses in channel 0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmChannel0Frequency register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel0Frequency.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that frequency (Hz) of PWM pulses in channel 0.
+    /// </summary>
+    [DisplayName("TimestampedPwmChannel0FrequencyPayload")]
+    [Description("Creates a timestamped message payload that frequency (Hz) of PWM pulses in channel 0.")]
+    public partial class CreateTimestampedPwmChannel0FrequencyPayload : CreatePwmChannel0FrequencyPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that frequency (Hz) of PWM pulses in channel 0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmChannel0Frequency register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel0Frequency.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that frequency (Hz) of PWM pulses in channel 1.
+    /// </summary>
+    [DisplayName("PwmChannel1FrequencyPayload")]
+    [Description("Creates a message payload that frequency (Hz) of PWM pulses in channel 1.")]
+    public partial class CreatePwmChannel1FrequencyPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that frequency (Hz) of PWM pulses in channel 1.
+        /// </summary>
+        [Range(min: 0.5, max: 32768)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that frequency (Hz) of PWM pulses in channel 1.")]
+        public float PwmChannel1Frequency { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PwmChannel1Frequency register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return PwmChannel1Frequency;
+        }
+
+        /// <summary>
+        /// Creates a message that frequency (Hz) of PWM pulses in channel 1.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmChannel1Frequency register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel1Frequency.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that frequency (Hz) of PWM pulses in channel 1.
+    /// </summary>
+    [DisplayName("TimestampedPwmChannel1FrequencyPayload")]
+    [Description("Creates a timestamped message payload that frequency (Hz) of PWM pulses in channel 1.")]
+    public partial class CreateTimestampedPwmChannel1FrequencyPayload : CreatePwmChannel1FrequencyPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that frequency (Hz) of PWM pulses in channel 1.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmChannel1Frequency register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel1Frequency.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that frequency (Hz) of PWM pulses in channel 2.
+    /// </summary>
+    [DisplayName("PwmChannel2FrequencyPayload")]
+    [Description("Creates a message payload that frequency (Hz) of PWM pulses in channel 2.")]
+    public partial class CreatePwmChannel2FrequencyPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that frequency (Hz) of PWM pulses in channel 2.
+        /// </summary>
+        [Range(min: 0.5, max: 32768)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that frequency (Hz) of PWM pulses in channel 2.")]
+        public float PwmChannel2Frequency { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PwmChannel2Frequency register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return PwmChannel2Frequency;
+        }
+
+        /// <summary>
+        /// Creates a message that frequency (Hz) of PWM pulses in channel 2.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmChannel2Frequency register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel2Frequency.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that frequency (Hz) of PWM pulses in channel 2.
+    /// </summary>
+    [DisplayName("TimestampedPwmChannel2FrequencyPayload")]
+    [Description("Creates a timestamped message payload that frequency (Hz) of PWM pulses in channel 2.")]
+    public partial class CreateTimestampedPwmChannel2FrequencyPayload : CreatePwmChannel2FrequencyPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that frequency (Hz) of PWM pulses in channel 2.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmChannel2Frequency register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel2Frequency.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that frequency (Hz) of PWM pulses in channel 3.
+    /// </summary>
+    [DisplayName("PwmChannel3FrequencyPayload")]
+    [Description("Creates a message payload that frequency (Hz) of PWM pulses in channel 3.")]
+    public partial class CreatePwmChannel3FrequencyPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that frequency (Hz) of PWM pulses in channel 3.
+        /// </summary>
+        [Range(min: 0.5, max: 32768)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that frequency (Hz) of PWM pulses in channel 3.")]
+        public float PwmChannel3Frequency { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PwmChannel3Frequency register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return PwmChannel3Frequency;
+        }
+
+        /// <summary>
+        /// Creates a message that frequency (Hz) of PWM pulses in channel 3.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmChannel3Frequency register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel3Frequency.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that frequency (Hz) of PWM pulses in channel 3.
+    /// </summary>
+    [DisplayName("TimestampedPwmChannel3FrequencyPayload")]
+    [Description("Creates a timestamped message payload that frequency (Hz) of PWM pulses in channel 3.")]
+    public partial class CreateTimestampedPwmChannel3FrequencyPayload : CreatePwmChannel3FrequencyPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that frequency (Hz) of PWM pulses in channel 3.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmChannel3Frequency register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel3Frequency.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that duty cycle (0-100) of PWM pulses in channel 0.
+    /// </summary>
+    [DisplayName("PwmChannel0DutyCyclePayload")]
+    [Description("Creates a message payload that duty cycle (0-100) of PWM pulses in channel 0.")]
+    public partial class CreatePwmChannel0DutyCyclePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that duty cycle (0-100) of PWM pulses in channel 0.
+        /// </summary>
+        [Range(min: 0.1, max: 99.9)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that duty cycle (0-100) of PWM pulses in channel 0.")]
+        public float PwmChannel0DutyCycle { get; set; } = 50F;
+
+        /// <summary>
+        /// Creates a message payload for the PwmChannel0DutyCycle register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return PwmChannel0DutyCycle;
+        }
+
+        /// <summary>
+        /// Creates a message that duty cycle (0-100) of PWM pulses in channel 0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmChannel0DutyCycle register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel0DutyCycle.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that duty cycle (0-100) of PWM pulses in channel 0.
+    /// </summary>
+    [DisplayName("TimestampedPwmChannel0DutyCyclePayload")]
+    [Description("Creates a timestamped message payload that duty cycle (0-100) of PWM pulses in channel 0.")]
+    public partial class CreateTimestampedPwmChannel0DutyCyclePayload : CreatePwmChannel0DutyCyclePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that duty cycle (0-100) of PWM pulses in channel 0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmChannel0DutyCycle register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel0DutyCycle.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that duty cycle (0-100) of PWM pulses in channel 1.
+    /// </summary>
+    [DisplayName("PwmChannel1DutyCyclePayload")]
+    [Description("Creates a message payload that duty cycle (0-100) of PWM pulses in channel 1.")]
+    public partial class CreatePwmChannel1DutyCyclePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that duty cycle (0-100) of PWM pulses in channel 1.
+        /// </summary>
+        [Range(min: 0.1, max: 99.9)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that duty cycle (0-100) of PWM pulses in channel 1.")]
+        public float PwmChannel1DutyCycle { get; set; } = 50F;
+
+        /// <summary>
+        /// Creates a message payload for the PwmChannel1DutyCycle register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return PwmChannel1DutyCycle;
+        }
+
+        /// <summary>
+        /// Creates a message that duty cycle (0-100) of PWM pulses in channel 1.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmChannel1DutyCycle register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel1DutyCycle.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that duty cycle (0-100) of PWM pulses in channel 1.
+    /// </summary>
+    [DisplayName("TimestampedPwmChannel1DutyCyclePayload")]
+    [Description("Creates a timestamped message payload that duty cycle (0-100) of PWM pulses in channel 1.")]
+    public partial class CreateTimestampedPwmChannel1DutyCyclePayload : CreatePwmChannel1DutyCyclePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that duty cycle (0-100) of PWM pulses in channel 1.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmChannel1DutyCycle register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel1DutyCycle.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that duty cycle (0-100) of PWM pulses in channel 2.
+    /// </summary>
+    [DisplayName("PwmChannel2DutyCyclePayload")]
+    [Description("Creates a message payload that duty cycle (0-100) of PWM pulses in channel 2.")]
+    public partial class CreatePwmChannel2DutyCyclePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that duty cycle (0-100) of PWM pulses in channel 2.
+        /// </summary>
+        [Range(min: 0.1, max: 99.9)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that duty cycle (0-100) of PWM pulses in channel 2.")]
+        public float PwmChannel2DutyCycle { get; set; } = 50F;
+
+        /// <summary>
+        /// Creates a message payload for the PwmChannel2DutyCycle register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return PwmChannel2DutyCycle;
+        }
+
+        /// <summary>
+        /// Creates a message that duty cycle (0-100) of PWM pulses in channel 2.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmChannel2DutyCycle register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel2DutyCycle.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that duty cycle (0-100) of PWM pulses in channel 2.
+    /// </summary>
+    [DisplayName("TimestampedPwmChannel2DutyCyclePayload")]
+    [Description("Creates a timestamped message payload that duty cycle (0-100) of PWM pulses in channel 2.")]
+    public partial class CreateTimestampedPwmChannel2DutyCyclePayload : CreatePwmChannel2DutyCyclePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that duty cycle (0-100) of PWM pulses in channel 2.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmChannel2DutyCycle register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel2DutyCycle.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that duty cycle (0-100) of PWM pulses in channel 3.
+    /// </summary>
+    [DisplayName("PwmChannel3DutyCyclePayload")]
+    [Description("Creates a message payload that duty cycle (0-100) of PWM pulses in channel 3.")]
+    public partial class CreatePwmChannel3DutyCyclePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that duty cycle (0-100) of PWM pulses in channel 3.
+        /// </summary>
+        [Range(min: 0.1, max: 99.9)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that duty cycle (0-100) of PWM pulses in channel 3.")]
+        public float PwmChannel3DutyCycle { get; set; } = 50F;
+
+        /// <summary>
+        /// Creates a message payload for the PwmChannel3DutyCycle register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return PwmChannel3DutyCycle;
+        }
+
+        /// <summary>
+        /// Creates a message that duty cycle (0-100) of PWM pulses in channel 3.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmChannel3DutyCycle register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel3DutyCycle.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that duty cycle (0-100) of PWM pulses in channel 3.
+    /// </summary>
+    [DisplayName("TimestampedPwmChannel3DutyCyclePayload")]
+    [Description("Creates a timestamped message payload that duty cycle (0-100) of PWM pulses in channel 3.")]
+    public partial class CreateTimestampedPwmChannel3DutyCyclePayload : CreatePwmChannel3DutyCyclePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that duty cycle (0-100) of PWM pulses in channel 3.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmChannel3DutyCycle register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel3DutyCycle.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that total number of pulses to be generated in channel 0.
+    /// </summary>
+    [DisplayName("PwmChannel0PulseCountPayload")]
+    [Description("Creates a message payload that total number of pulses to be generated in channel 0.")]
+    public partial class CreatePwmChannel0PulseCountPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that total number of pulses to be generated in channel 0.
+        /// </summary>
+        [Range(min: 1, max: uint.MaxValue)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that total number of pulses to be generated in channel 0.")]
+        public uint PwmChannel0PulseCount { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PwmChannel0PulseCount register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return PwmChannel0PulseCount;
+        }
+
+        /// <summary>
+        /// Creates a message that total number of pulses to be generated in channel 0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmChannel0PulseCount register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel0PulseCount.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that total number of pulses to be generated in channel 0.
+    /// </summary>
+    [DisplayName("TimestampedPwmChannel0PulseCountPayload")]
+    [Description("Creates a timestamped message payload that total number of pulses to be generated in channel 0.")]
+    public partial class CreateTimestampedPwmChannel0PulseCountPayload : CreatePwmChannel0PulseCountPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that total number of pulses to be generated in channel 0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmChannel0PulseCount register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel0PulseCount.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that total number of pulses to be generated in channel 1.
+    /// </summary>
+    [DisplayName("PwmChannel1PulseCountPayload")]
+    [Description("Creates a message payload that total number of pulses to be generated in channel 1.")]
+    public partial class CreatePwmChannel1PulseCountPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that total number of pulses to be generated in channel 1.
+        /// </summary>
+        [Range(min: 1, max: uint.MaxValue)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that total number of pulses to be generated in channel 1.")]
+        public uint PwmChannel1PulseCount { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PwmChannel1PulseCount register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return PwmChannel1PulseCount;
+        }
+
+        /// <summary>
+        /// Creates a message that total number of pulses to be generated in channel 1.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmChannel1PulseCount register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel1PulseCount.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that total number of pulses to be generated in channel 1.
+    /// </summary>
+    [DisplayName("TimestampedPwmChannel1PulseCountPayload")]
+    [Description("Creates a timestamped message payload that total number of pulses to be generated in channel 1.")]
+    public partial class CreateTimestampedPwmChannel1PulseCountPayload : CreatePwmChannel1PulseCountPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that total number of pulses to be generated in channel 1.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmChannel1PulseCount register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel1PulseCount.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that total number of pulses to be generated in channel 2.
+    /// </summary>
+    [DisplayName("PwmChannel2PulseCountPayload")]
+    [Description("Creates a message payload that total number of pulses to be generated in channel 2.")]
+    public partial class CreatePwmChannel2PulseCountPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that total number of pulses to be generated in channel 2.
+        /// </summary>
+        [Range(min: 1, max: uint.MaxValue)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that total number of pulses to be generated in channel 2.")]
+        public uint PwmChannel2PulseCount { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PwmChannel2PulseCount register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return PwmChannel2PulseCount;
+        }
+
+        /// <summary>
+        /// Creates a message that total number of pulses to be generated in channel 2.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmChannel2PulseCount register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel2PulseCount.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that total number of pulses to be generated in channel 2.
+    /// </summary>
+    [DisplayName("TimestampedPwmChannel2PulseCountPayload")]
+    [Description("Creates a timestamped message payload that total number of pulses to be generated in channel 2.")]
+    public partial class CreateTimestampedPwmChannel2PulseCountPayload : CreatePwmChannel2PulseCountPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that total number of pulses to be generated in channel 2.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmChannel2PulseCount register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel2PulseCount.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that total number of pulses to be generated in channel 3.
+    /// </summary>
+    [DisplayName("PwmChannel3PulseCountPayload")]
+    [Description("Creates a message payload that total number of pulses to be generated in channel 3.")]
+    public partial class CreatePwmChannel3PulseCountPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that total number of pulses to be generated in channel 3.
+        /// </summary>
+        [Range(min: 1, max: uint.MaxValue)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that total number of pulses to be generated in channel 3.")]
+        public uint PwmChannel3PulseCount { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PwmChannel3PulseCount register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return PwmChannel3PulseCount;
+        }
+
+        /// <summary>
+        /// Creates a message that total number of pulses to be generated in channel 3.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmChannel3PulseCount register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel3PulseCount.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that total number of pulses to be generated in channel 3.
+    /// </summary>
+    [DisplayName("TimestampedPwmChannel3PulseCountPayload")]
+    [Description("Creates a timestamped message payload that total number of pulses to be generated in channel 3.")]
+    public partial class CreateTimestampedPwmChannel3PulseCountPayload : CreatePwmChannel3PulseCountPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that total number of pulses to be generated in channel 3.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmChannel3PulseCount register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel3PulseCount.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that real frequency (Hz) of PWM pulses in channel 0.
+    /// </summary>
+    [DisplayName("PwmChannel0RealFrequencyPayload")]
+    [Description("Creates a message payload that real frequency (Hz) of PWM pulses in channel 0.")]
+    public partial class CreatePwmChannel0RealFrequencyPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that real frequency (Hz) of PWM pulses in channel 0.
+        /// </summary>
+        [Description("The value that real frequency (Hz) of PWM pulses in channel 0.")]
+        public float PwmChannel0RealFrequency { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PwmChannel0RealFrequency register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return PwmChannel0RealFrequency;
+        }
+
+        /// <summary>
+        /// Creates a message that real frequency (Hz) of PWM pulses in channel 0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmChannel0RealFrequency register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel0RealFrequency.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that real frequency (Hz) of PWM pulses in channel 0.
+    /// </summary>
+    [DisplayName("TimestampedPwmChannel0RealFrequencyPayload")]
+    [Description("Creates a timestamped message payload that real frequency (Hz) of PWM pulses in channel 0.")]
+    public partial class CreateTimestampedPwmChannel0RealFrequencyPayload : CreatePwmChannel0RealFrequencyPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that real frequency (Hz) of PWM pulses in channel 0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmChannel0RealFrequency register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel0RealFrequency.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that real frequency (Hz) of PWM pulses in channel 1.
+    /// </summary>
+    [DisplayName("PwmChannel1RealFrequencyPayload")]
+    [Description("Creates a message payload that real frequency (Hz) of PWM pulses in channel 1.")]
+    public partial class CreatePwmChannel1RealFrequencyPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that real frequency (Hz) of PWM pulses in channel 1.
+        /// </summary>
+        [Description("The value that real frequency (Hz) of PWM pulses in channel 1.")]
+        public float PwmChannel1RealFrequency { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PwmChannel1RealFrequency register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return PwmChannel1RealFrequency;
+        }
+
+        /// <summary>
+        /// Creates a message that real frequency (Hz) of PWM pulses in channel 1.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmChannel1RealFrequency register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel1RealFrequency.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that real frequency (Hz) of PWM pulses in channel 1.
+    /// </summary>
+    [DisplayName("TimestampedPwmChannel1RealFrequencyPayload")]
+    [Description("Creates a timestamped message payload that real frequency (Hz) of PWM pulses in channel 1.")]
+    public partial class CreateTimestampedPwmChannel1RealFrequencyPayload : CreatePwmChannel1RealFrequencyPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that real frequency (Hz) of PWM pulses in channel 1.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmChannel1RealFrequency register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel1RealFrequency.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that real frequency (Hz) of PWM pulses in channel 2.
+    /// </summary>
+    [DisplayName("PwmChannel2RealFrequencyPayload")]
+    [Description("Creates a message payload that real frequency (Hz) of PWM pulses in channel 2.")]
+    public partial class CreatePwmChannel2RealFrequencyPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that real frequency (Hz) of PWM pulses in channel 2.
+        /// </summary>
+        [Description("The value that real frequency (Hz) of PWM pulses in channel 2.")]
+        public float PwmChannel2RealFrequency { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PwmChannel2RealFrequency register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return PwmChannel2RealFrequency;
+        }
+
+        /// <summary>
+        /// Creates a message that real frequency (Hz) of PWM pulses in channel 2.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmChannel2RealFrequency register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel2RealFrequency.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that real frequency (Hz) of PWM pulses in channel 2.
+    /// </summary>
+    [DisplayName("TimestampedPwmChannel2RealFrequencyPayload")]
+    [Description("Creates a timestamped message payload that real frequency (Hz) of PWM pulses in channel 2.")]
+    public partial class CreateTimestampedPwmChannel2RealFrequencyPayload : CreatePwmChannel2RealFrequencyPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that real frequency (Hz) of PWM pulses in channel 2.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmChannel2RealFrequency register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel2RealFrequency.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that real frequency (Hz) of PWM pulses in channel 3.
+    /// </summary>
+    [DisplayName("PwmChannel3RealFrequencyPayload")]
+    [Description("Creates a message payload that real frequency (Hz) of PWM pulses in channel 3.")]
+    public partial class CreatePwmChannel3RealFrequencyPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that real frequency (Hz) of PWM pulses in channel 3.
+        /// </summary>
+        [Description("The value that real frequency (Hz) of PWM pulses in channel 3.")]
+        public float PwmChannel3RealFrequency { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PwmChannel3RealFrequency register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return PwmChannel3RealFrequency;
+        }
+
+        /// <summary>
+        /// Creates a message that real frequency (Hz) of PWM pulses in channel 3.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmChannel3RealFrequency register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel3RealFrequency.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that real frequency (Hz) of PWM pulses in channel 3.
+    /// </summary>
+    [DisplayName("TimestampedPwmChannel3RealFrequencyPayload")]
+    [Description("Creates a timestamped message payload that real frequency (Hz) of PWM pulses in channel 3.")]
+    public partial class CreateTimestampedPwmChannel3RealFrequencyPayload : CreatePwmChannel3RealFrequencyPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that real frequency (Hz) of PWM pulses in channel 3.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmChannel3RealFrequency register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel3RealFrequency.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that real duty cycle (0-100) of PWM pulses in channel 0.
+    /// </summary>
+    [DisplayName("PwmChannel0RealDutyCyclePayload")]
+    [Description("Creates a message payload that real duty cycle (0-100) of PWM pulses in channel 0.")]
+    public partial class CreatePwmChannel0RealDutyCyclePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that real duty cycle (0-100) of PWM pulses in channel 0.
+        /// </summary>
+        [Description("The value that real duty cycle (0-100) of PWM pulses in channel 0.")]
+        public float PwmChannel0RealDutyCycle { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PwmChannel0RealDutyCycle register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return PwmChannel0RealDutyCycle;
+        }
+
+        /// <summary>
+        /// Creates a message that real duty cycle (0-100) of PWM pulses in channel 0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmChannel0RealDutyCycle register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel0RealDutyCycle.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that real duty cycle (0-100) of PWM pulses in channel 0.
+    /// </summary>
+    [DisplayName("TimestampedPwmChannel0RealDutyCyclePayload")]
+    [Description("Creates a timestamped message payload that real duty cycle (0-100) of PWM pulses in channel 0.")]
+    public partial class CreateTimestampedPwmChannel0RealDutyCyclePayload : CreatePwmChannel0RealDutyCyclePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that real duty cycle (0-100) of PWM pulses in channel 0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmChannel0RealDutyCycle register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel0RealDutyCycle.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that real duty cycle (0-100) of PWM pulses in channel 1.
+    /// </summary>
+    [DisplayName("PwmChannel1RealDutyCyclePayload")]
+    [Description("Creates a message payload that real duty cycle (0-100) of PWM pulses in channel 1.")]
+    public partial class CreatePwmChannel1RealDutyCyclePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that real duty cycle (0-100) of PWM pulses in channel 1.
+        /// </summary>
+        [Description("The value that real duty cycle (0-100) of PWM pulses in channel 1.")]
+        public float PwmChannel1RealDutyCycle { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PwmChannel1RealDutyCycle register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return PwmChannel1RealDutyCycle;
+        }
+
+        /// <summary>
+        /// Creates a message that real duty cycle (0-100) of PWM pulses in channel 1.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmChannel1RealDutyCycle register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel1RealDutyCycle.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that real duty cycle (0-100) of PWM pulses in channel 1.
+    /// </summary>
+    [DisplayName("TimestampedPwmChannel1RealDutyCyclePayload")]
+    [Description("Creates a timestamped message payload that real duty cycle (0-100) of PWM pulses in channel 1.")]
+    public partial class CreateTimestampedPwmChannel1RealDutyCyclePayload : CreatePwmChannel1RealDutyCyclePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that real duty cycle (0-100) of PWM pulses in channel 1.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmChannel1RealDutyCycle register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel1RealDutyCycle.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that real duty cycle (0-100) of PWM pulses in channel 2.
+    /// </summary>
+    [DisplayName("PwmChannel2RealDutyCyclePayload")]
+    [Description("Creates a message payload that real duty cycle (0-100) of PWM pulses in channel 2.")]
+    public partial class CreatePwmChannel2RealDutyCyclePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that real duty cycle (0-100) of PWM pulses in channel 2.
+        /// </summary>
+        [Description("The value that real duty cycle (0-100) of PWM pulses in channel 2.")]
+        public float PwmChannel2RealDutyCycle { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PwmChannel2RealDutyCycle register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return PwmChannel2RealDutyCycle;
+        }
+
+        /// <summary>
+        /// Creates a message that real duty cycle (0-100) of PWM pulses in channel 2.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmChannel2RealDutyCycle register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel2RealDutyCycle.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that real duty cycle (0-100) of PWM pulses in channel 2.
+    /// </summary>
+    [DisplayName("TimestampedPwmChannel2RealDutyCyclePayload")]
+    [Description("Creates a timestamped message payload that real duty cycle (0-100) of PWM pulses in channel 2.")]
+    public partial class CreateTimestampedPwmChannel2RealDutyCyclePayload : CreatePwmChannel2RealDutyCyclePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that real duty cycle (0-100) of PWM pulses in channel 2.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmChannel2RealDutyCycle register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel2RealDutyCycle.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that real duty cycle (0-100) of PWM pulses in channel 3.
+    /// </summary>
+    [DisplayName("PwmChannel3RealDutyCyclePayload")]
+    [Description("Creates a message payload that real duty cycle (0-100) of PWM pulses in channel 3.")]
+    public partial class CreatePwmChannel3RealDutyCyclePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that real duty cycle (0-100) of PWM pulses in channel 3.
+        /// </summary>
+        [Description("The value that real duty cycle (0-100) of PWM pulses in channel 3.")]
+        public float PwmChannel3RealDutyCycle { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PwmChannel3RealDutyCycle register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return PwmChannel3RealDutyCycle;
+        }
+
+        /// <summary>
+        /// Creates a message that real duty cycle (0-100) of PWM pulses in channel 3.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmChannel3RealDutyCycle register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel3RealDutyCycle.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that real duty cycle (0-100) of PWM pulses in channel 3.
+    /// </summary>
+    [DisplayName("TimestampedPwmChannel3RealDutyCyclePayload")]
+    [Description("Creates a timestamped message payload that real duty cycle (0-100) of PWM pulses in channel 3.")]
+    public partial class CreateTimestampedPwmChannel3RealDutyCyclePayload : CreatePwmChannel3RealDutyCyclePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that real duty cycle (0-100) of PWM pulses in channel 3.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmChannel3RealDutyCycle register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel3RealDutyCycle.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that playback mode and clock source of channel 0.
+    /// </summary>
+    [DisplayName("PwmChannel0PlaybackModePayload")]
+    [Description("Creates a message payload that playback mode and clock source of channel 0.")]
+    public partial class CreatePwmChannel0PlaybackModePayload
+    {
+        /// <summary>
+        /// Gets or sets a value that specifies the playback mode.
+        /// </summary>
+        [Description("Specifies the playback mode.")]
+        public PlaybackMode PlaybackMode { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that specifies the clock source of the channel's timer.
+        /// </summary>
+        [Description("Specifies the clock source of the channel's timer.")]
+        public ClockSource ClockSource { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PwmChannel0PlaybackMode register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public PwmChannel0PlaybackModePayload GetPayload()
+        {
+            PwmChannel0PlaybackModePayload value;
+            value.PlaybackMode = PlaybackMode;
+            value.ClockSource = ClockSource;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that playback mode and clock source of channel 0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmChannel0PlaybackMode register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel0PlaybackMode.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that playback mode and clock source of channel 0.
+    /// </summary>
+    [DisplayName("TimestampedPwmChannel0PlaybackModePayload")]
+    [Description("Creates a timestamped message payload that playback mode and clock source of channel 0.")]
+    public partial class CreateTimestampedPwmChannel0PlaybackModePayload : CreatePwmChannel0PlaybackModePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that playback mode and clock source of channel 0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmChannel0PlaybackMode register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel0PlaybackMode.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that playback mode and clock source of channel 1.
+    /// </summary>
+    [DisplayName("PwmChannel1PlaybackModePayload")]
+    [Description("Creates a message payload that playback mode and clock source of channel 1.")]
+    public partial class CreatePwmChannel1PlaybackModePayload
+    {
+        /// <summary>
+        /// Gets or sets a value that specifies the playback mode.
+        /// </summary>
+        [Description("Specifies the playback mode.")]
+        public PlaybackMode PlaybackMode { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that specifies the clock source of the channel's timer.
+        /// </summary>
+        [Description("Specifies the clock source of the channel's timer.")]
+        public ClockSource ClockSource { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PwmChannel1PlaybackMode register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public PwmChannel1PlaybackModePayload GetPayload()
+        {
+            PwmChannel1PlaybackModePayload value;
+            value.PlaybackMode = PlaybackMode;
+            value.ClockSource = ClockSource;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that playback mode and clock source of channel 1.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmChannel1PlaybackMode register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel1PlaybackMode.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that playback mode and clock source of channel 1.
+    /// </summary>
+    [DisplayName("TimestampedPwmChannel1PlaybackModePayload")]
+    [Description("Creates a timestamped message payload that playback mode and clock source of channel 1.")]
+    public partial class CreateTimestampedPwmChannel1PlaybackModePayload : CreatePwmChannel1PlaybackModePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that playback mode and clock source of channel 1.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmChannel1PlaybackMode register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel1PlaybackMode.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that playback mode and clock source of channel 2.
+    /// </summary>
+    [DisplayName("PwmChannel2PlaybackModePayload")]
+    [Description("Creates a message payload that playback mode and clock source of channel 2.")]
+    public partial class CreatePwmChannel2PlaybackModePayload
+    {
+        /// <summary>
+        /// Gets or sets a value that specifies the playback mode.
+        /// </summary>
+        [Description("Specifies the playback mode.")]
+        public PlaybackMode PlaybackMode { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that specifies the clock source of the channel's timer.
+        /// </summary>
+        [Description("Specifies the clock source of the channel's timer.")]
+        public ClockSource ClockSource { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PwmChannel2PlaybackMode register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public PwmChannel2PlaybackModePayload GetPayload()
+        {
+            PwmChannel2PlaybackModePayload value;
+            value.PlaybackMode = PlaybackMode;
+            value.ClockSource = ClockSource;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that playback mode and clock source of channel 2.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmChannel2PlaybackMode register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel2PlaybackMode.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that playback mode and clock source of channel 2.
+    /// </summary>
+    [DisplayName("TimestampedPwmChannel2PlaybackModePayload")]
+    [Description("Creates a timestamped message payload that playback mode and clock source of channel 2.")]
+    public partial class CreateTimestampedPwmChannel2PlaybackModePayload : CreatePwmChannel2PlaybackModePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that playback mode and clock source of channel 2.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmChannel2PlaybackMode register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel2PlaybackMode.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that playback mode and clock source of channel 3.
+    /// </summary>
+    [DisplayName("PwmChannel3PlaybackModePayload")]
+    [Description("Creates a message payload that playback mode and clock source of channel 3.")]
+    public partial class CreatePwmChannel3PlaybackModePayload
+    {
+        /// <summary>
+        /// Gets or sets a value that specifies the playback mode.
+        /// </summary>
+        [Description("Specifies the playback mode.")]
+        public PlaybackMode PlaybackMode { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that specifies the clock source of the channel's timer.
+        /// </summary>
+        [Description("Specifies the clock source of the channel's timer.")]
+        public ClockSource ClockSource { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PwmChannel3PlaybackMode register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public PwmChannel3PlaybackModePayload GetPayload()
+        {
+            PwmChannel3PlaybackModePayload value;
+            value.PlaybackMode = PlaybackMode;
+            value.ClockSource = ClockSource;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that playback mode and clock source of channel 3.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmChannel3PlaybackMode register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel3PlaybackMode.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that playback mode and clock source of channel 3.
+    /// </summary>
+    [DisplayName("TimestampedPwmChannel3PlaybackModePayload")]
+    [Description("Creates a timestamped message payload that playback mode and clock source of channel 3.")]
+    public partial class CreateTimestampedPwmChannel3PlaybackModePayload : CreatePwmChannel3PlaybackModePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that playback mode and clock source of channel 3.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmChannel3PlaybackMode register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannel3PlaybackMode.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that target channels that will start the PWM sequence if Trigger0 is activated.
+    /// </summary>
+    [DisplayName("Trigger0TargetsPayload")]
+    [Description("Creates a message payload that target channels that will start the PWM sequence if Trigger0 is activated.")]
+    public partial class CreateTrigger0TargetsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that target channels that will start the PWM sequence if Trigger0 is activated.
+        /// </summary>
+        [Description("The value that target channels that will start the PWM sequence if Trigger0 is activated.")]
+        public PwmChannels Trigger0Targets { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Trigger0Targets register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public PwmChannels GetPayload()
+        {
+            return Trigger0Targets;
+        }
+
+        /// <summary>
+        /// Creates a message that target channels that will start the PWM sequence if Trigger0 is activated.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Trigger0Targets register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.Trigger0Targets.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that target channels that will start the PWM sequence if Trigger0 is activated.
+    /// </summary>
+    [DisplayName("TimestampedTrigger0TargetsPayload")]
+    [Description("Creates a timestamped message payload that target channels that will start the PWM sequence if Trigger0 is activated.")]
+    public partial class CreateTimestampedTrigger0TargetsPayload : CreateTrigger0TargetsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that target channels that will start the PWM sequence if Trigger0 is activated.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Trigger0Targets register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.Trigger0Targets.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that target channels that will start the PWM sequence if Trigger1 is activated.
+    /// </summary>
+    [DisplayName("Trigger1TargetsPayload")]
+    [Description("Creates a message payload that target channels that will start the PWM sequence if Trigger1 is activated.")]
+    public partial class CreateTrigger1TargetsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that target channels that will start the PWM sequence if Trigger1 is activated.
+        /// </summary>
+        [Description("The value that target channels that will start the PWM sequence if Trigger1 is activated.")]
+        public PwmChannels Trigger1Targets { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Trigger1Targets register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public PwmChannels GetPayload()
+        {
+            return Trigger1Targets;
+        }
+
+        /// <summary>
+        /// Creates a message that target channels that will start the PWM sequence if Trigger1 is activated.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Trigger1Targets register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.Trigger1Targets.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that target channels that will start the PWM sequence if Trigger1 is activated.
+    /// </summary>
+    [DisplayName("TimestampedTrigger1TargetsPayload")]
+    [Description("Creates a timestamped message payload that target channels that will start the PWM sequence if Trigger1 is activated.")]
+    public partial class CreateTimestampedTrigger1TargetsPayload : CreateTrigger1TargetsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that target channels that will start the PWM sequence if Trigger1 is activated.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Trigger1Targets register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.Trigger1Targets.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that target channels that will start the PWM sequence if Trigger2 is activated.
+    /// </summary>
+    [DisplayName("Trigger2TargetsPayload")]
+    [Description("Creates a message payload that target channels that will start the PWM sequence if Trigger2 is activated.")]
+    public partial class CreateTrigger2TargetsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that target channels that will start the PWM sequence if Trigger2 is activated.
+        /// </summary>
+        [Description("The value that target channels that will start the PWM sequence if Trigger2 is activated.")]
+        public PwmChannels Trigger2Targets { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Trigger2Targets register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public PwmChannels GetPayload()
+        {
+            return Trigger2Targets;
+        }
+
+        /// <summary>
+        /// Creates a message that target channels that will start the PWM sequence if Trigger2 is activated.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Trigger2Targets register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.Trigger2Targets.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that target channels that will start the PWM sequence if Trigger2 is activated.
+    /// </summary>
+    [DisplayName("TimestampedTrigger2TargetsPayload")]
+    [Description("Creates a timestamped message payload that target channels that will start the PWM sequence if Trigger2 is activated.")]
+    public partial class CreateTimestampedTrigger2TargetsPayload : CreateTrigger2TargetsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that target channels that will start the PWM sequence if Trigger2 is activated.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Trigger2Targets register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.Trigger2Targets.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that target channels that will start the PWM sequence if Trigger3 is activated.
+    /// </summary>
+    [DisplayName("Trigger3TargetsPayload")]
+    [Description("Creates a message payload that target channels that will start the PWM sequence if Trigger3 is activated.")]
+    public partial class CreateTrigger3TargetsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that target channels that will start the PWM sequence if Trigger3 is activated.
+        /// </summary>
+        [Description("The value that target channels that will start the PWM sequence if Trigger3 is activated.")]
+        public PwmChannels Trigger3Targets { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Trigger3Targets register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public PwmChannels GetPayload()
+        {
+            return Trigger3Targets;
+        }
+
+        /// <summary>
+        /// Creates a message that target channels that will start the PWM sequence if Trigger3 is activated.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Trigger3Targets register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.Trigger3Targets.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that target channels that will start the PWM sequence if Trigger3 is activated.
+    /// </summary>
+    [DisplayName("TimestampedTrigger3TargetsPayload")]
+    [Description("Creates a timestamped message payload that target channels that will start the PWM sequence if Trigger3 is activated.")]
+    public partial class CreateTimestampedTrigger3TargetsPayload : CreateTrigger3TargetsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that target channels that will start the PWM sequence if Trigger3 is activated.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Trigger3Targets register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.Trigger3Targets.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that emits a start software-trigger on the channels specified in the mask.
+    /// </summary>
+    [DisplayName("StartSoftwareTriggerPayload")]
+    [Description("Creates a message payload that emits a start software-trigger on the channels specified in the mask.")]
+    public partial class CreateStartSoftwareTriggerPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that emits a start software-trigger on the channels specified in the mask.
+        /// </summary>
+        [Description("The value that emits a start software-trigger on the channels specified in the mask.")]
+        public TriggerInputs StartSoftwareTrigger { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the StartSoftwareTrigger register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public TriggerInputs GetPayload()
+        {
+            return StartSoftwareTrigger;
+        }
+
+        /// <summary>
+        /// Creates a message that emits a start software-trigger on the channels specified in the mask.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the StartSoftwareTrigger register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.StartSoftwareTrigger.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that emits a start software-trigger on the channels specified in the mask.
+    /// </summary>
+    [DisplayName("TimestampedStartSoftwareTriggerPayload")]
+    [Description("Creates a timestamped message payload that emits a start software-trigger on the channels specified in the mask.")]
+    public partial class CreateTimestampedStartSoftwareTriggerPayload : CreateStartSoftwareTriggerPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that emits a start software-trigger on the channels specified in the mask.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the StartSoftwareTrigger register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.StartSoftwareTrigger.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that emits a stop software-trigger on the channels specified in the mask.
+    /// </summary>
+    [DisplayName("StopSoftwareTriggerPayload")]
+    [Description("Creates a message payload that emits a stop software-trigger on the channels specified in the mask.")]
+    public partial class CreateStopSoftwareTriggerPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that emits a stop software-trigger on the channels specified in the mask.
+        /// </summary>
+        [Description("The value that emits a stop software-trigger on the channels specified in the mask.")]
+        public TriggerInputs StopSoftwareTrigger { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the StopSoftwareTrigger register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public TriggerInputs GetPayload()
+        {
+            return StopSoftwareTrigger;
+        }
+
+        /// <summary>
+        /// Creates a message that emits a stop software-trigger on the channels specified in the mask.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the StopSoftwareTrigger register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.StopSoftwareTrigger.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that emits a stop software-trigger on the channels specified in the mask.
+    /// </summary>
+    [DisplayName("TimestampedStopSoftwareTriggerPayload")]
+    [Description("Creates a timestamped message payload that emits a stop software-trigger on the channels specified in the mask.")]
+    public partial class CreateTimestampedStopSoftwareTriggerPayload : CreateStopSoftwareTriggerPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that emits a stop software-trigger on the channels specified in the mask.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the StopSoftwareTrigger register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.StopSoftwareTrigger.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that arms the PWM channels specified in the mask. Once a PWM is triggered, it must be rearmed.
+    /// </summary>
+    [DisplayName("ArmPwmChannelsPayload")]
+    [Description("Creates a message payload that arms the PWM channels specified in the mask. Once a PWM is triggered, it must be rearmed.")]
+    public partial class CreateArmPwmChannelsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that arms the PWM channels specified in the mask. Once a PWM is triggered, it must be rearmed.
+        /// </summary>
+        [Description("The value that arms the PWM channels specified in the mask. Once a PWM is triggered, it must be rearmed.")]
+        public PwmChannels ArmPwmChannels { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ArmPwmChannels register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public PwmChannels GetPayload()
+        {
+            return ArmPwmChannels;
+        }
+
+        /// <summary>
+        /// Creates a message that arms the PWM channels specified in the mask. Once a PWM is triggered, it must be rearmed.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ArmPwmChannels register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.ArmPwmChannels.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that arms the PWM channels specified in the mask. Once a PWM is triggered, it must be rearmed.
+    /// </summary>
+    [DisplayName("TimestampedArmPwmChannelsPayload")]
+    [Description("Creates a timestamped message payload that arms the PWM channels specified in the mask. Once a PWM is triggered, it must be rearmed.")]
+    public partial class CreateTimestampedArmPwmChannelsPayload : CreateArmPwmChannelsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that arms the PWM channels specified in the mask. Once a PWM is triggered, it must be rearmed.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ArmPwmChannels register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.ArmPwmChannels.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that trigger mode of input channel 0.
+    /// </summary>
+    [DisplayName("Trigger0ModePayload")]
+    [Description("Creates a message payload that trigger mode of input channel 0.")]
+    public partial class CreateTrigger0ModePayload
+    {
+        /// <summary>
+        /// Gets or sets a value that specifies the trigger mode.
+        /// </summary>
+        [Description("Specifies the trigger mode.")]
+        public TriggerModeConfig TriggerMode { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that specifies the polarity of the trigger signal.
+        /// </summary>
+        [Description("Specifies the polarity of the trigger signal.")]
+        public TriggerPolarity Polarity { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Trigger0Mode register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public Trigger0ModePayload GetPayload()
+        {
+            Trigger0ModePayload value;
+            value.TriggerMode = TriggerMode;
+            value.Polarity = Polarity;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that trigger mode of input channel 0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Trigger0Mode register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.Trigger0Mode.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that trigger mode of input channel 0.
+    /// </summary>
+    [DisplayName("TimestampedTrigger0ModePayload")]
+    [Description("Creates a timestamped message payload that trigger mode of input channel 0.")]
+    public partial class CreateTimestampedTrigger0ModePayload : CreateTrigger0ModePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that trigger mode of input channel 0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Trigger0Mode register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.Trigger0Mode.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that trigger mode of input channel 1.
+    /// </summary>
+    [DisplayName("Trigger1ModePayload")]
+    [Description("Creates a message payload that trigger mode of input channel 1.")]
+    public partial class CreateTrigger1ModePayload
+    {
+        /// <summary>
+        /// Gets or sets a value that specifies the trigger mode.
+        /// </summary>
+        [Description("Specifies the trigger mode.")]
+        public TriggerModeConfig TriggerMode { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that specifies the polarity of the trigger signal.
+        /// </summary>
+        [Description("Specifies the polarity of the trigger signal.")]
+        public TriggerPolarity Polarity { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Trigger1Mode register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public Trigger1ModePayload GetPayload()
+        {
+            Trigger1ModePayload value;
+            value.TriggerMode = TriggerMode;
+            value.Polarity = Polarity;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that trigger mode of input channel 1.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Trigger1Mode register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.Trigger1Mode.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that trigger mode of input channel 1.
+    /// </summary>
+    [DisplayName("TimestampedTrigger1ModePayload")]
+    [Description("Creates a timestamped message payload that trigger mode of input channel 1.")]
+    public partial class CreateTimestampedTrigger1ModePayload : CreateTrigger1ModePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that trigger mode of input channel 1.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Trigger1Mode register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.Trigger1Mode.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that trigger mode of input channel 2.
+    /// </summary>
+    [DisplayName("Trigger2ModePayload")]
+    [Description("Creates a message payload that trigger mode of input channel 2.")]
+    public partial class CreateTrigger2ModePayload
+    {
+        /// <summary>
+        /// Gets or sets a value that specifies the trigger mode.
+        /// </summary>
+        [Description("Specifies the trigger mode.")]
+        public TriggerModeConfig TriggerMode { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that specifies the polarity of the trigger signal.
+        /// </summary>
+        [Description("Specifies the polarity of the trigger signal.")]
+        public TriggerPolarity Polarity { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Trigger2Mode register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public Trigger2ModePayload GetPayload()
+        {
+            Trigger2ModePayload value;
+            value.TriggerMode = TriggerMode;
+            value.Polarity = Polarity;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that trigger mode of input channel 2.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Trigger2Mode register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.Trigger2Mode.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that trigger mode of input channel 2.
+    /// </summary>
+    [DisplayName("TimestampedTrigger2ModePayload")]
+    [Description("Creates a timestamped message payload that trigger mode of input channel 2.")]
+    public partial class CreateTimestampedTrigger2ModePayload : CreateTrigger2ModePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that trigger mode of input channel 2.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Trigger2Mode register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.Trigger2Mode.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that trigger mode of input channel 3.
+    /// </summary>
+    [DisplayName("Trigger3ModePayload")]
+    [Description("Creates a message payload that trigger mode of input channel 3.")]
+    public partial class CreateTrigger3ModePayload
+    {
+        /// <summary>
+        /// Gets or sets a value that specifies the trigger mode.
+        /// </summary>
+        [Description("Specifies the trigger mode.")]
+        public TriggerModeConfig TriggerMode { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that specifies the polarity of the trigger signal.
+        /// </summary>
+        [Description("Specifies the polarity of the trigger signal.")]
+        public TriggerPolarity Polarity { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Trigger3Mode register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public Trigger3ModePayload GetPayload()
+        {
+            Trigger3ModePayload value;
+            value.TriggerMode = TriggerMode;
+            value.Polarity = Polarity;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that trigger mode of input channel 3.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Trigger3Mode register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.Trigger3Mode.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that trigger mode of input channel 3.
+    /// </summary>
+    [DisplayName("TimestampedTrigger3ModePayload")]
+    [Description("Creates a timestamped message payload that trigger mode of input channel 3.")]
+    public partial class CreateTimestampedTrigger3ModePayload : CreateTrigger3ModePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that trigger mode of input channel 3.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Trigger3Mode register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.Trigger3Mode.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that if set to Low, it will bypass the EnablePwmChannels and ArmPwmChannels register function.
+    /// </summary>
+    [DisplayName("RequestEnablePayload")]
+    [Description("Creates a message payload that if set to Low, it will bypass the EnablePwmChannels and ArmPwmChannels register function.")]
+    public partial class CreateRequestEnablePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that if set to Low, it will bypass the EnablePwmChannels and ArmPwmChannels register function.
+        /// </summary>
+        [Description("The value that if set to Low, it will bypass the EnablePwmChannels and ArmPwmChannels register function.")]
+        public PwmChannels RequestEnable { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the RequestEnable register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public PwmChannels GetPayload()
+        {
+            return RequestEnable;
+        }
+
+        /// <summary>
+        /// Creates a message that if set to Low, it will bypass the EnablePwmChannels and ArmPwmChannels register function.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the RequestEnable register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.RequestEnable.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that if set to Low, it will bypass the EnablePwmChannels and ArmPwmChannels register function.
+    /// </summary>
+    [DisplayName("TimestampedRequestEnablePayload")]
+    [Description("Creates a timestamped message payload that if set to Low, it will bypass the EnablePwmChannels and ArmPwmChannels register function.")]
+    public partial class CreateTimestampedRequestEnablePayload : CreateRequestEnablePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that if set to Low, it will bypass the EnablePwmChannels and ArmPwmChannels register function.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the RequestEnable register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.RequestEnable.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that enable enable.
+    /// </summary>
+    [DisplayName("EnablePwmChannelsPayload")]
+    [Description("Creates a message payload that enable enable.")]
+    public partial class CreateEnablePwmChannelsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that enable enable.
+        /// </summary>
+        [Description("The value that enable enable.")]
+        public PwmChannels EnablePwmChannels { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EnablePwmChannels register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public PwmChannels GetPayload()
+        {
+            return EnablePwmChannels;
+        }
+
+        /// <summary>
+        /// Creates a message that enable enable.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EnablePwmChannels register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.EnablePwmChannels.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that enable enable.
+    /// </summary>
+    [DisplayName("TimestampedEnablePwmChannelsPayload")]
+    [Description("Creates a timestamped message payload that enable enable.")]
+    public partial class CreateTimestampedEnablePwmChannelsPayload : CreateEnablePwmChannelsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that enable enable.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EnablePwmChannels register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.EnablePwmChannels.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that when triggered, all channels will be affected by the event.
+    /// </summary>
+    [DisplayName("TriggerAllModePayload")]
+    [Description("Creates a message payload that when triggered, all channels will be affected by the event.")]
+    public partial class CreateTriggerAllModePayload
+    {
+        /// <summary>
+        /// Gets or sets a value that specifies the trigger mode.
+        /// </summary>
+        [Description("Specifies the trigger mode.")]
+        public TriggerAllModeConfig TriggerMode { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that specifies the polarity of the trigger signal.
+        /// </summary>
+        [Description("Specifies the polarity of the trigger signal.")]
+        public TriggerPolarity Polarity { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the TriggerAllMode register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public TriggerAllModePayload GetPayload()
+        {
+            TriggerAllModePayload value;
+            value.TriggerMode = TriggerMode;
+            value.Polarity = Polarity;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that when triggered, all channels will be affected by the event.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the TriggerAllMode register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.TriggerAllMode.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that when triggered, all channels will be affected by the event.
+    /// </summary>
+    [DisplayName("TimestampedTriggerAllModePayload")]
+    [Description("Creates a timestamped message payload that when triggered, all channels will be affected by the event.")]
+    public partial class CreateTimestampedTriggerAllModePayload : CreateTriggerAllModePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that when triggered, all channels will be affected by the event.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the TriggerAllMode register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.TriggerAllMode.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that current state of all trigger channel inputs.
+    /// </summary>
+    [DisplayName("TriggerChannelStatePayload")]
+    [Description("Creates a message payload that current state of all trigger channel inputs.")]
+    public partial class CreateTriggerChannelStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that current state of all trigger channel inputs.
+        /// </summary>
+        [Description("The value that current state of all trigger channel inputs.")]
+        public TriggerInputs TriggerChannelState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the TriggerChannelState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public TriggerInputs GetPayload()
+        {
+            return TriggerChannelState;
+        }
+
+        /// <summary>
+        /// Creates a message that current state of all trigger channel inputs.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the TriggerChannelState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.TriggerChannelState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that current state of all trigger channel inputs.
+    /// </summary>
+    [DisplayName("TimestampedTriggerChannelStatePayload")]
+    [Description("Creates a timestamped message payload that current state of all trigger channel inputs.")]
+    public partial class CreateTimestampedTriggerChannelStatePayload : CreateTriggerChannelStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that current state of all trigger channel inputs.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the TriggerChannelState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.TriggerChannelState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that current state of all PWM channel outputs.
+    /// </summary>
+    [DisplayName("PwmChannelStatePayload")]
+    [Description("Creates a message payload that current state of all PWM channel outputs.")]
+    public partial class CreatePwmChannelStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that current state of all PWM channel outputs.
+        /// </summary>
+        [Description("The value that current state of all PWM channel outputs.")]
+        public PwmChannels PwmChannelState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PwmChannelState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public PwmChannels GetPayload()
+        {
+            return PwmChannelState;
+        }
+
+        /// <summary>
+        /// Creates a message that current state of all PWM channel outputs.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmChannelState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannelState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that current state of all PWM channel outputs.
+    /// </summary>
+    [DisplayName("TimestampedPwmChannelStatePayload")]
+    [Description("Creates a timestamped message payload that current state of all PWM channel outputs.")]
+    public partial class CreateTimestampedPwmChannelStatePayload : CreatePwmChannelStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that current state of all PWM channel outputs.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmChannelState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmChannelState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the state of the PWM for each channel. Emits an event each time a PMW starts or stops.
+    /// </summary>
+    [DisplayName("PwmStatePayload")]
+    [Description("Creates a message payload that the state of the PWM for each channel. Emits an event each time a PMW starts or stops.")]
+    public partial class CreatePwmStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the state of the PWM for each channel. Emits an event each time a PMW starts or stops.
+        /// </summary>
+        [Description("The value that the state of the PWM for each channel. Emits an event each time a PMW starts or stops.")]
+        public PwmChannels PwmState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PwmState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public PwmChannels GetPayload()
+        {
+            return PwmState;
+        }
+
+        /// <summary>
+        /// Creates a message that the state of the PWM for each channel. Emits an event each time a PMW starts or stops.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the state of the PWM for each channel. Emits an event each time a PMW starts or stops.
+    /// </summary>
+    [DisplayName("TimestampedPwmStatePayload")]
+    [Description("Creates a timestamped message payload that the state of the PWM for each channel. Emits an event each time a PMW starts or stops.")]
+    public partial class CreateTimestampedPwmStatePayload : CreatePwmStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the state of the PWM for each channel. Emits an event each time a PMW starts or stops.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.PwmState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that enables the generation of events.
+    /// </summary>
+    [DisplayName("EnableEventsPayload")]
+    [Description("Creates a message payload that enables the generation of events.")]
+    public partial class CreateEnableEventsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that enables the generation of events.
+        /// </summary>
+        [Description("The value that enables the generation of events.")]
+        public MultiPwmEvents EnableEvents { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EnableEvents register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public MultiPwmEvents GetPayload()
+        {
+            return EnableEvents;
+        }
+
+        /// <summary>
+        /// Creates a message that enables the generation of events.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EnableEvents register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.EnableEvents.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that enables the generation of events.
+    /// </summary>
+    [DisplayName("TimestampedEnableEventsPayload")]
+    [Description("Creates a timestamped message payload that enables the generation of events.")]
+    public partial class CreateTimestampedEnableEventsPayload : CreateEnableEventsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that enables the generation of events.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EnableEvents register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.EnableEvents.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that enables the hardware frequency meter on the specified trigger inputs. Only trigger inputs 0 and 1 can be measured.
+    /// </summary>
+    [DisplayName("FrequencyMeterEnablePayload")]
+    [Description("Creates a message payload that enables the hardware frequency meter on the specified trigger inputs. Only trigger inputs 0 and 1 can be measured.")]
+    public partial class CreateFrequencyMeterEnablePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that enables the hardware frequency meter on the specified trigger inputs. Only trigger inputs 0 and 1 can be measured.
+        /// </summary>
+        [Description("The value that enables the hardware frequency meter on the specified trigger inputs. Only trigger inputs 0 and 1 can be measured.")]
+        public FrequencyMeterInputs FrequencyMeterEnable { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the FrequencyMeterEnable register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public FrequencyMeterInputs GetPayload()
+        {
+            return FrequencyMeterEnable;
+        }
+
+        /// <summary>
+        /// Creates a message that enables the hardware frequency meter on the specified trigger inputs. Only trigger inputs 0 and 1 can be measured.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the FrequencyMeterEnable register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.FrequencyMeterEnable.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that enables the hardware frequency meter on the specified trigger inputs. Only trigger inputs 0 and 1 can be measured.
+    /// </summary>
+    [DisplayName("TimestampedFrequencyMeterEnablePayload")]
+    [Description("Creates a timestamped message payload that enables the hardware frequency meter on the specified trigger inputs. Only trigger inputs 0 and 1 can be measured.")]
+    public partial class CreateTimestampedFrequencyMeterEnablePayload : CreateFrequencyMeterEnablePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that enables the hardware frequency meter on the specified trigger inputs. Only trigger inputs 0 and 1 can be measured.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the FrequencyMeterEnable register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.FrequencyMeterEnable.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that number of measured periods averaged before the frequency meter registers are updated.
+    /// </summary>
+    [DisplayName("FrequencyMeterWindowPayload")]
+    [Description("Creates a message payload that number of measured periods averaged before the frequency meter registers are updated.")]
+    public partial class CreateFrequencyMeterWindowPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that number of measured periods averaged before the frequency meter registers are updated.
+        /// </summary>
+        [Range(min: 1, max: byte.MaxValue)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that number of measured periods averaged before the frequency meter registers are updated.")]
+        public byte FrequencyMeterWindow { get; set; } = 10;
+
+        /// <summary>
+        /// Creates a message payload for the FrequencyMeterWindow register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return FrequencyMeterWindow;
+        }
+
+        /// <summary>
+        /// Creates a message that number of measured periods averaged before the frequency meter registers are updated.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the FrequencyMeterWindow register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.FrequencyMeterWindow.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that number of measured periods averaged before the frequency meter registers are updated.
+    /// </summary>
+    [DisplayName("TimestampedFrequencyMeterWindowPayload")]
+    [Description("Creates a timestamped message payload that number of measured periods averaged before the frequency meter registers are updated.")]
+    public partial class CreateTimestampedFrequencyMeterWindowPayload : CreateFrequencyMeterWindowPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that number of measured periods averaged before the frequency meter registers are updated.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PwmChannel0Frequency register.</returns>
+        /// <returns>A new timestamped message for the FrequencyMeterWindow register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel0Frequency.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.FrequencyMeterWindow.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that frequency (Hz) of PWM pulses in channel 1.
+    /// that measured period (ns) of the signal on trigger inputs 0 and 1. Zero if no signal is detected.
     /// </summary>
-    [DisplayName("PwmChannel1FrequencyPayload")]
-    [Description("Creates a message payload that frequency (Hz) of PWM pulses in channel 1.")]
-    public partial class CreatePwmChannel1FrequencyPayload
+    [DisplayName("TriggerPeriodPayload")]
+    [Description("Creates a message payload that measured period (ns) of the signal on trigger inputs 0 and 1. Zero if no signal is detected.")]
+    public partial class CreateTriggerPeriodPayload
     {
         /// <summary>
-        /// Gets or sets the value that frequency (Hz) of PWM pulses in channel 1.
+        /// Gets or sets the value that measured period (ns) of the signal on trigger inputs 0 and 1. Zero if no signal is detected.
         /// </summary>
-        [Description("The value that frequency (Hz) of PWM pulses in channel 1.")]
-        public float PwmChannel1Frequency { get; set; }
+        [Description("The value that measured period (ns) of the signal on trigger inputs 0 and 1. Zero if no signal is detected.")]
+        public uint[] TriggerPeriod { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the PwmChannel1Frequency register.
+        /// Creates a message payload for the TriggerPeriod register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public uint[] GetPayload()
         {
-            return PwmChannel1Frequency;
+            return TriggerPeriod;
         }
 
         /// <summary>
-        /// Creates a message that frequency (Hz) of PWM pulses in channel 1.
+        /// Creates a message that measured period (ns) of the signal on trigger inputs 0 and 1. Zero if no signal is detected.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PwmChannel1Frequency register.</returns>
+        /// <returns>A new message for the TriggerPeriod register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel1Frequency.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.TriggerPeriod.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that frequency (Hz) of PWM pulses in channel 1.
+    /// that measured period (ns) of the signal on trigger inputs 0 and 1. Zero if no signal is detected.
     /// </summary>
-    [DisplayName("TimestampedPwmChannel1FrequencyPayload")]
-    [Description("Creates a timestamped message payload that frequency (Hz) of PWM pulses in channel 1.")]
-    public partial class CreateTimestampedPwmChannel1FrequencyPayload : CreatePwmChannel1FrequencyPayload
+    [DisplayName("TimestampedTriggerPeriodPayload")]
+    [Description("Creates a timestamped message payload that measured period (ns) of the signal on trigger inputs 0 and 1. Zero if no signal is detected.")]
+    public partial class CreateTimestampedTriggerPeriodPayload : CreateTriggerPeriodPayload
     {
         /// <summary>
-        /// Creates a timestamped message that frequency (Hz) of PWM pulses in channel 1.
+        /// Creates a timestamped message that measured period (ns) of the signal on trigger inputs 0 and 1. Zero if no signal is detected.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PwmChannel1Frequency register.</returns>
+        /// <returns>A new timestamped message for the TriggerPeriod register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel1Frequency.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.TriggerPeriod.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that frequency (Hz) of PWM pulses in channel 2.
+    /// that measured frequency (Hz) of the signal on trigger inputs 0 and 1. Emits an event each time a measurement window completes.
     /// </summary>
-    [DisplayName("PwmChannel2FrequencyPayload")]
-    [Description("Creates a message payload that frequency (Hz) of PWM pulses in channel 2.")]
-    public partial class CreatePwmChannel2FrequencyPayload
+    [DisplayName("TriggerFrequencyPayload")]
+    [Description("Creates a message payload that measured frequency (Hz) of the signal on trigger inputs 0 and 1. Emits an event each time a measurement window completes.")]
+    public partial class CreateTriggerFrequencyPayload
     {
         /// <summary>
-        /// Gets or sets the value that frequency (Hz) of PWM pulses in channel 2.
+        /// Gets or sets the value that measured frequency (Hz) of the signal on trigger inputs 0 and 1. Emits an event each time a measurement window completes.
         /// </summary>
-        [Description("The value that frequency (Hz) of PWM pulses in channel 2.")]
-        public float PwmChannel2Frequency { get; set; }
+        [Description("The value that measured frequency (Hz) of the signal on trigger inputs 0 and 1. Emits an event each time a measurement window completes.")]
+        public float[] TriggerFrequency { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the PwmChannel2Frequency register.
+        /// Creates a message payload for the TriggerFrequency register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public float[] GetPayload()
         {
-            return PwmChannel2Frequency;
+            return TriggerFrequency;
         }
 
         /// <summary>
-        /// Creates a message that frequency (Hz) of PWM pulses in channel 2.
+        /// Creates a message that measured frequency (Hz) of the signal on trigger inputs 0 and 1. Emits an event each time a measurement window completes.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PwmChannel2Frequency register.</returns>
+        /// <returns>A new message for the TriggerFrequency register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel2Frequency.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.TriggerFrequency.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that frequency (Hz) of PWM pulses in channel 2.
+    /// that measured frequency (Hz) of the signal on trigger inputs 0 and 1. Emits an event each time a measurement window completes.
     /// </summary>
-    [DisplayName("TimestampedPwmChannel2FrequencyPayload")]
-    [Description("Creates a timestamped message payload that frequency (Hz) of PWM pulses in channel 2.")]
-    public partial class CreateTimestampedPwmChannel2FrequencyPayload : CreatePwmChannel2FrequencyPayload
+    [DisplayName("TimestampedTriggerFrequencyPayload")]
+    [Description("Creates a timestamped message payload that measured frequency (Hz) of the signal on trigger inputs 0 and 1. Emits an event each time a measurement window completes.")]
+    public partial class CreateTimestampedTriggerFrequencyPayload : CreateTriggerFrequencyPayload
     {
         /// <summary>
-        /// Creates a timestamped message that frequency (Hz) of PWM pulses in channel 2.
+        /// Creates a timestamped message that measured frequency (Hz) of the signal on trigger inputs 0 and 1. Emits an event each time a measurement window completes.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PwmChannel2Frequency register.</returns>
+        /// <returns>A new timestamped message for the TriggerFrequency register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel2Frequency.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.TriggerFrequency.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that frequency (Hz) of PWM pulses in channel 3.
+    /// that measured duty cycle (0-100) of the signal on trigger inputs 0 and 1.
     /// </summary>
-    [DisplayName("PwmChannel3FrequencyPayload")]
-    [Description("Creates a message payload that frequency (Hz) of PWM pulses in channel 3.")]
-    public partial class CreatePwmChannel3FrequencyPayload
+    [DisplayName("TriggerDutyCyclePayload")]
+    [Description("Creates a message payload that measured duty cycle (0-100) of the signal on trigger inputs 0 and 1.")]
+    public partial class CreateTriggerDutyCyclePayload
     {
         /// <summary>
-        /// Gets or sets the value that frequency (Hz) of PWM pulses in channel 3.
+        /// Gets or sets the value that measured duty cycle (0-100) of the signal on trigger inputs 0 and 1.
         /// </summary>
-        [Description("The value that frequency (Hz) of PWM pulses in channel 3.")]
-        public float PwmChannel3Frequency { get; set; }
+        [Description("The value that measured duty cycle (0-100) of the signal on trigger inputs 0 and 1.")]
+        public float[] TriggerDutyCycle { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the PwmChannel3Frequency register.
+        /// Creates a message payload for the TriggerDutyCycle register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public float[] GetPayload()
         {
-            return PwmChannel3Frequency;
+            return TriggerDutyCycle;
         }
 
         /// <summary>
-        /// Creates a message that frequency (Hz) of PWM pulses in channel 3.
+        /// Creates a message that measured duty cycle (0-100) of the signal on trigger inputs 0 and 1.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PwmChannel3Frequency register.</returns>
+        /// <returns>A new message for the TriggerDutyCycle register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel3Frequency.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.TriggerDutyCycle.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that frequency (Hz) of PWM pulses in channel 3.
+    /// that measured duty cycle (0-100) of the signal on trigger inputs 0 and 1.
     /// </summary>
-    [DisplayName("TimestampedPwmChannel3FrequencyPayload")]
-    [Description("Creates a timestamped message payload that frequency (Hz) of PWM pulses in channel 3.")]
-    public partial class CreateTimestampedPwmChannel3FrequencyPayload : CreatePwmChannel3FrequencyPayload
+    [DisplayName("TimestampedTriggerDutyCyclePayload")]
+    [Description("Creates a timestamped message payload that measured duty cycle (0-100) of the signal on trigger inputs 0 and 1.")]
+    public partial class CreateTimestampedTriggerDutyCyclePayload : CreateTriggerDutyCyclePayload
     {
         /// <summary>
-        /// Creates a timestamped message that frequency (Hz) of PWM pulses in channel 3.
+        /// Creates a timestamped message that measured duty cycle (0-100) of the signal on trigger inputs 0 and 1.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PwmChannel3Frequency register.</returns>
+        /// <returns>A new timestamped message for the TriggerDutyCycle register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel3Frequency.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.TriggerDutyCycle.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that duty cycle (0-100) of PWM pulses in channel 0.
+    /// that period, in external clock cycles, of the channels clocked by a trigger input. When in use, the real frequency register reports the negative of this value.
     /// </summary>
-    [DisplayName("PwmChannel0DutyCyclePayload")]
-    [Description("Creates a message payload that duty cycle (0-100) of PWM pulses in channel 0.")]
-    public partial class CreatePwmChannel0DutyCyclePayload
+    [DisplayName("PwmExternalClockPeriodPayload")]
+    [Description("Creates a message payload that period, in external clock cycles, of the channels clocked by a trigger input. When in use, the real frequency register reports the negative of this value.")]
+    public partial class CreatePwmExternalClockPeriodPayload
     {
         /// <summary>
-        /// Gets or sets the value that duty cycle (0-100) of PWM pulses in channel 0.
+        /// Gets or sets the value that period, in external clock cycles, of the channels clocked by a trigger input. When in use, the real frequency register reports the negative of this value.
         /// </summary>
-        [Range(min: 0.1, max: 99.9)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that duty cycle (0-100) of PWM pulses in channel 0.")]
-        public float PwmChannel0DutyCycle { get; set; } = 50F;
+        [Description("The value that period, in external clock cycles, of the channels clocked by a trigger input. When in use, the real frequency register reports the negative of this value.")]
+        public ushort[] PwmExternalClockPeriod { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the PwmChannel0DutyCycle register.
+        /// Creates a message payload for the PwmExternalClockPeriod register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public ushort[] GetPayload()
         {
-            return PwmChannel0DutyCycle;
+            return PwmExternalClockPeriod;
         }
 
         /// <summary>
-        /// Creates a message that duty cycle (0-100) of PWM pulses in channel 0.
+        /// Creates a message that period, in external clock cycles, of the channels clocked by a trigger input. When in use, the real frequency register reports the negative of this value.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PwmChannel0DutyCycle register.</returns>
+        /// <returns>A new message for the PwmExternalClockPeriod register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel0DutyCycle.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.PwmExternalClockPeriod.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that duty cycle (0-100) of PWM pulses in channel 0.
+    /// that period, in external clock cycles, of the channels clocked by a trigger input. When in use, the real frequency register reports the negative of this value.
     /// </summary>
-    [DisplayName("TimestampedPwmChannel0DutyCyclePayload")]
-    [Description("Creates a timestamped message payload that duty cycle (0-100) of PWM pulses in channel 0.")]
-    public partial class CreateTimestampedPwmChannel0DutyCyclePayload : CreatePwmChannel0DutyCyclePayload
+    [DisplayName("TimestampedPwmExternalClockPeriodPayload")]
+    [Description("Creates a timestamped message payload that period, in external clock cycles, of the channels clocked by a trigger input. When in use, the real frequency register reports the negative of this value.")]
+    public partial class CreateTimestampedPwmExternalClockPeriodPayload : CreatePwmExternalClockPeriodPayload
     {
         /// <summary>
-        /// Creates a timestamped message that duty cycle (0-100) of PWM pulses in channel 0.
+        /// Creates a timestamped message that period, in external clock cycles, of the channels clocked by a trigger input. When in use, the real frequency register reports the negative of this value.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PwmChannel0DutyCycle register.</returns>
+        /// <returns>A new timestamped message for the PwmExternalClockPeriod register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel0DutyCycle.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.PwmExternalClockPeriod.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that duty cycle (0-100) of PWM pulses in channel 1.
+    /// that for each channel, the channels started as soon as it completes its pulse train in Count mode. Only the bits of the PwmChannels mask are valid.
     /// </summary>
-    [DisplayName("PwmChannel1DutyCyclePayload")]
-    [Description("Creates a message payload that duty cycle (0-100) of PWM pulses in channel 1.")]
-    public partial class CreatePwmChannel1DutyCyclePayload
+    [DisplayName("PwmChainedChannelsPayload")]
+    [Description("Creates a message payload that for each channel, the channels started as soon as it completes its pulse train in Count mode. Only the bits of the PwmChannels mask are valid.")]
+    public partial class CreatePwmChainedChannelsPayload
     {
         /// <summary>
-        /// Gets or sets the value that duty cycle (0-100) of PWM pulses in channel 1.
+        /// Gets or sets the value that for each channel, the channels started as soon as it completes its pulse train in Count mode. Only the bits of the PwmChannels mask are valid.
         /// </summary>
-        [Range(min: 0.1, max: 99.9)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that duty cycle (0-100) of PWM pulses in channel 1.")]
-        public float PwmChannel1DutyCycle { get; set; } = 50F;
+        [Description("The value that for each channel, the channels started as soon as it completes its pulse train in Count mode. Only the bits of the PwmChannels mask are valid.")]
+        public byte[] PwmChainedChannels { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the PwmChannel1DutyCycle register.
+        /// Creates a message payload for the PwmChainedChannels register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public byte[] GetPayload()
         {
-            return PwmChannel1DutyCycle;
+            return PwmChainedChannels;
         }
 
         /// <summary>
-        /// Creates a message that duty cycle (0-100) of PWM pulses in channel 1.
+        /// Creates a message that for each channel, the channels started as soon as it completes its pulse train in Count mode. Only the bits of the PwmChannels mask are valid.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PwmChannel1DutyCycle register.</returns>
+        /// <returns>A new message for the PwmChainedChannels register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel1DutyCycle.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.PwmChainedChannels.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that duty cycle (0-100) of PWM pulses in channel 1.
+    /// that for each channel, the channels started as soon as it completes its pulse train in Count mode. Only the bits of the PwmChannels mask are valid.
     /// </summary>
-    [DisplayName("TimestampedPwmChannel1DutyCyclePayload")]
-    [Description("Creates a timestamped message payload that duty cycle (0-100) of PWM pulses in channel 1.")]
-    public partial class CreateTimestampedPwmChannel1DutyCyclePayload : CreatePwmChannel1DutyCyclePayload
+    [DisplayName("TimestampedPwmChainedChannelsPayload")]
+    [Description("Creates a timestamped message payload that for each channel, the channels started as soon as it completes its pulse train in Count mode. Only the bits of the PwmChannels mask are valid.")]
+    public partial class CreateTimestampedPwmChainedChannelsPayload : CreatePwmChainedChannelsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that duty cycle (0-100) of PWM pulses in channel 1.
+        /// Creates a timestamped message that for each channel, the channels started as soon as it completes its pulse train in Count mode. Only the bits of the PwmChannels mask are valid.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PwmChannel1DutyCycle register.</returns>
+        /// <returns>A new timestamped message for the PwmChainedChannels register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel1DutyCycle.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.PwmChainedChannels.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that duty cycle (0-100) of PWM pulses in channel 2.
+    /// that truth table of each virtual trigger. Bit n is set when the virtual trigger is active for the input levels n, where bit 0 of n is TRIG_IN0, bit 3 is TRIG_IN3 and bit 4 is TRIG_ALL. Evaluated on every edge of the trigger inputs used as interrupts.
     /// </summary>
-    [DisplayName("PwmChannel2DutyCyclePayload")]
-    [Description("Creates a message payload that duty cycle (0-100) of PWM pulses in channel 2.")]
-    public partial class CreatePwmChannel2DutyCyclePayload
+    [DisplayName("VirtualTriggerTablePayload")]
+    [Description("Creates a message payload that truth table of each virtual trigger. Bit n is set when the virtual trigger is active for the input levels n, where bit 0 of n is TRIG_IN0, bit 3 is TRIG_IN3 and bit 4 is TRIG_ALL. Evaluated on every edge of the trigger inputs used as interrupts.")]
+    public partial class CreateVirtualTriggerTablePayload
     {
         /// <summary>
-        /// Gets or sets the value that duty cycle (0-100) of PWM pulses in channel 2.
+        /// Gets or sets the value that truth table of each virtual trigger. Bit n is set when the virtual trigger is active for the input levels n, where bit 0 of n is TRIG_IN0, bit 3 is TRIG_IN3 and bit 4 is TRIG_ALL. Evaluated on every edge of the trigger inputs used as interrupts.
         /// </summary>
-        [Range(min: 0.1, max: 99.9)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that duty cycle (0-100) of PWM pulses in channel 2.")]
-        public float PwmChannel2DutyCycle { get; set; } = 50F;
+        [Description("The value that truth table of each virtual trigger. Bit n is set when the virtual trigger is active for the input levels n, where bit 0 of n is TRIG_IN0, bit 3 is TRIG_IN3 and bit 4 is TRIG_ALL. Evaluated on every edge of the trigger inputs used as interrupts.")]
+        public uint[] VirtualTriggerTable { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the PwmChannel2DutyCycle register.
+        /// Creates a message payload for the VirtualTriggerTable register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public uint[] GetPayload()
         {
-            return PwmChannel2DutyCycle;
+            return VirtualTriggerTable;
         }
 
         /// <summary>
-        /// Creates a message that duty cycle (0-100) of PWM pulses in channel 2.
+        /// Creates a message that truth table of each virtual trigger. Bit n is set when the virtual trigger is active for the input levels n, where bit 0 of n is TRIG_IN0, bit 3 is TRIG_IN3 and bit 4 is TRIG_ALL. Evaluated on every edge of the trigger inputs used as interrupts.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PwmChannel2DutyCycle register.</returns>
+        /// <returns>A new message for the VirtualTriggerTable register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel2DutyCycle.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.VirtualTriggerTable.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that duty cycle (0-100) of PWM pulses in channel 2.
+    /// that truth table of each virtual trigger. Bit n is set when the virtual trigger is active for the input levels n, where bit 0 of n is TRIG_IN0, bit 3 is TRIG_IN3 and bit 4 is TRIG_ALL. Evaluated on every edge of the trigger inputs used as interrupts.
     /// </summary>
-    [DisplayName("TimestampedPwmChannel2DutyCyclePayload")]
-    [Description("Creates a timestamped message payload that duty cycle (0-100) of PWM pulses in channel 2.")]
-    public partial class CreateTimestampedPwmChannel2DutyCyclePayload : CreatePwmChannel2DutyCyclePayload
+    [DisplayName("TimestampedVirtualTriggerTablePayload")]
+    [Description("Creates a timestamped message payload that truth table of each virtual trigger. Bit n is set when the virtual trigger is active for the input levels n, where bit 0 of n is TRIG_IN0, bit 3 is TRIG_IN3 and bit 4 is TRIG_ALL. Evaluated on every edge of the trigger inputs used as interrupts.")]
+    public partial class CreateTimestampedVirtualTriggerTablePayload : CreateVirtualTriggerTablePayload
     {
         /// <summary>
-        /// Creates a timestamped message that duty cycle (0-100) of PWM pulses in channel 2.
+        /// Creates a timestamped message that truth table of each virtual trigger. Bit n is set when the virtual trigger is active for the input levels n, where bit 0 of n is TRIG_IN0, bit 3 is TRIG_IN3 and bit 4 is TRIG_ALL. Evaluated on every edge of the trigger inputs used as interrupts.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PwmChannel2DutyCycle register.</returns>
+        /// <returns>A new timestamped message for the VirtualTriggerTable register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel2DutyCycle.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.VirtualTriggerTable.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that duty cycle (0-100) of PWM pulses in channel 3.
+    /// that channels affected by each virtual trigger. Only the bits of the PwmChannels mask are valid.
     /// </summary>
-    [DisplayName("PwmChannel3DutyCyclePayload")]
-    [Description("Creates a message payload that duty cycle (0-100) of PWM pulses in channel 3.")]
-    public partial class CreatePwmChannel3DutyCyclePayload
+    [DisplayName("VirtualTriggerMaskPayload")]
+    [Description("Creates a message payload that channels affected by each virtual trigger. Only the bits of the PwmChannels mask are valid.")]
+    public partial class CreateVirtualTriggerMaskPayload
     {
         /// <summary>
-        /// Gets or sets the value that duty cycle (0-100) of PWM pulses in channel 3.
+        /// Gets or sets the value that channels affected by each virtual trigger. Only the bits of the PwmChannels mask are valid.
         /// </summary>
-        [Range(min: 0.1, max: 99.9)]
+        [Description("The value that channels affected by each virtual trigger. Only the bits of the PwmChannels mask are valid.")]
+        public byte[] VirtualTriggerMask { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the VirtualTriggerMask register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte[] GetPayload()
+        {
+            return VirtualTriggerMask;
+        }
+
+        /// <summary>
+        /// Creates a message that channels affected by each virtual trigger. Only the bits of the PwmChannels mask are valid.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the VirtualTriggerMask register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.VirtualTriggerMask.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that channels affected by each virtual trigger. Only the bits of the PwmChannels mask are valid.
+    /// </summary>
+    [DisplayName("TimestampedVirtualTriggerMaskPayload")]
+    [Description("Creates a timestamped message payload that channels affected by each virtual trigger. Only the bits of the PwmChannels mask are valid.")]
+    public partial class CreateTimestampedVirtualTriggerMaskPayload : CreateVirtualTriggerMaskPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that channels affected by each virtual trigger. Only the bits of the PwmChannels mask are valid.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the VirtualTriggerMask register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.VirtualTriggerMask.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that mode of each virtual trigger. Uses the values of TriggerModeConfig.
+    /// </summary>
+    [DisplayName("VirtualTriggerModePayload")]
+    [Description("Creates a message payload that mode of each virtual trigger. Uses the values of TriggerModeConfig.")]
+    public partial class CreateVirtualTriggerModePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that mode of each virtual trigger. Uses the values of TriggerModeConfig.
+        /// </summary>
+        [Description("The value that mode of each virtual trigger. Uses the values of TriggerModeConfig.")]
+        public byte[] VirtualTriggerMode { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the VirtualTriggerMode register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte[] GetPayload()
+        {
+            return VirtualTriggerMode;
+        }
+
+        /// <summary>
+        /// Creates a message that mode of each virtual trigger. Uses the values of TriggerModeConfig.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the VirtualTriggerMode register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.MultiPwm.VirtualTriggerMode.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that mode of each virtual trigger. Uses the values of TriggerModeConfig.
+    /// </summary>
+    [DisplayName("TimestampedVirtualTriggerModePayload")]
+    [Description("Creates a timestamped message payload that mode of each virtual trigger. Uses the values of TriggerModeConfig.")]
+    public partial class CreateTimestampedVirtualTriggerModePayload : CreateVirtualTriggerModePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that mode of each virtual trigger. Uses the values of TriggerModeConfig.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the VirtualTriggerMode register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.MultiPwm.VirtualTriggerMode.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that window, in microseconds, used to merge the changes of PwmState into a single PwmStateBatch event. The window starts at the first change, has a resolution of 500 us and is at most 50 ms. Zero disables the merging and PwmState events are sent instead.
+    /// </summary>
+    [DisplayName("EventCoalesceWindowPayload")]
+    [Description("Creates a message payload that window, in microseconds, used to merge the changes of PwmState into a single PwmStateBatch event. The window starts at the first change, has a resolution of 500 us and is at most 50 ms. Zero disables the merging and PwmState events are sent instead.")]
+    public partial class CreateEventCoalesceWindowPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that window, in microseconds, used to merge the changes of PwmState into a single PwmStateBatch event. The window starts at the first change, has a resolution of 500 us and is at most 50 ms. Zero disables the merging and PwmState events are sent instead.
+        /// </summary>
+        [Range(min: ushort.MinValue, max: 50000)]
         [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that duty cycle (0-100) of PWM pulses in channel 3.")]
-        public float PwmChannel3DutyCycle { get; set; } = 50F;
+        [Description("The value that window, in microseconds, used to merge the changes of PwmState into a single PwmStateBatch event. The window starts at the first change, has a resolution of 500 us and is at most 50 ms. Zero disables the merging and PwmState events are sent instead.")]
+        public ushort EventCoalesceWindow { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the PwmChannel3DutyCycle register.
+        /// Creates a message payload for the EventCoalesceWindow register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public ushort GetPayload()
         {
-            return PwmChannel3DutyCycle;
+            return EventCoalesceWindow;
         }
 
         /// <summary>
-        /// Creates a message that duty cycle (0-100) of PWM pulses in channel 3.
+        /// Creates a message that window, in microseconds, used to merge the changes of PwmState into a single PwmStateBatch event. The window starts at the first change, has a resolution of 500 us and is at most 50 ms. Zero disables the merging and PwmState events are sent instead.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PwmChannel3DutyCycle register.</returns>
+        /// <returns>A new message for the EventCoalesceWindow register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel3DutyCycle.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.EventCoalesceWindow.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that duty cycle (0-100) of PWM pulses in channel 3.
+    /// that window, in microseconds, used to merge the changes of PwmState into a single PwmStateBatch event. The window starts at the first change, has a resolution of 500 us and is at most 50 ms. Zero disables the merging and PwmState events are sent instead.
     /// </summary>
-    [DisplayName("TimestampedPwmChannel3DutyCyclePayload")]
-    [Description("Creates a timestamped message payload that duty cycle (0-100) of PWM pulses in channel 3.")]
-    public partial class CreateTimestampedPwmChannel3DutyCyclePayload : CreatePwmChannel3DutyCyclePayload
+    [DisplayName("TimestampedEventCoalesceWindowPayload")]
+    [Description("Creates a timestamped message payload that window, in microseconds, used to merge the changes of PwmState into a single PwmStateBatch event. The window starts at the first change, has a resolution of 500 us and is at most 50 ms. Zero disables the merging and PwmState events are sent instead.")]
+    public partial class CreateTimestampedEventCoalesceWindowPayload : CreateEventCoalesceWindowPayload
     {
         /// <summary>
-        /// Creates a timestamped message that duty cycle (0-100) of PWM pulses in channel 3.
+        /// Creates a timestamped message that window, in microseconds, used to merge the changes of PwmState into a single PwmStateBatch event. The window starts at the first change, has a resolution of 500 us and is at most 50 ms. Zero disables the merging and PwmState events are sent instead.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PwmChannel3DutyCycle register.</returns>
+        /// <returns>A new timestamped message for the EventCoalesceWindow register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel3DutyCycle.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.EventCoalesceWindow.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that total number of pulses to be generated in channel 0.
+    /// that changes of PwmState merged over EventCoalesceWindow. Holds the state of the channels at the end of the window, the channels that started and the channels that stopped. The event carries the timestamp of the first change.
     /// </summary>
-    [DisplayName("PwmChannel0PulseCountPayload")]
-    [Description("Creates a message payload that total number of pulses to be generated in channel 0.")]
-    public partial class CreatePwmChannel0PulseCountPayload
+    [DisplayName("PwmStateBatchPayload")]
+    [Description("Creates a message payload that changes of PwmState merged over EventCoalesceWindow. Holds the state of the channels at the end of the window, the channels that started and the channels that stopped. The event carries the timestamp of the first change.")]
+    public partial class CreatePwmStateBatchPayload
     {
         /// <summary>
-        /// Gets or sets the value that total number of pulses to be generated in channel 0.
+        /// Gets or sets the value that changes of PwmState merged over EventCoalesceWindow. Holds the state of the channels at the end of the window, the channels that started and the channels that stopped. The event carries the timestamp of the first change.
         /// </summary>
-        [Description("The value that total number of pulses to be generated in channel 0.")]
-        public uint PwmChannel0PulseCount { get; set; }
+        [Description("The value that changes of PwmState merged over EventCoalesceWindow. Holds the state of the channels at the end of the window, the channels that started and the channels that stopped. The event carries the timestamp of the first change.")]
+        public byte[] PwmStateBatch { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the PwmChannel0PulseCount register.
+        /// Creates a message payload for the PwmStateBatch register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public uint GetPayload()
+        public byte[] GetPayload()
         {
-            return PwmChannel0PulseCount;
+            return PwmStateBatch;
         }
 
         /// <summary>
-        /// Creates a message that total number of pulses to be generated in channel 0.
+        /// Creates a message that changes of PwmState merged over EventCoalesceWindow. Holds the state of the channels at the end of the window, the channels that started and the channels that stopped. The event carries the timestamp of the first change.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PwmChannel0PulseCount register.</returns>
+        /// <returns>A new message for the PwmStateBatch register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel0PulseCount.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.PwmStateBatch.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that total number of pulses to be generated in channel 0.
+    /// that changes of PwmState merged over EventCoalesceWindow. Holds the state of the channels at the end of the window, the channels that started and the channels that stopped. The event carries the timestamp of the first change.
     /// </summary>
-    [DisplayName("TimestampedPwmChannel0PulseCountPayload")]
-    [Description("Creates a timestamped message payload that total number of pulses to be generated in channel 0.")]
-    public partial class CreateTimestampedPwmChannel0PulseCountPayload : CreatePwmChannel0PulseCountPayload
+    [DisplayName("TimestampedPwmStateBatchPayload")]
+    [Description("Creates a timestamped message payload that changes of PwmState merged over EventCoalesceWindow. Holds the state of the channels at the end of the window, the channels that started and the channels that stopped. The event carries the timestamp of the first change.")]
+    public partial class CreateTimestampedPwmStateBatchPayload : CreatePwmStateBatchPayload
     {
         /// <summary>
-        /// Creates a timestamped message that total number of pulses to be generated in channel 0.
+        /// Creates a timestamped message that changes of PwmState merged over EventCoalesceWindow. Holds the state of the channels at the end of the window, the channels that started and the channels that stopped. The event carries the timestamp of the first change.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PwmChannel0PulseCount register.</returns>
+        /// <returns>A new timestamped message for the PwmStateBatch register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel0PulseCount.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.PwmStateBatch.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that total number of pulses to be generated in channel 1.
+    /// that five counters for each channel, channel 0 first. Pulses emitted, trains completed, accepted starts, starts ignored because the channel was running and starts ignored because the channel was disabled. Writing any value clears all counters.
     /// </summary>
-    [DisplayName("PwmChannel1PulseCountPayload")]
-    [Description("Creates a message payload that total number of pulses to be generated in channel 1.")]
-    public partial class CreatePwmChannel1PulseCountPayload
+    [DisplayName("PwmStatisticsPayload")]
+    [Description("Creates a message payload that five counters for each channel, channel 0 first. Pulses emitted, trains completed, accepted starts, starts ignored because the channel was running and starts ignored because the channel was disabled. Writing any value clears all counters.")]
+    public partial class CreatePwmStatisticsPayload
     {
         /// <summary>
-        /// Gets or sets the value that total number of pulses to be generated in channel 1.
+        /// Gets or sets the value that five counters for each channel, channel 0 first. Pulses emitted, trains completed, accepted starts, starts ignored because the channel was running and starts ignored because the channel was disabled. Writing any value clears all counters.
         /// </summary>
-        [Description("The value that total number of pulses to be generated in channel 1.")]
-        public uint PwmChannel1PulseCount { get; set; }
+        [Description("The value that five counters for each channel, channel 0 first. Pulses emitted, trains completed, accepted starts, starts ignored because the channel was running and starts ignored because the channel was disabled. Writing any value clears all counters.")]
+        public uint[] PwmStatistics { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the PwmChannel1PulseCount register.
+        /// Creates a message payload for the PwmStatistics register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public uint GetPayload()
+        public uint[] GetPayload()
         {
-            return PwmChannel1PulseCount;
+            return PwmStatistics;
         }
 
         /// <summary>
-        /// Creates a message that total number of pulses to be generated in channel 1.
+        /// Creates a message that five counters for each channel, channel 0 first. Pulses emitted, trains completed, accepted starts, starts ignored because the channel was running and starts ignored because the channel was disabled. Writing any value clears all counters.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PwmChannel1PulseCount register.</returns>
+        /// <returns>A new message for the PwmStatistics register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel1PulseCount.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.PwmStatistics.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that total number of pulses to be generated in channel 1.
+    /// that five counters for each channel, channel 0 first. Pulses emitted, trains completed, accepted starts, starts ignored because the channel was running and starts ignored because the channel was disabled. Writing any value clears all counters.
     /// </summary>
-    [DisplayName("TimestampedPwmChannel1PulseCountPayload")]
-    [Description("Creates a timestamped message payload that total number of pulses to be generated in channel 1.")]
-    public partial class CreateTimestampedPwmChannel1PulseCountPayload : CreatePwmChannel1PulseCountPayload
+    [DisplayName("TimestampedPwmStatisticsPayload")]
+    [Description("Creates a timestamped message payload that five counters for each channel, channel 0 first. Pulses emitted, trains completed, accepted starts, starts ignored because the channel was running and starts ignored because the channel was disabled. Writing any value clears all counters.")]
+    public partial class CreateTimestampedPwmStatisticsPayload : CreatePwmStatisticsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that total number of pulses to be generated in channel 1.
+        /// Creates a timestamped message that five counters for each channel, channel 0 first. Pulses emitted, trains completed, accepted starts, starts ignored because the channel was running and starts ignored because the channel was disabled. Writing any value clears all counters.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PwmChannel1PulseCount register.</returns>
+        /// <returns>A new timestamped message for the PwmStatistics register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel1PulseCount.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.PwmStatistics.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that total number of pulses to be generated in channel 2.
+    /// that configures the channels' statistics.
     /// </summary>
-    [DisplayName("PwmChannel2PulseCountPayload")]
-    [Description("Creates a message payload that total number of pulses to be generated in channel 2.")]
-    public partial class CreatePwmChannel2PulseCountPayload
+    [DisplayName("PwmStatisticsControlPayload")]
+    [Description("Creates a message payload that configures the channels' statistics.")]
+    public partial class CreatePwmStatisticsControlPayload
     {
         /// <summary>
-        /// Gets or sets the value that total number of pulses to be generated in channel 2.
+        /// Gets or sets the value that configures the channels' statistics.
         /// </summary>
-        [Description("The value that total number of pulses to be generated in channel 2.")]
-        public uint PwmChannel2PulseCount { get; set; }
+        [Description("The value that configures the channels' statistics.")]
+        public StatisticsControl PwmStatisticsControl { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the PwmChannel2PulseCount register.
+        /// Creates a message payload for the PwmStatisticsControl register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public uint GetPayload()
+        public StatisticsControl GetPayload()
         {
-            return PwmChannel2PulseCount;
+            return PwmStatisticsControl;
         }
 
         /// <summary>
-        /// Creates a message that total number of pulses to be generated in channel 2.
+        /// Creates a message that configures the channels' statistics.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PwmChannel2PulseCount register.</returns>
+        /// <returns>A new message for the PwmStatisticsControl register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel2PulseCount.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.PwmStatisticsControl.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that total number of pulses to be generated in channel 2.
+    /// that configures the channels' statistics.
     /// </summary>
-    [DisplayName("TimestampedPwmChannel2PulseCountPayload")]
-    [Description("Creates a timestamped message payload that total number of pulses to be generated in channel 2.")]
-    public partial class CreateTimestampedPwmChannel2PulseCountPayload : CreatePwmChannel2PulseCountPayload
+    [DisplayName("TimestampedPwmStatisticsControlPayload")]
+    [Description("Creates a timestamped message payload that configures the channels' statistics.")]
+    public partial class CreateTimestampedPwmStatisticsControlPayload : CreatePwmStatisticsControlPayload
     {
         /// <summary>
-        /// Creates a timestamped message that total number of pulses to be generated in channel 2.
+        /// Creates a timestamped message that configures the channels' statistics.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PwmChannel2PulseCount register.</returns>
+        /// <returns>A new timestamped message for the PwmStatisticsControl register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel2PulseCount.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.PwmStatisticsControl.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that total number of pulses to be generated in channel 3.
+    /// that for each running channel, the pulses left to emit in Count mode or the pulses emitted since the start in Infinite mode. Zero when the channel is stopped.
     /// </summary>
-    [DisplayName("PwmChannel3PulseCountPayload")]
-    [Description("Creates a message payload that total number of pulses to be generated in channel 3.")]
-    public partial class CreatePwmChannel3PulseCountPayload
+    [DisplayName("PwmRemainingCountPayload")]
+    [Description("Creates a message payload that for each running channel, the pulses left to emit in Count mode or the pulses emitted since the start in Infinite mode. Zero when the channel is stopped.")]
+    public partial class CreatePwmRemainingCountPayload
     {
         /// <summary>
-        /// Gets or sets the value that total number of pulses to be generated in channel 3.
+        /// Gets or sets the value that for each running channel, the pulses left to emit in Count mode or the pulses emitted since the start in Infinite mode. Zero when the channel is stopped.
         /// </summary>
-        [Description("The value that total number of pulses to be generated in channel 3.")]
-        public uint PwmChannel3PulseCount { get; set; }
+        [Description("The value that for each running channel, the pulses left to emit in Count mode or the pulses emitted since the start in Infinite mode. Zero when the channel is stopped.")]
+        public uint[] PwmRemainingCount { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the PwmChannel3PulseCount register.
+        /// Creates a message payload for the PwmRemainingCount register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public uint GetPayload()
+        public uint[] GetPayload()
         {
-            return PwmChannel3PulseCount;
+            return PwmRemainingCount;
         }
 
         /// <summary>
-        /// Creates a message that total number of pulses to be generated in channel 3.
+        /// Creates a message that for each running channel, the pulses left to emit in Count mode or the pulses emitted since the start in Infinite mode. Zero when the channel is stopped.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PwmChannel3PulseCount register.</returns>
+        /// <returns>A new message for the PwmRemainingCount register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel3PulseCount.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.PwmRemainingCount.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that total number of pulses to be generated in channel 3.
+    /// that for each running channel, the pulses left to emit in Count mode or the pulses emitted since the start in Infinite mode. Zero when the channel is stopped.
     /// </summary>
-    [DisplayName("TimestampedPwmChannel3PulseCountPayload")]
-    [Description("Creates a timestamped message payload that total number of pulses to be generated in channel 3.")]
-    public partial class CreateTimestampedPwmChannel3PulseCountPayload : CreatePwmChannel3PulseCountPayload
+    [DisplayName("TimestampedPwmRemainingCountPayload")]
+    [Description("Creates a timestamped message payload that for each running channel, the pulses left to emit in Count mode or the pulses emitted since the start in Infinite mode. Zero when the channel is stopped.")]
+    public partial class CreateTimestampedPwmRemainingCountPayload : CreatePwmRemainingCountPayload
     {
         /// <summary>
-        /// Creates a timestamped message that total number of pulses to be generated in channel 3.
+        /// Creates a timestamped message that for each running channel, the pulses left to emit in Count mode or the pulses emitted since the start in Infinite mode. Zero when the channel is stopped.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PwmChannel3PulseCount register.</returns>
+        /// <returns>A new timestamped message for the PwmRemainingCount register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel3PulseCount.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.PwmRemainingCount.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that real frequency (Hz) of PWM pulses in channel 0.
+    /// that for each channel, the number of pulses between PwmRemainingCount events. Zero disables the events of the channel.
     /// </summary>
-    [DisplayName("PwmChannel0RealFrequencyPayload")]
-    [Description("Creates a message payload that real frequency (Hz) of PWM pulses in channel 0.")]
-    public partial class CreatePwmChannel0RealFrequencyPayload
+    [DisplayName("PwmProgressIntervalPayload")]
+    [Description("Creates a message payload that for each channel, the number of pulses between PwmRemainingCount events. Zero disables the events of the channel.")]
+    public partial class CreatePwmProgressIntervalPayload
     {
         /// <summary>
-        /// Gets or sets the value that real frequency (Hz) of PWM pulses in channel 0.
+        /// Gets or sets the value that for each channel, the number of pulses between PwmRemainingCount events. Zero disables the events of the channel.
         /// </summary>
-        [Description("The value that real frequency (Hz) of PWM pulses in channel 0.")]
-        public float PwmChannel0RealFrequency { get; set; }
+        [Description("The value that for each channel, the number of pulses between PwmRemainingCount events. Zero disables the events of the channel.")]
+        public ushort[] PwmProgressInterval { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the PwmChannel0RealFrequency register.
+        /// Creates a message payload for the PwmProgressInterval register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public ushort[] GetPayload()
         {
-            return PwmChannel0RealFrequency;
+            return PwmProgressInterval;
         }
 
         /// <summary>
-        /// Creates a message that real frequency (Hz) of PWM pulses in channel 0.
+        /// Creates a message that for each channel, the number of pulses between PwmRemainingCount events. Zero disables the events of the channel.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PwmChannel0RealFrequency register.</returns>
+        /// <returns>A new message for the PwmProgressInterval register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel0RealFrequency.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.PwmProgressInterval.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that real frequency (Hz) of PWM pulses in channel 0.
+    /// that for each channel, the number of pulses between PwmRemainingCount events. Zero disables the events of the channel.
     /// </summary>
-    [DisplayName("TimestampedPwmChannel0RealFrequencyPayload")]
-    [Description("Creates a timestamped message payload that real frequency (Hz) of PWM pulses in channel 0.")]
-    public partial class CreateTimestampedPwmChannel0RealFrequencyPayload : CreatePwmChannel0RealFrequencyPayload
+    [DisplayName("TimestampedPwmProgressIntervalPayload")]
+    [Description("Creates a timestamped message payload that for each channel, the number of pulses between PwmRemainingCount events. Zero disables the events of the channel.")]
+    public partial class CreateTimestampedPwmProgressIntervalPayload : CreatePwmProgressIntervalPayload
     {
         /// <summary>
-        /// Creates a timestamped message that real frequency (Hz) of PWM pulses in channel 0.
+        /// Creates a timestamped message that for each channel, the number of pulses between PwmRemainingCount events. Zero disables the events of the channel.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PwmChannel0RealFrequency register.</returns>
+        /// <returns>A new timestamped message for the PwmProgressInterval register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel0RealFrequency.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.PwmProgressInterval.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that real frequency (Hz) of PWM pulses in channel 1.
+    /// that number of calls of the channel 0 to 3 compare interrupts, the trigger input 0 to 3 interrupts and the trigger all interrupt. Writing any value restarts the profiling. Only available on firmware built with PWM_PROFILING, reads as zero otherwise.
     /// </summary>
-    [DisplayName("PwmChannel1RealFrequencyPayload")]
-    [Description("Creates a message payload that real frequency (Hz) of PWM pulses in channel 1.")]
-    public partial class CreatePwmChannel1RealFrequencyPayload
+    [DisplayName("ProfilingInterruptCountPayload")]
+    [Description("Creates a message payload that number of calls of the channel 0 to 3 compare interrupts, the trigger input 0 to 3 interrupts and the trigger all interrupt. Writing any value restarts the profiling. Only available on firmware built with PWM_PROFILING, reads as zero otherwise.")]
+    public partial class CreateProfilingInterruptCountPayload
     {
         /// <summary>
-        /// Gets or sets the value that real frequency (Hz) of PWM pulses in channel 1.
+        /// Gets or sets the value that number of calls of the channel 0 to 3 compare interrupts, the trigger input 0 to 3 interrupts and the trigger all interrupt. Writing any value restarts the profiling. Only available on firmware built with PWM_PROFILING, reads as zero otherwise.
         /// </summary>
-        [Description("The value that real frequency (Hz) of PWM pulses in channel 1.")]
-        public float PwmChannel1RealFrequency { get; set; }
+        [Description("The value that number of calls of the channel 0 to 3 compare interrupts, the trigger input 0 to 3 interrupts and the trigger all interrupt. Writing any value restarts the profiling. Only available on firmware built with PWM_PROFILING, reads as zero otherwise.")]
+        public uint[] ProfilingInterruptCount { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the PwmChannel1RealFrequency register.
+        /// Creates a message payload for the ProfilingInterruptCount register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public uint[] GetPayload()
         {
-            return PwmChannel1RealFrequency;
+            return ProfilingInterruptCount;
         }
 
         /// <summary>
-        /// Creates a message that real frequency (Hz) of PWM pulses in channel 1.
+        /// Creates a message that number of calls of the channel 0 to 3 compare interrupts, the trigger input 0 to 3 interrupts and the trigger all interrupt. Writing any value restarts the profiling. Only available on firmware built with PWM_PROFILING, reads as zero otherwise.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PwmChannel1RealFrequency register.</returns>
+        /// <returns>A new message for the ProfilingInterruptCount register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel1RealFrequency.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.ProfilingInterruptCount.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that real frequency (Hz) of PWM pulses in channel 1.
+    /// that number of calls of the channel 0 to 3 compare interrupts, the trigger input 0 to 3 interrupts and the trigger all interrupt. Writing any value restarts the profiling. Only available on firmware built with PWM_PROFILING, reads as zero otherwise.
     /// </summary>
-    [DisplayName("TimestampedPwmChannel1RealFrequencyPayload")]
-    [Description("Creates a timestamped message payload that real frequency (Hz) of PWM pulses in channel 1.")]
-    public partial class CreateTimestampedPwmChannel1RealFrequencyPayload : CreatePwmChannel1RealFrequencyPayload
+    [DisplayName("TimestampedProfilingInterruptCountPayload")]
+    [Description("Creates a timestamped message payload that number of calls of the channel 0 to 3 compare interrupts, the trigger input 0 to 3 interrupts and the trigger all interrupt. Writing any value restarts the profiling. Only available on firmware built with PWM_PROFILING, reads as zero otherwise.")]
+    public partial class CreateTimestampedProfilingInterruptCountPayload : CreateProfilingInterruptCountPayload
     {
         /// <summary>
-        /// Creates a timestamped message that real frequency (Hz) of PWM pulses in channel 1.
+        /// Creates a timestamped message that number of calls of the channel 0 to 3 compare interrupts, the trigger input 0 to 3 interrupts and the trigger all interrupt. Writing any value restarts the profiling. Only available on firmware built with PWM_PROFILING, reads as zero otherwise.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PwmChannel1RealFrequency register.</returns>
+        /// <returns>A new timestamped message for the ProfilingInterruptCount register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel1RealFrequency.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.ProfilingInterruptCount.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that real frequency (Hz) of PWM pulses in channel 2.
+    /// that maximum CPU cycles spent on each of the profiled interrupts. Only available on firmware built with PWM_PROFILING.
     /// </summary>
-    [DisplayName("PwmChannel2RealFrequencyPayload")]
-    [Description("Creates a message payload that real frequency (Hz) of PWM pulses in channel 2.")]
-    public partial class CreatePwmChannel2RealFrequencyPayload
+    [DisplayName("ProfilingInterruptMaxCyclesPayload")]
+    [Description("Creates a message payload that maximum CPU cycles spent on each of the profiled interrupts. Only available on firmware built with PWM_PROFILING.")]
+    public partial class CreateProfilingInterruptMaxCyclesPayload
     {
         /// <summary>
-        /// Gets or sets the value that real frequency (Hz) of PWM pulses in channel 2.
+        /// Gets or sets the value that maximum CPU cycles spent on each of the profiled interrupts. Only available on firmware built with PWM_PROFILING.
         /// </summary>
-        [Description("The value that real frequency (Hz) of PWM pulses in channel 2.")]
-        public float PwmChannel2RealFrequency { get; set; }
+        [Description("The value that maximum CPU cycles spent on each of the profiled interrupts. Only available on firmware built with PWM_PROFILING.")]
+        public ushort[] ProfilingInterruptMaxCycles { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the PwmChannel2RealFrequency register.
+        /// Creates a message payload for the ProfilingInterruptMaxCycles register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public ushort[] GetPayload()
         {
-            return PwmChannel2RealFrequency;
+            return ProfilingInterruptMaxCycles;
         }
 
         /// <summary>
-        /// Creates a message that real frequency (Hz) of PWM pulses in channel 2.
+        /// Creates a message that maximum CPU cycles spent on each of the profiled interrupts. Only available on firmware built with PWM_PROFILING.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PwmChannel2RealFrequency register.</returns>
+        /// <returns>A new message for the ProfilingInterruptMaxCycles register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel2RealFrequency.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.ProfilingInterruptMaxCycles.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that real frequency (Hz) of PWM pulses in channel 2.
+    /// that maximum CPU cycles spent on each of the profiled interrupts. Only available on firmware built with PWM_PROFILING.
     /// </summary>
-    [DisplayName("TimestampedPwmChannel2RealFrequencyPayload")]
-    [Description("Creates a timestamped message payload that real frequency (Hz) of PWM pulses in channel 2.")]
-    public partial class CreateTimestampedPwmChannel2RealFrequencyPayload : CreatePwmChannel2RealFrequencyPayload
+    [DisplayName("TimestampedProfilingInterruptMaxCyclesPayload")]
+    [Description("Creates a timestamped message payload that maximum CPU cycles spent on each of the profiled interrupts. Only available on firmware built with PWM_PROFILING.")]
+    public partial class CreateTimestampedProfilingInterruptMaxCyclesPayload : CreateProfilingInterruptMaxCyclesPayload
     {
         /// <summary>
-        /// Creates a timestamped message that real frequency (Hz) of PWM pulses in channel 2.
+        /// Creates a timestamped message that maximum CPU cycles spent on each of the profiled interrupts. Only available on firmware built with PWM_PROFILING.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PwmChannel2RealFrequency register.</returns>
+        /// <returns>A new timestamped message for the ProfilingInterruptMaxCycles register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel2RealFrequency.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.ProfilingInterruptMaxCycles.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that real frequency (Hz) of PWM pulses in channel 3.
+    /// that mean CPU cycles spent on each of the profiled interrupts. Only available on firmware built with PWM_PROFILING.
     /// </summary>
-    [DisplayName("PwmChannel3RealFrequencyPayload")]
-    [Description("Creates a message payload that real frequency (Hz) of PWM pulses in channel 3.")]
-    public partial class CreatePwmChannel3RealFrequencyPayload
+    [DisplayName("ProfilingInterruptMeanCyclesPayload")]
+    [Description("Creates a message payload that mean CPU cycles spent on each of the profiled interrupts. Only available on firmware built with PWM_PROFILING.")]
+    public partial class CreateProfilingInterruptMeanCyclesPayload
     {
         /// <summary>
-        /// Gets or sets the value that real frequency (Hz) of PWM pulses in channel 3.
+        /// Gets or sets the value that mean CPU cycles spent on each of the profiled interrupts. Only available on firmware built with PWM_PROFILING.
         /// </summary>
-        [Description("The value that real frequency (Hz) of PWM pulses in channel 3.")]
-        public float PwmChannel3RealFrequency { get; set; }
+        [Description("The value that mean CPU cycles spent on each of the profiled interrupts. Only available on firmware built with PWM_PROFILING.")]
+        public ushort[] ProfilingInterruptMeanCycles { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the PwmChannel3RealFrequency register.
+        /// Creates a message payload for the ProfilingInterruptMeanCycles register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public ushort[] GetPayload()
         {
-            return PwmChannel3RealFrequency;
+            return ProfilingInterruptMeanCycles;
         }
 
         /// <summary>
-        /// Creates a message that real frequency (Hz) of PWM pulses in channel 3.
+        /// Creates a message that mean CPU cycles spent on each of the profiled interrupts. Only available on firmware built with PWM_PROFILING.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PwmChannel3RealFrequency register.</returns>
+        /// <returns>A new message for the ProfilingInterruptMeanCycles register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel3RealFrequency.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.ProfilingInterruptMeanCycles.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that real frequency (Hz) of PWM pulses in channel 3.
+    /// that mean CPU cycles spent on each of the profiled interrupts. Only available on firmware built with PWM_PROFILING.
     /// </summary>
-    [DisplayName("TimestampedPwmChannel3RealFrequencyPayload")]
-    [Description("Creates a timestamped message payload that real frequency (Hz) of PWM pulses in channel 3.")]
-    public partial class CreateTimestampedPwmChannel3RealFrequencyPayload : CreatePwmChannel3RealFrequencyPayload
+    [DisplayName("TimestampedProfilingInterruptMeanCyclesPayload")]
+    [Description("Creates a timestamped message payload that mean CPU cycles spent on each of the profiled interrupts. Only available on firmware built with PWM_PROFILING.")]
+    public partial class CreateTimestampedProfilingInterruptMeanCyclesPayload : CreateProfilingInterruptMeanCyclesPayload
     {
         /// <summary>
-        /// Creates a timestamped message that real frequency (Hz) of PWM pulses in channel 3.
+        /// Creates a timestamped message that mean CPU cycles spent on each of the profiled interrupts. Only available on firmware built with PWM_PROFILING.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PwmChannel3RealFrequency register.</returns>
+        /// <returns>A new timestamped message for the ProfilingInterruptMeanCycles register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel3RealFrequency.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.ProfilingInterruptMeanCycles.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that real duty cycle (0-100) of PWM pulses in channel 0.
+    /// that maximum CPU cycles from the start of a trigger interrupt to the start of a channel. Only available on firmware built with PWM_PROFILING.
     /// </summary>
-    [DisplayName("PwmChannel0RealDutyCyclePayload")]
-    [Description("Creates a message payload that real duty cycle (0-100) of PWM pulses in channel 0.")]
-    public partial class CreatePwmChannel0RealDutyCyclePayload
+    [DisplayName("ProfilingMaxLatencyPayload")]
+    [Description("Creates a message payload that maximum CPU cycles from the start of a trigger interrupt to the start of a channel. Only available on firmware built with PWM_PROFILING.")]
+    public partial class CreateProfilingMaxLatencyPayload
     {
         /// <summary>
-        /// Gets or sets the value that real duty cycle (0-100) of PWM pulses in channel 0.
+        /// Gets or sets the value that maximum CPU cycles from the start of a trigger interrupt to the start of a channel. Only available on firmware built with PWM_PROFILING.
         /// </summary>
-        [Description("The value that real duty cycle (0-100) of PWM pulses in channel 0.")]
-        public float PwmChannel0RealDutyCycle { get; set; }
+        [Description("The value that maximum CPU cycles from the start of a trigger interrupt to the start of a channel. Only available on firmware built with PWM_PROFILING.")]
+        public ushort ProfilingMaxLatency { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the PwmChannel0RealDutyCycle register.
+        /// Creates a message payload for the ProfilingMaxLatency register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public ushort GetPayload()
         {
-            return PwmChannel0RealDutyCycle;
+            return ProfilingMaxLatency;
         }
 
         /// <summary>
-        /// Creates a message that real duty cycle (0-100) of PWM pulses in channel 0.
+        /// Creates a message that maximum CPU cycles from the start of a trigger interrupt to the start of a channel. Only available on firmware built with PWM_PROFILING.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PwmChannel0RealDutyCycle register.</returns>
+        /// <returns>A new message for the ProfilingMaxLatency register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel0RealDutyCycle.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.ProfilingMaxLatency.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that real duty cycle (0-100) of PWM pulses in channel 0.
+    /// that maximum CPU cycles from the start of a trigger interrupt to the start of a channel. Only available on firmware built with PWM_PROFILING.
     /// </summary>
-    [DisplayName("TimestampedPwmChannel0RealDutyCyclePayload")]
-    [Description("Creates a timestamped message payload that real duty cycle (0-100) of PWM pulses in channel 0.")]
-    public partial class CreateTimestampedPwmChannel0RealDutyCyclePayload : CreatePwmChannel0RealDutyCyclePayload
+    [DisplayName("TimestampedProfilingMaxLatencyPayload")]
+    [Description("Creates a timestamped message payload that maximum CPU cycles from the start of a trigger interrupt to the start of a channel. Only available on firmware built with PWM_PROFILING.")]
+    public partial class CreateTimestampedProfilingMaxLatencyPayload : CreateProfilingMaxLatencyPayload
     {
         /// <summary>
-        /// Creates a timestamped message that real duty cycle (0-100) of PWM pulses in channel 0.
+        /// Creates a timestamped message that maximum CPU cycles from the start of a trigger interrupt to the start of a channel. Only available on firmware built with PWM_PROFILING.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PwmChannel0RealDutyCycle register.</returns>
+        /// <returns>A new timestamped message for the ProfilingMaxLatency register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel0RealDutyCycle.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.ProfilingMaxLatency.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that real duty cycle (0-100) of PWM pulses in channel 1.
+    /// that cPU load on the last second, in percentage, relative to the most idle second observed. Only available on firmware built with PWM_PROFILING.
     /// </summary>
-    [DisplayName("PwmChannel1RealDutyCyclePayload")]
-    [Description("Creates a message payload that real duty cycle (0-100) of PWM pulses in channel 1.")]
-    public partial class CreatePwmChannel1RealDutyCyclePayload
+    [DisplayName("ProfilingCpuLoadPayload")]
+    [Description("Creates a message payload that cPU load on the last second, in percentage, relative to the most idle second observed. Only available on firmware built with PWM_PROFILING.")]
+    public partial class CreateProfilingCpuLoadPayload
     {
         /// <summary>
-        /// Gets or sets the value that real duty cycle (0-100) of PWM pulses in channel 1.
+        /// Gets or sets the value that cPU load on the last second, in percentage, relative to the most idle second observed. Only available on firmware built with PWM_PROFILING.
         /// </summary>
-        [Description("The value that real duty cycle (0-100) of PWM pulses in channel 1.")]
-        public float PwmChannel1RealDutyCycle { get; set; }
+        [Description("The value that cPU load on the last second, in percentage, relative to the most idle second observed. Only available on firmware built with PWM_PROFILING.")]
+        public float ProfilingCpuLoad { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the PwmChannel1RealDutyCycle register.
+        /// Creates a message payload for the ProfilingCpuLoad register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
         public float GetPayload()
         {
-            return PwmChannel1RealDutyCycle;
+            return ProfilingCpuLoad;
         }
 
         /// <summary>
-        /// Creates a message that real duty cycle (0-100) of PWM pulses in channel 1.
+        /// Creates a message that cPU load on the last second, in percentage, relative to the most idle second observed. Only available on firmware built with PWM_PROFILING.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PwmChannel1RealDutyCycle register.</returns>
+        /// <returns>A new message for the ProfilingCpuLoad register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel1RealDutyCycle.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.ProfilingCpuLoad.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that real duty cycle (0-100) of PWM pulses in channel 1.
+    /// that cPU load on the last second, in percentage, relative to the most idle second observed. Only available on firmware built with PWM_PROFILING.
     /// </summary>
-    [DisplayName("TimestampedPwmChannel1RealDutyCyclePayload")]
-    [Description("Creates a timestamped message payload that real duty cycle (0-100) of PWM pulses in channel 1.")]
-    public partial class CreateTimestampedPwmChannel1RealDutyCyclePayload : CreatePwmChannel1RealDutyCyclePayload
+    [DisplayName("TimestampedProfilingCpuLoadPayload")]
+    [Description("Creates a timestamped message payload that cPU load on the last second, in percentage, relative to the most idle second observed. Only available on firmware built with PWM_PROFILING.")]
+    public partial class CreateTimestampedProfilingCpuLoadPayload : CreateProfilingCpuLoadPayload
     {
         /// <summary>
-        /// Creates a timestamped message that real duty cycle (0-100) of PWM pulses in channel 1.
+        /// Creates a timestamped message that cPU load on the last second, in percentage, relative to the most idle second observed. Only available on firmware built with PWM_PROFILING.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PwmChannel1RealDutyCycle register.</returns>
+        /// <returns>A new timestamped message for the ProfilingCpuLoad register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel1RealDutyCycle.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.ProfilingCpuLoad.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that real duty cycle (0-100) of PWM pulses in channel 2.
+    /// that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 0. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.
     /// </summary>
-    [DisplayName("PwmChannel2RealDutyCyclePayload")]
-    [Description("Creates a message payload that real duty cycle (0-100) of PWM pulses in channel 2.")]
-    public partial class CreatePwmChannel2RealDutyCyclePayload
+    [DisplayName("Channel0ConfigurationPayload")]
+    [Description("Creates a message payload that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 0. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.")]
+    public partial class CreateChannel0ConfigurationPayload
     {
         /// <summary>
-        /// Gets or sets the value that real duty cycle (0-100) of PWM pulses in channel 2.
+        /// Gets or sets the value that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 0. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.
         /// </summary>
-        [Description("The value that real duty cycle (0-100) of PWM pulses in channel 2.")]
-        public float PwmChannel2RealDutyCycle { get; set; }
+        [Description("The value that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 0. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.")]
+        public float[] Channel0Configuration { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the PwmChannel2RealDutyCycle register.
+        /// Creates a message payload for the Channel0Configuration register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public float[] GetPayload()
         {
-            return PwmChannel2RealDutyCycle;
+            return Channel0Configuration;
         }
 
         /// <summary>
-        /// Creates a message that real duty cycle (0-100) of PWM pulses in channel 2.
+        /// Creates a message that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 0. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PwmChannel2RealDutyCycle register.</returns>
+        /// <returns>A new message for the Channel0Configuration register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel2RealDutyCycle.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.Channel0Configuration.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that real duty cycle (0-100) of PWM pulses in channel 2.
+    /// that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 0. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.
     /// </summary>
-    [DisplayName("TimestampedPwmChannel2RealDutyCyclePayload")]
-    [Description("Creates a timestamped message payload that real duty cycle (0-100) of PWM pulses in channel 2.")]
-    public partial class CreateTimestampedPwmChannel2RealDutyCyclePayload : CreatePwmChannel2RealDutyCyclePayload
+    [DisplayName("TimestampedChannel0ConfigurationPayload")]
+    [Description("Creates a timestamped message payload that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 0. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.")]
+    public partial class CreateTimestampedChannel0ConfigurationPayload : CreateChannel0ConfigurationPayload
     {
         /// <summary>
-        /// Creates a timestamped message that real duty cycle (0-100) of PWM pulses in channel 2.
+        /// Creates a timestamped message that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 0. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PwmChannel2RealDutyCycle register.</returns>
+        /// <returns>A new timestamped message for the Channel0Configuration register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel2RealDutyCycle.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.Channel0Configuration.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that real duty cycle (0-100) of PWM pulses in channel 3.
+    /// that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 1. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.
     /// </summary>
-    [DisplayName("PwmChannel3RealDutyCyclePayload")]
-    [Description("Creates a message payload that real duty cycle (0-100) of PWM pulses in channel 3.")]
-    public partial class CreatePwmChannel3RealDutyCyclePayload
+    [DisplayName("Channel1ConfigurationPayload")]
+    [Description("Creates a message payload that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 1. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.")]
+    public partial class CreateChannel1ConfigurationPayload
     {
         /// <summary>
-        /// Gets or sets the value that real duty cycle (0-100) of PWM pulses in channel 3.
+        /// Gets or sets the value that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 1. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.
         /// </summary>
-        [Description("The value that real duty cycle (0-100) of PWM pulses in channel 3.")]
-        public float PwmChannel3RealDutyCycle { get; set; }
+        [Description("The value that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 1. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.")]
+        public float[] Channel1Configuration { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the PwmChannel3RealDutyCycle register.
+        /// Creates a message payload for the Channel1Configuration register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public float[] GetPayload()
         {
-            return PwmChannel3RealDutyCycle;
+            return Channel1Configuration;
         }
 
         /// <summary>
-        /// Creates a message that real duty cycle (0-100) of PWM pulses in channel 3.
+        /// Creates a message that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 1. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PwmChannel3RealDutyCycle register.</returns>
+        /// <returns>A new message for the Channel1Configuration register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel3RealDutyCycle.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.Channel1Configuration.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that real duty cycle (0-100) of PWM pulses in channel 3.
+    /// that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 1. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.
     /// </summary>
-    [DisplayName("TimestampedPwmChannel3RealDutyCyclePayload")]
-    [Description("Creates a timestamped message payload that real duty cycle (0-100) of PWM pulses in channel 3.")]
-    public partial class CreateTimestampedPwmChannel3RealDutyCyclePayload : CreatePwmChannel3RealDutyCyclePayload
+    [DisplayName("TimestampedChannel1ConfigurationPayload")]
+    [Description("Creates a timestamped message payload that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 1. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.")]
+    public partial class CreateTimestampedChannel1ConfigurationPayload : CreateChannel1ConfigurationPayload
     {
         /// <summary>
-        /// Creates a timestamped message that real duty cycle (0-100) of PWM pulses in channel 3.
+        /// Creates a timestamped message that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 1. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PwmChannel3RealDutyCycle register.</returns>
+        /// <returns>A new timestamped message for the Channel1Configuration register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel3RealDutyCycle.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.Channel1Configuration.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that playback mode of channel 0.
+    /// that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 2. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.
     /// </summary>
-    [DisplayName("PwmChannel0PlaybackModePayload")]
-    [Description("Creates a message payload that playback mode of channel 0.")]
-    public partial class CreatePwmChannel0PlaybackModePayload
+    [DisplayName("Channel2ConfigurationPayload")]
+    [Description("Creates a message payload that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 2. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.")]
+    public partial class CreateChannel2ConfigurationPayload
     {
         /// <summary>
-        /// Gets or sets the value that playback mode of channel 0.
+        /// Gets or sets the value that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 2. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.
         /// </summary>
-        [Description("The value that playback mode of channel 0.")]
-        public PlaybackMode PwmChannel0PlaybackMode { get; set; }
+        [Description("The value that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 2. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.")]
+        public float[] Channel2Configuration { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the PwmChannel0PlaybackMode register.
+        /// Creates a message payload for the Channel2Configuration register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public PlaybackMode GetPayload()
+        public float[] GetPayload()
         {
-            return PwmChannel0PlaybackMode;
+            return Channel2Configuration;
         }
 
         /// <summary>
-        /// Creates a message that playback mode of channel 0.
+        /// Creates a message that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 2. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PwmChannel0PlaybackMode register.</returns>
+        /// <returns>A new message for the Channel2Configuration register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel0PlaybackMode.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.Channel2Configuration.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that playback mode of channel 0.
+    /// that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 2. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.
     /// </summary>
-    [DisplayName("TimestampedPwmChannel0PlaybackModePayload")]
-    [Description("Creates a timestamped message payload that playback mode of channel 0.")]
-    public partial class CreateTimestampedPwmChannel0PlaybackModePayload : CreatePwmChannel0PlaybackModePayload
+    [DisplayName("TimestampedChannel2ConfigurationPayload")]
+    [Description("Creates a timestamped message payload that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 2. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.")]
+    public partial class CreateTimestampedChannel2ConfigurationPayload : CreateChannel2ConfigurationPayload
     {
         /// <summary>
-        /// Creates a timestamped message that playback mode of channel 0.
+        /// Creates a timestamped message that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 2. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PwmChannel0PlaybackMode register.</returns>
+        /// <returns>A new timestamped message for the Channel2Configuration register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel0PlaybackMode.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.Channel2Configuration.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that playback mode of channel 1.
+    /// that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 3. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.
     /// </summary>
-    [DisplayName("PwmChannel1PlaybackModePayload")]
-    [Description("Creates a message payload that playback mode of channel 1.")]
-    public partial class CreatePwmChannel1PlaybackModePayload
+    [DisplayName("Channel3ConfigurationPayload")]
+    [Description("Creates a message payload that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 3. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.")]
+    public partial class CreateChannel3ConfigurationPayload
     {
         /// <summary>
-        /// Gets or sets the value that playback mode of channel 1.
+        /// Gets or sets the value that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 3. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.
         /// </summary>
-        [Description("The value that playback mode of channel 1.")]
-        public PlaybackMode PwmChannel1PlaybackMode { get; set; }
+        [Description("The value that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 3. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.")]
+        public float[] Channel3Configuration { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the PwmChannel1PlaybackMode register.
+        /// Creates a message payload for the Channel3Configuration register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public PlaybackMode GetPayload()
+        public float[] GetPayload()
         {
-            return PwmChannel1PlaybackMode;
+            return Channel3Configuration;
         }
 
         /// <summary>
-        /// Creates a message that playback mode of channel 1.
+        /// Creates a message that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 3. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PwmChannel1PlaybackMode register.</returns>
+        /// <returns>A new message for the Channel3Configuration register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel1PlaybackMode.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.Channel3Configuration.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that playback mode of channel 1.
+    /// that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 3. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.
     /// </summary>
-    [DisplayName("TimestampedPwmChannel1PlaybackModePayload")]
-    [Description("Creates a timestamped message payload that playback mode of channel 1.")]
-    public partial class CreateTimestampedPwmChannel1PlaybackModePayload : CreatePwmChannel1PlaybackModePayload
+    [DisplayName("TimestampedChannel3ConfigurationPayload")]
+    [Description("Creates a timestamped message payload that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 3. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.")]
+    public partial class CreateTimestampedChannel3ConfigurationPayload : CreateChannel3ConfigurationPayload
     {
         /// <summary>
-        /// Creates a timestamped message that playback mode of channel 1.
+        /// Creates a timestamped message that frequency, duty cycle, counts, mode, real frequency and real duty cycle of channel 3. The first four are validated and applied together with a single update of the real values. The last two are ignored on writes and the reply carries the updated values. Counts must be an integer up to 16777216.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PwmChannel1PlaybackMode register.</returns>
+        /// <returns>A new timestamped message for the Channel3Configuration register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel1PlaybackMode.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.Channel3Configuration.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that playback mode of channel 2.
+    /// that the Channel0Configuration to Channel3Configuration registers in a single register. All channels are validated before any of them is applied.
     /// </summary>
-    [DisplayName("PwmChannel2PlaybackModePayload")]
-    [Description("Creates a message payload that playback mode of channel 2.")]
-    public partial class CreatePwmChannel2PlaybackModePayload
+    [DisplayName("ChannelsConfigurationPayload")]
+    [Description("Creates a message payload that the Channel0Configuration to Channel3Configuration registers in a single register. All channels are validated before any of them is applied.")]
+    public partial class CreateChannelsConfigurationPayload
     {
         /// <summary>
-        /// Gets or sets the value that playback mode of channel 2.
+        /// Gets or sets the value that the Channel0Configuration to Channel3Configuration registers in a single register. All channels are validated before any of them is applied.
         /// </summary>
-        [Description("The value that playback mode of channel 2.")]
-        public PlaybackMode PwmChannel2PlaybackMode { get; set; }
+        [Description("The value that the Channel0Configuration to Channel3Configuration registers in a single register. All channels are validated before any of them is applied.")]
+        public float[] ChannelsConfiguration { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the PwmChannel2PlaybackMode register.
+        /// Creates a message payload for the ChannelsConfiguration register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public PlaybackMode GetPayload()
+        public float[] GetPayload()
         {
-            return PwmChannel2PlaybackMode;
+            return ChannelsConfiguration;
         }
 
         /// <summary>
-        /// Creates a message that playback mode of channel 2.
+        /// Creates a message that the Channel0Configuration to Channel3Configuration registers in a single register. All channels are validated before any of them is applied.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PwmChannel2PlaybackMode register.</returns>
+        /// <returns>A new message for the ChannelsConfiguration register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel2PlaybackMode.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.ChannelsConfiguration.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that playback mode of channel 2.
+    /// that the Channel0Configuration to Channel3Configuration registers in a single register. All channels are validated before any of them is applied.
     /// </summary>
-    [DisplayName("TimestampedPwmChannel2PlaybackModePayload")]
-    [Description("Creates a timestamped message payload that playback mode of channel 2.")]
-    public partial class CreateTimestampedPwmChannel2PlaybackModePayload : CreatePwmChannel2PlaybackModePayload
+    [DisplayName("TimestampedChannelsConfigurationPayload")]
+    [Description("Creates a timestamped message payload that the Channel0Configuration to Channel3Configuration registers in a single register. All channels are validated before any of them is applied.")]
+    public partial class CreateTimestampedChannelsConfigurationPayload : CreateChannelsConfigurationPayload
     {
         /// <summary>
-        /// Creates a timestamped message that playback mode of channel 2.
+        /// Creates a timestamped message that the Channel0Configuration to Channel3Configuration registers in a single register. All channels are validated before any of them is applied.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PwmChannel2PlaybackMode register.</returns>
+        /// <returns>A new timestamped message for the ChannelsConfiguration register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel2PlaybackMode.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.ChannelsConfiguration.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that playback mode of channel 3.
+    /// that staged frequency, duty cycle and counts of each channel, channel 0 first. A channel written with a zero frequency keeps its staged configuration. Written values only take effect when committed with CommitStagedConfiguration.
     /// </summary>
-    [DisplayName("PwmChannel3PlaybackModePayload")]
-    [Description("Creates a message payload that playback mode of channel 3.")]
-    public partial class CreatePwmChannel3PlaybackModePayload
+    [DisplayName("StagedConfigurationPayload")]
+    [Description("Creates a message payload that staged frequency, duty cycle and counts of each channel, channel 0 first. A channel written with a zero frequency keeps its staged configuration. Written values only take effect when committed with CommitStagedConfiguration.")]
+    public partial class CreateStagedConfigurationPayload
     {
         /// <summary>
-        /// Gets or sets the value that playback mode of channel 3.
+        /// Gets or sets the value that staged frequency, duty cycle and counts of each channel, channel 0 first. A channel written with a zero frequency keeps its staged configuration. Written values only take effect when committed with CommitStagedConfiguration.
         /// </summary>
-        [Description("The value that playback mode of channel 3.")]
-        public PlaybackMode PwmChannel3PlaybackMode { get; set; }
+        [Description("The value that staged frequency, duty cycle and counts of each channel, channel 0 first. A channel written with a zero frequency keeps its staged configuration. Written values only take effect when committed with CommitStagedConfiguration.")]
+        public float[] StagedConfiguration { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the PwmChannel3PlaybackMode register.
+        /// Creates a message payload for the StagedConfiguration register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public PlaybackMode GetPayload()
+        public float[] GetPayload()
         {
-            return PwmChannel3PlaybackMode;
+            return StagedConfiguration;
         }
 
         /// <summary>
-        /// Creates a message that playback mode of channel 3.
+        /// Creates a message that staged frequency, duty cycle and counts of each channel, channel 0 first. A channel written with a zero frequency keeps its staged configuration. Written values only take effect when committed with CommitStagedConfiguration.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PwmChannel3PlaybackMode register.</returns>
+        /// <returns>A new message for the StagedConfiguration register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel3PlaybackMode.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.StagedConfiguration.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that playback mode of channel 3.
+    /// that staged frequency, duty cycle and counts of each channel, channel 0 first. A channel written with a zero frequency keeps its staged configuration. Written values only take effect when committed with CommitStagedConfiguration.
     /// </summary>
-    [DisplayName("TimestampedPwmChannel3PlaybackModePayload")]
-    [Description("Creates a timestamped message payload that playback mode of channel 3.")]
-    public partial class CreateTimestampedPwmChannel3PlaybackModePayload : CreatePwmChannel3PlaybackModePayload
+    [DisplayName("TimestampedStagedConfigurationPayload")]
+    [Description("Creates a timestamped message payload that staged frequency, duty cycle and counts of each channel, channel 0 first. A channel written with a zero frequency keeps its staged configuration. Written values only take effect when committed with CommitStagedConfiguration.")]
+    public partial class CreateTimestampedStagedConfigurationPayload : CreateStagedConfigurationPayload
     {
         /// <summary>
-        /// Creates a timestamped message that playback mode of channel 3.
+        /// Creates a timestamped message that staged frequency, duty cycle and counts of each channel, channel 0 first. A channel written with a zero frequency keeps its staged configuration. Written values only take effect when committed with CommitStagedConfiguration.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PwmChannel3PlaybackMode register.</returns>
+        /// <returns>A new timestamped message for the StagedConfiguration register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannel3PlaybackMode.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.StagedConfiguration.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that target channels that will start the PWM sequence if Trigger0 is activated.
+    /// that applies the staged configuration of the selected channels at the same time. Running channels that keep their prescaler change at the end of their current period, and count the new number of pulses from the commit. If CommitOnTrigger is set, the commit waits for the next active edge of one of the CommitTriggers inputs and the register reads the pending commit until then.
     /// </summary>
-    [DisplayName("Trigger0TargetsPayload")]
-    [Description("Creates a message payload that target channels that will start the PWM sequence if Trigger0 is activated.")]
-    public partial class CreateTrigger0TargetsPayload
+    [DisplayName("CommitStagedConfigurationPayload")]
+    [Description("Creates a message payload that applies the staged configuration of the selected channels at the same time. Running channels that keep their prescaler change at the end of their current period, and count the new number of pulses from the commit. If CommitOnTrigger is set, the commit waits for the next active edge of one of the CommitTriggers inputs and the register reads the pending commit until then.")]
+    public partial class CreateCommitStagedConfigurationPayload
     {
         /// <summary>
-        /// Gets or sets the value that target channels that will start the PWM sequence if Trigger0 is activated.
+        /// Gets or sets the value that applies the staged configuration of the selected channels at the same time. Running channels that keep their prescaler change at the end of their current period, and count the new number of pulses from the commit. If CommitOnTrigger is set, the commit waits for the next active edge of one of the CommitTriggers inputs and the register reads the pending commit until then.
         /// </summary>
-        [Description("The value that target channels that will start the PWM sequence if Trigger0 is activated.")]
-        public PwmChannels Trigger0Targets { get; set; }
+        [Description("The value that applies the staged configuration of the selected channels at the same time. Running channels that keep their prescaler change at the end of their current period, and count the new number of pulses from the commit. If CommitOnTrigger is set, the commit waits for the next active edge of one of the CommitTriggers inputs and the register reads the pending commit until then.")]
+        public StagedCommit CommitStagedConfiguration { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Trigger0Targets register.
+        /// Creates a message payload for the CommitStagedConfiguration register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public PwmChannels GetPayload()
+        public StagedCommit GetPayload()
         {
-            return Trigger0Targets;
+            return CommitStagedConfiguration;
         }
 
         /// <summary>
-        /// Creates a message that target channels that will start the PWM sequence if Trigger0 is activated.
+        /// Creates a message that applies the staged configuration of the selected channels at the same time. Running channels that keep their prescaler change at the end of their current period, and count the new number of pulses from the commit. If CommitOnTrigger is set, the commit waits for the next active edge of one of the CommitTriggers inputs and the register reads the pending commit until then.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Trigger0Targets register.</returns>
+        /// <returns>A new message for the CommitStagedConfiguration register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.Trigger0Targets.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.CommitStagedConfiguration.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that target channels that will start the PWM sequence if Trigger0 is activated.
+    /// that applies the staged configuration of the selected channels at the same time. Running channels that keep their prescaler change at the end of their current period, and count the new number of pulses from the commit. If CommitOnTrigger is set, the commit waits for the next active edge of one of the CommitTriggers inputs and the register reads the pending commit until then.
     /// </summary>
-    [DisplayName("TimestampedTrigger0TargetsPayload")]
-    [Description("Creates a timestamped message payload that target channels that will start the PWM sequence if Trigger0 is activated.")]
-    public partial class CreateTimestampedTrigger0TargetsPayload : CreateTrigger0TargetsPayload
+    [DisplayName("TimestampedCommitStagedConfigurationPayload")]
+    [Description("Creates a timestamped message payload that applies the staged configuration of the selected channels at the same time. Running channels that keep their prescaler change at the end of their current period, and count the new number of pulses from the commit. If CommitOnTrigger is set, the commit waits for the next active edge of one of the CommitTriggers inputs and the register reads the pending commit until then.")]
+    public partial class CreateTimestampedCommitStagedConfigurationPayload : CreateCommitStagedConfigurationPayload
     {
         /// <summary>
-        /// Creates a timestamped message that target channels that will start the PWM sequence if Trigger0 is activated.
+        /// Creates a timestamped message that applies the staged configuration of the selected channels at the same time. Running channels that keep their prescaler change at the end of their current period, and count the new number of pulses from the commit. If CommitOnTrigger is set, the commit waits for the next active edge of one of the CommitTriggers inputs and the register reads the pending commit until then.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Trigger0Targets register.</returns>
+        /// <returns>A new timestamped message for the CommitStagedConfiguration register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.Trigger0Targets.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.CommitStagedConfiguration.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that target channels that will start the PWM sequence if Trigger1 is activated.
+    /// that trigger inputs whose active edge applies a pending staged configuration.
     /// </summary>
-    [DisplayName("Trigger1TargetsPayload")]
-    [Description("Creates a message payload that target channels that will start the PWM sequence if Trigger1 is activated.")]
-    public partial class CreateTrigger1TargetsPayload
+    [DisplayName("CommitTriggersPayload")]
+    [Description("Creates a message payload that trigger inputs whose active edge applies a pending staged configuration.")]
+    public partial class CreateCommitTriggersPayload
     {
         /// <summary>
-        /// Gets or sets the value that target channels that will start the PWM sequence if Trigger1 is activated.
+        /// Gets or sets the value that trigger inputs whose active edge applies a pending staged configuration.
         /// </summary>
-        [Description("The value that target channels that will start the PWM sequence if Trigger1 is activated.")]
-        public PwmChannels Trigger1Targets { get; set; }
+        [Description("The value that trigger inputs whose active edge applies a pending staged configuration.")]
+        public TriggerSources CommitTriggers { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Trigger1Targets register.
+        /// Creates a message payload for the CommitTriggers register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public PwmChannels GetPayload()
+        public TriggerSources GetPayload()
         {
-            return Trigger1Targets;
+            return CommitTriggers;
         }
 
         /// <summary>
-        /// Creates a message that target channels that will start the PWM sequence if Trigger1 is activated.
+        /// Creates a message that trigger inputs whose active edge applies a pending staged configuration.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Trigger1Targets register.</returns>
+        /// <returns>A new message for the CommitTriggers register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.Trigger1Targets.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.CommitTriggers.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that target channels that will start the PWM sequence if Trigger1 is activated.
+    /// that trigger inputs whose active edge applies a pending staged configuration.
     /// </summary>
-    [DisplayName("TimestampedTrigger1TargetsPayload")]
-    [Description("Creates a timestamped message payload that target channels that will start the PWM sequence if Trigger1 is activated.")]
-    public partial class CreateTimestampedTrigger1TargetsPayload : CreateTrigger1TargetsPayload
+    [DisplayName("TimestampedCommitTriggersPayload")]
+    [Description("Creates a timestamped message payload that trigger inputs whose active edge applies a pending staged configuration.")]
+    public partial class CreateTimestampedCommitTriggersPayload : CreateCommitTriggersPayload
     {
         /// <summary>
-        /// Creates a timestamped message that target channels that will start the PWM sequence if Trigger1 is activated.
+        /// Creates a timestamped message that trigger inputs whose active edge applies a pending staged configuration.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Trigger1Targets register.</returns>
+        /// <returns>A new timestamped message for the CommitTriggers register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.Trigger1Targets.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.CommitTriggers.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that target channels that will start the PWM sequence if Trigger2 is activated.
+    /// that saves the current configuration of the channels and triggers on the specified preset. The preset is kept in the EEPROM.
     /// </summary>
-    [DisplayName("Trigger2TargetsPayload")]
-    [Description("Creates a message payload that target channels that will start the PWM sequence if Trigger2 is activated.")]
-    public partial class CreateTrigger2TargetsPayload
+    [DisplayName("SavePresetPayload")]
+    [Description("Creates a message payload that saves the current configuration of the channels and triggers on the specified preset. The preset is kept in the EEPROM.")]
+    public partial class CreateSavePresetPayload
     {
         /// <summary>
-        /// Gets or sets the value that target channels that will start the PWM sequence if Trigger2 is activated.
+        /// Gets or sets the value that saves the current configuration of the channels and triggers on the specified preset. The preset is kept in the EEPROM.
         /// </summary>
-        [Description("The value that target channels that will start the PWM sequence if Trigger2 is activated.")]
-        public PwmChannels Trigger2Targets { get; set; }
+        [Range(min: byte.MinValue, max: 3)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that saves the current configuration of the channels and triggers on the specified preset. The preset is kept in the EEPROM.")]
+        public byte SavePreset { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Trigger2Targets register.
+        /// Creates a message payload for the SavePreset register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public PwmChannels GetPayload()
+        public byte GetPayload()
         {
-            return Trigger2Targets;
+            return SavePreset;
         }
 
         /// <summary>
-        /// Creates a message that target channels that will start the PWM sequence if Trigger2 is activated.
+        /// Creates a message that saves the current configuration of the channels and triggers on the specified preset. The preset is kept in the EEPROM.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Trigger2Targets register.</returns>
+        /// <returns>A new message for the SavePreset register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.Trigger2Targets.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.SavePreset.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that target channels that will start the PWM sequence if Trigger2 is activated.
+    /// that saves the current configuration of the channels and triggers on the specified preset. The preset is kept in the EEPROM.
     /// </summary>
-    [DisplayName("TimestampedTrigger2TargetsPayload")]
-    [Description("Creates a timestamped message payload that target channels that will start the PWM sequence if Trigger2 is activated.")]
-    public partial class CreateTimestampedTrigger2TargetsPayload : CreateTrigger2TargetsPayload
+    [DisplayName("TimestampedSavePresetPayload")]
+    [Description("Creates a timestamped message payload that saves the current configuration of the channels and triggers on the specified preset. The preset is kept in the EEPROM.")]
+    public partial class CreateTimestampedSavePresetPayload : CreateSavePresetPayload
     {
         /// <summary>
-        /// Creates a timestamped message that target channels that will start the PWM sequence if Trigger2 is activated.
+        /// Creates a timestamped message that saves the current configuration of the channels and triggers on the specified preset. The preset is kept in the EEPROM.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Trigger2Targets register.</returns>
+        /// <returns>A new timestamped message for the SavePreset register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.Trigger2Targets.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.SavePreset.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that target channels that will start the PWM sequence if Trigger3 is activated.
+    /// that loads the specified preset. Reads the last loaded preset, or 255 if none was loaded since the last reset.
     /// </summary>
-    [DisplayName("Trigger3TargetsPayload")]
-    [Description("Creates a message payload that target channels that will start the PWM sequence if Trigger3 is activated.")]
-    public partial class CreateTrigger3TargetsPayload
+    [DisplayName("LoadPresetPayload")]
+    [Description("Creates a message payload that loads the specified preset. Reads the last loaded preset, or 255 if none was loaded since the last reset.")]
+    public partial class CreateLoadPresetPayload
     {
         /// <summary>
-        /// Gets or sets the value that target channels that will start the PWM sequence if Trigger3 is activated.
+        /// Gets or sets the value that loads the specified preset. Reads the last loaded preset, or 255 if none was loaded since the last reset.
         /// </summary>
-        [Description("The value that target channels that will start the PWM sequence if Trigger3 is activated.")]
-        public PwmChannels Trigger3Targets { get; set; }
+        [Range(min: byte.MinValue, max: 3)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that loads the specified preset. Reads the last loaded preset, or 255 if none was loaded since the last reset.")]
+        public byte LoadPreset { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Trigger3Targets register.
+        /// Creates a message payload for the LoadPreset register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public PwmChannels GetPayload()
+        public byte GetPayload()
         {
-            return Trigger3Targets;
+            return LoadPreset;
         }
 
         /// <summary>
-        /// Creates a message that target channels that will start the PWM sequence if Trigger3 is activated.
+        /// Creates a message that loads the specified preset. Reads the last loaded preset, or 255 if none was loaded since the last reset.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Trigger3Targets register.</returns>
+        /// <returns>A new message for the LoadPreset register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.Trigger3Targets.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.LoadPreset.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that target channels that will start the PWM sequence if Trigger3 is activated.
+    /// that loads the specified preset. Reads the last loaded preset, or 255 if none was loaded since the last reset.
     /// </summary>
-    [DisplayName("TimestampedTrigger3TargetsPayload")]
-    [Description("Creates a timestamped message payload that target channels that will start the PWM sequence if Trigger3 is activated.")]
-    public partial class CreateTimestampedTrigger3TargetsPayload : CreateTrigger3TargetsPayload
+    [DisplayName("TimestampedLoadPresetPayload")]
+    [Description("Creates a timestamped message payload that loads the specified preset. Reads the last loaded preset, or 255 if none was loaded since the last reset.")]
+    public partial class CreateTimestampedLoadPresetPayload : CreateLoadPresetPayload
     {
         /// <summary>
-        /// Creates a timestamped message that target channels that will start the PWM sequence if Trigger3 is activated.
+        /// Creates a timestamped message that loads the specified preset. Reads the last loaded preset, or 255 if none was loaded since the last reset.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Trigger3Targets register.</returns>
+        /// <returns>A new timestamped message for the LoadPreset register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.Trigger3Targets.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.LoadPreset.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that emits a start software-trigger on the channels specified in the mask.
+    /// that name of each preset, with 8 characters per preset. The names are kept in the EEPROM.
     /// </summary>
-    [DisplayName("StartSoftwareTriggerPayload")]
-    [Description("Creates a message payload that emits a start software-trigger on the channels specified in the mask.")]
-    public partial class CreateStartSoftwareTriggerPayload
+    [DisplayName("PresetNamesPayload")]
+    [Description("Creates a message payload that name of each preset, with 8 characters per preset. The names are kept in the EEPROM.")]
+    public partial class CreatePresetNamesPayload
     {
         /// <summary>
-        /// Gets or sets the value that emits a start software-trigger on the channels specified in the mask.
+        /// Gets or sets the value that name of each preset, with 8 characters per preset. The names are kept in the EEPROM.
         /// </summary>
-        [Description("The value that emits a start software-trigger on the channels specified in the mask.")]
-        public TriggerInputs StartSoftwareTrigger { get; set; }
+        [Description("The value that name of each preset, with 8 characters per preset. The names are kept in the EEPROM.")]
+        public byte[] PresetNames { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the StartSoftwareTrigger register.
+        /// Creates a message payload for the PresetNames register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public TriggerInputs GetPayload()
+        public byte[] GetPayload()
         {
-            return StartSoftwareTrigger;
+            return PresetNames;
         }
 
         /// <summary>
-        /// Creates a message that emits a start software-trigger on the channels specified in the mask.
+        /// Creates a message that name of each preset, with 8 characters per preset. The names are kept in the EEPROM.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the StartSoftwareTrigger register.</returns>
+        /// <returns>A new message for the PresetNames register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.StartSoftwareTrigger.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.PresetNames.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that emits a start software-trigger on the channels specified in the mask.
+    /// that name of each preset, with 8 characters per preset. The names are kept in the EEPROM.
     /// </summary>
-    [DisplayName("TimestampedStartSoftwareTriggerPayload")]
-    [Description("Creates a timestamped message payload that emits a start software-trigger on the channels specified in the mask.")]
-    public partial class CreateTimestampedStartSoftwareTriggerPayload : CreateStartSoftwareTriggerPayload
+    [DisplayName("TimestampedPresetNamesPayload")]
+    [Description("Creates a timestamped message payload that name of each preset, with 8 characters per preset. The names are kept in the EEPROM.")]
+    public partial class CreateTimestampedPresetNamesPayload : CreatePresetNamesPayload
     {
         /// <summary>
-        /// Creates a timestamped message that emits a start software-trigger on the channels specified in the mask.
+        /// Creates a timestamped message that name of each preset, with 8 characters per preset. The names are kept in the EEPROM.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the StartSoftwareTrigger register.</returns>
+        /// <returns>A new timestamped message for the PresetNames register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.StartSoftwareTrigger.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.PresetNames.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that emits a stop software-trigger on the channels specified in the mask.
+    /// that trigger inputs whose active edge loads the next saved preset.
     /// </summary>
-    [DisplayName("StopSoftwareTriggerPayload")]
-    [Description("Creates a message payload that emits a stop software-trigger on the channels specified in the mask.")]
-    public partial class CreateStopSoftwareTriggerPayload
+    [DisplayName("PresetTriggersPayload")]
+    [Description("Creates a message payload that trigger inputs whose active edge loads the next saved preset.")]
+    public partial class CreatePresetTriggersPayload
     {
         /// <summary>
-        /// Gets or sets the value that emits a stop software-trigger on the channels specified in the mask.
+        /// Gets or sets the value that trigger inputs whose active edge loads the next saved preset.
         /// </summary>
-        [Description("The value that emits a stop software-trigger on the channels specified in the mask.")]
-        public TriggerInputs StopSoftwareTrigger { get; set; }
+        [Description("The value that trigger inputs whose active edge loads the next saved preset.")]
+        public TriggerSources PresetTriggers { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the StopSoftwareTrigger register.
+        /// Creates a message payload for the PresetTriggers register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public TriggerInputs GetPayload()
+        public TriggerSources GetPayload()
         {
-            return StopSoftwareTrigger;
+            return PresetTriggers;
         }
 
         /// <summary>
-        /// Creates a message that emits a stop software-trigger on the channels specified in the mask.
+        /// Creates a message that trigger inputs whose active edge loads the next saved preset.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the StopSoftwareTrigger register.</returns>
+        /// <returns>A new message for the PresetTriggers register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.StopSoftwareTrigger.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.PresetTriggers.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that emits a stop software-trigger on the channels specified in the mask.
+    /// that trigger inputs whose active edge loads the next saved preset.
     /// </summary>
-    [DisplayName("TimestampedStopSoftwareTriggerPayload")]
-    [Description("Creates a timestamped message payload that emits a stop software-trigger on the channels specified in the mask.")]
-    public partial class CreateTimestampedStopSoftwareTriggerPayload : CreateStopSoftwareTriggerPayload
+    [DisplayName("TimestampedPresetTriggersPayload")]
+    [Description("Creates a timestamped message payload that trigger inputs whose active edge loads the next saved preset.")]
+    public partial class CreateTimestampedPresetTriggersPayload : CreatePresetTriggersPayload
     {
         /// <summary>
-        /// Creates a timestamped message that emits a stop software-trigger on the channels specified in the mask.
+        /// Creates a timestamped message that trigger inputs whose active edge loads the next saved preset.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the StopSoftwareTrigger register.</returns>
+        /// <returns>A new timestamped message for the PresetTriggers register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.StopSoftwareTrigger.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.PresetTriggers.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that arms the PWM channels specified in the mask. Once a PWM is triggered, it must be rearmed.
+    /// that queues a train on channel 0 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.
     /// </summary>
-    [DisplayName("ArmPwmChannelsPayload")]
-    [Description("Creates a message payload that arms the PWM channels specified in the mask. Once a PWM is triggered, it must be rearmed.")]
-    public partial class CreateArmPwmChannelsPayload
+    [DisplayName("Channel0TrainPayload")]
+    [Description("Creates a message payload that queues a train on channel 0 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.")]
+    public partial class CreateChannel0TrainPayload
     {
         /// <summary>
-        /// Gets or sets the value that arms the PWM channels specified in the mask. Once a PWM is triggered, it must be rearmed.
+        /// Gets or sets the value that queues a train on channel 0 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.
         /// </summary>
-        [Description("The value that arms the PWM channels specified in the mask. Once a PWM is triggered, it must be rearmed.")]
-        public PwmChannels ArmPwmChannels { get; set; }
+        [Description("The value that queues a train on channel 0 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.")]
+        public float[] Channel0Train { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the ArmPwmChannels register.
+        /// Creates a message payload for the Channel0Train register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public PwmChannels GetPayload()
+        public float[] GetPayload()
         {
-            return ArmPwmChannels;
+            return Channel0Train;
         }
 
         /// <summary>
-        /// Creates a message that arms the PWM channels specified in the mask. Once a PWM is triggered, it must be rearmed.
+        /// Creates a message that queues a train on channel 0 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the ArmPwmChannels register.</returns>
+        /// <returns>A new message for the Channel0Train register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.ArmPwmChannels.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.Channel0Train.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that arms the PWM channels specified in the mask. Once a PWM is triggered, it must be rearmed.
+    /// that queues a train on channel 0 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.
     /// </summary>
-    [DisplayName("TimestampedArmPwmChannelsPayload")]
-    [Description("Creates a timestamped message payload that arms the PWM channels specified in the mask. Once a PWM is triggered, it must be rearmed.")]
-    public partial class CreateTimestampedArmPwmChannelsPayload : CreateArmPwmChannelsPayload
+    [DisplayName("TimestampedChannel0TrainPayload")]
+    [Description("Creates a timestamped message payload that queues a train on channel 0 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.")]
+    public partial class CreateTimestampedChannel0TrainPayload : CreateChannel0TrainPayload
     {
         /// <summary>
-        /// Creates a timestamped message that arms the PWM channels specified in the mask. Once a PWM is triggered, it must be rearmed.
+        /// Creates a timestamped message that queues a train on channel 0 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the ArmPwmChannels register.</returns>
+        /// <returns>A new timestamped message for the Channel0Train register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.ArmPwmChannels.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.Channel0Train.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that trigger mode of input channel 0.
+    /// that queues a train on channel 1 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.
     /// </summary>
-    [DisplayName("Trigger0ModePayload")]
-    [Description("Creates a message payload that trigger mode of input channel 0.")]
-    public partial class CreateTrigger0ModePayload
+    [DisplayName("Channel1TrainPayload")]
+    [Description("Creates a message payload that queues a train on channel 1 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.")]
+    public partial class CreateChannel1TrainPayload
     {
         /// <summary>
-        /// Gets or sets a value that specifies the trigger mode.
-        /// </summary>
-        [Description("Specifies the trigger mode.")]
-        public TriggerModeConfig TriggerMode { get; set; }
-
-        /// <summary>
-        /// Gets or sets a value that specifies the polarity of the trigger signal.
+        /// Gets or sets the value that queues a train on channel 1 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.
         /// </summary>
-        [Description("Specifies the polarity of the trigger signal.")]
-        public TriggerPolarity Polarity { get; set; }
+        [Description("The value that queues a train on channel 1 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.")]
+        public float[] Channel1Train { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Trigger0Mode register.
+        /// Creates a message payload for the Channel1Train register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public Trigger0ModePayload GetPayload()
+        public float[] GetPayload()
         {
-            Trigger0ModePayload value;
-            value.TriggerMode = TriggerMode;
-            value.Polarity = Polarity;
-            return value;
+            return Channel1Train;
         }
 
         /// <summary>
-        /// Creates a message that trigger mode of input channel 0.
+        /// Creates a message that queues a train on channel 1 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Trigger0Mode register.</returns>
+        /// <returns>A new message for the Channel1Train register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.Trigger0Mode.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.Channel1Train.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that trigger mode of input channel 0.
+    /// that queues a train on channel 1 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.
     /// </summary>
-    [DisplayName("TimestampedTrigger0ModePayload")]
-    [Description("Creates a timestamped message payload that trigger mode of input channel 0.")]
-    public partial class CreateTimestampedTrigger0ModePayload : CreateTrigger0ModePayload
+    [DisplayName("TimestampedChannel1TrainPayload")]
+    [Description("Creates a timestamped message payload that queues a train on channel 1 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.")]
+    public partial class CreateTimestampedChannel1TrainPayload : CreateChannel1TrainPayload
     {
         /// <summary>
-        /// Creates a timestamped message that trigger mode of input channel 0.
+        /// Creates a timestamped message that queues a train on channel 1 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Trigger0Mode register.</returns>
+        /// <returns>A new timestamped message for the Channel1Train register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.Trigger0Mode.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.Channel1Train.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that trigger mode of input channel 1.
+    /// that queues a train on channel 2 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.
     /// </summary>
-    [DisplayName("Trigger1ModePayload")]
-    [Description("Creates a message payload that trigger mode of input channel 1.")]
-    public partial class CreateTrigger1ModePayload
+    [DisplayName("Channel2TrainPayload")]
+    [Description("Creates a message payload that queues a train on channel 2 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.")]
+    public partial class CreateChannel2TrainPayload
     {
         /// <summary>
-        /// Gets or sets a value that specifies the trigger mode.
-        /// </summary>
-        [Description("Specifies the trigger mode.")]
-        public TriggerModeConfig TriggerMode { get; set; }
-
-        /// <summary>
-        /// Gets or sets a value that specifies the polarity of the trigger signal.
+        /// Gets or sets the value that queues a train on channel 2 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.
         /// </summary>
-        [Description("Specifies the polarity of the trigger signal.")]
-        public TriggerPolarity Polarity { get; set; }
+        [Description("The value that queues a train on channel 2 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.")]
+        public float[] Channel2Train { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Trigger1Mode register.
+        /// Creates a message payload for the Channel2Train register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public Trigger1ModePayload GetPayload()
+        public float[] GetPayload()
         {
-            Trigger1ModePayload value;
-            value.TriggerMode = TriggerMode;
-            value.Polarity = Polarity;
-            return value;
+            return Channel2Train;
         }
 
         /// <summary>
-        /// Creates a message that trigger mode of input channel 1.
+        /// Creates a message that queues a train on channel 2 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Trigger1Mode register.</returns>
+        /// <returns>A new message for the Channel2Train register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.Trigger1Mode.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.Channel2Train.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that trigger mode of input channel 1.
+    /// that queues a train on channel 2 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.
     /// </summary>
-    [DisplayName("TimestampedTrigger1ModePayload")]
-    [Description("Creates a timestamped message payload that trigger mode of input channel 1.")]
-    public partial class CreateTimestampedTrigger1ModePayload : CreateTrigger1ModePayload
+    [DisplayName("TimestampedChannel2TrainPayload")]
+    [Description("Creates a timestamped message payload that queues a train on channel 2 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.")]
+    public partial class CreateTimestampedChannel2TrainPayload : CreateChannel2TrainPayload
     {
         /// <summary>
-        /// Creates a timestamped message that trigger mode of input channel 1.
+        /// Creates a timestamped message that queues a train on channel 2 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Trigger1Mode register.</returns>
+        /// <returns>A new timestamped message for the Channel2Train register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.Trigger1Mode.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.Channel2Train.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that trigger mode of input channel 2.
+    /// that queues a train on channel 3 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.
     /// </summary>
-    [DisplayName("Trigger2ModePayload")]
-    [Description("Creates a message payload that trigger mode of input channel 2.")]
-    public partial class CreateTrigger2ModePayload
+    [DisplayName("Channel3TrainPayload")]
+    [Description("Creates a message payload that queues a train on channel 3 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.")]
+    public partial class CreateChannel3TrainPayload
     {
         /// <summary>
-        /// Gets or sets a value that specifies the trigger mode.
-        /// </summary>
-        [Description("Specifies the trigger mode.")]
-        public TriggerModeConfig TriggerMode { get; set; }
-
-        /// <summary>
-        /// Gets or sets a value that specifies the polarity of the trigger signal.
+        /// Gets or sets the value that queues a train on channel 3 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.
         /// </summary>
-        [Description("Specifies the polarity of the trigger signal.")]
-        public TriggerPolarity Polarity { get; set; }
+        [Description("The value that queues a train on channel 3 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.")]
+        public float[] Channel3Train { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Trigger2Mode register.
+        /// Creates a message payload for the Channel3Train register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public Trigger2ModePayload GetPayload()
+        public float[] GetPayload()
         {
-            Trigger2ModePayload value;
-            value.TriggerMode = TriggerMode;
-            value.Polarity = Polarity;
-            return value;
+            return Channel3Train;
         }
 
         /// <summary>
-        /// Creates a message that trigger mode of input channel 2.
+        /// Creates a message that queues a train on channel 3 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Trigger2Mode register.</returns>
+        /// <returns>A new message for the Channel3Train register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.Trigger2Mode.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.Channel3Train.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that trigger mode of input channel 2.
+    /// that queues a train on channel 3 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.
     /// </summary>
-    [DisplayName("TimestampedTrigger2ModePayload")]
-    [Description("Creates a timestamped message payload that trigger mode of input channel 2.")]
-    public partial class CreateTimestampedTrigger2ModePayload : CreateTrigger2ModePayload
+    [DisplayName("TimestampedChannel3TrainPayload")]
+    [Description("Creates a timestamped message payload that queues a train on channel 3 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.")]
+    public partial class CreateTimestampedChannel3TrainPayload : CreateChannel3TrainPayload
     {
         /// <summary>
-        /// Creates a timestamped message that trigger mode of input channel 2.
+        /// Creates a timestamped message that queues a train on channel 3 with the frequency, duty cycle and number of pulses. When a train in Count mode ends, the next queued train starts on the following period without a gap. The train must use the same prescaler as the channel's frequency and the channel can't be clocked by a trigger input.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Trigger2Mode register.</returns>
+        /// <returns>A new timestamped message for the Channel3Train register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.Trigger2Mode.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.Channel3Train.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that trigger mode of input channel 3.
+    /// that number of trains waiting on each channel's queue. Writing zeros empties all the queues, other values are refused. The queue is also emptied, with an event, when its next train is due and the channel's frequency was changed to one that needs another prescaler.
     /// </summary>
-    [DisplayName("Trigger3ModePayload")]
-    [Description("Creates a message payload that trigger mode of input channel 3.")]
-    public partial class CreateTrigger3ModePayload
+    [DisplayName("TrainQueueLevelPayload")]
+    [Description("Creates a message payload that number of trains waiting on each channel's queue. Writing zeros empties all the queues, other values are refused. The queue is also emptied, with an event, when its next train is due and the channel's frequency was changed to one that needs another prescaler.")]
+    public partial class CreateTrainQueueLevelPayload
     {
         /// <summary>
-        /// Gets or sets a value that specifies the trigger mode.
-        /// </summary>
-        [Description("Specifies the trigger mode.")]
-        public TriggerModeConfig TriggerMode { get; set; }
-
-        /// <summary>
-        /// Gets or sets a value that specifies the polarity of the trigger signal.
+        /// Gets or sets the value that number of trains waiting on each channel's queue. Writing zeros empties all the queues, other values are refused. The queue is also emptied, with an event, when its next train is due and the channel's frequency was changed to one that needs another prescaler.
         /// </summary>
-        [Description("Specifies the polarity of the trigger signal.")]
-        public TriggerPolarity Polarity { get; set; }
+        [Description("The value that number of trains waiting on each channel's queue. Writing zeros empties all the queues, other values are refused. The queue is also emptied, with an event, when its next train is due and the channel's frequency was changed to one that needs another prescaler.")]
+        public byte[] TrainQueueLevel { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Trigger3Mode register.
+        /// Creates a message payload for the TrainQueueLevel register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public Trigger3ModePayload GetPayload()
+        public byte[] GetPayload()
         {
-            Trigger3ModePayload value;
-            value.TriggerMode = TriggerMode;
-            value.Polarity = Polarity;
-            return value;
+            return TrainQueueLevel;
         }
 
         /// <summary>
-        /// Creates a message that trigger mode of input channel 3.
+        /// Creates a message that number of trains waiting on each channel's queue. Writing zeros empties all the queues, other values are refused. The queue is also emptied, with an event, when its next train is due and the channel's frequency was changed to one that needs another prescaler.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Trigger3Mode register.</returns>
+        /// <returns>A new message for the TrainQueueLevel register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.Trigger3Mode.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.TrainQueueLevel.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that trigger mode of input channel 3.
+    /// that number of trains waiting on each channel's queue. Writing zeros empties all the queues, other values are refused. The queue is also emptied, with an event, when its next train is due and the channel's frequency was changed to one that needs another prescaler.
     /// </summary>
-    [DisplayName("TimestampedTrigger3ModePayload")]
-    [Description("Creates a timestamped message payload that trigger mode of input channel 3.")]
-    public partial class CreateTimestampedTrigger3ModePayload : CreateTrigger3ModePayload
+    [DisplayName("TimestampedTrainQueueLevelPayload")]
+    [Description("Creates a timestamped message payload that number of trains waiting on each channel's queue. Writing zeros empties all the queues, other values are refused. The queue is also emptied, with an event, when its next train is due and the channel's frequency was changed to one that needs another prescaler.")]
+    public partial class CreateTimestampedTrainQueueLevelPayload : CreateTrainQueueLevelPayload
     {
         /// <summary>
-        /// Creates a timestamped message that trigger mode of input channel 3.
+        /// Creates a timestamped message that number of trains waiting on each channel's queue. Writing zeros empties all the queues, other values are refused. The queue is also emptied, with an event, when its next train is due and the channel's frequency was changed to one that needs another prescaler.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Trigger3Mode register.</returns>
+        /// <returns>A new timestamped message for the TrainQueueLevel register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.Trigger3Mode.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.TrainQueueLevel.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that if set to Low, it will bypass the EnablePwmChannels and ArmPwmChannels register function.
+    /// that a TrainQueueLevel event is sent when a queued train starts and leaves this number of trains or less on the queue.
     /// </summary>
-    [DisplayName("RequestEnablePayload")]
-    [Description("Creates a message payload that if set to Low, it will bypass the EnablePwmChannels and ArmPwmChannels register function.")]
-    public partial class CreateRequestEnablePayload
+    [DisplayName("TrainQueueLowPayload")]
+    [Description("Creates a message payload that a TrainQueueLevel event is sent when a queued train starts and leaves this number of trains or less on the queue.")]
+    public partial class CreateTrainQueueLowPayload
     {
         /// <summary>
-        /// Gets or sets the value that if set to Low, it will bypass the EnablePwmChannels and ArmPwmChannels register function.
+        /// Gets or sets the value that a TrainQueueLevel event is sent when a queued train starts and leaves this number of trains or less on the queue.
         /// </summary>
-        [Description("The value that if set to Low, it will bypass the EnablePwmChannels and ArmPwmChannels register function.")]
-        public PwmChannels RequestEnable { get; set; }
+        [Range(min: byte.MinValue, max: 3)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that a TrainQueueLevel event is sent when a queued train starts and leaves this number of trains or less on the queue.")]
+        public byte TrainQueueLow { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the RequestEnable register.
+        /// Creates a message payload for the TrainQueueLow register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public PwmChannels GetPayload()
+        public byte GetPayload()
         {
-            return RequestEnable;
+            return TrainQueueLow;
         }
 
         /// <summary>
-        /// Creates a message that if set to Low, it will bypass the EnablePwmChannels and ArmPwmChannels register function.
+        /// Creates a message that a TrainQueueLevel event is sent when a queued train starts and leaves this number of trains or less on the queue.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the RequestEnable register.</returns>
+        /// <returns>A new message for the TrainQueueLow register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.RequestEnable.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.TrainQueueLow.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that if set to Low, it will bypass the EnablePwmChannels and ArmPwmChannels register function.
+    /// that a TrainQueueLevel event is sent when a queued train starts and leaves this number of trains or less on the queue.
     /// </summary>
-    [DisplayName("TimestampedRequestEnablePayload")]
-    [Description("Creates a timestamped message payload that if set to Low, it will bypass the EnablePwmChannels and ArmPwmChannels register function.")]
-    public partial class CreateTimestampedRequestEnablePayload : CreateRequestEnablePayload
+    [DisplayName("TimestampedTrainQueueLowPayload")]
+    [Description("Creates a timestamped message payload that a TrainQueueLevel event is sent when a queued train starts and leaves this number of trains or less on the queue.")]
+    public partial class CreateTimestampedTrainQueueLowPayload : CreateTrainQueueLowPayload
     {
         /// <summary>
-        /// Creates a timestamped message that if set to Low, it will bypass the EnablePwmChannels and ArmPwmChannels register function.
+        /// Creates a timestamped message that a TrainQueueLevel event is sent when a queued train starts and leaves this number of trains or less on the queue.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the RequestEnable register.</returns>
+        /// <returns>A new timestamped message for the TrainQueueLow register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.RequestEnable.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.TrainQueueLow.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that enable enable.
+    /// that minimum CPU cycles from the start of a trigger interrupt to the start of a channel. Only available on firmware built with PWM_PROFILING.
     /// </summary>
-    [DisplayName("EnablePwmChannelsPayload")]
-    [Description("Creates a message payload that enable enable.")]
-    public partial class CreateEnablePwmChannelsPayload
+    [DisplayName("ProfilingMinLatencyPayload")]
+    [Description("Creates a message payload that minimum CPU cycles from the start of a trigger interrupt to the start of a channel. Only available on firmware built with PWM_PROFILING.")]
+    public partial class CreateProfilingMinLatencyPayload
     {
         /// <summary>
-        /// Gets or sets the value that enable enable.
+        /// Gets or sets the value that minimum CPU cycles from the start of a trigger interrupt to the start of a channel. Only available on firmware built with PWM_PROFILING.
         /// </summary>
-        [Description("The value that enable enable.")]
-        public PwmChannels EnablePwmChannels { get; set; }
+        [Description("The value that minimum CPU cycles from the start of a trigger interrupt to the start of a channel. Only available on firmware built with PWM_PROFILING.")]
+        public ushort ProfilingMinLatency { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the EnablePwmChannels register.
+        /// Creates a message payload for the ProfilingMinLatency register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public PwmChannels GetPayload()
+        public ushort GetPayload()
         {
-            return EnablePwmChannels;
+            return ProfilingMinLatency;
         }
 
         /// <summary>
-        /// Creates a message that enable enable.
+        /// Creates a message that minimum CPU cycles from the start of a trigger interrupt to the start of a channel. Only available on firmware built with PWM_PROFILING.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the EnablePwmChannels register.</returns>
+        /// <returns>A new message for the ProfilingMinLatency register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.EnablePwmChannels.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.ProfilingMinLatency.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that enable enable.
+    /// that minimum CPU cycles from the start of a trigger interrupt to the start of a channel. Only available on firmware built with PWM_PROFILING.
     /// </summary>
-    [DisplayName("TimestampedEnablePwmChannelsPayload")]
-    [Description("Creates a timestamped message payload that enable enable.")]
-    public partial class CreateTimestampedEnablePwmChannelsPayload : CreateEnablePwmChannelsPayload
+    [DisplayName("TimestampedProfilingMinLatencyPayload")]
+    [Description("Creates a timestamped message payload that minimum CPU cycles from the start of a trigger interrupt to the start of a channel. Only available on firmware built with PWM_PROFILING.")]
+    public partial class CreateTimestampedProfilingMinLatencyPayload : CreateProfilingMinLatencyPayload
     {
         /// <summary>
-        /// Creates a timestamped message that enable enable.
+        /// Creates a timestamped message that minimum CPU cycles from the start of a trigger interrupt to the start of a channel. Only available on firmware built with PWM_PROFILING.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the EnablePwmChannels register.</returns>
+        /// <returns>A new timestamped message for the ProfilingMinLatency register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.EnablePwmChannels.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.ProfilingMinLatency.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that when triggered, all channels will be affected by the event.
+    /// that number of channel starts by latency from the start of the trigger interrupt, in buckets of 64 CPU cycles (2 us). The last bucket also counts the longer latencies. Only available on firmware built with PWM_PROFILING.
     /// </summary>
-    [DisplayName("TriggerAllModePayload")]
-    [Description("Creates a message payload that when triggered, all channels will be affected by the event.")]
-    public partial class CreateTriggerAllModePayload
+    [DisplayName("ProfilingLatencyHistogramPayload")]
+    [Description("Creates a message payload that number of channel starts by latency from the start of the trigger interrupt, in buckets of 64 CPU cycles (2 us). The last bucket also counts the longer latencies. Only available on firmware built with PWM_PROFILING.")]
+    public partial class CreateProfilingLatencyHistogramPayload
     {
         /// <summary>
-        /// Gets or sets a value that specifies the trigger mode.
-        /// </summary>
-        [Description("Specifies the trigger mode.")]
-        public TriggerAllModeConfig TriggerMode { get; set; }
-
-        /// <summary>
-        /// Gets or sets a value that specifies the polarity of the trigger signal.
+        /// Gets or sets the value that number of channel starts by latency from the start of the trigger interrupt, in buckets of 64 CPU cycles (2 us). The last bucket also counts the longer latencies. Only available on firmware built with PWM_PROFILING.
         /// </summary>
-        [Description("Specifies the polarity of the trigger signal.")]
-        public TriggerPolarity Polarity { get; set; }
+        [Description("The value that number of channel starts by latency from the start of the trigger interrupt, in buckets of 64 CPU cycles (2 us). The last bucket also counts the longer latencies. Only available on firmware built with PWM_PROFILING.")]
+        public ushort[] ProfilingLatencyHistogram { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the TriggerAllMode register.
+        /// Creates a message payload for the ProfilingLatencyHistogram register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public TriggerAllModePayload GetPayload()
+        public ushort[] GetPayload()
         {
-            TriggerAllModePayload value;
-            value.TriggerMode = TriggerMode;
-            value.Polarity = Polarity;
-            return value;
+            return ProfilingLatencyHistogram;
         }
 
         /// <summary>
-        /// Creates a message that when triggered, all channels will be affected by the event.
+        /// Creates a message that number of channel starts by latency from the start of the trigger interrupt, in buckets of 64 CPU cycles (2 us). The last bucket also counts the longer latencies. Only available on firmware built with PWM_PROFILING.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the TriggerAllMode register.</returns>
+        /// <returns>A new message for the ProfilingLatencyHistogram register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.TriggerAllMode.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.ProfilingLatencyHistogram.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that when triggered, all channels will be affected by the event.
+    /// that number of channel starts by latency from the start of the trigger interrupt, in buckets of 64 CPU cycles (2 us). The last bucket also counts the longer latencies. Only available on firmware built with PWM_PROFILING.
     /// </summary>
-    [DisplayName("TimestampedTriggerAllModePayload")]
-    [Description("Creates a timestamped message payload that when triggered, all channels will be affected by the event.")]
-    public partial class CreateTimestampedTriggerAllModePayload : CreateTriggerAllModePayload
+    [DisplayName("TimestampedProfilingLatencyHistogramPayload")]
+    [Description("Creates a timestamped message payload that number of channel starts by latency from the start of the trigger interrupt, in buckets of 64 CPU cycles (2 us). The last bucket also counts the longer latencies. Only available on firmware built with PWM_PROFILING.")]
+    public partial class CreateTimestampedProfilingLatencyHistogramPayload : CreateProfilingLatencyHistogramPayload
     {
         /// <summary>
-        /// Creates a timestamped message that when triggered, all channels will be affected by the event.
+        /// Creates a timestamped message that number of channel starts by latency from the start of the trigger interrupt, in buckets of 64 CPU cycles (2 us). The last bucket also counts the longer latencies. Only available on firmware built with PWM_PROFILING.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the TriggerAllMode register.</returns>
+        /// <returns>A new timestamped message for the ProfilingLatencyHistogram register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.TriggerAllMode.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.ProfilingLatencyHistogram.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that current state of all trigger channel inputs.
+    /// that maximum CPU cycles between the first and the last channel started by the same trigger interrupt. Only available on firmware built with PWM_PROFILING.
     /// </summary>
-    [DisplayName("TriggerChannelStatePayload")]
-    [Description("Creates a message payload that current state of all trigger channel inputs.")]
-    public partial class CreateTriggerChannelStatePayload
+    [DisplayName("ProfilingMaxSkewPayload")]
+    [Description("Creates a message payload that maximum CPU cycles between the first and the last channel started by the same trigger interrupt. Only available on firmware built with PWM_PROFILING.")]
+    public partial class CreateProfilingMaxSkewPayload
     {
         /// <summary>
-        /// Gets or sets the value that current state of all trigger channel inputs.
+        /// Gets or sets the value that maximum CPU cycles between the first and the last channel started by the same trigger interrupt. Only available on firmware built with PWM_PROFILING.
         /// </summary>
-        [Description("The value that current state of all trigger channel inputs.")]
-        public TriggerInputs TriggerChannelState { get; set; }
+        [Description("The value that maximum CPU cycles between the first and the last channel started by the same trigger interrupt. Only available on firmware built with PWM_PROFILING.")]
+        public ushort ProfilingMaxSkew { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the TriggerChannelState register.
+        /// Creates a message payload for the ProfilingMaxSkew register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public TriggerInputs GetPayload()
+        public ushort GetPayload()
         {
-            return TriggerChannelState;
+            return ProfilingMaxSkew;
         }
 
         /// <summary>
-        /// Creates a message that current state of all trigger channel inputs.
+        /// Creates a message that maximum CPU cycles between the first and the last channel started by the same trigger interrupt. Only available on firmware built with PWM_PROFILING.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the TriggerChannelState register.</returns>
+        /// <returns>A new message for the ProfilingMaxSkew register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.TriggerChannelState.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.ProfilingMaxSkew.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that current state of all trigger channel inputs.
+    /// that maximum CPU cycles between the first and the last channel started by the same trigger interrupt. Only available on firmware built with PWM_PROFILING.
     /// </summary>
-    [DisplayName("TimestampedTriggerChannelStatePayload")]
-    [Description("Creates a timestamped message payload that current state of all trigger channel inputs.")]
-    public partial class CreateTimestampedTriggerChannelStatePayload : CreateTriggerChannelStatePayload
+    [DisplayName("TimestampedProfilingMaxSkewPayload")]
+    [Description("Creates a timestamped message payload that maximum CPU cycles between the first and the last channel started by the same trigger interrupt. Only available on firmware built with PWM_PROFILING.")]
+    public partial class CreateTimestampedProfilingMaxSkewPayload : CreateProfilingMaxSkewPayload
     {
         /// <summary>
-        /// Creates a timestamped message that current state of all trigger channel inputs.
+        /// Creates a timestamped message that maximum CPU cycles between the first and the last channel started by the same trigger interrupt. Only available on firmware built with PWM_PROFILING.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the TriggerChannelState register.</returns>
+        /// <returns>A new timestamped message for the ProfilingMaxSkew register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.TriggerChannelState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.ProfilingMaxSkew.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that current state of all PWM channel outputs.
+    /// that number of events dropped because the queue of their interrupt level was full. Saturates at 65535 and is cleared on reset.
     /// </summary>
-    [DisplayName("PwmChannelStatePayload")]
-    [Description("Creates a message payload that current state of all PWM channel outputs.")]
-    public partial class CreatePwmChannelStatePayload
+    [DisplayName("DroppedEventsPayload")]
+    [Description("Creates a message payload that number of events dropped because the queue of their interrupt level was full. Saturates at 65535 and is cleared on reset.")]
+    public partial class CreateDroppedEventsPayload
     {
         /// <summary>
-        /// Gets or sets the value that current state of all PWM channel outputs.
+        /// Gets or sets the value that number of events dropped because the queue of their interrupt level was full. Saturates at 65535 and is cleared on reset.
         /// </summary>
-        [Description("The value that current state of all PWM channel outputs.")]
-        public PwmChannels PwmChannelState { get; set; }
+        [Description("The value that number of events dropped because the queue of their interrupt level was full. Saturates at 65535 and is cleared on reset.")]
+        public ushort DroppedEvents { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the PwmChannelState register.
+        /// Creates a message payload for the DroppedEvents register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public PwmChannels GetPayload()
+        public ushort GetPayload()
         {
-            return PwmChannelState;
+            return DroppedEvents;
         }
 
         /// <summary>
-        /// Creates a message that current state of all PWM channel outputs.
+        /// Creates a message that number of events dropped because the queue of their interrupt level was full. Saturates at 65535 and is cleared on reset.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PwmChannelState register.</returns>
+        /// <returns>A new message for the DroppedEvents register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannelState.FromPayload(messageType, GetPayload());
+            return Harp.MultiPwm.DroppedEvents.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that current state of all PWM channel outputs.
+    /// that number of events dropped because the queue of their interrupt level was full. Saturates at 65535 and is cleared on reset.
     /// </summary>
-    [DisplayName("TimestampedPwmChannelStatePayload")]
-    [Description("Creates a timestamped message payload that current state of all PWM channel outputs.")]
-    public partial class CreateTimestampedPwmChannelStatePayload : CreatePwmChannelStatePayload
+    [DisplayName("TimestampedDroppedEventsPayload")]
+    [Description("Creates a timestamped message payload that number of events dropped because the queue of their interrupt level was full. Saturates at 65535 and is cleared on reset.")]
+    public partial class CreateTimestampedDroppedEventsPayload : CreateDroppedEventsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that current state of all PWM channel outputs.
+        /// Creates a timestamped message that number of events dropped because the queue of their interrupt level was full. Saturates at 65535 and is cleared on reset.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PwmChannelState register.</returns>
+        /// <returns>A new timestamped message for the DroppedEvents register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.MultiPwm.PwmChannelState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.MultiPwm.DroppedEvents.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that the state of the PWM for each channel. Emits an event each time a PMW starts or stops.
+    /// Represents the payload of the PwmChannel0PlaybackMode register.
     /// </summary>
-    [DisplayName("PwmStatePayload")]
-    [Description("Creates a message payload that the state of the PWM for each channel. Emits an event each time a PMW starts or stops.")]
-    public partial class CreatePwmStatePayload
+    public struct PwmChannel0PlaybackModePayload
     {
         /// <summary>
-        /// Gets or sets the value that the state of the PWM for each channel. Emits an event each time a PMW starts or stops.
+        /// Initializes a new instance of the <see cref="PwmChannel0PlaybackModePayload"/> structure.
         /// </summary>
-        [Description("The value that the state of the PWM for each channel. Emits an event each time a PMW starts or stops.")]
-        public PwmChannels PwmState { get; set; }
+        /// <param name="playbackMode">Specifies the playback mode.</param>
+        /// <param name="clockSource">Specifies the clock source of the channel's timer.</param>
+        public PwmChannel0PlaybackModePayload(
+            PlaybackMode playbackMode,
+            ClockSource clockSource)
+        {
+            PlaybackMode = playbackMode;
+            ClockSource = clockSource;
+        }
 
         /// <summary>
-        /// Creates a message payload for the PwmState register.
+        /// Specifies the playback mode.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public PwmChannels GetPayload()
-        {
-            return PwmState;
-        }
+        public PlaybackMode PlaybackMode;
 
         /// <summary>
-        /// Creates a message that the state of the PWM for each channel. Emits an event each time a PMW starts or stops.
+        /// Specifies the clock source of the channel's timer.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the PwmState register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        public ClockSource ClockSource;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the PwmChannel0PlaybackMode register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// PwmChannel0PlaybackMode register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.MultiPwm.PwmState.FromPayload(messageType, GetPayload());
+            return "PwmChannel0PlaybackModePayload { " +
+                "PlaybackMode = " + PlaybackMode + ", " +
+                "ClockSource = " + ClockSource + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that the state of the PWM for each channel. Emits an event each time a PMW starts or stops.
+    /// Represents the payload of the PwmChannel1PlaybackMode register.
     /// </summary>
-    [DisplayName("TimestampedPwmStatePayload")]
-    [Description("Creates a timestamped message payload that the state of the PWM for each channel. Emits an event each time a PMW starts or stops.")]
-    public partial class CreateTimestampedPwmStatePayload : CreatePwmStatePayload
+    public struct PwmChannel1PlaybackModePayload
     {
         /// <summary>
-        /// Creates a timestamped message that the state of the PWM for each channel. Emits an event each time a PMW starts or stops.
+        /// Initializes a new instance of the <see cref="PwmChannel1PlaybackModePayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the PwmState register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="playbackMode">Specifies the playback mode.</param>
+        /// <param name="clockSource">Specifies the clock source of the channel's timer.</param>
+        public PwmChannel1PlaybackModePayload(
+            PlaybackMode playbackMode,
+            ClockSource clockSource)
         {
-            return Harp.MultiPwm.PwmState.FromPayload(timestamp, messageType, GetPayload());
+            PlaybackMode = playbackMode;
+            ClockSource = clockSource;
+        }
+
+        /// <summary>
+        /// Specifies the playback mode.
+        /// </summary>
+        public PlaybackMode PlaybackMode;
+
+        /// <summary>
+        /// Specifies the clock source of the channel's timer.
+        /// </summary>
+        public ClockSource ClockSource;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the PwmChannel1PlaybackMode register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// PwmChannel1PlaybackMode register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "PwmChannel1PlaybackModePayload { " +
+                "PlaybackMode = " + PlaybackMode + ", " +
+                "ClockSource = " + ClockSource + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that enables the generation of events.
+    /// Represents the payload of the PwmChannel2PlaybackMode register.
     /// </summary>
-    [DisplayName("EnableEventsPayload")]
-    [Description("Creates a message payload that enables the generation of events.")]
-    public partial class CreateEnableEventsPayload
+    public struct PwmChannel2PlaybackModePayload
     {
         /// <summary>
-        /// Gets or sets the value that enables the generation of events.
+        /// Initializes a new instance of the <see cref="PwmChannel2PlaybackModePayload"/> structure.
         /// </summary>
-        [Description("The value that enables the generation of events.")]
-        public MultiPwmEvents EnableEvents { get; set; }
+        /// <param name="playbackMode">Specifies the playback mode.</param>
+        /// <param name="clockSource">Specifies the clock source of the channel's timer.</param>
+        public PwmChannel2PlaybackModePayload(
+            PlaybackMode playbackMode,
+            ClockSource clockSource)
+        {
+            PlaybackMode = playbackMode;
+            ClockSource = clockSource;
+        }
 
         /// <summary>
-        /// Creates a message payload for the EnableEvents register.
+        /// Specifies the playback mode.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public MultiPwmEvents GetPayload()
-        {
-            return EnableEvents;
-        }
+        public PlaybackMode PlaybackMode;
 
         /// <summary>
-        /// Creates a message that enables the generation of events.
+        /// Specifies the clock source of the channel's timer.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the EnableEvents register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        public ClockSource ClockSource;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the PwmChannel2PlaybackMode register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// PwmChannel2PlaybackMode register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.MultiPwm.EnableEvents.FromPayload(messageType, GetPayload());
+            return "PwmChannel2PlaybackModePayload { " +
+                "PlaybackMode = " + PlaybackMode + ", " +
+                "ClockSource = " + ClockSource + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that enables the generation of events.
+    /// Represents the payload of the PwmChannel3PlaybackMode register.
     /// </summary>
-    [DisplayName("TimestampedEnableEventsPayload")]
-    [Description("Creates a timestamped message payload that enables the generation of events.")]
-    public partial class CreateTimestampedEnableEventsPayload : CreateEnableEventsPayload
+    public struct PwmChannel3PlaybackModePayload
     {
         /// <summary>
-        /// Creates a timestamped message that enables the generation of events.
+        /// Initializes a new instance of the <see cref="PwmChannel3PlaybackModePayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the EnableEvents register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="playbackMode">Specifies the playback mode.</param>
+        /// <param name="clockSource">Specifies the clock source of the channel's timer.</param>
+        public PwmChannel3PlaybackModePayload(
+            PlaybackMode playbackMode,
+            ClockSource clockSource)
         {
-            return Harp.MultiPwm.EnableEvents.FromPayload(timestamp, messageType, GetPayload());
+            PlaybackMode = playbackMode;
+            ClockSource = clockSource;
+        }
+
+        /// <summary>
+        /// Specifies the playback mode.
+        /// </summary>
+        public PlaybackMode PlaybackMode;
+
+        /// <summary>
+        /// Specifies the clock source of the channel's timer.
+        /// </summary>
+        public ClockSource ClockSource;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the PwmChannel3PlaybackMode register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// PwmChannel3PlaybackMode register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "PwmChannel3PlaybackModePayload { " +
+                "PlaybackMode = " + PlaybackMode + ", " +
+                "ClockSource = " + ClockSource + " " +
+            "}";
         }
     }
 
@@ -7362,6 +14596,20 @@ namespace Harp.MultiPwm
         Channel3 = 0x8
     }
 
+    /// <summary>
+    /// Trigger inputs, including the trigger all input, that can apply a pending operation.
+    /// </summary>
+    [Flags]
+    public enum TriggerSources : byte
+    {
+        None = 0x0,
+        Channel0 = 0x1,
+        Channel1 = 0x2,
+        Channel2 = 0x4,
+        Channel3 = 0x8,
+        TriggerAll = 0x10
+    }
+
     /// <summary>
     /// Available events that can be enabled/disabled.
     /// </summary>
@@ -7369,7 +14617,45 @@ namespace Harp.MultiPwm
     public enum MultiPwmEvents : byte
     {
         None = 0x0,
-        Execution = 0x1
+        Execution = 0x1,
+        FrequencyMeter = 0x2,
+        Progress = 0x4,
+        TrainQueue = 0x8
+    }
+
+    /// <summary>
+    /// Trigger inputs that can be measured by the frequency meter.
+    /// </summary>
+    [Flags]
+    public enum FrequencyMeterInputs : byte
+    {
+        None = 0x0,
+        Channel0 = 0x1,
+        Channel1 = 0x2
+    }
+
+    /// <summary>
+    /// Channels to commit and commit mode.
+    /// </summary>
+    [Flags]
+    public enum StagedCommit : byte
+    {
+        None = 0x0,
+        Channel0 = 0x1,
+        Channel1 = 0x2,
+        Channel2 = 0x4,
+        Channel3 = 0x8,
+        CommitOnTrigger = 0x80
+    }
+
+    /// <summary>
+    /// Configuration of the channels' statistics.
+    /// </summary>
+    [Flags]
+    public enum StatisticsControl : byte
+    {
+        None = 0x0,
+        ClearOnRead = 0x1
     }
 
     /// <summary>
@@ -7382,12 +14668,23 @@ namespace Harp.MultiPwm
     }
 
     /// <summary>
-    /// Available operation modes for trigger input channels.
+    /// Available clock sources for the timer of a PWM channel.
+    /// </summary>
+    public enum ClockSource : byte
+    {
+        Internal = 0,
+        Trigger0 = 1,
+        Trigger1 = 2
+    }
+
+    /// <summary>
+    /// Available operation modes for trigger input channels. In Gate mode the channels run while the trigger is active and freeze, with their output low, while it is inactive. Only channels 0 and 2 gated by trigger input 0 or 1 have their output cut in hardware when the gate closes; every other channel is cut and frozen by the trigger's interrupt, within its latency. The gate always opens through the interrupt, which resumes each timer where it stopped, so the frozen period is completed.
     /// </summary>
     public enum TriggerModeConfig : byte
     {
         Start = 0,
-        StartAndStop = 1
+        StartAndStop = 1,
+        Gate = 2
     }
 
     /// <summary>
@@ -7396,7 +14693,7 @@ namespace Harp.MultiPwm
     public enum TriggerPolarity : byte
     {
         Default = 0,
-        Inverted = 8
+        Inverted = 1
     }
 
     /// <summary>